@@ -0,0 +1,267 @@
+/*
+ * This header file provides a simple API translation layer
+ * between the Arm C Language Extensions scalar intrinsics (arm_acle.h) and
+ * their corresponding RISC-V instructions.
+ *
+ * acle2rvv is part of neon2rvv and is freely redistributable under the MIT License.
+ *
+ * MIT License
+ *
+ * Copyright (c) 2015-2024 NEON2RVV Contributors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACLE2RVV_H
+#define ACLE2RVV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma push_macro("FORCE_INLINE")
+#define FORCE_INLINE static inline __attribute__((always_inline))
+#endif
+
+// The bit manipulation intrinsics are written in plain C. GCC and Clang turn them into the Zbb clz/ctz/rev8/ror
+// instructions when Zbb is enabled and into short shift sequences otherwise. The instructions the compilers do not
+// pattern match (brev8, clmul and the Zicbop prefetches) are emitted with inline assembly when the extension is
+// enabled.
+
+/* Barriers */
+
+// The barrier argument selects the Arm shareability domain, RISC-V fences cover every domain.
+FORCE_INLINE void __dmb(unsigned int mb) {
+  (void)mb;
+  __asm__ __volatile__("fence rw, rw" ::: "memory");
+}
+
+FORCE_INLINE void __dsb(unsigned int mb) {
+  (void)mb;
+  __asm__ __volatile__("fence iorw, iorw" ::: "memory");
+}
+
+FORCE_INLINE void __isb(unsigned int mb) {
+  (void)mb;
+  __asm__ __volatile__("fence.i" ::: "memory");
+}
+
+/* Hints */
+
+FORCE_INLINE void __nop(void) { __asm__ __volatile__("nop"); }
+
+FORCE_INLINE void __yield(void) {
+#if defined(__riscv_zihintpause)
+  __asm__ __volatile__("pause");
+#else
+  // pause is encoded as a FENCE hint, so cores without Zihintpause execute it as a nop
+  __asm__ __volatile__(".4byte 0x0100000f");
+#endif
+}
+
+/* Memory prefetch */
+
+#if defined(__riscv_zicbop)
+#define __pld(addr) __asm__ __volatile__("prefetch.r 0(%0)" ::"r"((const void *)(addr)))
+#define __pli(addr) __asm__ __volatile__("prefetch.i 0(%0)" ::"r"((const void *)(addr)))
+// Zicbop has no cache level or retention hints, only the access kind is kept
+#define __pldx(access_kind, cache_level, retention_policy, addr)            \
+  do {                                                                      \
+    if (access_kind) {                                                      \
+      __asm__ __volatile__("prefetch.w 0(%0)" ::"r"((const void *)(addr))); \
+    } else {                                                                \
+      __asm__ __volatile__("prefetch.r 0(%0)" ::"r"((const void *)(addr))); \
+    }                                                                       \
+  } while (0)
+#define __plix(cache_level, retention_policy, addr) __pli(addr)
+#else
+// level 0 (L1) keeps the most locality, a streaming (retention_policy == 1) prefetch keeps none
+#define __pld(addr) __builtin_prefetch((const void *)(addr), 0, 3)
+#define __pli(addr) ((void)(addr))
+#define __pldx(access_kind, cache_level, retention_policy, addr) \
+  __builtin_prefetch((const void *)(addr), (access_kind), (retention_policy) ? 0 : 3 - (cache_level))
+#define __plix(cache_level, retention_policy, addr) ((void)(addr))
+#endif
+
+/* Data processing */
+
+FORCE_INLINE unsigned int __clz(uint32_t x) { return x ? __builtin_clz(x) : 32; }
+
+FORCE_INLINE unsigned int __clzll(uint64_t x) { return x ? __builtin_clzll(x) : 64; }
+
+FORCE_INLINE unsigned int __clzl(unsigned long x) { return sizeof(long) == 8 ? __clzll(x) : __clz(x); }
+
+FORCE_INLINE unsigned int __cls(uint32_t x) { return __clz(x ^ (uint32_t)((int32_t)x >> 31)) - 1; }
+
+FORCE_INLINE unsigned int __clsll(uint64_t x) { return __clzll(x ^ (uint64_t)((int64_t)x >> 63)) - 1; }
+
+FORCE_INLINE unsigned int __clsl(unsigned long x) { return sizeof(long) == 8 ? __clsll(x) : __cls(x); }
+
+FORCE_INLINE uint32_t __rev(uint32_t x) { return __builtin_bswap32(x); }
+
+FORCE_INLINE uint64_t __revll(uint64_t x) { return __builtin_bswap64(x); }
+
+FORCE_INLINE unsigned long __revl(unsigned long x) { return sizeof(long) == 8 ? __revll(x) : __rev(x); }
+
+FORCE_INLINE int16_t __revsh(int16_t x) { return (int16_t)__builtin_bswap16((uint16_t)x); }
+
+FORCE_INLINE uint32_t __ror(uint32_t x, uint32_t y) {
+  y &= 31;
+  return (x >> y) | (x << ((32 - y) & 31));
+}
+
+FORCE_INLINE uint64_t __rorll(uint64_t x, uint32_t y) {
+  y &= 63;
+  return (x >> y) | (x << ((64 - y) & 63));
+}
+
+FORCE_INLINE unsigned long __rorl(unsigned long x, uint32_t y) {
+  return sizeof(long) == 8 ? __rorll(x, y) : __ror(x, y);
+}
+
+FORCE_INLINE uint32_t __rev16(uint32_t x) { return __ror(__rev(x), 16); }
+
+FORCE_INLINE uint64_t __rev16ll(uint64_t x) {
+  return ((x >> 8) & UINT64_C(0x00ff00ff00ff00ff)) | ((x & UINT64_C(0x00ff00ff00ff00ff)) << 8);
+}
+
+FORCE_INLINE unsigned long __rev16l(unsigned long x) { return sizeof(long) == 8 ? __rev16ll(x) : __rev16(x); }
+
+// reverse the bits inside every byte, the byte order is left alone
+static inline uint64_t acle2rvv_brev8(uint64_t x) {
+#if defined(__riscv_zbkb) && __riscv_xlen == 64
+  uint64_t r;
+  __asm__("brev8 %0, %1" : "=r"(r) : "r"(x));
+  return r;
+#else
+  x = ((x >> 1) & UINT64_C(0x5555555555555555)) | ((x & UINT64_C(0x5555555555555555)) << 1);
+  x = ((x >> 2) & UINT64_C(0x3333333333333333)) | ((x & UINT64_C(0x3333333333333333)) << 2);
+  return ((x >> 4) & UINT64_C(0x0f0f0f0f0f0f0f0f)) | ((x & UINT64_C(0x0f0f0f0f0f0f0f0f)) << 4);
+#endif
+}
+
+FORCE_INLINE uint32_t __rbit(uint32_t x) { return __rev((uint32_t)acle2rvv_brev8(x)); }
+
+FORCE_INLINE uint64_t __rbitll(uint64_t x) { return __revll(acle2rvv_brev8(x)); }
+
+FORCE_INLINE unsigned long __rbitl(unsigned long x) { return sizeof(long) == 8 ? __rbitll(x) : __rbit(x); }
+
+/* Saturating intrinsics */
+
+FORCE_INLINE int32_t __ssat(int32_t x, unsigned int sat) {
+  int32_t max = (int32_t)(UINT64_C(0xffffffff) >> (33 - sat));
+  x = x < max ? x : max;
+  return x > -max - 1 ? x : -max - 1;
+}
+
+FORCE_INLINE uint32_t __usat(int32_t x, unsigned int sat) {
+  int64_t max = (int64_t)(UINT64_C(0xffffffff) >> (32 - sat));
+  int64_t r = x < max ? x : max;
+  return (uint32_t)(r > 0 ? r : 0);
+}
+
+FORCE_INLINE int32_t __qadd(int32_t a, int32_t b) {
+  int32_t r;
+  return __builtin_add_overflow(a, b, &r) ? (a >> 31) ^ INT32_MAX : r;
+}
+
+FORCE_INLINE int32_t __qsub(int32_t a, int32_t b) {
+  int32_t r;
+  return __builtin_sub_overflow(a, b, &r) ? (a >> 31) ^ INT32_MAX : r;
+}
+
+FORCE_INLINE int32_t __qdbl(int32_t a) { return __qadd(a, a); }
+
+/* CRC32 */
+
+#define ACLE2RVV_CRC32_POLY 0xedb88320
+#define ACLE2RVV_CRC32C_POLY 0x82f63b78
+#define ACLE2RVV_CRC32_POLY_QT UINT64_C(0x5a72d812fb808b20)
+#define ACLE2RVV_CRC32C_POLY_QT UINT64_C(0xa434f61c6f5389f8)
+
+// Fold 'bits' bits of 'data' into the bit-reflected 'crc'. With Zbc this is a Barrett reduction, where the constant is
+// floor(x^128 / P) in the bit-reflected domain. Without it the data is shifted through one bit at a time.
+static inline uint32_t acle2rvv_crc32(uint32_t crc, uint64_t data, unsigned int bits, uint32_t poly, uint64_t poly_qt) {
+#if defined(__riscv_zbc) && __riscv_xlen == 64
+  uint64_t s = bits == 64 ? data ^ crc : (data ^ crc) << (64 - bits);
+  uint32_t crc_low = bits < 32 ? crc >> bits : 0;
+  uint64_t r;
+  __asm__(
+      "clmul %0, %1, %2\n\t"
+      "slli %0, %0, 1\n\t"
+      "xor %0, %0, %1\n\t"
+      "clmulr %0, %0, %3\n\t"
+      "srli %0, %0, 32"
+      : "=&r"(r)
+      : "r"(s), "r"(poly_qt), "r"((uint64_t)poly << 32));
+  return (uint32_t)r ^ crc_low;
+#else
+  (void)poly_qt;
+  for (unsigned int i = 0; i < bits; i++) {
+    uint32_t bit = (crc ^ (uint32_t)(data >> i)) & 1;
+    crc = (crc >> 1) ^ (poly & -bit);
+  }
+  return crc;
+#endif
+}
+
+FORCE_INLINE uint32_t __crc32b(uint32_t a, uint8_t b) {
+  return acle2rvv_crc32(a, b, 8, ACLE2RVV_CRC32_POLY, ACLE2RVV_CRC32_POLY_QT);
+}
+
+FORCE_INLINE uint32_t __crc32h(uint32_t a, uint16_t b) {
+  return acle2rvv_crc32(a, b, 16, ACLE2RVV_CRC32_POLY, ACLE2RVV_CRC32_POLY_QT);
+}
+
+FORCE_INLINE uint32_t __crc32w(uint32_t a, uint32_t b) {
+  return acle2rvv_crc32(a, b, 32, ACLE2RVV_CRC32_POLY, ACLE2RVV_CRC32_POLY_QT);
+}
+
+FORCE_INLINE uint32_t __crc32d(uint32_t a, uint64_t b) {
+  return acle2rvv_crc32(a, b, 64, ACLE2RVV_CRC32_POLY, ACLE2RVV_CRC32_POLY_QT);
+}
+
+FORCE_INLINE uint32_t __crc32cb(uint32_t a, uint8_t b) {
+  return acle2rvv_crc32(a, b, 8, ACLE2RVV_CRC32C_POLY, ACLE2RVV_CRC32C_POLY_QT);
+}
+
+FORCE_INLINE uint32_t __crc32ch(uint32_t a, uint16_t b) {
+  return acle2rvv_crc32(a, b, 16, ACLE2RVV_CRC32C_POLY, ACLE2RVV_CRC32C_POLY_QT);
+}
+
+FORCE_INLINE uint32_t __crc32cw(uint32_t a, uint32_t b) {
+  return acle2rvv_crc32(a, b, 32, ACLE2RVV_CRC32C_POLY, ACLE2RVV_CRC32C_POLY_QT);
+}
+
+FORCE_INLINE uint32_t __crc32cd(uint32_t a, uint64_t b) {
+  return acle2rvv_crc32(a, b, 64, ACLE2RVV_CRC32C_POLY, ACLE2RVV_CRC32C_POLY_QT);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma pop_macro("FORCE_INLINE")
+#endif
+
+#endif /* ACLE2RVV_H */
@@ -63,8 +63,40 @@ extern "C" {
 #endif
 
 // Fast Path Options
+// NEON2RVV_FAST_MATH trades exact AArch64 floating-point behaviour for shorter RVV sequences. Every family below
+// follows it unless its own NEON2RVV_STRICT_* option is defined:
+// - NEON2RVV_STRICT_VMULX: vmulx returns 2.0 for (+/-inf) * (+/-0) instead of NaN
+// - NEON2RVV_STRICT_NAN: vmax/vmin and the vmaxv/vminv/vpmax/vpmin reductions propagate NaN instead of ignoring NaN
+//   lanes
+// - NEON2RVV_STRICT_REDUCTION: vaddvq_f32 adds in the AArch64 pairwise order instead of using the unordered vfredusum
+//   (signed zeros are kept either way)
+//
+// NEON2RVV_STRICT_ESTIMATE is a separate opt-in that NEON2RVV_FAST_MATH leaves alone. By default every vrecpe/vrsqrte
+// form (vector, scalar and u32) returns the 7-bit vfrec7/vfrsqrt7 seed, which is all a Newton-Raphson step needs.
+// Defined to 1, every form instead returns the AArch64 estimate bit for bit (FPRecipEstimate()/FPRSqrtEstimate() and
+// UnsignedRecipEstimate()/UnsignedRSqrtEstimate()), at the cost of an integer divide or square root per lane.
+#ifndef NEON2RVV_FAST_MATH
+#define NEON2RVV_FAST_MATH 0
+#endif
 #ifndef NEON2RVV_STRICT_VMULX
-#define NEON2RVV_STRICT_VMULX 1
+#define NEON2RVV_STRICT_VMULX (!NEON2RVV_FAST_MATH)
+#endif
+#ifndef NEON2RVV_STRICT_NAN
+#define NEON2RVV_STRICT_NAN (!NEON2RVV_FAST_MATH)
+#endif
+#ifndef NEON2RVV_STRICT_REDUCTION
+#define NEON2RVV_STRICT_REDUCTION (!NEON2RVV_FAST_MATH)
+#endif
+#ifndef NEON2RVV_STRICT_ESTIMATE
+#define NEON2RVV_STRICT_ESTIMATE 0
+#endif
+
+// When the vector length is pinned to 128 bits (e.g. `-mrvv-vector-bits=zvl` with vlen == 128), a 128-bit NEON
+// register fills exactly one RVV register, so the registers of an LMUL=2/4 group line up with the fields of a tuple.
+#if defined(__riscv_v_fixed_vlen) && __riscv_v_fixed_vlen == 128
+#define NEON2RVV_FIXED_VLEN_128 1
+#else
+#define NEON2RVV_FIXED_VLEN_128 0
 #endif
 
 typedef float float32_t;
@@ -158,6 +190,13 @@ typedef vfloat64m1x4_t float64x2x4_t;
 #error unsupported vlen
 #endif
 
+// Half precision needs Zvfh. Zvfhmin only has the conversions, not the f16 -> f32 widening FMAs.
+#if defined(__riscv_zvfh)
+typedef _Float16 float16_t;
+typedef vfloat16m1_t float16x4_t;
+typedef vfloat16m1_t float16x8_t;
+#endif
+
 // XRM
 // #define __RISCV_VXRM_RNU 0  // round-to-nearest-up (add +0.5 LSB)
 // #define __RISCV_VXRM_RNE 1  // round-to-nearest-even
@@ -170,51 +209,28 @@ typedef vfloat64m1x4_t float64x2x4_t;
 // #define __RISCV_FRM_RUP 3  // round up (towards +infinity)
 // #define __RISCV_FRM_RMM 4  // round to nearest, ties to max magnitude
 
-static inline int8_t neon2rvv_saturate_int8(int a) {
-  if (a > INT8_MAX)
-    return (int8_t)INT8_MAX;
-  if (a < INT8_MIN)
-    return (int8_t)INT8_MIN;
-  return (int8_t)a;
-}
-static inline uint8_t neon2rvv_saturate_uint8(int a) {
-  if (a > UINT8_MAX) {
-    return (uint8_t)UINT8_MAX;
-  } else if (a < 0) {
-    return 0;
-  }
-  return (uint8_t)a;
-}
-static inline int16_t neon2rvv_saturate_int16(int a) {
-  if (a > INT16_MAX)
-    return (int16_t)INT16_MAX;
-  if (a < INT16_MIN)
-    return (int16_t)INT16_MIN;
-  return (int16_t)a;
-}
-static inline uint16_t neon2rvv_saturate_uint16(int a) {
-  if (a > UINT16_MAX) {
-    return (uint16_t)UINT16_MAX;
-  } else if (a < 0) {
-    return 0;
-  }
-  return a;
+// The clamps are written as min/max selects so that they compile to Zbb min/max rather than to branches
+static inline int8_t neon2rvv_saturate_int8(int64_t a) {
+  a = a < INT8_MAX ? a : INT8_MAX;
+  return (int8_t)(a > INT8_MIN ? a : INT8_MIN);
+}
+static inline uint8_t neon2rvv_saturate_uint8(int64_t a) {
+  a = a < UINT8_MAX ? a : UINT8_MAX;
+  return (uint8_t)(a > 0 ? a : 0);
+}
+static inline int16_t neon2rvv_saturate_int16(int64_t a) {
+  a = a < INT16_MAX ? a : INT16_MAX;
+  return (int16_t)(a > INT16_MIN ? a : INT16_MIN);
+}
+static inline uint16_t neon2rvv_saturate_uint16(int64_t a) {
+  a = a < UINT16_MAX ? a : UINT16_MAX;
+  return (uint16_t)(a > 0 ? a : 0);
 }
 static inline int32_t neon2rvv_saturate_int32(int64_t a) {
-  if (a > INT32_MAX)
-    return (int32_t)INT32_MAX;
-  if (a < INT32_MIN)
-    return (int32_t)INT32_MIN;
-  return (int32_t)a;
-}
-static inline uint32_t neon2rvv_saturate_uint32(uint64_t a) {
-  if (a > UINT32_MAX) {
-    return (uint32_t)UINT32_MAX;
-  } else if (a < 0) {
-    return 0;
-  }
-  return a;
+  a = a < INT32_MAX ? a : INT32_MAX;
+  return (int32_t)(a > INT32_MIN ? a : INT32_MIN);
 }
+static inline uint32_t neon2rvv_saturate_uint32(uint64_t a) { return (uint32_t)(a < UINT32_MAX ? a : UINT32_MAX); }
 
 // forward declaration
 // FIXME vdup_n_* will be removed if the __riscv_vmv_* errors are fixed
@@ -242,10 +258,14 @@ FORCE_INLINE uint64x2_t vdupq_n_u64(uint64_t a);
 FORCE_INLINE int8x8_t vcnt_s8(int8x8_t a);
 FORCE_INLINE uint8x8_t vcnt_u8(uint8x8_t a);
 
-FORCE_INLINE int64_t vget_lane_s64(int64x1_t a, const int b);
-FORCE_INLINE uint64_t vget_lane_u64(uint64x1_t a, const int b);
-FORCE_INLINE int64_t vqrshld_s64(int64_t a, int64_t b);
-FORCE_INLINE uint64_t vqrshld_u64(uint64_t a, int64_t b);
+#if NEON2RVV_FIXED_VLEN_128
+// With vlen == 128 the upper register of an LMUL=2 group holds the upper half of its lanes, so the `_high` intrinsics
+// can widen the whole source and take that register instead of sliding the source down first. The narrowing ones put
+// the wide source in the upper register and narrow under a mask of the upper lanes, which keeps `r` in the lower half.
+static inline vbool8_t neon2rvv_high_half_b8(void) { return __riscv_vreinterpret_v_u16m1_b8(vdup_n_u16(0xff00)); }
+static inline vbool16_t neon2rvv_high_half_b16(void) { return __riscv_vreinterpret_v_u8m1_b16(vdup_n_u8(0xf0)); }
+static inline vbool32_t neon2rvv_high_half_b32(void) { return __riscv_vreinterpret_v_u8m1_b32(vdup_n_u8(0x0c)); }
+#endif
 
 /* vadd */
 FORCE_INLINE int8x8_t vadd_s8(int8x8_t a, int8x8_t b) { return __riscv_vadd_vv_i8m1(a, b, 8); }
@@ -329,39 +349,63 @@ FORCE_INLINE uint64x2_t vaddl_u32(uint32x2_t a, uint32x2_t b) {
 }
 
 FORCE_INLINE int16x8_t vaddl_high_s8(int8x16_t a, int8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i16m2_i16m1(__riscv_vwadd_vv_i16m2(a, b, 16), 1);
+#else
   vint8m1_t a_high = __riscv_vslidedown_vx_i8m1(a, 8, 16);
   vint8m1_t b_high = __riscv_vslidedown_vx_i8m1(b, 8, 16);
   return __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vwadd_vv_i16m2(a_high, b_high, 8));
+#endif
 }
 
 FORCE_INLINE int32x4_t vaddl_high_s16(int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwadd_vv_i32m2(a, b, 8), 1);
+#else
   vint16m1_t a_high = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwadd_vv_i32m2(a_high, b_high, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vaddl_high_s32(int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwadd_vv_i64m2(a, b, 4), 1);
+#else
   vint32m1_t a_high = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwadd_vv_i64m2(a_high, b_high, 2));
+#endif
 }
 
 FORCE_INLINE uint16x8_t vaddl_high_u8(uint8x16_t a, uint8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vwaddu_vv_u16m2(a, b, 16), 1);
+#else
   vuint8m1_t a_high = __riscv_vslidedown_vx_u8m1(a, 8, 16);
   vuint8m1_t b_high = __riscv_vslidedown_vx_u8m1(b, 8, 16);
   return __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vwaddu_vv_u16m2(a_high, b_high, 8));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vaddl_high_u16(uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwaddu_vv_u32m2(a, b, 8), 1);
+#else
   vuint16m1_t a_high = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwaddu_vv_u32m2(a_high, b_high, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vaddl_high_u32(uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwaddu_vv_u64m2(a, b, 4), 1);
+#else
   vuint32m1_t a_high = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwaddu_vv_u64m2(a_high, b_high, 2));
+#endif
 }
 
 FORCE_INLINE int16x8_t vaddw_s8(int16x8_t a, int8x8_t b) {
@@ -389,38 +433,68 @@ FORCE_INLINE uint64x2_t vaddw_u32(uint64x2_t a, uint32x2_t b) {
 }
 
 FORCE_INLINE int16x8_t vaddw_high_s8(int16x8_t a, int8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_wide = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vget_v_i16m2_i16m1(__riscv_vwadd_wv_i16m2(a_wide, b, 16), 1);
+#else
   vint16m1_t b_ext = __riscv_vsext_vf2_i16m1(__riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(b, 8, 16)), 8);
   return __riscv_vadd_vv_i16m1(a, b_ext, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vaddw_high_s16(int32x4_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_wide = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwadd_wv_i32m2(a_wide, b, 8), 1);
+#else
   vint32m1_t b_ext =
       __riscv_vsext_vf2_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(b, 4, 8)), 4);
   return __riscv_vadd_vv_i32m1(a, b_ext, 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vaddw_high_s32(int64x2_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_wide = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwadd_wv_i64m2(a_wide, b, 4), 1);
+#else
   vint64m1_t b_ext =
       __riscv_vsext_vf2_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, 4)), 2);
   return __riscv_vadd_vv_i64m1(a, b_ext, 2);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vaddw_high_u8(uint16x8_t a, uint8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_wide = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vwaddu_wv_u16m2(a_wide, b, 16), 1);
+#else
   vuint16m1_t b_ext =
       __riscv_vzext_vf2_u16m1(__riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(b, 8, 16)), 8);
   return __riscv_vadd_vv_u16m1(a, b_ext, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vaddw_high_u16(uint32x4_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_wide = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwaddu_wv_u32m2(a_wide, b, 8), 1);
+#else
   vuint32m1_t b_ext =
       __riscv_vzext_vf2_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, 8)), 4);
   return __riscv_vadd_vv_u32m1(a, b_ext, 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vaddw_high_u32(uint64x2_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_wide = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwaddu_wv_u64m2(a_wide, b, 4), 1);
+#else
   vuint64m1_t b_ext =
       __riscv_vzext_vf2_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(b, 2, 4)), 2);
   return __riscv_vadd_vv_u64m1(a, b_ext, 2);
+#endif
 }
 
 FORCE_INLINE int8x8_t vhadd_s8(int8x8_t a, int8x8_t b) { return __riscv_vaadd_vv_i8m1(a, b, __RISCV_VXRM_RDN, 8); }
@@ -537,14 +611,12 @@ FORCE_INLINE uint32x4_t vqaddq_u32(uint32x4_t a, uint32x4_t b) { return __riscv_
 
 FORCE_INLINE uint64x2_t vqaddq_u64(uint64x2_t a, uint64x2_t b) { return __riscv_vsaddu_vv_u64m1(a, b, 2); }
 
+// A signed overflow always goes in the direction of 'a', so the saturated value is picked from its sign bit.
 #define SATURATE_ADD_SUB(BIT)                                                       \
   static inline int##BIT##_t sat_add_int##BIT(int##BIT##_t a, int##BIT##_t b) {     \
-    if (a > 0 && b > INT##BIT##_MAX - a) {                                          \
-      return INT##BIT##_MAX;                                                        \
-    } else if (a < 0 && b < INT##BIT##_MIN - a) {                                   \
-      return INT##BIT##_MIN;                                                        \
-    } else                                                                          \
-      return a + b;                                                                 \
+    int##BIT##_t r;                                                                 \
+    int##BIT##_t sat = (a >> (BIT - 1)) ^ INT##BIT##_MAX;                           \
+    return __builtin_add_overflow(a, b, &r) ? sat : r;                              \
   }                                                                                 \
   static inline uint##BIT##_t sat_add_uint##BIT(uint##BIT##_t a, uint##BIT##_t b) { \
     uint##BIT##_t r = a + b;                                                        \
@@ -552,12 +624,9 @@ FORCE_INLINE uint64x2_t vqaddq_u64(uint64x2_t a, uint64x2_t b) { return __riscv_
     return r;                                                                       \
   }                                                                                 \
   static inline int##BIT##_t sat_sub_int##BIT(int##BIT##_t a, int##BIT##_t b) {     \
-    if (b > 0 && a < INT##BIT##_MIN + b) {                                          \
-      return INT##BIT##_MIN;                                                        \
-    } else if (b < 0 && a > INT##BIT##_MAX + b) {                                   \
-      return INT##BIT##_MAX;                                                        \
-    } else                                                                          \
-      return a - b;                                                                 \
+    int##BIT##_t r;                                                                 \
+    int##BIT##_t sat = (a >> (BIT - 1)) ^ INT##BIT##_MAX;                           \
+    return __builtin_sub_overflow(a, b, &r) ? sat : r;                              \
   }                                                                                 \
   static inline uint##BIT##_t sat_sub_uint##BIT(uint##BIT##_t a, uint##BIT##_t b) { \
     uint##BIT##_t r = a - b;                                                        \
@@ -585,53 +654,141 @@ FORCE_INLINE uint32_t vqadds_u32(uint32_t a, uint32_t b) { return sat_add_uint32
 
 FORCE_INLINE uint64_t vqaddd_u64(uint64_t a, uint64_t b) { return sat_add_uint64(a, b); }
 
-// FORCE_INLINE int8x8_t vuqadd_s8(int8x8_t a, uint8x8_t b);
+FORCE_INLINE int8x8_t vuqadd_s8(int8x8_t a, uint8x8_t b) {
+  vuint8m1_t a_bias = __riscv_vxor_vx_u8m1(__riscv_vreinterpret_v_i8m1_u8m1(a), (uint8_t)INT8_MIN, 8);
+  vuint8m1_t sum = __riscv_vsaddu_vv_u8m1(a_bias, b, 8);
+  return __riscv_vreinterpret_v_u8m1_i8m1(__riscv_vxor_vx_u8m1(sum, (uint8_t)INT8_MIN, 8));
+}
 
-// FORCE_INLINE int8x16_t vuqaddq_s8(int8x16_t a, uint8x16_t b);
+FORCE_INLINE int8x16_t vuqaddq_s8(int8x16_t a, uint8x16_t b) {
+  vuint8m1_t a_bias = __riscv_vxor_vx_u8m1(__riscv_vreinterpret_v_i8m1_u8m1(a), (uint8_t)INT8_MIN, 16);
+  vuint8m1_t sum = __riscv_vsaddu_vv_u8m1(a_bias, b, 16);
+  return __riscv_vreinterpret_v_u8m1_i8m1(__riscv_vxor_vx_u8m1(sum, (uint8_t)INT8_MIN, 16));
+}
 
-// FORCE_INLINE int16x4_t vuqadd_s16(int16x4_t a, uint16x4_t b);
+FORCE_INLINE int16x4_t vuqadd_s16(int16x4_t a, uint16x4_t b) {
+  vuint16m1_t a_bias = __riscv_vxor_vx_u16m1(__riscv_vreinterpret_v_i16m1_u16m1(a), (uint16_t)INT16_MIN, 4);
+  vuint16m1_t sum = __riscv_vsaddu_vv_u16m1(a_bias, b, 4);
+  return __riscv_vreinterpret_v_u16m1_i16m1(__riscv_vxor_vx_u16m1(sum, (uint16_t)INT16_MIN, 4));
+}
 
-// FORCE_INLINE int16x8_t vuqaddq_s16(int16x8_t a, uint16x8_t b);
+FORCE_INLINE int16x8_t vuqaddq_s16(int16x8_t a, uint16x8_t b) {
+  vuint16m1_t a_bias = __riscv_vxor_vx_u16m1(__riscv_vreinterpret_v_i16m1_u16m1(a), (uint16_t)INT16_MIN, 8);
+  vuint16m1_t sum = __riscv_vsaddu_vv_u16m1(a_bias, b, 8);
+  return __riscv_vreinterpret_v_u16m1_i16m1(__riscv_vxor_vx_u16m1(sum, (uint16_t)INT16_MIN, 8));
+}
 
-// FORCE_INLINE int32x2_t vuqadd_s32(int32x2_t a, uint32x2_t b);
+FORCE_INLINE int32x2_t vuqadd_s32(int32x2_t a, uint32x2_t b) {
+  vuint32m1_t a_bias = __riscv_vxor_vx_u32m1(__riscv_vreinterpret_v_i32m1_u32m1(a), (uint32_t)INT32_MIN, 2);
+  vuint32m1_t sum = __riscv_vsaddu_vv_u32m1(a_bias, b, 2);
+  return __riscv_vreinterpret_v_u32m1_i32m1(__riscv_vxor_vx_u32m1(sum, (uint32_t)INT32_MIN, 2));
+}
 
-// FORCE_INLINE int32x4_t vuqaddq_s32(int32x4_t a, uint32x4_t b);
+FORCE_INLINE int32x4_t vuqaddq_s32(int32x4_t a, uint32x4_t b) {
+  vuint32m1_t a_bias = __riscv_vxor_vx_u32m1(__riscv_vreinterpret_v_i32m1_u32m1(a), (uint32_t)INT32_MIN, 4);
+  vuint32m1_t sum = __riscv_vsaddu_vv_u32m1(a_bias, b, 4);
+  return __riscv_vreinterpret_v_u32m1_i32m1(__riscv_vxor_vx_u32m1(sum, (uint32_t)INT32_MIN, 4));
+}
 
-// FORCE_INLINE int64x1_t vuqadd_s64(int64x1_t a, uint64x1_t b);
+FORCE_INLINE int64x1_t vuqadd_s64(int64x1_t a, uint64x1_t b) {
+  vuint64m1_t a_bias = __riscv_vxor_vx_u64m1(__riscv_vreinterpret_v_i64m1_u64m1(a), (uint64_t)INT64_MIN, 1);
+  vuint64m1_t sum = __riscv_vsaddu_vv_u64m1(a_bias, b, 1);
+  return __riscv_vreinterpret_v_u64m1_i64m1(__riscv_vxor_vx_u64m1(sum, (uint64_t)INT64_MIN, 1));
+}
 
-// FORCE_INLINE int64x2_t vuqaddq_s64(int64x2_t a, uint64x2_t b);
+FORCE_INLINE int64x2_t vuqaddq_s64(int64x2_t a, uint64x2_t b) {
+  vuint64m1_t a_bias = __riscv_vxor_vx_u64m1(__riscv_vreinterpret_v_i64m1_u64m1(a), (uint64_t)INT64_MIN, 2);
+  vuint64m1_t sum = __riscv_vsaddu_vv_u64m1(a_bias, b, 2);
+  return __riscv_vreinterpret_v_u64m1_i64m1(__riscv_vxor_vx_u64m1(sum, (uint64_t)INT64_MIN, 2));
+}
 
-// FORCE_INLINE int8_t vuqaddb_s8(int8_t a, uint8_t b);
+FORCE_INLINE int8_t vuqaddb_s8(int8_t a, uint8_t b) {
+  return (int8_t)(sat_add_uint8((uint8_t)a ^ (uint8_t)INT8_MIN, b) ^ (uint8_t)INT8_MIN);
+}
 
-// FORCE_INLINE int16_t vuqaddh_s16(int16_t a, uint16_t b);
+FORCE_INLINE int16_t vuqaddh_s16(int16_t a, uint16_t b) {
+  return (int16_t)(sat_add_uint16((uint16_t)a ^ (uint16_t)INT16_MIN, b) ^ (uint16_t)INT16_MIN);
+}
 
-// FORCE_INLINE int32_t vuqadds_s32(int32_t a, uint32_t b);
+FORCE_INLINE int32_t vuqadds_s32(int32_t a, uint32_t b) {
+  return (int32_t)(sat_add_uint32((uint32_t)a ^ (uint32_t)INT32_MIN, b) ^ (uint32_t)INT32_MIN);
+}
 
-// FORCE_INLINE int64_t vuqaddd_s64(int64_t a, uint64_t b);
+FORCE_INLINE int64_t vuqaddd_s64(int64_t a, uint64_t b) {
+  return (int64_t)(sat_add_uint64((uint64_t)a ^ (uint64_t)INT64_MIN, b) ^ (uint64_t)INT64_MIN);
+}
 
-// FORCE_INLINE uint8x8_t vsqadd_u8(uint8x8_t a, int8x8_t b);
+FORCE_INLINE uint8x8_t vsqadd_u8(uint8x8_t a, int8x8_t b) {
+  vbool8_t b_neg = __riscv_vmslt_vx_i8m1_b8(b, 0, 8);
+  vuint8m1_t b_u = __riscv_vreinterpret_v_i8m1_u8m1(b);
+  vuint8m1_t sum = __riscv_vsaddu_vv_u8m1(a, b_u, 8);
+  return __riscv_vssubu_vv_u8m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u8m1(b_u, 0, 8), 8);
+}
 
-// FORCE_INLINE uint8x16_t vsqaddq_u8(uint8x16_t a, int8x16_t b);
+FORCE_INLINE uint8x16_t vsqaddq_u8(uint8x16_t a, int8x16_t b) {
+  vbool8_t b_neg = __riscv_vmslt_vx_i8m1_b8(b, 0, 16);
+  vuint8m1_t b_u = __riscv_vreinterpret_v_i8m1_u8m1(b);
+  vuint8m1_t sum = __riscv_vsaddu_vv_u8m1(a, b_u, 16);
+  return __riscv_vssubu_vv_u8m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u8m1(b_u, 0, 16), 16);
+}
 
-// FORCE_INLINE uint16x4_t vsqadd_u16(uint16x4_t a, int16x4_t b);
+FORCE_INLINE uint16x4_t vsqadd_u16(uint16x4_t a, int16x4_t b) {
+  vbool16_t b_neg = __riscv_vmslt_vx_i16m1_b16(b, 0, 4);
+  vuint16m1_t b_u = __riscv_vreinterpret_v_i16m1_u16m1(b);
+  vuint16m1_t sum = __riscv_vsaddu_vv_u16m1(a, b_u, 4);
+  return __riscv_vssubu_vv_u16m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u16m1(b_u, 0, 4), 4);
+}
 
-// FORCE_INLINE uint16x8_t vsqaddq_u16(uint16x8_t a, int16x8_t b);
+FORCE_INLINE uint16x8_t vsqaddq_u16(uint16x8_t a, int16x8_t b) {
+  vbool16_t b_neg = __riscv_vmslt_vx_i16m1_b16(b, 0, 8);
+  vuint16m1_t b_u = __riscv_vreinterpret_v_i16m1_u16m1(b);
+  vuint16m1_t sum = __riscv_vsaddu_vv_u16m1(a, b_u, 8);
+  return __riscv_vssubu_vv_u16m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u16m1(b_u, 0, 8), 8);
+}
 
-// FORCE_INLINE uint32x2_t vsqadd_u32(uint32x2_t a, int32x2_t b);
+FORCE_INLINE uint32x2_t vsqadd_u32(uint32x2_t a, int32x2_t b) {
+  vbool32_t b_neg = __riscv_vmslt_vx_i32m1_b32(b, 0, 2);
+  vuint32m1_t b_u = __riscv_vreinterpret_v_i32m1_u32m1(b);
+  vuint32m1_t sum = __riscv_vsaddu_vv_u32m1(a, b_u, 2);
+  return __riscv_vssubu_vv_u32m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u32m1(b_u, 0, 2), 2);
+}
 
-// FORCE_INLINE uint32x4_t vsqaddq_u32(uint32x4_t a, int32x4_t b);
+FORCE_INLINE uint32x4_t vsqaddq_u32(uint32x4_t a, int32x4_t b) {
+  vbool32_t b_neg = __riscv_vmslt_vx_i32m1_b32(b, 0, 4);
+  vuint32m1_t b_u = __riscv_vreinterpret_v_i32m1_u32m1(b);
+  vuint32m1_t sum = __riscv_vsaddu_vv_u32m1(a, b_u, 4);
+  return __riscv_vssubu_vv_u32m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u32m1(b_u, 0, 4), 4);
+}
 
-// FORCE_INLINE uint64x1_t vsqadd_u64(uint64x1_t a, int64x1_t b);
+FORCE_INLINE uint64x1_t vsqadd_u64(uint64x1_t a, int64x1_t b) {
+  vbool64_t b_neg = __riscv_vmslt_vx_i64m1_b64(b, 0, 1);
+  vuint64m1_t b_u = __riscv_vreinterpret_v_i64m1_u64m1(b);
+  vuint64m1_t sum = __riscv_vsaddu_vv_u64m1(a, b_u, 1);
+  return __riscv_vssubu_vv_u64m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u64m1(b_u, 0, 1), 1);
+}
 
-// FORCE_INLINE uint64x2_t vsqaddq_u64(uint64x2_t a, int64x2_t b);
+FORCE_INLINE uint64x2_t vsqaddq_u64(uint64x2_t a, int64x2_t b) {
+  vbool64_t b_neg = __riscv_vmslt_vx_i64m1_b64(b, 0, 2);
+  vuint64m1_t b_u = __riscv_vreinterpret_v_i64m1_u64m1(b);
+  vuint64m1_t sum = __riscv_vsaddu_vv_u64m1(a, b_u, 2);
+  return __riscv_vssubu_vv_u64m1_mu(b_neg, sum, a, __riscv_vrsub_vx_u64m1(b_u, 0, 2), 2);
+}
 
-// FORCE_INLINE uint8_t vsqaddb_u8(uint8_t a, int8_t b);
+FORCE_INLINE uint8_t vsqaddb_u8(uint8_t a, int8_t b) {
+  return b < 0 ? sat_sub_uint8(a, (uint8_t)(0 - (uint8_t)b)) : sat_add_uint8(a, (uint8_t)b);
+}
 
-// FORCE_INLINE uint16_t vsqaddh_u16(uint16_t a, int16_t b);
+FORCE_INLINE uint16_t vsqaddh_u16(uint16_t a, int16_t b) {
+  return b < 0 ? sat_sub_uint16(a, (uint16_t)(0 - (uint16_t)b)) : sat_add_uint16(a, (uint16_t)b);
+}
 
-// FORCE_INLINE uint32_t vsqadds_u32(uint32_t a, int32_t b);
+FORCE_INLINE uint32_t vsqadds_u32(uint32_t a, int32_t b) {
+  return b < 0 ? sat_sub_uint32(a, (uint32_t)(0 - (uint32_t)b)) : sat_add_uint32(a, (uint32_t)b);
+}
 
-// FORCE_INLINE uint64_t vsqaddd_u64(uint64_t a, int64_t b);
+FORCE_INLINE uint64_t vsqaddd_u64(uint64_t a, int64_t b) {
+  return b < 0 ? sat_sub_uint64(a, (uint64_t)(0 - (uint64_t)b)) : sat_add_uint64(a, (uint64_t)b);
+}
 
 FORCE_INLINE int8x8_t vaddhn_s16(int16x8_t a, int16x8_t b) {
   vint16m1_t ab_add = __riscv_vadd_vv_i16m1(a, b, 8);
@@ -664,39 +821,75 @@ FORCE_INLINE uint32x2_t vaddhn_u64(uint64x2_t a, uint64x2_t b) {
 }
 
 FORCE_INLINE int8x16_t vaddhn_high_s16(int8x8_t r, int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t ab_add = __riscv_vadd_vv_i16m1(a, b, 8);
+  vint16m2_t ab_add_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(ab_add), 1, ab_add);
+  return __riscv_vnsra_wx_i8m1_mu(neon2rvv_high_half_b8(), r, ab_add_hi, 8, 16);
+#else
   vint16m1_t ab_add = __riscv_vadd_vv_i16m1(a, b, 8);
   vint8m1_t addhn = __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vnsra_wx_i8mf2(ab_add, 8, 8));
   return __riscv_vslideup_vx_i8m1(r, addhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vaddhn_high_s32(int16x4_t r, int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t ab_add = __riscv_vadd_vv_i32m1(a, b, 4);
+  vint32m2_t ab_add_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(ab_add), 1, ab_add);
+  return __riscv_vnsra_wx_i16m1_mu(neon2rvv_high_half_b16(), r, ab_add_hi, 16, 8);
+#else
   vint32m1_t ab_add = __riscv_vadd_vv_i32m1(a, b, 4);
   vint16m1_t addhn = __riscv_vlmul_ext_v_i16mf2_i16m1(__riscv_vnsra_wx_i16mf2(ab_add, 16, 4));
   return __riscv_vslideup_vx_i16m1(r, addhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vaddhn_high_s64(int32x2_t r, int64x2_t a, int64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t ab_add = __riscv_vadd_vv_i64m1(a, b, 2);
+  vint64m2_t ab_add_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(ab_add), 1, ab_add);
+  return __riscv_vnsra_wx_i32m1_mu(neon2rvv_high_half_b32(), r, ab_add_hi, 32, 4);
+#else
   vint64m1_t ab_add = __riscv_vadd_vv_i64m1(a, b, 2);
   vint32m1_t addhn = __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vnsra_wx_i32mf2(ab_add, 32, 2));
   return __riscv_vslideup_vx_i32m1(r, addhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vaddhn_high_u16(uint8x8_t r, uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t ab_add = __riscv_vadd_vv_u16m1(a, b, 8);
+  vuint16m2_t ab_add_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(ab_add), 1, ab_add);
+  return __riscv_vnsrl_wx_u8m1_mu(neon2rvv_high_half_b8(), r, ab_add_hi, 8, 16);
+#else
   vuint16m1_t ab_add = __riscv_vadd_vv_u16m1(a, b, 8);
   vuint8m1_t addhn = __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vnsrl_wx_u8mf2(ab_add, 8, 8));
   return __riscv_vslideup_vx_u8m1(r, addhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vaddhn_high_u32(uint16x4_t r, uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t ab_add = __riscv_vadd_vv_u32m1(a, b, 4);
+  vuint32m2_t ab_add_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(ab_add), 1, ab_add);
+  return __riscv_vnsrl_wx_u16m1_mu(neon2rvv_high_half_b16(), r, ab_add_hi, 16, 8);
+#else
   vuint32m1_t ab_add = __riscv_vadd_vv_u32m1(a, b, 4);
   vuint16m1_t addhn = __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnsrl_wx_u16mf2(ab_add, 16, 4));
   return __riscv_vslideup_vx_u16m1(r, addhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vaddhn_high_u64(uint32x2_t r, uint64x2_t a, uint64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t ab_add = __riscv_vadd_vv_u64m1(a, b, 2);
+  vuint64m2_t ab_add_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(ab_add), 1, ab_add);
+  return __riscv_vnsrl_wx_u32m1_mu(neon2rvv_high_half_b32(), r, ab_add_hi, 32, 4);
+#else
   vuint64m1_t ab_add = __riscv_vadd_vv_u64m1(a, b, 2);
   vuint32m1_t addhn = __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnsrl_wx_u32mf2(ab_add, 32, 2));
   return __riscv_vslideup_vx_u32m1(r, addhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vraddhn_s16(int16x8_t a, int16x8_t b) {
@@ -736,45 +929,87 @@ FORCE_INLINE uint32x2_t vraddhn_u64(uint64x2_t a, uint64x2_t b) {
 }
 
 FORCE_INLINE int8x16_t vraddhn_high_s16(int8x8_t r, int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t ab_add = __riscv_vadd_vv_i16m1(a, b, 8);
+  vint16m1_t add_round = __riscv_vadd_vx_i16m1(ab_add, 1 << 7, 8);
+  vint16m2_t add_round_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(add_round), 1, add_round);
+  return __riscv_vnsra_wx_i8m1_mu(neon2rvv_high_half_b8(), r, add_round_hi, 8, 16);
+#else
   vint16m1_t add_ab = __riscv_vadd_vv_i16m1(a, b, 8);
   vint16m1_t add_round = __riscv_vadd_vx_i16m1(add_ab, 1 << 7, 8);
   vint8m1_t raddhn = __riscv_vnsra_wx_i8m1(__riscv_vlmul_ext_v_i16m1_i16m2(add_round), 8, 8);
   return __riscv_vslideup_vx_i8m1(r, raddhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vraddhn_high_s32(int16x4_t r, int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t ab_add = __riscv_vadd_vv_i32m1(a, b, 4);
+  vint32m1_t add_round = __riscv_vadd_vx_i32m1(ab_add, 1 << 15, 4);
+  vint32m2_t add_round_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(add_round), 1, add_round);
+  return __riscv_vnsra_wx_i16m1_mu(neon2rvv_high_half_b16(), r, add_round_hi, 16, 8);
+#else
   vint32m1_t add_ab = __riscv_vadd_vv_i32m1(a, b, 4);
   vint32m1_t add_round = __riscv_vadd_vx_i32m1(add_ab, 1 << 15, 4);
   vint16m1_t raddhn = __riscv_vnsra_wx_i16m1(__riscv_vlmul_ext_v_i32m1_i32m2(add_round), 16, 4);
   return __riscv_vslideup_vx_i16m1(r, raddhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vraddhn_high_s64(int32x2_t r, int64x2_t a, int64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t ab_add = __riscv_vadd_vv_i64m1(a, b, 2);
+  vint64m1_t add_round = __riscv_vadd_vx_i64m1(ab_add, (int64_t)1 << 31, 2);
+  vint64m2_t add_round_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(add_round), 1, add_round);
+  return __riscv_vnsra_wx_i32m1_mu(neon2rvv_high_half_b32(), r, add_round_hi, 32, 4);
+#else
   vint64m1_t add_ab = __riscv_vadd_vv_i64m1(a, b, 2);
   vint64m1_t add_round = __riscv_vadd_vx_i64m1(add_ab, (int64_t)1 << 31, 2);
   vint32m1_t raddhn = __riscv_vnsra_wx_i32m1(__riscv_vlmul_ext_v_i64m1_i64m2(add_round), 32, 2);
   return __riscv_vslideup_vx_i32m1(r, raddhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vraddhn_high_u16(uint8x8_t r, uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t ab_add = __riscv_vadd_vv_u16m1(a, b, 8);
+  vuint16m1_t add_round = __riscv_vadd_vx_u16m1(ab_add, 1 << 7, 8);
+  vuint16m2_t add_round_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(add_round), 1, add_round);
+  return __riscv_vnsrl_wx_u8m1_mu(neon2rvv_high_half_b8(), r, add_round_hi, 8, 16);
+#else
   vuint16m1_t add_ab = __riscv_vadd_vv_u16m1(a, b, 8);
   vuint16m1_t add_round = __riscv_vadd_vx_u16m1(add_ab, 1 << 7, 8);
   vuint8m1_t raddhn = __riscv_vnsrl_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(add_round), 8, 8);
   return __riscv_vslideup_vx_u8m1(r, raddhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vraddhn_high_u32(uint16x4_t r, uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t ab_add = __riscv_vadd_vv_u32m1(a, b, 4);
+  vuint32m1_t add_round = __riscv_vadd_vx_u32m1(ab_add, 1 << 15, 4);
+  vuint32m2_t add_round_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(add_round), 1, add_round);
+  return __riscv_vnsrl_wx_u16m1_mu(neon2rvv_high_half_b16(), r, add_round_hi, 16, 8);
+#else
   vuint32m1_t add_ab = __riscv_vadd_vv_u32m1(a, b, 4);
   vuint32m1_t add_round = __riscv_vadd_vx_u32m1(add_ab, 1 << 15, 4);
   vuint16m1_t raddhn = __riscv_vnsrl_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(add_round), 16, 4);
   return __riscv_vslideup_vx_u16m1(r, raddhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vraddhn_high_u64(uint32x2_t r, uint64x2_t a, uint64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t ab_add = __riscv_vadd_vv_u64m1(a, b, 2);
+  vuint64m1_t add_round = __riscv_vadd_vx_u64m1(ab_add, (int64_t)1 << 31, 2);
+  vuint64m2_t add_round_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(add_round), 1, add_round);
+  return __riscv_vnsrl_wx_u32m1_mu(neon2rvv_high_half_b32(), r, add_round_hi, 32, 4);
+#else
   vuint64m1_t add_ab = __riscv_vadd_vv_u64m1(a, b, 2);
   vuint64m1_t add_round = __riscv_vadd_vx_u64m1(add_ab, (int64_t)1 << 31, 2);
   vuint32m1_t raddhn = __riscv_vnsrl_wx_u32m1(__riscv_vlmul_ext_v_u64m1_u64m2(add_round), 32, 2);
   return __riscv_vslideup_vx_u32m1(r, raddhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vmul_s8(int8x8_t a, int8x8_t b) { return __riscv_vmul_vv_i8m1(a, b, 8); }
@@ -986,125 +1221,108 @@ FORCE_INLINE uint16x8_t vmulq_u16(uint16x8_t a, uint16x8_t b) { return __riscv_v
 FORCE_INLINE uint32x4_t vmulq_u32(uint32x4_t a, uint32x4_t b) { return __riscv_vmul_vv_u32m1(a, b, 4); }
 
 FORCE_INLINE int16x4_t vqdmulh_s16(int16x4_t a, int16x4_t b) {
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b, 4);
-  return __riscv_vnclip_wx_i16m1(ab_mul, 15, __RISCV_VXRM_RDN, 4);
+  return __riscv_vsmul_vv_i16m1(a, b, __RISCV_VXRM_RDN, 4);
 }
 
 FORCE_INLINE int32x2_t vqdmulh_s32(int32x2_t a, int32x2_t b) {
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b, 2);
-  return __riscv_vnclip_wx_i32m1(ab_mul, 31, __RISCV_VXRM_RDN, 2);
+  return __riscv_vsmul_vv_i32m1(a, b, __RISCV_VXRM_RDN, 2);
 }
 
 FORCE_INLINE int16x8_t vqdmulhq_s16(int16x8_t a, int16x8_t b) {
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b, 8);
-  return __riscv_vnclip_wx_i16m1(ab_mul, 15, __RISCV_VXRM_RDN, 8);
+  return __riscv_vsmul_vv_i16m1(a, b, __RISCV_VXRM_RDN, 8);
 }
 
 FORCE_INLINE int32x4_t vqdmulhq_s32(int32x4_t a, int32x4_t b) {
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b, 4);
-  return __riscv_vnclip_wx_i32m1(ab_mul, 31, __RISCV_VXRM_RDN, 4);
+  return __riscv_vsmul_vv_i32m1(a, b, __RISCV_VXRM_RDN, 4);
 }
 
 FORCE_INLINE int16_t vqdmulhh_s16(int16_t a, int16_t b) {
-  int32_t product = (int32_t)a * (int32_t)b;
-  int32_t result = product >> 15;
-  return result > INT16_MAX ? INT16_MAX : (int16_t)result;
+  vint16m1_t a_s = __riscv_vmv_s_x_i16m1(a, 1);
+  return __riscv_vmv_x_s_i16m1_i16(__riscv_vsmul_vx_i16m1(a_s, b, __RISCV_VXRM_RDN, 1));
 }
 
 FORCE_INLINE int32_t vqdmulhs_s32(int32_t a, int32_t b) {
-  int64_t product = (int64_t)a * (int64_t)b;
-  int64_t result = product >> 31;
-  return result > INT32_MAX ? INT32_MAX : (int32_t)result;
+  vint32m1_t a_s = __riscv_vmv_s_x_i32m1(a, 1);
+  return __riscv_vmv_x_s_i32m1_i32(__riscv_vsmul_vx_i32m1(a_s, b, __RISCV_VXRM_RDN, 1));
 }
 
 FORCE_INLINE int16x4_t vqrdmulh_s16(int16x4_t a, int16x4_t b) {
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b, 4);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 4);
-  return __riscv_vnclip_wx_i16m1(ab_mulx2, 16, __RISCV_VXRM_RNU, 4);
+  return __riscv_vsmul_vv_i16m1(a, b, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int32x2_t vqrdmulh_s32(int32x2_t a, int32x2_t b) {
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b, 2);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 2);
-  return __riscv_vnclip_wx_i32m1(ab_mulx2, 32, __RISCV_VXRM_RNU, 2);
+  return __riscv_vsmul_vv_i32m1(a, b, __RISCV_VXRM_RNU, 2);
 }
 
 FORCE_INLINE int16x8_t vqrdmulhq_s16(int16x8_t a, int16x8_t b) {
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b, 8);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 8);
-  return __riscv_vnclip_wx_i16m1(ab_mulx2, 16, __RISCV_VXRM_RNU, 8);
+  return __riscv_vsmul_vv_i16m1(a, b, __RISCV_VXRM_RNU, 8);
 }
 
 FORCE_INLINE int32x4_t vqrdmulhq_s32(int32x4_t a, int32x4_t b) {
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b, 4);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 4);
-  return __riscv_vnclip_wx_i32m1(ab_mulx2, 32, __RISCV_VXRM_RNU, 4);
+  return __riscv_vsmul_vv_i32m1(a, b, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int16_t vqrdmulhh_s16(int16_t a, int16_t b) {
-  int32_t dmul = 2 * (int32_t)a * (int32_t)b;
-  return ((dmul >> 15) + 1) >> 1;
+  vint16m1_t a_s = __riscv_vmv_s_x_i16m1(a, 1);
+  return __riscv_vmv_x_s_i16m1_i16(__riscv_vsmul_vx_i16m1(a_s, b, __RISCV_VXRM_RNU, 1));
 }
 
 FORCE_INLINE int32_t vqrdmulhs_s32(int32_t a, int32_t b) {
-  int64_t dmul = 2 * (int64_t)a * (int64_t)b;
-  return ((dmul >> 31) + 1) >> 1;
+  vint32m1_t a_s = __riscv_vmv_s_x_i32m1(a, 1);
+  return __riscv_vmv_x_s_i32m1_i32(__riscv_vsmul_vx_i32m1(a_s, b, __RISCV_VXRM_RNU, 1));
 }
 
 FORCE_INLINE int16x4_t vqrdmlah_s16(int16x4_t a, int16x4_t b, int16x4_t c) {
-  vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c, 4);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 4);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 4);
-  return __riscv_vsadd_vv_i16m1(a, bc_s, 4);
+  // accumulate in the widened domain so that the result is rounded and saturated only once
+  vint32m2_t a_wide = __riscv_vwmulsu_vx_i32m2(a, (uint16_t)1 << 15, 4);
+  vint32m2_t abc_acc = __riscv_vwmacc_vv_i32m2(a_wide, b, c, 4);
+  return __riscv_vnclip_wx_i16m1(abc_acc, 15, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int32x2_t vqrdmlah_s32(int32x2_t a, int32x2_t b, int32x2_t c) {
-  vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c, 2);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 2);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 2);
-  return __riscv_vsadd_vv_i32m1(a, bc_s, 2);
+  vint64m2_t a_wide = __riscv_vwmulsu_vx_i64m2(a, (uint32_t)1 << 31, 2);
+  vint64m2_t abc_acc = __riscv_vwmacc_vv_i64m2(a_wide, b, c, 2);
+  return __riscv_vnclip_wx_i32m1(abc_acc, 31, __RISCV_VXRM_RNU, 2);
 }
 
 FORCE_INLINE int16x8_t vqrdmlahq_s16(int16x8_t a, int16x8_t b, int16x8_t c) {
-  vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c, 8);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 8);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 8);
-  return __riscv_vsadd_vv_i16m1(a, bc_s, 8);
+  vint32m2_t a_wide = __riscv_vwmulsu_vx_i32m2(a, (uint16_t)1 << 15, 8);
+  vint32m2_t abc_acc = __riscv_vwmacc_vv_i32m2(a_wide, b, c, 8);
+  return __riscv_vnclip_wx_i16m1(abc_acc, 15, __RISCV_VXRM_RNU, 8);
 }
 
 FORCE_INLINE int32x4_t vqrdmlahq_s32(int32x4_t a, int32x4_t b, int32x4_t c) {
-  vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c, 4);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 4);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 4);
-  return __riscv_vsadd_vv_i32m1(a, bc_s, 4);
+  vint64m2_t a_wide = __riscv_vwmulsu_vx_i64m2(a, (uint32_t)1 << 31, 4);
+  vint64m2_t abc_acc = __riscv_vwmacc_vv_i64m2(a_wide, b, c, 4);
+  return __riscv_vnclip_wx_i32m1(abc_acc, 31, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int16x4_t vqrdmlsh_s16(int16x4_t a, int16x4_t b, int16x4_t c) {
+  vint32m2_t a_wide = __riscv_vwmulsu_vx_i32m2(a, (uint16_t)1 << 15, 4);
   vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c, 4);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 4);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 4);
-  return __riscv_vssub_vv_i16m1(a, bc_s, 4);
+  vint32m2_t abc_acc = __riscv_vsub_vv_i32m2(a_wide, bc_mul, 4);
+  return __riscv_vnclip_wx_i16m1(abc_acc, 15, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int32x2_t vqrdmlsh_s32(int32x2_t a, int32x2_t b, int32x2_t c) {
+  vint64m2_t a_wide = __riscv_vwmulsu_vx_i64m2(a, (uint32_t)1 << 31, 2);
   vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c, 2);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 2);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 2);
-  return __riscv_vssub_vv_i32m1(a, bc_s, 2);
+  vint64m2_t abc_acc = __riscv_vsub_vv_i64m2(a_wide, bc_mul, 2);
+  return __riscv_vnclip_wx_i32m1(abc_acc, 31, __RISCV_VXRM_RNU, 2);
 }
 
 FORCE_INLINE int16x8_t vqrdmlshq_s16(int16x8_t a, int16x8_t b, int16x8_t c) {
+  vint32m2_t a_wide = __riscv_vwmulsu_vx_i32m2(a, (uint16_t)1 << 15, 8);
   vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c, 8);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 8);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 8);
-  return __riscv_vssub_vv_i16m1(a, bc_s, 8);
+  vint32m2_t abc_acc = __riscv_vsub_vv_i32m2(a_wide, bc_mul, 8);
+  return __riscv_vnclip_wx_i16m1(abc_acc, 15, __RISCV_VXRM_RNU, 8);
 }
 
 FORCE_INLINE int32x4_t vqrdmlshq_s32(int32x4_t a, int32x4_t b, int32x4_t c) {
+  vint64m2_t a_wide = __riscv_vwmulsu_vx_i64m2(a, (uint32_t)1 << 31, 4);
   vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c, 4);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 4);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 4);
-  return __riscv_vssub_vv_i32m1(a, bc_s, 4);
+  vint64m2_t abc_acc = __riscv_vsub_vv_i64m2(a_wide, bc_mul, 4);
+  return __riscv_vnclip_wx_i32m1(abc_acc, 31, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int16x8_t vmull_s8(int8x8_t a, int8x8_t b) {
@@ -1146,39 +1364,63 @@ FORCE_INLINE uint64x2_t vmull_u32(uint32x2_t a, uint32x2_t b) {
 // FORCE_INLINE poly16x8_t vmull_p8(poly8x8_t a, poly8x8_t b);
 
 FORCE_INLINE int16x8_t vmull_high_s8(int8x16_t a, int8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i16m2_i16m1(__riscv_vwmul_vv_i16m2(a, b, 16), 1);
+#else
   vint8mf2_t a_high = __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(a, 8, 16));
   vint8mf2_t b_high = __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(b, 8, 16));
   return __riscv_vwmul_vv_i16m1(a_high, b_high, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vmull_high_s16(int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(a, b, 8), 1);
+#else
   vint16mf2_t a_high = __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(a, 4, 8));
   vint16mf2_t b_high = __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(b, 4, 8));
   return __riscv_vwmul_vv_i32m1(a_high, b_high, 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vmull_high_s32(int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(a, b, 4), 1);
+#else
   vint32mf2_t a_high = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(a, 2, 4));
   vint32mf2_t b_high = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, 4));
   return __riscv_vwmul_vv_i64m1(a_high, b_high, 2);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vmull_high_u8(uint8x16_t a, uint8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vwmulu_vv_u16m2(a, b, 16), 1);
+#else
   vuint8mf2_t a_high = __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(a, 8, 16));
   vuint8mf2_t b_high = __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(b, 8, 16));
   return __riscv_vwmulu_vv_u16m1(a_high, b_high, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmull_high_u16(uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(a, b, 8), 1);
+#else
   vuint16mf2_t a_high = __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(a, 4, 8));
   vuint16mf2_t b_high = __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, 8));
   return __riscv_vwmulu_vv_u32m1(a_high, b_high, 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmull_high_u32(uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(a, b, 4), 1);
+#else
   vuint32mf2_t a_high = __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(a, 2, 4));
   vuint32mf2_t b_high = __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(b, 2, 4));
   return __riscv_vwmulu_vv_u64m1(a_high, b_high, 2);
+#endif
 }
 
 // FORCE_INLINE poly16x8_t vmull_high_p8(poly8x16_t a, poly8x16_t b);
@@ -1195,12 +1437,12 @@ FORCE_INLINE int64x2_t vqdmull_s32(int32x2_t a, int32x2_t b) {
 
 FORCE_INLINE int32_t vqdmullh_s16(int16_t a, int16_t b) {
   int32_t tmp = (int32_t)a * (int32_t)b;
-  return tmp > INT32_MAX / 2 ? INT32_MAX : tmp < INT32_MIN / 2 ? INT32_MIN : tmp * 2;
+  return sat_add_int32(tmp, tmp);
 }
 
 FORCE_INLINE int64_t vqdmulls_s32(int32_t a, int32_t b) {
   int64_t tmp = (int64_t)a * (int64_t)b;
-  return tmp > INT64_MAX / 2 ? INT64_MAX : tmp < INT64_MIN / 2 ? INT64_MIN : tmp * 2;
+  return sat_add_int64(tmp, tmp);
 }
 
 FORCE_INLINE int32x4_t vqdmull_high_s16(int16x8_t a, int16x8_t b) {
@@ -1292,39 +1534,69 @@ FORCE_INLINE uint64x2_t vmlal_u32(uint64x2_t a, uint32x2_t b, uint32x2_t c) {
 }
 
 FORCE_INLINE int16x8_t vmlal_high_s8(int16x8_t a, int8x16_t b, int8x16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_wide = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vget_v_i16m2_i16m1(__riscv_vwmacc_vv_i16m2(a_wide, b, c, 16), 1);
+#else
   vint8mf2_t b_high = __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(b, 8, 16));
   vint8mf2_t c_high = __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(c, 8, 16));
   return __riscv_vwmacc_vv_i16m1(a, b_high, c_high, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vmlal_high_s16(int32x4_t a, int16x8_t b, int16x8_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_wide = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmacc_vv_i32m2(a_wide, b, c, 8), 1);
+#else
   vint16mf2_t b_high = __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(b, 4, 8));
   vint16mf2_t c_high = __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(c, 4, 8));
   return __riscv_vwmacc_vv_i32m1(a, b_high, c_high, 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlal_high_s32(int64x2_t a, int32x4_t b, int32x4_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_wide = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmacc_vv_i64m2(a_wide, b, c, 4), 1);
+#else
   vint32mf2_t b_high = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, 4));
   vint32mf2_t c_high = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(c, 2, 4));
   return __riscv_vwmacc_vv_i64m1(a, b_high, c_high, 2);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vmlal_high_u8(uint16x8_t a, uint8x16_t b, uint8x16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_wide = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vwmaccu_vv_u16m2(a_wide, b, c, 16), 1);
+#else
   vuint8mf2_t b_high = __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(b, 8, 16));
   vuint8mf2_t c_high = __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(c, 8, 16));
   return __riscv_vwmaccu_vv_u16m1(a, b_high, c_high, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlal_high_u16(uint32x4_t a, uint16x8_t b, uint16x8_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_wide = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmaccu_vv_u32m2(a_wide, b, c, 8), 1);
+#else
   vuint16mf2_t b_high = __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, 8));
   vuint16mf2_t c_high = __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(c, 4, 8));
   return __riscv_vwmaccu_vv_u32m1(a, b_high, c_high, 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlal_high_u32(uint64x2_t a, uint32x4_t b, uint32x4_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_wide = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmaccu_vv_u64m2(a_wide, b, c, 4), 1);
+#else
   vuint32mf2_t b_high = __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(b, 2, 4));
   vuint32mf2_t c_high = __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(c, 2, 4));
   return __riscv_vwmaccu_vv_u64m1(a, b_high, c_high, 2);
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmlal_s16(int32x4_t a, int16x4_t b, int16x4_t c) {
@@ -1341,24 +1613,14 @@ FORCE_INLINE int64x2_t vqdmlal_s32(int64x2_t a, int32x2_t b, int32x2_t c) {
 
 FORCE_INLINE int32_t vqdmlalh_s16(int32_t a, int16_t b, int16_t c) {
   int32_t tmp = (int32_t)b * (int32_t)c;
-  tmp = tmp > INT32_MAX / 2 ? INT32_MAX : tmp < INT32_MIN / 2 ? INT32_MIN : tmp * 2;
-  if (a > 0 && tmp > INT32_MAX - a) {
-    return INT32_MAX;
-  } else if (a < 0 && tmp < INT32_MIN - a) {
-    return INT32_MIN;
-  }
-  return a + tmp;
+  tmp = sat_add_int32(tmp, tmp);
+  return sat_add_int32(a, tmp);
 }
 
 FORCE_INLINE int64_t vqdmlals_s32(int64_t a, int32_t b, int32_t c) {
   int64_t tmp = (int64_t)b * (int64_t)c;
-  tmp = tmp > INT64_MAX / 2 ? INT64_MAX : tmp < INT64_MIN / 2 ? INT64_MIN : tmp * 2;
-  if (a > 0 && tmp > INT64_MAX - a) {
-    return INT64_MAX;
-  } else if (a < 0 && tmp < INT64_MIN - a) {
-    return INT64_MIN;
-  }
-  return a + tmp;
+  tmp = sat_add_int64(tmp, tmp);
+  return sat_add_int64(a, tmp);
 }
 
 FORCE_INLINE int32x4_t vqdmlal_high_s16(int32x4_t a, int16x8_t b, int16x8_t c) {
@@ -1458,39 +1720,69 @@ FORCE_INLINE uint64x2_t vmlsl_u32(uint64x2_t a, uint32x2_t b, uint32x2_t c) {
 }
 
 FORCE_INLINE int16x8_t vmlsl_high_s8(int16x8_t a, int8x16_t b, int8x16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t bc_mul = __riscv_vget_v_i16m2_i16m1(__riscv_vwmul_vv_i16m2(b, c, 16), 1);
+  return __riscv_vsub_vv_i16m1(a, bc_mul, 8);
+#else
   vint8mf2_t b_high = __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(b, 8, 16));
   vint8mf2_t c_high = __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(c, 8, 16));
   return __riscv_vsub_vv_i16m1(a, __riscv_vwmul_vv_i16m1(b_high, c_high, 8), 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vmlsl_high_s16(int32x4_t a, int16x8_t b, int16x8_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t bc_mul = __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(b, c, 8), 1);
+  return __riscv_vsub_vv_i32m1(a, bc_mul, 4);
+#else
   vint16mf2_t b_high = __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(b, 4, 8));
   vint16mf2_t c_high = __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(c, 4, 8));
   return __riscv_vsub_vv_i32m1(a, __riscv_vwmul_vv_i32m1(b_high, c_high, 4), 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlsl_high_s32(int64x2_t a, int32x4_t b, int32x4_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t bc_mul = __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(b, c, 4), 1);
+  return __riscv_vsub_vv_i64m1(a, bc_mul, 2);
+#else
   vint32mf2_t b_high = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, 4));
   vint32mf2_t c_high = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(c, 2, 4));
   return __riscv_vsub_vv_i64m1(a, __riscv_vwmul_vv_i64m1(b_high, c_high, 2), 2);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vmlsl_high_u8(uint16x8_t a, uint8x16_t b, uint8x16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t bc_mul = __riscv_vget_v_u16m2_u16m1(__riscv_vwmulu_vv_u16m2(b, c, 16), 1);
+  return __riscv_vsub_vv_u16m1(a, bc_mul, 8);
+#else
   vuint8mf2_t b_high = __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(b, 8, 16));
   vuint8mf2_t c_high = __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(c, 8, 16));
   return __riscv_vsub_vv_u16m1(a, __riscv_vwmulu_vv_u16m1(b_high, c_high, 8), 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlsl_high_u16(uint32x4_t a, uint16x8_t b, uint16x8_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t bc_mul = __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(b, c, 8), 1);
+  return __riscv_vsub_vv_u32m1(a, bc_mul, 4);
+#else
   vuint16mf2_t b_high = __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, 8));
   vuint16mf2_t c_high = __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(c, 4, 8));
   return __riscv_vsub_vv_u32m1(a, __riscv_vwmulu_vv_u32m1(b_high, c_high, 4), 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlsl_high_u32(uint64x2_t a, uint32x4_t b, uint32x4_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t bc_mul = __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(b, c, 4), 1);
+  return __riscv_vsub_vv_u64m1(a, bc_mul, 2);
+#else
   vuint32mf2_t b_high = __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(b, 2, 4));
   vuint32mf2_t c_high = __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(c, 2, 4));
   return __riscv_vsub_vv_u64m1(a, __riscv_vwmulu_vv_u64m1(b_high, c_high, 2), 2);
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmlsl_s16(int32x4_t a, int16x4_t b, int16x4_t c) {
@@ -1507,24 +1799,14 @@ FORCE_INLINE int64x2_t vqdmlsl_s32(int64x2_t a, int32x2_t b, int32x2_t c) {
 
 FORCE_INLINE int32_t vqdmlslh_s16(int32_t a, int16_t b, int16_t c) {
   int32_t tmp = (int32_t)b * (int32_t)c;
-  tmp = tmp > INT32_MAX / 2 ? INT32_MAX : tmp < INT32_MIN / 2 ? INT32_MIN : tmp * 2;
-  if (tmp > 0 && a < INT32_MIN + tmp) {
-    return INT32_MIN;
-  } else if (tmp < 0 && a > INT32_MAX + tmp) {
-    return INT32_MAX;
-  }
-  return a - tmp;
+  tmp = sat_add_int32(tmp, tmp);
+  return sat_sub_int32(a, tmp);
 }
 
 FORCE_INLINE int64_t vqdmlsls_s32(int64_t a, int32_t b, int32_t c) {
   int64_t tmp = (int64_t)b * (int64_t)c;
-  tmp = tmp > INT64_MAX / 2 ? INT64_MAX : tmp < INT64_MIN / 2 ? INT64_MIN : tmp * 2;
-  if (tmp > 0 && a < INT64_MIN + tmp) {
-    return INT64_MIN;
-  } else if (tmp < 0 && a > INT64_MAX + tmp) {
-    return INT64_MAX;
-  }
-  return a - tmp;
+  tmp = sat_add_int64(tmp, tmp);
+  return sat_sub_int64(a, tmp);
 }
 
 FORCE_INLINE int32x4_t vqdmlsl_high_s16(int32x4_t a, int16x8_t b, int16x8_t c) {
@@ -1842,39 +2124,63 @@ FORCE_INLINE uint64x2_t vsubl_u32(uint32x2_t a, uint32x2_t b) {
 }
 
 FORCE_INLINE int16x8_t vsubl_high_s8(int8x16_t a, int8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i16m2_i16m1(__riscv_vwsub_vv_i16m2(a, b, 16), 1);
+#else
   vint8m1_t a_high = __riscv_vslidedown_vx_i8m1(a, 8, 16);
   vint8m1_t b_high = __riscv_vslidedown_vx_i8m1(b, 8, 16);
   return __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vwsub_vv_i16m2(a_high, b_high, 8));
+#endif
 }
 
 FORCE_INLINE int32x4_t vsubl_high_s16(int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwsub_vv_i32m2(a, b, 8), 1);
+#else
   vint16m1_t a_high = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwsub_vv_i32m2(a_high, b_high, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vsubl_high_s32(int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwsub_vv_i64m2(a, b, 4), 1);
+#else
   vint32m1_t a_high = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwsub_vv_i64m2(a_high, b_high, 2));
+#endif
 }
 
 FORCE_INLINE uint16x8_t vsubl_high_u8(uint8x16_t a, uint8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vwsubu_vv_u16m2(a, b, 16), 1);
+#else
   vuint8m1_t a_high = __riscv_vslidedown_vx_u8m1(a, 8, 16);
   vuint8m1_t b_high = __riscv_vslidedown_vx_u8m1(b, 8, 16);
   return __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vwsubu_vv_u16m2(a_high, b_high, 8));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vsubl_high_u16(uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwsubu_vv_u32m2(a, b, 8), 1);
+#else
   vuint16m1_t a_high = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwsubu_vv_u32m2(a_high, b_high, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vsubl_high_u32(uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwsubu_vv_u64m2(a, b, 4), 1);
+#else
   vuint32m1_t a_high = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwsubu_vv_u64m2(a_high, b_high, 2));
+#endif
 }
 
 FORCE_INLINE int16x8_t vsubw_s8(int16x8_t a, int8x8_t b) {
@@ -1905,36 +2211,66 @@ FORCE_INLINE uint64x2_t vsubw_u32(uint64x2_t a, uint32x2_t b) {
 }
 
 FORCE_INLINE int16x8_t vsubw_high_s8(int16x8_t a, int8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_wide = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vget_v_i16m2_i16m1(__riscv_vwsub_wv_i16m2(a_wide, b, 16), 1);
+#else
   vint8m1_t b_high = __riscv_vslidedown_vx_i8m1(b, 8, 16);
   return __riscv_vwmacc_vx_i16m1(a, -1, __riscv_vlmul_trunc_v_i8m1_i8mf2(b_high), 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vsubw_high_s16(int32x4_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_wide = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwsub_wv_i32m2(a_wide, b, 8), 1);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   return __riscv_vwmacc_vx_i32m1(a, -1, __riscv_vlmul_trunc_v_i16m1_i16mf2(b_high), 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vsubw_high_s32(int64x2_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_wide = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwsub_wv_i64m2(a_wide, b, 4), 1);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   return __riscv_vwmacc_vx_i64m1(a, -1, __riscv_vlmul_trunc_v_i32m1_i32mf2(b_high), 2);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vsubw_high_u8(uint16x8_t a, uint8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_wide = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vwsubu_wv_u16m2(a_wide, b, 16), 1);
+#else
   vuint8m1_t b_high = __riscv_vslidedown_vx_u8m1(b, 8, 16);
   vuint16m1_t b_ext = __riscv_vzext_vf2_u16m1(__riscv_vlmul_trunc_v_u8m1_u8mf2(b_high), 8);
   return __riscv_vsub_vv_u16m1(a, b_ext, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vsubw_high_u16(uint32x4_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_wide = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwsubu_wv_u32m2(a_wide, b, 8), 1);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   vuint32m1_t b_ext = __riscv_vzext_vf2_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(b_high), 4);
   return __riscv_vsub_vv_u32m1(a, b_ext, 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vsubw_high_u32(uint64x2_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_wide = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwsubu_wv_u64m2(a_wide, b, 4), 1);
+#else
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   vuint64m1_t b_ext = __riscv_vzext_vf2_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(b_high), 2);
   return __riscv_vsub_vv_u64m1(a, b_ext, 2);
+#endif
 }
 
 FORCE_INLINE int8x8_t vhsub_s8(int8x8_t a, int8x8_t b) { return __riscv_vasub_vv_i8m1(a, b, __RISCV_VXRM_RDN, 8); }
@@ -2054,39 +2390,75 @@ FORCE_INLINE uint32x2_t vsubhn_u64(uint64x2_t a, uint64x2_t b) {
 }
 
 FORCE_INLINE int8x16_t vsubhn_high_s16(int8x8_t r, int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t ab_sub = __riscv_vsub_vv_i16m1(a, b, 8);
+  vint16m2_t ab_sub_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(ab_sub), 1, ab_sub);
+  return __riscv_vnsra_wx_i8m1_mu(neon2rvv_high_half_b8(), r, ab_sub_hi, 8, 16);
+#else
   vint16m1_t ab_add = __riscv_vsub_vv_i16m1(a, b, 8);
   vint8m1_t addhn = __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vnsra_wx_i8mf2(ab_add, 8, 8));
   return __riscv_vslideup_vx_i8m1(r, addhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vsubhn_high_s32(int16x4_t r, int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t ab_sub = __riscv_vsub_vv_i32m1(a, b, 4);
+  vint32m2_t ab_sub_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(ab_sub), 1, ab_sub);
+  return __riscv_vnsra_wx_i16m1_mu(neon2rvv_high_half_b16(), r, ab_sub_hi, 16, 8);
+#else
   vint32m1_t ab_add = __riscv_vsub_vv_i32m1(a, b, 4);
   vint16m1_t addhn = __riscv_vlmul_ext_v_i16mf2_i16m1(__riscv_vnsra_wx_i16mf2(ab_add, 16, 4));
   return __riscv_vslideup_vx_i16m1(r, addhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vsubhn_high_s64(int32x2_t r, int64x2_t a, int64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t ab_sub = __riscv_vsub_vv_i64m1(a, b, 2);
+  vint64m2_t ab_sub_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(ab_sub), 1, ab_sub);
+  return __riscv_vnsra_wx_i32m1_mu(neon2rvv_high_half_b32(), r, ab_sub_hi, 32, 4);
+#else
   vint64m1_t ab_add = __riscv_vsub_vv_i64m1(a, b, 2);
   vint32m1_t addhn = __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vnsra_wx_i32mf2(ab_add, 32, 2));
   return __riscv_vslideup_vx_i32m1(r, addhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vsubhn_high_u16(uint8x8_t r, uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t ab_sub = __riscv_vsub_vv_u16m1(a, b, 8);
+  vuint16m2_t ab_sub_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(ab_sub), 1, ab_sub);
+  return __riscv_vnsrl_wx_u8m1_mu(neon2rvv_high_half_b8(), r, ab_sub_hi, 8, 16);
+#else
   vuint16m1_t ab_add = __riscv_vsub_vv_u16m1(a, b, 8);
   vuint8m1_t addhn = __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vnsrl_wx_u8mf2(ab_add, 8, 8));
   return __riscv_vslideup_vx_u8m1(r, addhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vsubhn_high_u32(uint16x4_t r, uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t ab_sub = __riscv_vsub_vv_u32m1(a, b, 4);
+  vuint32m2_t ab_sub_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(ab_sub), 1, ab_sub);
+  return __riscv_vnsrl_wx_u16m1_mu(neon2rvv_high_half_b16(), r, ab_sub_hi, 16, 8);
+#else
   vuint32m1_t ab_add = __riscv_vsub_vv_u32m1(a, b, 4);
   vuint16m1_t addhn = __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnsrl_wx_u16mf2(ab_add, 16, 4));
   return __riscv_vslideup_vx_u16m1(r, addhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vsubhn_high_u64(uint32x2_t r, uint64x2_t a, uint64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t ab_sub = __riscv_vsub_vv_u64m1(a, b, 2);
+  vuint64m2_t ab_sub_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(ab_sub), 1, ab_sub);
+  return __riscv_vnsrl_wx_u32m1_mu(neon2rvv_high_half_b32(), r, ab_sub_hi, 32, 4);
+#else
   vuint64m1_t ab_add = __riscv_vsub_vv_u64m1(a, b, 2);
   vuint32m1_t addhn = __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnsrl_wx_u32mf2(ab_add, 32, 2));
   return __riscv_vslideup_vx_u32m1(r, addhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vrsubhn_s16(int16x8_t a, int16x8_t b) {
@@ -2127,45 +2499,87 @@ FORCE_INLINE uint32x2_t vrsubhn_u64(uint64x2_t a, uint64x2_t b) {
 }
 
 FORCE_INLINE int8x16_t vrsubhn_high_s16(int8x8_t r, int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t ab_sub = __riscv_vsub_vv_i16m1(a, b, 8);
+  vint16m1_t sub_round = __riscv_vadd_vx_i16m1(ab_sub, 1 << 7, 8);
+  vint16m2_t sub_round_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(sub_round), 1, sub_round);
+  return __riscv_vnsra_wx_i8m1_mu(neon2rvv_high_half_b8(), r, sub_round_hi, 8, 16);
+#else
   vint16m1_t add_ab = __riscv_vsub_vv_i16m1(a, b, 8);
   vint16m1_t add_round = __riscv_vadd_vx_i16m1(add_ab, 1 << 7, 8);
   vint8m1_t subhn = __riscv_vnsra_wx_i8m1(__riscv_vlmul_ext_v_i16m1_i16m2(add_round), 8, 8);
   return __riscv_vslideup_vx_i8m1(r, subhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vrsubhn_high_s32(int16x4_t r, int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t ab_sub = __riscv_vsub_vv_i32m1(a, b, 4);
+  vint32m1_t sub_round = __riscv_vadd_vx_i32m1(ab_sub, 1 << 15, 4);
+  vint32m2_t sub_round_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(sub_round), 1, sub_round);
+  return __riscv_vnsra_wx_i16m1_mu(neon2rvv_high_half_b16(), r, sub_round_hi, 16, 8);
+#else
   vint32m1_t ab_sub = __riscv_vsub_vv_i32m1(a, b, 4);
   vint32m1_t sub_round = __riscv_vadd_vx_i32m1(ab_sub, 1 << 15, 4);
   vint16m1_t subhn = __riscv_vnsra_wx_i16m1(__riscv_vlmul_ext_v_i32m1_i32m2(sub_round), 16, 4);
   return __riscv_vslideup_vx_i16m1(r, subhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vrsubhn_high_s64(int32x2_t r, int64x2_t a, int64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t ab_sub = __riscv_vsub_vv_i64m1(a, b, 2);
+  vint64m1_t sub_round = __riscv_vadd_vx_i64m1(ab_sub, (int64_t)1 << 31, 2);
+  vint64m2_t sub_round_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(sub_round), 1, sub_round);
+  return __riscv_vnsra_wx_i32m1_mu(neon2rvv_high_half_b32(), r, sub_round_hi, 32, 4);
+#else
   vint64m1_t ab_sub = __riscv_vsub_vv_i64m1(a, b, 2);
   vint64m1_t sub_round = __riscv_vadd_vx_i64m1(ab_sub, (int64_t)1 << 31, 2);
   vint32m1_t subhn = __riscv_vnsra_wx_i32m1(__riscv_vlmul_ext_v_i64m1_i64m2(sub_round), 32, 2);
   return __riscv_vslideup_vx_i32m1(r, subhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vrsubhn_high_u16(uint8x8_t r, uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t ab_sub = __riscv_vsub_vv_u16m1(a, b, 8);
+  vuint16m1_t sub_round = __riscv_vadd_vx_u16m1(ab_sub, 1 << 7, 8);
+  vuint16m2_t sub_round_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(sub_round), 1, sub_round);
+  return __riscv_vnsrl_wx_u8m1_mu(neon2rvv_high_half_b8(), r, sub_round_hi, 8, 16);
+#else
   vuint16m1_t add_ab = __riscv_vsub_vv_u16m1(a, b, 8);
   vuint16m1_t add_round = __riscv_vadd_vx_u16m1(add_ab, 1 << 7, 8);
   vuint8m1_t subhn = __riscv_vnsrl_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(add_round), 8, 8);
   return __riscv_vslideup_vx_u8m1(r, subhn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vrsubhn_high_u32(uint16x4_t r, uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t ab_sub = __riscv_vsub_vv_u32m1(a, b, 4);
+  vuint32m1_t sub_round = __riscv_vadd_vx_u32m1(ab_sub, 1 << 15, 4);
+  vuint32m2_t sub_round_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(sub_round), 1, sub_round);
+  return __riscv_vnsrl_wx_u16m1_mu(neon2rvv_high_half_b16(), r, sub_round_hi, 16, 8);
+#else
   vuint32m1_t add_ab = __riscv_vsub_vv_u32m1(a, b, 4);
   vuint32m1_t add_round = __riscv_vadd_vx_u32m1(add_ab, 1 << 15, 4);
   vuint16m1_t subhn = __riscv_vnsrl_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(add_round), 16, 4);
   return __riscv_vslideup_vx_u16m1(r, subhn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vrsubhn_high_u64(uint32x2_t r, uint64x2_t a, uint64x2_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t ab_sub = __riscv_vsub_vv_u64m1(a, b, 2);
+  vuint64m1_t sub_round = __riscv_vadd_vx_u64m1(ab_sub, (int64_t)1 << 31, 2);
+  vuint64m2_t sub_round_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(sub_round), 1, sub_round);
+  return __riscv_vnsrl_wx_u32m1_mu(neon2rvv_high_half_b32(), r, sub_round_hi, 32, 4);
+#else
   vuint64m1_t add_ab = __riscv_vsub_vv_u64m1(a, b, 2);
   vuint64m1_t add_round = __riscv_vadd_vx_u64m1(add_ab, (int64_t)1 << 31, 2);
   vuint32m1_t subhn = __riscv_vnsrl_wx_u32m1(__riscv_vlmul_ext_v_u64m1_u64m2(add_round), 32, 2);
   return __riscv_vslideup_vx_u32m1(r, subhn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x8_t vceq_s8(int8x8_t a, int8x8_t b) {
@@ -3207,30 +3621,22 @@ FORCE_INLINE int64x2_t vqabsq_s64(int64x2_t a) {
 
 FORCE_INLINE int8_t vqabsb_s8(int8_t a) {
   int8_t mask = a >> 7;
-  int8_t a_xor = a ^ mask;
-  int8_t un_sat = a_xor - mask;
-  return (un_sat & 0x80) ? INT8_MAX : un_sat;
+  return sat_sub_int8(a ^ mask, mask);
 }
 
 FORCE_INLINE int16_t vqabsh_s16(int16_t a) {
   int16_t mask = a >> 15;
-  int16_t a_xor = a ^ mask;
-  int16_t un_sat = a_xor - mask;
-  return (un_sat & 0x8000) ? INT16_MAX : un_sat;
+  return sat_sub_int16(a ^ mask, mask);
 }
 
 FORCE_INLINE int32_t vqabss_s32(int32_t a) {
   int32_t mask = a >> 31;
-  int32_t a_xor = a ^ mask;
-  int32_t un_sat = a_xor - mask;
-  return (un_sat & 0x80000000) ? INT32_MAX : un_sat;
+  return sat_sub_int32(a ^ mask, mask);
 }
 
 FORCE_INLINE int64_t vqabsd_s64(int64_t a) {
   int64_t mask = a >> 63;
-  int64_t a_xor = a ^ mask;
-  int64_t un_sat = a_xor - mask;
-  return (un_sat & 0x8000000000000000) ? INT64_MAX : un_sat;
+  return sat_sub_int64(a ^ mask, mask);
 }
 
 FORCE_INLINE uint32x2_t vcage_f32(float32x2_t a, float32x2_t b) {
@@ -3621,6 +4027,12 @@ FORCE_INLINE uint64x2_t vabdl_u32(uint32x2_t a, uint32x2_t b) {
 }
 
 FORCE_INLINE int16x8_t vabdl_high_s8(int8x16_t a, int8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t ab_sub = __riscv_vget_v_i16m2_i16m1(__riscv_vwsub_vv_i16m2(a, b, 16), 1);
+  vint16m1_t sign_bit_mask = __riscv_vsra_vx_i16m1(ab_sub, 15, 8);
+  vint16m1_t ab_xor = __riscv_vxor_vv_i16m1(ab_sub, sign_bit_mask, 8);
+  return __riscv_vsub_vv_i16m1(ab_xor, sign_bit_mask, 8);
+#else
   vint8m1_t a_high = __riscv_vslidedown_vx_i8m1(a, 8, 16);
   vint8m1_t b_high = __riscv_vslidedown_vx_i8m1(b, 8, 16);
   vint16m1_t ab_sub =
@@ -3628,9 +4040,16 @@ FORCE_INLINE int16x8_t vabdl_high_s8(int8x16_t a, int8x16_t b) {
   vint16m1_t sign_bit_mask = __riscv_vsra_vx_i16m1(ab_sub, 15, 8);
   vint16m1_t ab_xor = __riscv_vxor_vv_i16m1(ab_sub, sign_bit_mask, 8);
   return __riscv_vsub_vv_i16m1(ab_xor, sign_bit_mask, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vabdl_high_s16(int16x8_t a, int16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t ab_sub = __riscv_vget_v_i32m2_i32m1(__riscv_vwsub_vv_i32m2(a, b, 8), 1);
+  vint32m1_t sign_bit_mask = __riscv_vsra_vx_i32m1(ab_sub, 31, 4);
+  vint32m1_t ab_xor = __riscv_vxor_vv_i32m1(ab_sub, sign_bit_mask, 4);
+  return __riscv_vsub_vv_i32m1(ab_xor, sign_bit_mask, 4);
+#else
   vint16m1_t a_high = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   vint32m1_t ab_sub =
@@ -3638,9 +4057,16 @@ FORCE_INLINE int32x4_t vabdl_high_s16(int16x8_t a, int16x8_t b) {
   vint32m1_t sign_bit_mask = __riscv_vsra_vx_i32m1(ab_sub, 31, 4);
   vint32m1_t ab_xor = __riscv_vxor_vv_i32m1(ab_sub, sign_bit_mask, 4);
   return __riscv_vsub_vv_i32m1(ab_xor, sign_bit_mask, 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vabdl_high_s32(int32x4_t a, int32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t ab_sub = __riscv_vget_v_i64m2_i64m1(__riscv_vwsub_vv_i64m2(a, b, 4), 1);
+  vint64m1_t sign_bit_mask = __riscv_vsra_vx_i64m1(ab_sub, 63, 2);
+  vint64m1_t ab_xor = __riscv_vxor_vv_i64m1(ab_sub, sign_bit_mask, 2);
+  return __riscv_vsub_vv_i64m1(ab_xor, sign_bit_mask, 2);
+#else
   vint32m1_t a_high = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   vint64m1_t ab_sub =
@@ -3648,9 +4074,15 @@ FORCE_INLINE int64x2_t vabdl_high_s32(int32x4_t a, int32x4_t b) {
   vint64m1_t sign_bit_mask = __riscv_vsra_vx_i64m1(ab_sub, 63, 4);
   vint64m1_t ab_xor = __riscv_vxor_vv_i64m1(ab_sub, sign_bit_mask, 4);
   return __riscv_vsub_vv_i64m1(ab_xor, sign_bit_mask, 4);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vabdl_high_u8(uint8x16_t a, uint8x16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m1_t ab_max = __riscv_vmaxu_vv_u8m1(a, b, 16);
+  vuint8m1_t ab_min = __riscv_vminu_vv_u8m1(a, b, 16);
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vwsubu_vv_u16m2(ab_max, ab_min, 16), 1);
+#else
   vuint8m1_t a_high = __riscv_vslidedown_vx_u8m1(a, 8, 16);
   vuint8m1_t b_high = __riscv_vslidedown_vx_u8m1(b, 8, 16);
   vuint16m1_t a_ext = __riscv_vzext_vf2_u16m1(__riscv_vlmul_trunc_v_u8m1_u8mf2(a_high), 8);
@@ -3659,9 +4091,15 @@ FORCE_INLINE uint16x8_t vabdl_high_u8(uint8x16_t a, uint8x16_t b) {
   vuint16m1_t ab_sub = __riscv_vsub_vv_u16m1(a_ext, b_ext, 8);
   vuint16m1_t ba_sub = __riscv_vsub_vv_u16m1(b_ext, a_ext, 8);
   return __riscv_vmerge_vvm_u16m1(ba_sub, ab_sub, a_gt_mask, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vabdl_high_u16(uint16x8_t a, uint16x8_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t ab_max = __riscv_vmaxu_vv_u16m1(a, b, 8);
+  vuint16m1_t ab_min = __riscv_vminu_vv_u16m1(a, b, 8);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwsubu_vv_u32m2(ab_max, ab_min, 8), 1);
+#else
   vuint16m1_t a_high = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   vuint32m1_t a_ext = __riscv_vzext_vf2_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(a_high), 4);
@@ -3670,9 +4108,15 @@ FORCE_INLINE uint32x4_t vabdl_high_u16(uint16x8_t a, uint16x8_t b) {
   vuint32m1_t ab_sub = __riscv_vsub_vv_u32m1(a_ext, b_ext, 4);
   vuint32m1_t ba_sub = __riscv_vsub_vv_u32m1(b_ext, a_ext, 4);
   return __riscv_vmerge_vvm_u32m1(ba_sub, ab_sub, a_gt_mask, 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vabdl_high_u32(uint32x4_t a, uint32x4_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t ab_max = __riscv_vmaxu_vv_u32m1(a, b, 4);
+  vuint32m1_t ab_min = __riscv_vminu_vv_u32m1(a, b, 4);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwsubu_vv_u64m2(ab_max, ab_min, 4), 1);
+#else
   vuint32m1_t a_high = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   vuint64m1_t a_ext = __riscv_vzext_vf2_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(a_high), 2);
@@ -3681,6 +4125,7 @@ FORCE_INLINE uint64x2_t vabdl_high_u32(uint32x4_t a, uint32x4_t b) {
   vuint64m1_t ab_sub = __riscv_vsub_vv_u64m1(a_ext, b_ext, 2);
   vuint64m1_t ba_sub = __riscv_vsub_vv_u64m1(b_ext, a_ext, 2);
   return __riscv_vmerge_vvm_u64m1(ba_sub, ab_sub, a_gt_mask, 2);
+#endif
 }
 
 FORCE_INLINE int8x8_t vaba_s8(int8x8_t a, int8x8_t b, int8x8_t c) {
@@ -3813,6 +4258,13 @@ FORCE_INLINE uint64x2_t vabal_u32(uint64x2_t a, uint32x2_t b, uint32x2_t c) {
 }
 
 FORCE_INLINE int16x8_t vabal_high_s8(int16x8_t a, int8x16_t b, int8x16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t bc_sub = __riscv_vget_v_i16m2_i16m1(__riscv_vwsub_vv_i16m2(b, c, 16), 1);
+  vint16m1_t sign_bit_mask = __riscv_vsra_vx_i16m1(bc_sub, 15, 8);
+  vint16m1_t bc_xor = __riscv_vxor_vv_i16m1(bc_sub, sign_bit_mask, 8);
+  vint16m1_t abs_diff = __riscv_vsub_vv_i16m1(bc_xor, sign_bit_mask, 8);
+  return __riscv_vadd_vv_i16m1(a, abs_diff, 8);
+#else
   vint8m1_t b_high = __riscv_vslidedown_vx_i8m1(b, 8, 16);
   vint8m1_t c_high = __riscv_vslidedown_vx_i8m1(c, 8, 16);
   vint16m1_t bc_sub = __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vwsub_vv_i16m2(b_high, c_high, 8));
@@ -3820,9 +4272,17 @@ FORCE_INLINE int16x8_t vabal_high_s8(int16x8_t a, int8x16_t b, int8x16_t c) {
   vint16m1_t bc_xor = __riscv_vxor_vv_i16m1(bc_sub, sign_bit_mask, 8);
   vint16m1_t abs_diff = __riscv_vsub_vv_i16m1(bc_xor, sign_bit_mask, 8);
   return __riscv_vadd_vv_i16m1(a, abs_diff, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vabal_high_s16(int32x4_t a, int16x8_t b, int16x8_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t bc_sub = __riscv_vget_v_i32m2_i32m1(__riscv_vwsub_vv_i32m2(b, c, 8), 1);
+  vint32m1_t sign_bit_mask = __riscv_vsra_vx_i32m1(bc_sub, 31, 4);
+  vint32m1_t bc_xor = __riscv_vxor_vv_i32m1(bc_sub, sign_bit_mask, 4);
+  vint32m1_t abs_diff = __riscv_vsub_vv_i32m1(bc_xor, sign_bit_mask, 4);
+  return __riscv_vadd_vv_i32m1(a, abs_diff, 4);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   vint16m1_t c_high = __riscv_vslidedown_vx_i16m1(c, 4, 8);
   vint32m1_t bc_sub = __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwsub_vv_i32m2(b_high, c_high, 4));
@@ -3830,9 +4290,17 @@ FORCE_INLINE int32x4_t vabal_high_s16(int32x4_t a, int16x8_t b, int16x8_t c) {
   vint32m1_t bc_xor = __riscv_vxor_vv_i32m1(bc_sub, sign_bit_mask, 4);
   vint32m1_t abs_diff = __riscv_vsub_vv_i32m1(bc_xor, sign_bit_mask, 4);
   return __riscv_vadd_vv_i32m1(a, abs_diff, 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vabal_high_s32(int64x2_t a, int32x4_t b, int32x4_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t bc_sub = __riscv_vget_v_i64m2_i64m1(__riscv_vwsub_vv_i64m2(b, c, 4), 1);
+  vint64m1_t sign_bit_mask = __riscv_vsra_vx_i64m1(bc_sub, 63, 2);
+  vint64m1_t bc_xor = __riscv_vxor_vv_i64m1(bc_sub, sign_bit_mask, 2);
+  vint64m1_t abs_diff = __riscv_vsub_vv_i64m1(bc_xor, sign_bit_mask, 2);
+  return __riscv_vadd_vv_i64m1(a, abs_diff, 2);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   vint32m1_t c_high = __riscv_vslidedown_vx_i32m1(c, 2, 4);
   vint64m1_t bc_sub = __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwsub_vv_i64m2(b_high, c_high, 2));
@@ -3840,33 +4308,55 @@ FORCE_INLINE int64x2_t vabal_high_s32(int64x2_t a, int32x4_t b, int32x4_t c) {
   vint64m1_t bc_xor = __riscv_vxor_vv_i64m1(bc_sub, sign_bit_mask, 2);
   vint64m1_t abs_diff = __riscv_vsub_vv_i64m1(bc_xor, sign_bit_mask, 2);
   return __riscv_vadd_vv_i64m1(a, abs_diff, 2);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vabal_high_u8(uint16x8_t a, uint8x16_t b, uint8x16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m1_t bc_max = __riscv_vmaxu_vv_u8m1(b, c, 16);
+  vuint8m1_t bc_min = __riscv_vminu_vv_u8m1(b, c, 16);
+  vuint16m1_t bc_sub = __riscv_vget_v_u16m2_u16m1(__riscv_vwsubu_vv_u16m2(bc_max, bc_min, 16), 1);
+  return __riscv_vadd_vv_u16m1(a, bc_sub, 8);
+#else
   vuint8m1_t b_high = __riscv_vslidedown_vx_u8m1(b, 8, 16);
   vuint8m1_t c_high = __riscv_vslidedown_vx_u8m1(c, 8, 16);
   vuint8m1_t bc_max = __riscv_vmaxu_vv_u8m1(b_high, c_high, 8);
   vuint8m1_t bc_min = __riscv_vminu_vv_u8m1(b_high, c_high, 8);
   vuint16m1_t bc_sub = __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vwsubu_vv_u16m2(bc_max, bc_min, 8));
   return __riscv_vadd_vv_u16m1(a, bc_sub, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vabal_high_u16(uint32x4_t a, uint16x8_t b, uint16x8_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t bc_max = __riscv_vmaxu_vv_u16m1(b, c, 8);
+  vuint16m1_t bc_min = __riscv_vminu_vv_u16m1(b, c, 8);
+  vuint32m1_t bc_sub = __riscv_vget_v_u32m2_u32m1(__riscv_vwsubu_vv_u32m2(bc_max, bc_min, 8), 1);
+  return __riscv_vadd_vv_u32m1(a, bc_sub, 4);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   vuint16m1_t c_high = __riscv_vslidedown_vx_u16m1(c, 4, 8);
   vuint16m1_t bc_max = __riscv_vmaxu_vv_u16m1(b_high, c_high, 4);
   vuint16m1_t bc_min = __riscv_vminu_vv_u16m1(b_high, c_high, 4);
   vuint32m1_t bc_sub = __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwsubu_vv_u32m2(bc_max, bc_min, 4));
   return __riscv_vadd_vv_u32m1(a, bc_sub, 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vabal_high_u32(uint64x2_t a, uint32x4_t b, uint32x4_t c) {
-  vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
-  vuint32m1_t c_high = __riscv_vslidedown_vx_u32m1(c, 2, 4);
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t bc_max = __riscv_vmaxu_vv_u32m1(b, c, 4);
+  vuint32m1_t bc_min = __riscv_vminu_vv_u32m1(b, c, 4);
+  vuint64m1_t bc_sub = __riscv_vget_v_u64m2_u64m1(__riscv_vwsubu_vv_u64m2(bc_max, bc_min, 4), 1);
+  return __riscv_vadd_vv_u64m1(a, bc_sub, 2);
+#else
+  vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
+  vuint32m1_t c_high = __riscv_vslidedown_vx_u32m1(c, 2, 4);
   vuint32m1_t bc_max = __riscv_vmaxu_vv_u32m1(b_high, c_high, 2);
   vuint32m1_t bc_min = __riscv_vminu_vv_u32m1(b_high, c_high, 2);
   vuint64m1_t bc_sub = __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwsubu_vv_u64m2(bc_max, bc_min, 2));
   return __riscv_vadd_vv_u64m1(a, bc_sub, 2);
+#endif
 }
 
 FORCE_INLINE int8x8_t vmax_s8(int8x8_t a, int8x8_t b) { return __riscv_vmax_vv_i8m1(a, b, 8); }
@@ -3875,7 +4365,15 @@ FORCE_INLINE int16x4_t vmax_s16(int16x4_t a, int16x4_t b) { return __riscv_vmax_
 
 FORCE_INLINE int32x2_t vmax_s32(int32x2_t a, int32x2_t b) { return __riscv_vmax_vv_i32m1(a, b, 2); }
 
-FORCE_INLINE float32x2_t vmax_f32(float32x2_t a, float32x2_t b) { return __riscv_vfmax_vv_f32m1(a, b, 2); }
+FORCE_INLINE float32x2_t vmax_f32(float32x2_t a, float32x2_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmax_vv_f32m1(a, b, 2);
+#else
+  vbool32_t mask = __riscv_vmand_mm_b32(__riscv_vmfeq_vv_f32m1_b32(a, a, 2), __riscv_vmfeq_vv_f32m1_b32(b, b, 2), 2);
+  float32x2_t max_res = __riscv_vfmax_vv_f32m1(a, b, 2);
+  return __riscv_vmerge_vvm_f32m1(vdup_n_f32(NAN), max_res, mask, 2);
+#endif
+}
 
 FORCE_INLINE uint8x8_t vmax_u8(uint8x8_t a, uint8x8_t b) { return __riscv_vmaxu_vv_u8m1(a, b, 8); }
 
@@ -3890,82 +4388,50 @@ FORCE_INLINE int16x8_t vmaxq_s16(int16x8_t a, int16x8_t b) { return __riscv_vmax
 FORCE_INLINE int32x4_t vmaxq_s32(int32x4_t a, int32x4_t b) { return __riscv_vmax_vv_i32m1(a, b, 4); }
 
 FORCE_INLINE float32x4_t vmaxq_f32(float32x4_t a, float32x4_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmax_vv_f32m1(a, b, 4);
+#else
   vbool32_t mask = __riscv_vmand_mm_b32(__riscv_vmfeq_vv_f32m1_b32(a, a, 4), __riscv_vmfeq_vv_f32m1_b32(b, b, 4), 4);
   float32x4_t max_res = __riscv_vfmax_vv_f32m1(a, b, 4);
   return __riscv_vmerge_vvm_f32m1(vdupq_n_f32(NAN), max_res, mask, 4);
+#endif
 }
 
-FORCE_INLINE float64x1_t vmax_f64(float64x1_t a, float64x1_t b) { return __riscv_vfmax_vv_f64m1(a, b, 1); }
+FORCE_INLINE float64x1_t vmax_f64(float64x1_t a, float64x1_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmax_vv_f64m1(a, b, 1);
+#else
+  vbool64_t mask = __riscv_vmand_mm_b64(__riscv_vmfeq_vv_f64m1_b64(a, a, 1), __riscv_vmfeq_vv_f64m1_b64(b, b, 1), 1);
+  float64x1_t max_res = __riscv_vfmax_vv_f64m1(a, b, 1);
+  return __riscv_vmerge_vvm_f64m1(vdup_n_f64(NAN), max_res, mask, 1);
+#endif
+}
 
 FORCE_INLINE float64x2_t vmaxq_f64(float64x2_t a, float64x2_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmax_vv_f64m1(a, b, 2);
+#else
   vbool64_t mask = __riscv_vmand_mm_b64(__riscv_vmfeq_vv_f64m1_b64(a, a, 2), __riscv_vmfeq_vv_f64m1_b64(b, b, 2), 2);
   float64x2_t max_res = __riscv_vfmax_vv_f64m1(a, b, 2);
   return __riscv_vmerge_vvm_f64m1(vdupq_n_f64(NAN), max_res, mask, 2);
+#endif
 }
 
-FORCE_INLINE float32x2_t vmaxnm_f32(float32x2_t a, float32x2_t b) {
-  vbool32_t a_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(a, a, 2);
-  vbool32_t b_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(b, b, 2);
-  float32x2_t a_replace = __riscv_vmerge_vvm_f32m1(b, a, a_non_nan_mask, 2);
-  float32x2_t b_replace = __riscv_vmerge_vvm_f32m1(a, b, b_non_nan_mask, 2);
-  return __riscv_vfmax_vv_f32m1(a_replace, b_replace, 2);
-}
+FORCE_INLINE float32x2_t vmaxnm_f32(float32x2_t a, float32x2_t b) { return __riscv_vfmax_vv_f32m1(a, b, 2); }
 
-FORCE_INLINE float32x4_t vmaxnmq_f32(float32x4_t a, float32x4_t b) {
-  vbool32_t a_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(a, a, 4);
-  vbool32_t b_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(b, b, 4);
-  float32x2_t a_replace = __riscv_vmerge_vvm_f32m1(b, a, a_non_nan_mask, 4);
-  float32x2_t b_replace = __riscv_vmerge_vvm_f32m1(a, b, b_non_nan_mask, 4);
-  return __riscv_vfmax_vv_f32m1(a_replace, b_replace, 4);
-}
+FORCE_INLINE float32x4_t vmaxnmq_f32(float32x4_t a, float32x4_t b) { return __riscv_vfmax_vv_f32m1(a, b, 4); }
 
-FORCE_INLINE float64x1_t vmaxnm_f64(float64x1_t a, float64x1_t b) {
-  vbool64_t a_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(a, a, 1);
-  vbool64_t b_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(b, b, 1);
-  float64x2_t a_replace = __riscv_vmerge_vvm_f64m1(b, a, a_non_nan_mask, 1);
-  float64x2_t b_replace = __riscv_vmerge_vvm_f64m1(a, b, b_non_nan_mask, 1);
-  return __riscv_vfmax_vv_f64m1(a_replace, b_replace, 1);
-}
+FORCE_INLINE float64x1_t vmaxnm_f64(float64x1_t a, float64x1_t b) { return __riscv_vfmax_vv_f64m1(a, b, 1); }
 
-FORCE_INLINE float64x2_t vmaxnmq_f64(float64x2_t a, float64x2_t b) {
-  vbool64_t a_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(a, a, 2);
-  vbool64_t b_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(b, b, 2);
-  float64x2_t a_replace = __riscv_vmerge_vvm_f64m1(b, a, a_non_nan_mask, 2);
-  float64x2_t b_replace = __riscv_vmerge_vvm_f64m1(a, b, b_non_nan_mask, 2);
-  return __riscv_vfmax_vv_f64m1(a_replace, b_replace, 2);
-}
+FORCE_INLINE float64x2_t vmaxnmq_f64(float64x2_t a, float64x2_t b) { return __riscv_vfmax_vv_f64m1(a, b, 2); }
 
-FORCE_INLINE float32x2_t vminnm_f32(float32x2_t a, float32x2_t b) {
-  vbool32_t a_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(a, a, 2);
-  vbool32_t b_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(b, b, 2);
-  float32x2_t a_replace = __riscv_vmerge_vvm_f32m1(b, a, a_non_nan_mask, 2);
-  float32x2_t b_replace = __riscv_vmerge_vvm_f32m1(a, b, b_non_nan_mask, 2);
-  return __riscv_vfmin_vv_f32m1(a_replace, b_replace, 2);
-}
+FORCE_INLINE float32x2_t vminnm_f32(float32x2_t a, float32x2_t b) { return __riscv_vfmin_vv_f32m1(a, b, 2); }
 
-FORCE_INLINE float32x4_t vminnmq_f32(float32x4_t a, float32x4_t b) {
-  vbool32_t a_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(a, a, 4);
-  vbool32_t b_non_nan_mask = __riscv_vmfeq_vv_f32m1_b32(b, b, 4);
-  float32x2_t a_replace = __riscv_vmerge_vvm_f32m1(b, a, a_non_nan_mask, 4);
-  float32x2_t b_replace = __riscv_vmerge_vvm_f32m1(a, b, b_non_nan_mask, 4);
-  return __riscv_vfmin_vv_f32m1(a_replace, b_replace, 4);
-}
+FORCE_INLINE float32x4_t vminnmq_f32(float32x4_t a, float32x4_t b) { return __riscv_vfmin_vv_f32m1(a, b, 4); }
 
-FORCE_INLINE float64x1_t vminnm_f64(float64x1_t a, float64x1_t b) {
-  vbool64_t a_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(a, a, 1);
-  vbool64_t b_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(b, b, 1);
-  float64x2_t a_replace = __riscv_vmerge_vvm_f64m1(b, a, a_non_nan_mask, 1);
-  float64x2_t b_replace = __riscv_vmerge_vvm_f64m1(a, b, b_non_nan_mask, 1);
-  return __riscv_vfmin_vv_f64m1(a_replace, b_replace, 1);
-}
+FORCE_INLINE float64x1_t vminnm_f64(float64x1_t a, float64x1_t b) { return __riscv_vfmin_vv_f64m1(a, b, 1); }
 
-FORCE_INLINE float64x2_t vminnmq_f64(float64x2_t a, float64x2_t b) {
-  vbool64_t a_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(a, a, 2);
-  vbool64_t b_non_nan_mask = __riscv_vmfeq_vv_f64m1_b64(b, b, 2);
-  float64x2_t a_replace = __riscv_vmerge_vvm_f64m1(b, a, a_non_nan_mask, 2);
-  float64x2_t b_replace = __riscv_vmerge_vvm_f64m1(a, b, b_non_nan_mask, 2);
-  return __riscv_vfmin_vv_f64m1(a_replace, b_replace, 2);
-}
+FORCE_INLINE float64x2_t vminnmq_f64(float64x2_t a, float64x2_t b) { return __riscv_vfmin_vv_f64m1(a, b, 2); }
 
 FORCE_INLINE uint8x16_t vmaxq_u8(uint8x16_t a, uint8x16_t b) { return __riscv_vmaxu_vv_u8m1(a, b, 16); }
 
@@ -3979,7 +4445,15 @@ FORCE_INLINE int16x4_t vmin_s16(int16x4_t a, int16x4_t b) { return __riscv_vmin_
 
 FORCE_INLINE int32x2_t vmin_s32(int32x2_t a, int32x2_t b) { return __riscv_vmin_vv_i32m1(a, b, 2); }
 
-FORCE_INLINE float32x2_t vmin_f32(float32x2_t a, float32x2_t b) { return __riscv_vfmin_vv_f32m1(a, b, 2); }
+FORCE_INLINE float32x2_t vmin_f32(float32x2_t a, float32x2_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmin_vv_f32m1(a, b, 2);
+#else
+  vbool32_t mask = __riscv_vmand_mm_b32(__riscv_vmfeq_vv_f32m1_b32(a, a, 2), __riscv_vmfeq_vv_f32m1_b32(b, b, 2), 2);
+  float32x2_t min_res = __riscv_vfmin_vv_f32m1(a, b, 2);
+  return __riscv_vmerge_vvm_f32m1(vdup_n_f32(NAN), min_res, mask, 2);
+#endif
+}
 
 FORCE_INLINE uint8x8_t vmin_u8(uint8x8_t a, uint8x8_t b) { return __riscv_vminu_vv_u8m1(a, b, 8); }
 
@@ -3994,17 +4468,33 @@ FORCE_INLINE int16x8_t vminq_s16(int16x8_t a, int16x8_t b) { return __riscv_vmin
 FORCE_INLINE int32x4_t vminq_s32(int32x4_t a, int32x4_t b) { return __riscv_vmin_vv_i32m1(a, b, 4); }
 
 FORCE_INLINE float32x4_t vminq_f32(float32x4_t a, float32x4_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmin_vv_f32m1(a, b, 4);
+#else
   vbool32_t mask = __riscv_vmand_mm_b32(__riscv_vmfeq_vv_f32m1_b32(a, a, 4), __riscv_vmfeq_vv_f32m1_b32(b, b, 4), 4);
   float32x4_t min_res = __riscv_vfmin_vv_f32m1(a, b, 4);
   return __riscv_vmerge_vvm_f32m1(vdupq_n_f32(NAN), min_res, mask, 4);
+#endif
 }
 
-FORCE_INLINE float64x1_t vmin_f64(float64x1_t a, float64x1_t b) { return __riscv_vfmin_vv_f64m1(a, b, 1); }
+FORCE_INLINE float64x1_t vmin_f64(float64x1_t a, float64x1_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmin_vv_f64m1(a, b, 1);
+#else
+  vbool64_t mask = __riscv_vmand_mm_b64(__riscv_vmfeq_vv_f64m1_b64(a, a, 1), __riscv_vmfeq_vv_f64m1_b64(b, b, 1), 1);
+  float64x1_t min_res = __riscv_vfmin_vv_f64m1(a, b, 1);
+  return __riscv_vmerge_vvm_f64m1(vdup_n_f64(NAN), min_res, mask, 1);
+#endif
+}
 
 FORCE_INLINE float64x2_t vminq_f64(float64x2_t a, float64x2_t b) {
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmin_vv_f64m1(a, b, 2);
+#else
   vbool64_t mask = __riscv_vmand_mm_b64(__riscv_vmfeq_vv_f64m1_b64(a, a, 2), __riscv_vmfeq_vv_f64m1_b64(b, b, 2), 2);
   float64x2_t min_res = __riscv_vfmin_vv_f64m1(a, b, 2);
   return __riscv_vmerge_vvm_f64m1(vdupq_n_f64(NAN), min_res, mask, 2);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vminq_u8(uint8x16_t a, uint8x16_t b) { return __riscv_vminu_vv_u8m1(a, b, 16); }
@@ -4651,27 +5141,49 @@ FORCE_INLINE uint64_t vpaddd_u64(uint64x2_t a) {
 }
 
 FORCE_INLINE float32_t vpadds_f32(float32x2_t a) {
-  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredosum_vs_f32m1_f32m1(a, __riscv_vfmv_v_f_f32m1(0, 2), 2));
+  float32x2_t a_swap = __riscv_vslidedown_vx_f32m1(a, 1, 2);
+  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfadd_vv_f32m1(a, a_swap, 1));
 }
 
 FORCE_INLINE float64_t vpaddd_f64(float64x2_t a) {
-  return __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredosum_vs_f64m1_f64m1(a, __riscv_vfmv_v_f_f64m1(0, 2), 2));
+  float64x2_t a_swap = __riscv_vslidedown_vx_f64m1(a, 1, 2);
+  return __riscv_vfmv_f_s_f64m1_f64(__riscv_vfadd_vv_f64m1(a, a_swap, 1));
 }
 
 FORCE_INLINE float32_t vpmaxs_f32(float32x2_t a) {
+#if !NEON2RVV_STRICT_NAN
   return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmax_vs_f32m1_f32m1(a, a, 2));
+#else
+  float32x2_t a_swap = __riscv_vslidedown_vx_f32m1(a, 1, 2);
+  return __riscv_vfmv_f_s_f32m1_f32(vmaxq_f32(a, a_swap));
+#endif
 }
 
 FORCE_INLINE float64_t vpmaxqd_f64(float64x2_t a) {
+#if !NEON2RVV_STRICT_NAN
   return __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredmax_vs_f64m1_f64m1(a, a, 2));
+#else
+  float64x2_t a_swap = __riscv_vslidedown_vx_f64m1(a, 1, 2);
+  return __riscv_vfmv_f_s_f64m1_f64(vmaxq_f64(a, a_swap));
+#endif
 }
 
 FORCE_INLINE float32_t vpmins_f32(float32x2_t a) {
+#if !NEON2RVV_STRICT_NAN
   return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmin_vs_f32m1_f32m1(a, a, 2));
+#else
+  float32x2_t a_swap = __riscv_vslidedown_vx_f32m1(a, 1, 2);
+  return __riscv_vfmv_f_s_f32m1_f32(vminq_f32(a, a_swap));
+#endif
 }
 
 FORCE_INLINE float64_t vpminqd_f64(float64x2_t a) {
+#if !NEON2RVV_STRICT_NAN
   return __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredmin_vs_f64m1_f64m1(a, a, 2));
+#else
+  float64x2_t a_swap = __riscv_vslidedown_vx_f64m1(a, 1, 2);
+  return __riscv_vfmv_f_s_f64m1_f64(vminq_f64(a, a_swap));
+#endif
 }
 
 // FORCE_INLINE float32_t vpmaxnms_f32(float32x2_t a);
@@ -4738,17 +5250,20 @@ FORCE_INLINE uint64_t vaddvq_u64(uint64x2_t a) {
   return __riscv_vmv_x_s_u64m1_u64(__riscv_vredsum_vs_u64m1_u64m1(a, vdupq_n_u64(0), 2));
 }
 
-FORCE_INLINE float32_t vaddv_f32(float32x2_t a) {
-  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredosum_vs_f32m1_f32m1(a, __riscv_vfmv_v_f_f32m1(0, 2), 2));
-}
+FORCE_INLINE float32_t vaddv_f32(float32x2_t a) { return vpadds_f32(a); }
 
 FORCE_INLINE float32_t vaddvq_f32(float32x4_t a) {
-  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredosum_vs_f32m1_f32m1(a, __riscv_vfmv_v_f_f32m1(0, 4), 4));
+#if !NEON2RVV_STRICT_REDUCTION
+  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredusum_vs_f32m1_f32m1(a, __riscv_vfmv_s_f_f32m1(-0.0f, 1), 4));
+#else
+  // (a0 + a1) + (a2 + a3), the same order as the two FADDP steps on AArch64
+  float32x4_t a_pair = __riscv_vfadd_vv_f32m1(a, __riscv_vslidedown_vx_f32m1(a, 1, 4), 4);
+  float32x4_t a_pair_high = __riscv_vslidedown_vx_f32m1(a_pair, 2, 4);
+  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfadd_vv_f32m1(a_pair, a_pair_high, 1));
+#endif
 }
 
-FORCE_INLINE float64_t vaddvq_f64(float64x2_t a) {
-  return __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredosum_vs_f64m1_f64m1(a, __riscv_vfmv_v_f_f64m1(0, 2), 2));
-}
+FORCE_INLINE float64_t vaddvq_f64(float64x2_t a) { return vpaddd_f64(a); }
 
 FORCE_INLINE int16_t vaddlv_s8(int8x8_t a) {
   return __riscv_vmv_x_s_i16m1_i16(__riscv_vwredsum_vs_i8m1_i16m1(a, vdup_n_s16(0), 8));
@@ -4846,25 +5361,18 @@ FORCE_INLINE uint32_t vmaxvq_u32(uint32x4_t a) {
   return __riscv_vmv_x_s_u32m1_u32(__riscv_vredmaxu_vs_u32m1_u32m1(a, vdupq_n_u32(0), 4));
 }
 
-FORCE_INLINE float32_t vmaxv_f32(float32x2_t a) {
-  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmax_vs_f32m1_f32m1(a, __riscv_vfmv_v_f_f32m1(-FLT_MAX, 2), 2));
-}
+FORCE_INLINE float32_t vmaxv_f32(float32x2_t a) { return vpmaxs_f32(a); }
 
 FORCE_INLINE float32_t vmaxvq_f32(float32x4_t a) {
-  uint8_t mask = __riscv_vmv_x_s_u8m1_u8(__riscv_vreinterpret_v_b32_u8m1(__riscv_vmfeq_vv_f32m1_b32(a, a, 4)));
-  if ((mask & 0b1111) != 0b1111) {
-    return NAN;
-  }
-  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmax_vs_f32m1_f32m1(a, __riscv_vfmv_v_f_f32m1(-FLT_MAX, 4), 4));
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmax_vs_f32m1_f32m1(a, a, 4));
+#else
+  float32x4_t a_pair = vmaxq_f32(a, __riscv_vslidedown_vx_f32m1(a, 1, 4));
+  return __riscv_vfmv_f_s_f32m1_f32(vmaxq_f32(a_pair, __riscv_vslidedown_vx_f32m1(a_pair, 2, 4)));
+#endif
 }
 
-FORCE_INLINE float64_t vmaxvq_f64(float64x2_t a) {
-  uint8_t mask = __riscv_vmv_x_s_u8m1_u8(__riscv_vreinterpret_v_b64_u8m1(__riscv_vmfeq_vv_f64m1_b64(a, a, 2)));
-  if ((mask & 0b11) != 0b11) {
-    return NAN;
-  }
-  return __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredmax_vs_f64m1_f64m1(a, __riscv_vfmv_v_f_f64m1(-DBL_MAX, 2), 2));
-}
+FORCE_INLINE float64_t vmaxvq_f64(float64x2_t a) { return vpmaxqd_f64(a); }
 
 FORCE_INLINE int8_t vminv_s8(int8x8_t a) {
   return __riscv_vmv_x_s_i8m1_i8(__riscv_vredmin_vs_i8m1_i8m1(a, vdup_n_s8(INT8_MAX), 8));
@@ -4914,25 +5422,18 @@ FORCE_INLINE uint32_t vminvq_u32(uint32x4_t a) {
   return __riscv_vmv_x_s_u32m1_u32(__riscv_vredminu_vs_u32m1_u32m1(a, vdupq_n_u32(UINT32_MAX), 4));
 }
 
-FORCE_INLINE float32_t vminv_f32(float32x2_t a) {
-  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmin_vs_f32m1_f32m1(a, __riscv_vfmv_v_f_f32m1(FLT_MAX, 2), 2));
-}
+FORCE_INLINE float32_t vminv_f32(float32x2_t a) { return vpmins_f32(a); }
 
 FORCE_INLINE float32_t vminvq_f32(float32x4_t a) {
-  uint8_t mask = __riscv_vmv_x_s_u8m1_u8(__riscv_vreinterpret_v_b32_u8m1(__riscv_vmfeq_vv_f32m1_b32(a, a, 4)));
-  if ((mask & 0b1111) != 0b1111) {
-    return NAN;
-  }
-  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmin_vs_f32m1_f32m1(a, __riscv_vfmv_v_f_f32m1(FLT_MAX, 4), 4));
+#if !NEON2RVV_STRICT_NAN
+  return __riscv_vfmv_f_s_f32m1_f32(__riscv_vfredmin_vs_f32m1_f32m1(a, a, 4));
+#else
+  float32x4_t a_pair = vminq_f32(a, __riscv_vslidedown_vx_f32m1(a, 1, 4));
+  return __riscv_vfmv_f_s_f32m1_f32(vminq_f32(a_pair, __riscv_vslidedown_vx_f32m1(a_pair, 2, 4)));
+#endif
 }
 
-FORCE_INLINE float64_t vminvq_f64(float64x2_t a) {
-  uint8_t mask = __riscv_vmv_x_s_u8m1_u8(__riscv_vreinterpret_v_b64_u8m1(__riscv_vmfeq_vv_f64m1_b64(a, a, 2)));
-  if ((mask & 0b11) != 0b11) {
-    return NAN;
-  }
-  return __riscv_vfmv_f_s_f64m1_f64(__riscv_vfredmin_vs_f64m1_f64m1(a, __riscv_vfmv_v_f_f64m1(DBL_MAX, 2), 2));
-}
+FORCE_INLINE float64_t vminvq_f64(float64x2_t a) { return vpminqd_f64(a); }
 
 FORCE_INLINE float32_t vmaxnmv_f32(float32x2_t a) {
   float32x2_t a_swap = __riscv_vslidedown_vx_f32m1(a, 1, 2);
@@ -4940,8 +5441,8 @@ FORCE_INLINE float32_t vmaxnmv_f32(float32x2_t a) {
 }
 
 FORCE_INLINE float32_t vmaxnmvq_f32(float32x4_t a) {
-  float32x2_t a_high = __riscv_vslidedown_vx_f32m1(a, 2, 4);
-  return vmaxnmv_f32(vmaxnm_f32(a, a_high));
+  float32x4_t a_pair = vmaxnmq_f32(a, __riscv_vslidedown_vx_f32m1(a, 1, 4));
+  return __riscv_vfmv_f_s_f32m1_f32(vmaxnmq_f32(a_pair, __riscv_vslidedown_vx_f32m1(a_pair, 2, 4)));
 }
 
 FORCE_INLINE float64_t vmaxnmvq_f64(float64x2_t a) {
@@ -4955,8 +5456,8 @@ FORCE_INLINE float32_t vminnmv_f32(float32x2_t a) {
 }
 
 FORCE_INLINE float32_t vminnmvq_f32(float32x4_t a) {
-  float32x2_t a_high = __riscv_vslidedown_vx_f32m1(a, 2, 4);
-  return vminnmv_f32(vminnm_f32(a, a_high));
+  float32x4_t a_pair = vminnmq_f32(a, __riscv_vslidedown_vx_f32m1(a, 1, 4));
+  return __riscv_vfmv_f_s_f32m1_f32(vminnmq_f32(a_pair, __riscv_vslidedown_vx_f32m1(a_pair, 2, 4)));
 }
 
 FORCE_INLINE float64_t vminnmvq_f64(float64x2_t a) {
@@ -5036,6 +5537,160 @@ FORCE_INLINE float32_t vrsqrtss_f32(float32_t a, float32_t b) { return (3.0 - a
 
 FORCE_INLINE float64_t vrsqrtsd_f64(float64_t a, float64_t b) { return (3.0 - a * b) / 2.0; }
 
+// The 64-bit register shifts take the signed low byte of each lane of 'b' as the shift count, and a negative count
+// shifts right. RVV shifts only look at the low 6 bits of the count, so counts of 64 or more are fixed up with masks.
+static inline vint64m1_t neon2rvv_shl_count_s64(vint64m1_t b, size_t vl) {
+  return __riscv_vsra_vx_i64m1(__riscv_vsll_vx_i64m1(b, 56, vl), 56, vl);
+}
+
+static inline vint64m1_t neon2rvv_shl_s64(vint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  vbool64_t out_mask = __riscv_vmsgt_vx_i64m1_b64(cnt, 63, vl);
+  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(cnt), vl);
+  vuint64m1_t rcnt = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vneg_v_i64m1(cnt, vl));
+  vint64m1_t shr = __riscv_vsra_vv_i64m1(a, __riscv_vminu_vx_u64m1(rcnt, 63, vl), vl);
+  vint64m1_t res = __riscv_vmerge_vvm_i64m1(shr, shl, left_mask, vl);
+  return __riscv_vmerge_vxm_i64m1(res, 0, out_mask, vl);
+}
+
+static inline vuint64m1_t neon2rvv_shl_u64(vuint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  // |cnt| >= 64
+  vbool64_t out_mask =
+      __riscv_vmsgtu_vx_u64m1_b64(__riscv_vreinterpret_v_i64m1_u64m1(__riscv_vadd_vx_i64m1(cnt, 63, vl)), 126, vl);
+  vuint64m1_t shl = __riscv_vsll_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(cnt), vl);
+  vuint64m1_t shr = __riscv_vsrl_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vneg_v_i64m1(cnt, vl)), vl);
+  vuint64m1_t res = __riscv_vmerge_vvm_u64m1(shr, shl, left_mask, vl);
+  return __riscv_vmerge_vxm_u64m1(res, 0, out_mask, vl);
+}
+
+static inline vint64m1_t neon2rvv_rshl_s64(vint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  // |cnt| >= 64, a rounding right shift by 64 or more is 0 for every signed input
+  vbool64_t out_mask =
+      __riscv_vmsgtu_vx_u64m1_b64(__riscv_vreinterpret_v_i64m1_u64m1(__riscv_vadd_vx_i64m1(cnt, 63, vl)), 126, vl);
+  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(cnt), vl);
+  vint64m1_t shr = __riscv_vssra_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vneg_v_i64m1(cnt, vl)),
+                                          __RISCV_VXRM_RNU, vl);
+  vint64m1_t res = __riscv_vmerge_vvm_i64m1(shr, shl, left_mask, vl);
+  return __riscv_vmerge_vxm_i64m1(res, 0, out_mask, vl);
+}
+
+static inline vuint64m1_t neon2rvv_rshl_u64(vuint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  vbool64_t out_mask =
+      __riscv_vmsgtu_vx_u64m1_b64(__riscv_vreinterpret_v_i64m1_u64m1(__riscv_vadd_vx_i64m1(cnt, 63, vl)), 126, vl);
+  // shifting right by exactly 64 still rounds the top bit in
+  vbool64_t half_mask = __riscv_vmseq_vx_i64m1_b64(cnt, -64, vl);
+  vuint64m1_t shl = __riscv_vsll_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(cnt), vl);
+  vuint64m1_t shr = __riscv_vssrl_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vneg_v_i64m1(cnt, vl)),
+                                           __RISCV_VXRM_RNU, vl);
+  vuint64m1_t res = __riscv_vmerge_vvm_u64m1(shr, shl, left_mask, vl);
+  res = __riscv_vmerge_vxm_u64m1(res, 0, out_mask, vl);
+  return __riscv_vmerge_vvm_u64m1(res, __riscv_vsrl_vx_u64m1(a, 63, vl), half_mask, vl);
+}
+
+// Saturating left shift. Counts above 63 are clamped to 63, which saturates every lane except 0 and -1, and -1 << 63
+// is already INT64_MIN.
+static inline vint64m1_t neon2rvv_qshl_left_s64(vint64m1_t a, vint64m1_t cnt, size_t vl) {
+  vuint64m1_t lcnt = __riscv_vminu_vx_u64m1(__riscv_vreinterpret_v_i64m1_u64m1(cnt), 63, vl);
+  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, lcnt, vl);
+  vbool64_t ovf_mask = __riscv_vmsne_vv_i64m1_b64(__riscv_vsra_vv_i64m1(shl, lcnt, vl), a, vl);
+  vint64m1_t sat = __riscv_vxor_vx_i64m1(__riscv_vsra_vx_i64m1(a, 63, vl), INT64_MAX, vl);
+  return __riscv_vmerge_vvm_i64m1(shl, sat, ovf_mask, vl);
+}
+
+// Saturating left shift. A lane overflows when it is above UINT64_MAX >> cnt, and only 0 fits a count above 63.
+static inline vuint64m1_t neon2rvv_qshl_left_u64(vuint64m1_t a, vint64m1_t cnt, size_t vl) {
+  vuint64m1_t lcnt = __riscv_vreinterpret_v_i64m1_u64m1(cnt);
+  vuint64m1_t limit = __riscv_vsrl_vv_u64m1(__riscv_vmv_v_x_u64m1(UINT64_MAX, vl), lcnt, vl);
+  limit = __riscv_vmerge_vxm_u64m1(limit, 0, __riscv_vmsgt_vx_i64m1_b64(cnt, 63, vl), vl);
+  vbool64_t ovf_mask = __riscv_vmsltu_vv_u64m1_b64(limit, a, vl);
+  return __riscv_vmerge_vxm_u64m1(__riscv_vsll_vv_u64m1(a, lcnt, vl), UINT64_MAX, ovf_mask, vl);
+}
+
+static inline vint64m1_t neon2rvv_qshl_s64(vint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  vint64m1_t shl = neon2rvv_qshl_left_s64(a, cnt, vl);
+  vuint64m1_t rcnt = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vneg_v_i64m1(cnt, vl));
+  vint64m1_t shr = __riscv_vsra_vv_i64m1(a, __riscv_vminu_vx_u64m1(rcnt, 63, vl), vl);
+  return __riscv_vmerge_vvm_i64m1(shr, shl, left_mask, vl);
+}
+
+static inline vuint64m1_t neon2rvv_qshl_u64(vuint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  vbool64_t out_mask = __riscv_vmslt_vx_i64m1_b64(cnt, -63, vl);
+  vuint64m1_t shl = neon2rvv_qshl_left_u64(a, cnt, vl);
+  vuint64m1_t shr = __riscv_vsrl_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vneg_v_i64m1(cnt, vl)), vl);
+  vuint64m1_t res = __riscv_vmerge_vvm_u64m1(shr, shl, left_mask, vl);
+  return __riscv_vmerge_vxm_u64m1(res, 0, out_mask, vl);
+}
+
+static inline vint64m1_t neon2rvv_qrshl_s64(vint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  vint64m1_t shl = neon2rvv_qshl_left_s64(a, cnt, vl);
+  // the rounding right shift takes care of counts below -63
+  vint64m1_t shr = neon2rvv_rshl_s64(a, cnt, vl);
+  return __riscv_vmerge_vvm_i64m1(shr, shl, left_mask, vl);
+}
+
+static inline vuint64m1_t neon2rvv_qrshl_u64(vuint64m1_t a, vint64m1_t b, size_t vl) {
+  vint64m1_t cnt = neon2rvv_shl_count_s64(b, vl);
+  vbool64_t left_mask = __riscv_vmsge_vx_i64m1_b64(cnt, 0, vl);
+  vuint64m1_t shl = neon2rvv_qshl_left_u64(a, cnt, vl);
+  vuint64m1_t shr = neon2rvv_rshl_u64(a, cnt, vl);
+  return __riscv_vmerge_vvm_u64m1(shr, shl, left_mask, vl);
+}
+
+// The scalar saturating register shifts take the signed low byte of b as the count, like the vector forms, and use
+// min/max clamps and selects instead of branches. A left shift saturates when shifting back does not give a again, as
+// in vqshld_n_s64. A right shift by n is done as a shift by n - 1 and then by 1, so n = 64 needs no special case, and
+// the rounding forms add the last bit shifted out. Narrower elements are shifted as 64-bit values and then clamped,
+// which gives the same result.
+static inline int64_t neon2rvv_shift_count(int64_t cnt, int64_t lo, int64_t hi) {
+  cnt = cnt < hi ? cnt : hi;
+  return cnt > lo ? cnt : lo;
+}
+
+static inline int64_t neon2rvv_qshld_s64(int64_t a, int64_t b) {
+  int64_t cnt = (int8_t)b;
+  int64_t lcnt = neon2rvv_shift_count(cnt, 0, 63);
+  int64_t shl = (int64_t)((uint64_t)a << lcnt);
+  int64_t left = (shl >> lcnt) == a ? shl : (a >> 63) ^ INT64_MAX;
+  return cnt >= 0 ? left : a >> neon2rvv_shift_count(-cnt, 0, 63);
+}
+
+static inline uint64_t neon2rvv_qshld_u64(uint64_t a, int64_t b) {
+  int64_t cnt = (int8_t)b;
+  int64_t lcnt = neon2rvv_shift_count(cnt, 0, 63);
+  // only 0 fits a count above 63
+  uint64_t limit = cnt > 63 ? 0 : UINT64_MAX >> lcnt;
+  uint64_t left = (a << lcnt) | -(uint64_t)(a > limit);
+  return cnt >= 0 ? left : (a >> (neon2rvv_shift_count(-cnt, 1, 64) - 1)) >> 1;
+}
+
+// a signed value shifted right by 64 or more rounds to 0
+static inline int64_t neon2rvv_qrshld_s64(int64_t a, int64_t b) {
+  int64_t cnt = (int8_t)b;
+  int64_t t = a >> (neon2rvv_shift_count(-cnt, 1, 64) - 1);
+  return cnt >= 0 ? neon2rvv_qshld_s64(a, b) : (t >> 1) + (t & 1);
+}
+
+// an unsigned value shifted right by 64 rounds to its top bit, and by more to 0
+static inline uint64_t neon2rvv_qrshld_u64(uint64_t a, int64_t b) {
+  int64_t cnt = (int8_t)b;
+  uint64_t t = a >> (neon2rvv_shift_count(-cnt, 1, 64) - 1);
+  uint64_t right = cnt < -64 ? 0 : (t >> 1) + (t & 1);
+  return cnt >= 0 ? neon2rvv_qshld_u64(a, b) : right;
+}
+
 FORCE_INLINE int8x8_t vshl_s8(int8x8_t a, int8x8_t b) {
   // implementation only works within defined range 'b' in [0, 7]
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 8);
@@ -5066,14 +5721,7 @@ FORCE_INLINE int32x2_t vshl_s32(int32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE int64x1_t vshl_s64(int64x1_t a, int64x1_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t positive_mask = __riscv_vmsgt_vx_i64m1_b64(b, 0, 1);
-  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 1);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 1);
-  vint64m1_t shr = __riscv_vsra_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 1);
-  return __riscv_vmerge_vvm_i64m1(shr, shl, positive_mask, 1);
-}
+FORCE_INLINE int64x1_t vshl_s64(int64x1_t a, int64x1_t b) { return neon2rvv_shl_s64(a, b, 1); }
 
 FORCE_INLINE uint8x8_t vshl_u8(uint8x8_t a, int8x8_t b) {
   // implementation only works within defined range 'b' in [0, 7]
@@ -5105,14 +5753,7 @@ FORCE_INLINE uint32x2_t vshl_u32(uint32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE uint64x1_t vshl_u64(uint64x1_t a, int64x1_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t positive_mask = __riscv_vmsgt_vx_i64m1_b64(b, 0, 1);
-  vuint64m1_t shl = __riscv_vsll_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 1);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 1);
-  vuint64m1_t shr = __riscv_vsrl_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 1);
-  return __riscv_vmerge_vvm_u64m1(shr, shl, positive_mask, 1);
-}
+FORCE_INLINE uint64x1_t vshl_u64(uint64x1_t a, int64x1_t b) { return neon2rvv_shl_u64(a, b, 1); }
 
 FORCE_INLINE int8x16_t vshlq_s8(int8x16_t a, int8x16_t b) {
   // implementation only works within defined range 'b' in [0, 7]
@@ -5144,14 +5785,7 @@ FORCE_INLINE int32x4_t vshlq_s32(int32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 4);
 }
 
-FORCE_INLINE int64x2_t vshlq_s64(int64x2_t a, int64x2_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t positive_mask = __riscv_vmsgt_vx_i64m1_b64(b, 0, 2);
-  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 2);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 2);
-  vint64m1_t shr = __riscv_vsra_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 2);
-  return __riscv_vmerge_vvm_i64m1(shr, shl, positive_mask, 2);
-}
+FORCE_INLINE int64x2_t vshlq_s64(int64x2_t a, int64x2_t b) { return neon2rvv_shl_s64(a, b, 2); }
 
 FORCE_INLINE uint8x16_t vshlq_u8(uint8x16_t a, int8x16_t b) {
   // implementation only works within defined range 'b' in [0, 7]
@@ -5183,14 +5817,7 @@ FORCE_INLINE uint32x4_t vshlq_u32(uint32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 4);
 }
 
-FORCE_INLINE uint64x2_t vshlq_u64(uint64x2_t a, int64x2_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t positive_mask = __riscv_vmsgt_vx_i64m1_b64(b, 0, 2);
-  vuint64m1_t shl = __riscv_vsll_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 2);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 2);
-  vuint64m1_t shr = __riscv_vsrl_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 2);
-  return __riscv_vmerge_vvm_u64m1(shr, shl, positive_mask, 2);
-}
+FORCE_INLINE uint64x2_t vshlq_u64(uint64x2_t a, int64x2_t b) { return neon2rvv_shl_u64(a, b, 2); }
 
 FORCE_INLINE int64_t vshld_s64(int64_t a, int64_t b) {
   if (b < 0) {
@@ -5235,17 +5862,7 @@ FORCE_INLINE int32x2_t vrshl_s32(int32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE int64x1_t vrshl_s64(int64x1_t a, int64x1_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t non_neg_mask = __riscv_vmsge_vx_i64m1_b64(b, 0, 1);
-  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 1);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 1);
-  vint64m1_t round_const = __riscv_vsll_vv_i64m1(
-      vdup_n_s64(1), __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vsub_vx_i64m1(__riscv_vneg_v_i64m1(b, 1), 1, 1)), 1);
-  vint64m1_t a_round = __riscv_vadd_vv_i64m1(a, round_const, 1);
-  vint64m1_t shr = __riscv_vsra_vv_i64m1((a_round), __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 1);
-  return __riscv_vmerge_vvm_i64m1(shr, shl, non_neg_mask, 1);
-}
+FORCE_INLINE int64x1_t vrshl_s64(int64x1_t a, int64x1_t b) { return neon2rvv_rshl_s64(a, b, 1); }
 
 FORCE_INLINE uint8x8_t vrshl_u8(uint8x8_t a, int8x8_t b) {
   // implementation only works within defined range 'b' in [0, 7]
@@ -5277,17 +5894,7 @@ FORCE_INLINE uint32x2_t vrshl_u32(uint32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE uint64x1_t vrshl_u64(uint64x1_t a, int64x1_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t non_neg_mask = __riscv_vmsge_vx_i64m1_b64(b, 0, 1);
-  vuint64m1_t shl = __riscv_vsll_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 1);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 1);
-  vuint64m1_t round_const = __riscv_vsll_vv_u64m1(
-      vdup_n_u64(1), __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vsub_vx_i64m1(__riscv_vneg_v_i64m1(b, 1), 1, 1)), 1);
-  vuint64m1_t a_round = __riscv_vadd_vv_u64m1(a, round_const, 1);
-  vuint64m1_t shr = __riscv_vsrl_vv_u64m1((a_round), __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 1);
-  return __riscv_vmerge_vvm_u64m1(shr, shl, non_neg_mask, 1);
-}
+FORCE_INLINE uint64x1_t vrshl_u64(uint64x1_t a, int64x1_t b) { return neon2rvv_rshl_u64(a, b, 1); }
 
 FORCE_INLINE int8x16_t vrshlq_s8(int8x16_t a, int8x16_t b) {
   // implementation only works within defined range 'b' in [0, 7]
@@ -5319,17 +5926,7 @@ FORCE_INLINE int32x4_t vrshlq_s32(int32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 4);
 }
 
-FORCE_INLINE int64x2_t vrshlq_s64(int64x2_t a, int64x2_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t non_neg_mask = __riscv_vmsge_vx_i64m1_b64(b, 0, 2);
-  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 2);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 2);
-  vint64m1_t round_const = __riscv_vsll_vv_i64m1(
-      vdupq_n_s64(1), __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vsub_vx_i64m1(__riscv_vneg_v_i64m1(b, 2), 1, 2)), 2);
-  vint64m1_t a_round = __riscv_vadd_vv_i64m1(a, round_const, 2);
-  vint64m1_t shr = __riscv_vsra_vv_i64m1((a_round), __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 2);
-  return __riscv_vmerge_vvm_i64m1(shr, shl, non_neg_mask, 2);
-}
+FORCE_INLINE int64x2_t vrshlq_s64(int64x2_t a, int64x2_t b) { return neon2rvv_rshl_s64(a, b, 2); }
 
 FORCE_INLINE uint8x16_t vrshlq_u8(uint8x16_t a, int8x16_t b) {
   // implementation only works within defined range 'b' in [0, 7]
@@ -5361,17 +5958,7 @@ FORCE_INLINE uint32x4_t vrshlq_u32(uint32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 4);
 }
 
-FORCE_INLINE uint64x2_t vrshlq_u64(uint64x2_t a, int64x2_t b) {
-  // implementation only works within defined range 'b' in [0, 63]
-  vbool64_t non_neg_mask = __riscv_vmsge_vx_i64m1_b64(b, 0, 2);
-  vuint64m1_t shl = __riscv_vsll_vv_u64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 2);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 2);
-  vuint64m1_t round_const = __riscv_vsll_vv_u64m1(
-      vdupq_n_u64(1), __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vsub_vx_i64m1(__riscv_vneg_v_i64m1(b, 2), 1, 2)), 2);
-  vuint64m1_t a_round = __riscv_vadd_vv_u64m1(a, round_const, 2);
-  vuint64m1_t shr = __riscv_vsrl_vv_u64m1((a_round), __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 2);
-  return __riscv_vmerge_vvm_u64m1(shr, shl, non_neg_mask, 2);
-}
+FORCE_INLINE uint64x2_t vrshlq_u64(uint64x2_t a, int64x2_t b) { return neon2rvv_rshl_u64(a, b, 2); }
 
 FORCE_INLINE int64_t vrshld_s64(int64_t a, int64_t b) {
   if (b < 0) {
@@ -5430,13 +6017,7 @@ FORCE_INLINE int32x2_t vqshl_s32(int32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE int64x1_t vqshl_s64(int64x1_t a, int64x1_t b) {
-  vbool64_t positive_mask = __riscv_vmsgt_vx_i64m1_b64(b, 0, 1);
-  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 1);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 1);
-  vint64m1_t shr = __riscv_vsra_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 1);
-  return __riscv_vmerge_vvm_i64m1(shr, shl, positive_mask, 1);
-}
+FORCE_INLINE int64x1_t vqshl_s64(int64x1_t a, int64x1_t b) { return neon2rvv_qshl_s64(a, b, 1); }
 
 FORCE_INLINE uint8x8_t vqshl_u8(uint8x8_t a, int8x8_t b) {
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 8);
@@ -5477,22 +6058,7 @@ FORCE_INLINE uint32x2_t vqshl_u32(uint32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE uint64x1_t vqshl_u64(uint64x1_t a, int64x1_t b) {
-  uint64_t _a = ((uint64_t *)&a)[0];
-  int64_t _b = ((int64_t *)&b)[0];
-  _b = _b % 8;
-  uint64_t _c;
-  if (_b < 0) {
-    _c = _a >> -_b;
-  } else {
-    if ((UINT64_MAX >> _b) < _a) {
-      _c = UINT64_MAX;
-    } else {
-      _c = (uint64_t)_a << _b;
-    }
-  }
-  return __riscv_vmv_v_x_u64m1(_c, 1);
-}
+FORCE_INLINE uint64x1_t vqshl_u64(uint64x1_t a, int64x1_t b) { return neon2rvv_qshl_u64(a, b, 1); }
 
 FORCE_INLINE int8x16_t vqshlq_s8(int8x16_t a, int8x16_t b) {
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 16);
@@ -5533,13 +6099,7 @@ FORCE_INLINE int32x4_t vqshlq_s32(int32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 4);
 }
 
-FORCE_INLINE int64x2_t vqshlq_s64(int64x2_t a, int64x2_t b) {
-  vbool64_t positive_mask = __riscv_vmsgt_vx_i64m1_b64(b, 0, 2);
-  vint64m1_t shl = __riscv_vsll_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b), 2);
-  vint64m1_t b_neg = __riscv_vneg_v_i64m1(b, 2);
-  vint64m1_t shr = __riscv_vsra_vv_i64m1(a, __riscv_vreinterpret_v_i64m1_u64m1(b_neg), 2);
-  return __riscv_vmerge_vvm_i64m1(shr, shl, positive_mask, 2);
-}
+FORCE_INLINE int64x2_t vqshlq_s64(int64x2_t a, int64x2_t b) { return neon2rvv_qshl_s64(a, b, 2); }
 
 FORCE_INLINE uint8x16_t vqshlq_u8(uint8x16_t a, int8x16_t b) {
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 16);
@@ -5580,151 +6140,32 @@ FORCE_INLINE uint32x4_t vqshlq_u32(uint32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 4);
 }
 
-FORCE_INLINE uint64x2_t vqshlq_u64(uint64x2_t a, int64x2_t b) {
-  uint64_t *_a = ((uint64_t *)&a);
-  int64_t *_b = ((int64_t *)&b);
-  uint64_t _c[2];
-  for (int i = 0; i < 2; i++) {
-    _b[i] = _b[i] % 8;
-    if (_b[i] < 0) {
-      _c[i] = _a[i] >> -_b[i];
-    } else {
-      if ((UINT64_MAX >> _b[i]) < _a[i]) {
-        _c[i] = UINT64_MAX;
-      } else {
-        _c[i] = (uint64_t)_a[i] << _b[i];
-      }
-    }
-  }
-  return __riscv_vle64_v_u64m1(_c, 2);
-}
-
-FORCE_INLINE int8_t vqshlb_s8(int8_t a, int8_t b) {
-  if (b < 0) {
-    return a >> -b;
-  }
+FORCE_INLINE uint64x2_t vqshlq_u64(uint64x2_t a, int64x2_t b) { return neon2rvv_qshl_u64(a, b, 2); }
 
-  int16_t tmp = a << b;
-  if (tmp > INT8_MAX) {
-    return (int8_t)INT8_MAX;
-  }
-  if (tmp < INT8_MIN) {
-    return (int8_t)INT8_MIN;
-  }
-  return (int8_t)tmp;
-}
+FORCE_INLINE int8_t vqshlb_s8(int8_t a, int8_t b) { return neon2rvv_saturate_int8(neon2rvv_qshld_s64(a, b)); }
 
-FORCE_INLINE int16_t vqshlh_s16(int16_t a, int16_t b) {
-  if (b < 0) {
-    return a >> -b;
-  }
-  int32_t tmp = a << b;
-  if (tmp > INT16_MAX) {
-    return (int16_t)INT16_MAX;
-  }
-  if (tmp < INT16_MIN) {
-    return (int16_t)INT16_MIN;
-  }
-  return (int16_t)tmp;
-}
+FORCE_INLINE int16_t vqshlh_s16(int16_t a, int16_t b) { return neon2rvv_saturate_int16(neon2rvv_qshld_s64(a, b)); }
 
-FORCE_INLINE int32_t vqshls_s32(int32_t a, int32_t b) {
-  if (b < 0) {
-    int32_t rshift = -b;
-    if (rshift >= 32) {
-      return (a < 0) ? -1 : 0;
-    }
-    return a >> rshift;
-  }
-  if (b >= 32) {
-    if (a > 0) {
-      return INT32_MAX;
-    }
-    if (a < 0) {
-      return INT32_MIN;
-    }
-    return 0;
-  }
-  int64_t tmp = ((int64_t)a) << b;
-  if (tmp > INT32_MAX) {
-    return INT32_MAX;
-  }
-  if (tmp < INT32_MIN) {
-    return INT32_MIN;
-  }
-  return (int32_t)tmp;
-}
+FORCE_INLINE int32_t vqshls_s32(int32_t a, int32_t b) { return neon2rvv_saturate_int32(neon2rvv_qshld_s64(a, b)); }
 
-FORCE_INLINE int64_t vqshld_s64(int64_t a, int64_t b) {
-  if (b < 0) {
-    int64_t rshift = -b;
-    if (rshift >= 64) {
-      return (a < 0) ? -1 : 0;
-    }
-    return a >> rshift;
-  }
-  if (b >= 64) {
-    if (a > 0) {
-      return INT64_MAX;
-    }
-    if (a < 0) {
-      return INT64_MIN;
-    }
-    return 0;
-  }
-  __int128 tmp = ((__int128)a) << b;
-  if (tmp > INT64_MAX) {
-    return INT64_MAX;
-  }
-  if (tmp < INT64_MIN) {
-    return INT64_MIN;
-  }
-  return (int64_t)tmp;
-}
+FORCE_INLINE int64_t vqshld_s64(int64_t a, int64_t b) { return neon2rvv_qshld_s64(a, b); }
 
 FORCE_INLINE uint8_t vqshlb_u8(uint8_t a, int8_t b) {
-  if (b < 0) {
-    return a >> -b;
-  }
-  if ((UINT8_MAX >> b) < a) {
-    return UINT8_MAX;
-  } else {
-    return a << b;
-  }
+  uint64_t r = neon2rvv_qshld_u64(a, b);
+  return (uint8_t)(r < UINT8_MAX ? r : UINT8_MAX);
 }
 
 FORCE_INLINE uint16_t vqshlh_u16(uint16_t a, int16_t b) {
-  if (b < 0) {
-    return a >> -b;
-  }
-  if ((UINT16_MAX >> b) < a) {
-    return UINT16_MAX;
-  } else {
-    return a << b;
-  }
+  uint64_t r = neon2rvv_qshld_u64(a, b);
+  return (uint16_t)(r < UINT16_MAX ? r : UINT16_MAX);
 }
 
 FORCE_INLINE uint32_t vqshls_u32(uint32_t a, int32_t b) {
-  if (b < 0) {
-    return a >> -b;
-  }
-  if ((UINT32_MAX >> b) < a) {
-    return UINT32_MAX;
-  } else {
-    return a << b;
-  }
+  uint64_t r = neon2rvv_qshld_u64(a, b);
+  return (uint32_t)(r < UINT32_MAX ? r : UINT32_MAX);
 }
 
-FORCE_INLINE uint64_t vqshld_u64(uint64_t a, int64_t b) {
-  if (b < 0) {
-    return a >> -b;
-  }
-  if ((UINT64_MAX >> b) < a) {
-    return UINT64_MAX;
-  } else {
-    return (uint64_t)a << b;
-  }
-}
+FORCE_INLINE uint64_t vqshld_u64(uint64_t a, int64_t b) { return neon2rvv_qshld_u64(a, b); }
 
 FORCE_INLINE int8x8_t vqrshl_s8(int8x8_t a, int8x8_t b) {
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 8);
@@ -5765,11 +6206,7 @@ FORCE_INLINE int32x2_t vqrshl_s32(int32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE int64x1_t vqrshl_s64(int64x1_t a, int64x1_t b) {
-  int64_t a0 = vget_lane_s64(a, 0);
-  int64_t b0 = vget_lane_s64(b, 0);
-  return vdup_n_s64(vqrshld_s64(a0, b0));
-}
+FORCE_INLINE int64x1_t vqrshl_s64(int64x1_t a, int64x1_t b) { return neon2rvv_qrshl_s64(a, b, 1); }
 
 FORCE_INLINE uint8x8_t vqrshl_u8(uint8x8_t a, int8x8_t b) {
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 8);
@@ -5810,11 +6247,7 @@ FORCE_INLINE uint32x2_t vqrshl_u32(uint32x2_t a, int32x2_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 2);
 }
 
-FORCE_INLINE uint64x1_t vqrshl_u64(uint64x1_t a, int64x1_t b) {
-  uint64_t a0 = vget_lane_u64(a, 0);
-  int64_t b0 = vget_lane_s64(b, 0);
-  return vdup_n_u64(vqrshld_u64(a0, b0));
-}
+FORCE_INLINE uint64x1_t vqrshl_u64(uint64x1_t a, int64x1_t b) { return neon2rvv_qrshl_u64(a, b, 1); }
 
 FORCE_INLINE int8x16_t vqrshlq_s8(int8x16_t a, int8x16_t b) {
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 16);
@@ -5855,7 +6288,7 @@ FORCE_INLINE int32x4_t vqrshlq_s32(int32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_i32m1(shr, shl, positive_mask, 4);
 }
 
-// FORCE_INLINE int64x2_t vqrshlq_s64(int64x2_t a, int64x2_t b);
+FORCE_INLINE int64x2_t vqrshlq_s64(int64x2_t a, int64x2_t b) { return neon2rvv_qrshl_s64(a, b, 2); }
 
 FORCE_INLINE uint8x16_t vqrshlq_u8(uint8x16_t a, int8x16_t b) {
   vbool8_t positive_mask = __riscv_vmsgt_vx_i8m1_b8(b, 0, 16);
@@ -5896,137 +6329,32 @@ FORCE_INLINE uint32x4_t vqrshlq_u32(uint32x4_t a, int32x4_t b) {
   return __riscv_vmerge_vvm_u32m1(shr, shl, positive_mask, 4);
 }
 
-// FORCE_INLINE uint64x2_t vqrshlq_u64(uint64x2_t a, int64x2_t b);
+FORCE_INLINE uint64x2_t vqrshlq_u64(uint64x2_t a, int64x2_t b) { return neon2rvv_qrshl_u64(a, b, 2); }
 
-FORCE_INLINE int8_t vqrshlb_s8(int8_t a, int8_t b) {
-  if (b < 0) {
-    return ((int16_t)a + (1 << (-b - 1))) >> (-b);
-  } else {
-    return vqshlb_s8(a, b);
-  }
-}
+FORCE_INLINE int8_t vqrshlb_s8(int8_t a, int8_t b) { return neon2rvv_saturate_int8(neon2rvv_qrshld_s64(a, b)); }
 
-FORCE_INLINE int16_t vqrshlh_s16(int16_t a, int16_t b) {
-  if (b < 0) {
-    return ((int32_t)a + (1 << (-b - 1))) >> (-b);
-  } else {
-    return vqshlh_s16(a, b);
-  }
-}
+FORCE_INLINE int16_t vqrshlh_s16(int16_t a, int16_t b) { return neon2rvv_saturate_int16(neon2rvv_qrshld_s64(a, b)); }
 
-FORCE_INLINE int32_t vqrshls_s32(int32_t a, int32_t b) {
-  if (b < 0) {
-    return ((int64_t)a + (1 << (-b - 1))) >> (-b);
-  } else {
-    return vqshls_s32(a, b);
-  }
-}
+FORCE_INLINE int32_t vqrshls_s32(int32_t a, int32_t b) { return neon2rvv_saturate_int32(neon2rvv_qrshld_s64(a, b)); }
 
-FORCE_INLINE int64_t vqrshld_s64(int64_t a, int64_t b) {
-  if (b < 0) {
-    if (b <= -64) {
-      return 0;
-    }
-    uint64_t b_neg = (uint64_t)(-b);
-    // Rounded arithmetic right shift without __int128:
-    // a = q * 2^n + r, where q = a >> n and r are low n bits of a.
-    // Add round-to-nearest increment (2^(n-1)) to r and carry into q.
-    int64_t q = a >> b_neg;
-    uint64_t mask = (UINT64_C(1) << b_neg) - 1;
-    uint64_t r = ((uint64_t)a) & mask;
-    uint64_t carry = (r + (UINT64_C(1) << (b_neg - 1))) >> b_neg;
-    return q + (int64_t)carry;
-  } else {
-    if (b >= 64) {
-      if (a > 0) {
-        return INT64_MAX;
-      }
-      if (a < 0) {
-        return INT64_MIN;
-      }
-      return 0;
-    }
-    return vqshld_s64(a, b);
-  }
-}
+FORCE_INLINE int64_t vqrshld_s64(int64_t a, int64_t b) { return neon2rvv_qrshld_s64(a, b); }
 
 FORCE_INLINE uint8_t vqrshlb_u8(uint8_t a, int8_t b) {
-  if (b < 0) {
-    if (b <= -8) {
-      return 0;
-    }
-    uint32_t b_neg = (uint32_t)(-b);
-    uint32_t q = (uint32_t)a >> b_neg;
-    uint32_t mask = (UINT32_C(1) << b_neg) - 1;
-    uint32_t r = (uint32_t)a & mask;
-    uint32_t carry = (r + (UINT32_C(1) << (b_neg - 1))) >> b_neg;
-    return (uint8_t)(q + carry);
-  } else {
-    if (b >= 8) {
-      return a == 0 ? 0 : UINT8_MAX;
-    }
-    return vqshlb_u8(a, b);
-  }
+  uint64_t r = neon2rvv_qrshld_u64(a, b);
+  return (uint8_t)(r < UINT8_MAX ? r : UINT8_MAX);
 }
 
 FORCE_INLINE uint16_t vqrshlh_u16(uint16_t a, int16_t b) {
-  if (b < 0) {
-    if (b <= -16) {
-      return 0;
-    }
-    uint32_t b_neg = (uint32_t)(-b);
-    uint32_t q = (uint32_t)a >> b_neg;
-    uint32_t mask = (UINT32_C(1) << b_neg) - 1;
-    uint32_t r = (uint32_t)a & mask;
-    uint32_t carry = (r + (UINT32_C(1) << (b_neg - 1))) >> b_neg;
-    return (uint16_t)(q + carry);
-  } else {
-    if (b >= 16) {
-      return a == 0 ? 0 : UINT16_MAX;
-    }
-    return vqshlh_u16(a, b);
-  }
+  uint64_t r = neon2rvv_qrshld_u64(a, b);
+  return (uint16_t)(r < UINT16_MAX ? r : UINT16_MAX);
 }
 
 FORCE_INLINE uint32_t vqrshls_u32(uint32_t a, int32_t b) {
-  if (b < 0) {
-    if (b <= -32) {
-      return 0;
-    }
-    uint64_t b_neg = (uint64_t)(-b);
-    uint64_t q = (uint64_t)a >> b_neg;
-    uint64_t mask = (UINT64_C(1) << b_neg) - 1;
-    uint64_t r = (uint64_t)a & mask;
-    uint64_t carry = (r + (UINT64_C(1) << (b_neg - 1))) >> b_neg;
-    return (uint32_t)(q + carry);
-  } else {
-    if (b >= 32) {
-      return a == 0 ? 0 : UINT32_MAX;
-    }
-    return vqshls_u32(a, b);
-  }
+  uint64_t r = neon2rvv_qrshld_u64(a, b);
+  return (uint32_t)(r < UINT32_MAX ? r : UINT32_MAX);
 }
 
-FORCE_INLINE uint64_t vqrshld_u64(uint64_t a, int64_t b) {
-  if (b < 0) {
-    if (b <= -64) {
-      return 0;
-    }
-    uint64_t b_neg = (uint64_t)(-b);
-    // Rounded logical right shift without __uint128_t:
-    // split into quotient/remainder at 2^n and propagate rounding carry.
-    uint64_t q = a >> b_neg;
-    uint64_t mask = (UINT64_C(1) << b_neg) - 1;
-    uint64_t r = a & mask;
-    uint64_t carry = (r + (UINT64_C(1) << (b_neg - 1))) >> b_neg;
-    return q + carry;
-  } else {
-    if (b >= 64) {
-      return a == 0 ? 0 : UINT64_MAX;
-    }
-    return vqshld_u64(a, b);
-  }
-}
+FORCE_INLINE uint64_t vqrshld_u64(uint64_t a, int64_t b) { return neon2rvv_qrshld_u64(a, b); }
 
 FORCE_INLINE int8x8_t vshr_n_s8(int8x8_t a, const int b) {
   const int imm = b - (b >> 3);
@@ -6248,36 +6576,66 @@ FORCE_INLINE uint32x2_t vshrn_n_u64(uint64x2_t a, const int b) {
 }
 
 FORCE_INLINE int8x16_t vshrn_high_n_s16(int8x8_t r, int16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vnsra_wx_i8m1_mu(neon2rvv_high_half_b8(), r, a_hi, n, 16);
+#else
   vint8m1_t shrn_n = __riscv_vreinterpret_v_u8m1_i8m1(
       __riscv_vnsrl_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(__riscv_vreinterpret_v_i16m1_u16m1(a)), n, 8));
   return __riscv_vslideup_vx_i8m1(r, shrn_n, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vshrn_high_n_s32(int16x4_t r, int32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vnsra_wx_i16m1_mu(neon2rvv_high_half_b16(), r, a_hi, n, 8);
+#else
   vint16m1_t shrn_n = __riscv_vreinterpret_v_u16m1_i16m1(
       __riscv_vnsrl_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vreinterpret_v_i32m1_u32m1(a)), n, 4));
   return __riscv_vslideup_vx_i16m1(r, shrn_n, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vshrn_high_n_s64(int32x2_t r, int64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vnsra_wx_i32m1_mu(neon2rvv_high_half_b32(), r, a_hi, n, 4);
+#else
   vint32m1_t shrn_n = __riscv_vreinterpret_v_u32m1_i32m1(
       __riscv_vnsrl_wx_u32m1(__riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vreinterpret_v_i64m1_u64m1(a)), n, 2));
   return __riscv_vslideup_vx_i32m1(r, shrn_n, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vshrn_high_n_u16(uint8x8_t r, uint16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vnsrl_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_hi, n, 16);
+#else
   vuint8m1_t shrn_n = __riscv_vnsrl_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(a), n, 8);
   return __riscv_vslideup_vx_u8m1(r, shrn_n, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vshrn_high_n_u32(uint16x4_t r, uint32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vnsrl_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_hi, n, 8);
+#else
   vuint16m1_t shrn_n = __riscv_vnsrl_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(a), n, 4);
   return __riscv_vslideup_vx_u16m1(r, shrn_n, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vshrn_high_n_u64(uint32x2_t r, uint64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vnsrl_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_hi, n, 4);
+#else
   vuint32m1_t shrn_n = __riscv_vnsrl_wx_u32m1(__riscv_vlmul_ext_v_u64m1_u64m2(a), n, 2);
   return __riscv_vslideup_vx_u32m1(r, shrn_n, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vrshrn_n_s16(int16x8_t a, const int b) {
@@ -6313,43 +6671,81 @@ FORCE_INLINE uint32x2_t vrshrn_n_u64(uint64x2_t a, const int b) {
 }
 
 FORCE_INLINE int8x16_t vrshrn_high_n_s16(int8x8_t r, int16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t a_round = __riscv_vadd_vx_i16m1(a, 1 << (n - 1), 8);
+  vint16m2_t a_round_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a_round), 1, a_round);
+  return __riscv_vnsra_wx_i8m1_mu(neon2rvv_high_half_b8(), r, a_round_hi, n, 16);
+#else
   vuint16m1_t a_round = __riscv_vadd_vx_u16m1(__riscv_vreinterpret_v_i16m1_u16m1(a), 1 << (n - 1), 8);
   vint8m1_t vrshrn =
       __riscv_vreinterpret_v_u8m1_i8m1(__riscv_vnsrl_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(a_round), n, 8));
   return __riscv_vslideup_vx_i8m1(r, vrshrn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vrshrn_high_n_s32(int16x4_t r, int32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t a_round = __riscv_vadd_vx_i32m1(a, 1 << (n - 1), 4);
+  vint32m2_t a_round_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a_round), 1, a_round);
+  return __riscv_vnsra_wx_i16m1_mu(neon2rvv_high_half_b16(), r, a_round_hi, n, 8);
+#else
   vuint32m1_t a_round = __riscv_vadd_vx_u32m1(__riscv_vreinterpret_v_i32m1_u32m1(a), 1 << (n - 1), 4);
   vint16m1_t vrshrn =
       __riscv_vreinterpret_v_u16m1_i16m1(__riscv_vnsrl_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(a_round), n, 4));
   return __riscv_vslideup_vx_i16m1(r, vrshrn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vrshrn_high_n_s64(int32x2_t r, int64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t sra = __riscv_vsra_vx_i64m1(a, n - 1, 2);
+  vint64m1_t sra_round = __riscv_vadd_vv_i64m1(sra, __riscv_vand_vx_i64m1(sra, 1, 2), 2);
+  vint64m2_t sra_round_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(sra_round), 1, sra_round);
+  return __riscv_vnsra_wx_i32m1_mu(neon2rvv_high_half_b32(), r, sra_round_hi, 1, 4);
+#else
   vint64m1_t sra = __riscv_vsra_vx_i64m1(a, n - 1, 2);
   vint64m1_t sra_round = __riscv_vadd_vv_i64m1(sra, __riscv_vand_vx_i64m1(sra, 1, 2), 2);
   vint32m1_t vrshrn = __riscv_vnsra_wx_i32m1(__riscv_vlmul_ext_v_i64m1_i64m2(sra_round), 1, 2);
   return __riscv_vslideup_vx_i32m1(r, vrshrn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vrshrn_high_n_u16(uint8x8_t r, uint16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t a_round = __riscv_vadd_vx_u16m1(a, 1 << (n - 1), 8);
+  vuint16m2_t a_round_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a_round), 1, a_round);
+  return __riscv_vnsrl_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_round_hi, n, 16);
+#else
   vuint16m1_t a_round = __riscv_vadd_vx_u16m1(a, 1 << (n - 1), 8);
   vuint8m1_t vrshrn = __riscv_vnsrl_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(a_round), n, 8);
   return __riscv_vslideup_vx_u8m1(r, vrshrn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vrshrn_high_n_u32(uint16x4_t r, uint32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t a_round = __riscv_vadd_vx_u32m1(a, 1 << (n - 1), 4);
+  vuint32m2_t a_round_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a_round), 1, a_round);
+  return __riscv_vnsrl_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_round_hi, n, 8);
+#else
   vuint32m1_t a_round = __riscv_vadd_vx_u32m1(a, 1 << (n - 1), 4);
   vuint16m1_t vrshrn = __riscv_vnsrl_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(a_round), n, 4);
   return __riscv_vslideup_vx_u16m1(r, vrshrn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vrshrn_high_n_u64(uint32x2_t r, uint64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t srl = __riscv_vsrl_vx_u64m1(a, n - 1, 2);
+  vuint64m1_t srl_round = __riscv_vadd_vv_u64m1(srl, __riscv_vand_vx_u64m1(srl, 1, 2), 2);
+  vuint64m2_t srl_round_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(srl_round), 1, srl_round);
+  return __riscv_vnsrl_wx_u32m1_mu(neon2rvv_high_half_b32(), r, srl_round_hi, 1, 4);
+#else
   vuint64m1_t srl = __riscv_vsrl_vx_u64m1(a, n - 1, 2);
   vuint64m1_t srl_round = __riscv_vadd_vv_u64m1(srl, __riscv_vand_vx_u64m1(srl, 1, 2), 2);
   vuint32m1_t vrshrn = __riscv_vnsrl_wx_u32m1(__riscv_vlmul_ext_v_u64m1_u64m2(srl_round), 1, 2);
   return __riscv_vslideup_vx_u32m1(r, vrshrn, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vqshrn_n_s16(int16x8_t a, const int b) {
@@ -6389,33 +6785,63 @@ FORCE_INLINE uint16_t vqshrns_n_u32(uint32_t a, const int n) { return neon2rvv_s
 FORCE_INLINE uint32_t vqshrnd_n_u64(uint64_t a, const int n) { return neon2rvv_saturate_uint32(a >> n); }
 
 FORCE_INLINE int8x16_t vqshrn_high_n_s16(int8x8_t r, int16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vnclip_wx_i8m1_mu(neon2rvv_high_half_b8(), r, a_hi, n, __RISCV_VXRM_RDN, 16);
+#else
   vint8m1_t qshrn_n = __riscv_vnclip_wx_i8m1(__riscv_vlmul_ext_v_i16m1_i16m2(a), n, __RISCV_VXRM_RDN, 8);
   return __riscv_vslideup_vx_i8m1(r, qshrn_n, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vqshrn_high_n_s32(int16x4_t r, int32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vnclip_wx_i16m1_mu(neon2rvv_high_half_b16(), r, a_hi, n, __RISCV_VXRM_RDN, 8);
+#else
   vint16m1_t qshrn_n = __riscv_vnclip_wx_i16m1(__riscv_vlmul_ext_v_i32m1_i32m2(a), n, __RISCV_VXRM_RDN, 4);
   return __riscv_vslideup_vx_i16m1(r, qshrn_n, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vqshrn_high_n_s64(int32x2_t r, int64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vnclip_wx_i32m1_mu(neon2rvv_high_half_b32(), r, a_hi, n, __RISCV_VXRM_RDN, 4);
+#else
   vint32m1_t qshrn_n = __riscv_vnclip_wx_i32m1(__riscv_vlmul_ext_v_i64m1_i64m2(a), n, __RISCV_VXRM_RDN, 2);
   return __riscv_vslideup_vx_i32m1(r, qshrn_n, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vqshrn_high_n_u16(uint8x8_t r, uint16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vnclipu_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_hi, n, __RISCV_VXRM_RDN, 16);
+#else
   vuint8m1_t qshrn_n = __riscv_vnclipu_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(a), n, __RISCV_VXRM_RDN, 8);
   return __riscv_vslideup_vx_u8m1(r, qshrn_n, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vqshrn_high_n_u32(uint16x4_t r, uint32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vnclipu_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_hi, n, __RISCV_VXRM_RDN, 8);
+#else
   vuint16m1_t qshrn_n = __riscv_vnclipu_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(a), n, __RISCV_VXRM_RDN, 4);
   return __riscv_vslideup_vx_u16m1(r, qshrn_n, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vqshrn_high_n_u64(uint32x2_t r, uint64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vnclipu_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_hi, n, __RISCV_VXRM_RDN, 4);
+#else
   vuint32m1_t qshrn_n = __riscv_vnclipu_wx_u32m1(__riscv_vlmul_ext_v_u64m1_u64m2(a), n, __RISCV_VXRM_RDN, 2);
   return __riscv_vslideup_vx_u32m1(r, qshrn_n, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vqrshrn_n_s16(int16x8_t a, const int b) {
@@ -6453,11 +6879,8 @@ FORCE_INLINE int16_t vqrshrns_n_s32(int32_t a, const int n) {
 }
 
 FORCE_INLINE int32_t vqrshrnd_n_s64(int64_t a, const int n) {
-  int64_t round_const = 0;
-  if (a & ((int64_t)1 << (n - 1))) {
-    round_const = 1;
-  }
-  return neon2rvv_saturate_int32(((a >> (n - 1)) + round_const) >> 1);
+  int64_t a_half = a >> (n - 1);
+  return neon2rvv_saturate_int32((a_half >> 1) + (a_half & 1));
 }
 
 FORCE_INLINE uint8_t vqrshrnh_n_u16(uint16_t a, const int n) {
@@ -6471,41 +6894,68 @@ FORCE_INLINE uint16_t vqrshrns_n_u32(uint32_t a, const int n) {
 }
 
 FORCE_INLINE uint32_t vqrshrnd_n_u64(uint64_t a, const int n) {
-  uint64_t round_const = 0;
-  if (a & ((uint64_t)1 << (n - 1))) {
-    round_const = 1;
-  }
-  return neon2rvv_saturate_uint32(((a >> (n - 1)) + round_const) >> 1);
+  uint64_t a_half = a >> (n - 1);
+  return neon2rvv_saturate_uint32((a_half >> 1) + (a_half & 1));
 }
 
 FORCE_INLINE int8x16_t vqrshrn_high_n_s16(int8x8_t r, int16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vnclip_wx_i8m1_mu(neon2rvv_high_half_b8(), r, a_hi, n, __RISCV_VXRM_RNU, 16);
+#else
   vint8m1_t vqrshrn = __riscv_vnclip_wx_i8m1(__riscv_vlmul_ext_v_i16m1_i16m2(a), n, __RISCV_VXRM_RNU, 8);
   return __riscv_vslideup_vx_i8m1(r, vqrshrn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vqrshrn_high_n_s32(int16x4_t r, int32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vnclip_wx_i16m1_mu(neon2rvv_high_half_b16(), r, a_hi, n, __RISCV_VXRM_RNU, 8);
+#else
   vint16m1_t vqrshrn = __riscv_vnclip_wx_i16m1(__riscv_vlmul_ext_v_i32m1_i32m2(a), n, __RISCV_VXRM_RNU, 4);
   return __riscv_vslideup_vx_i16m1(r, vqrshrn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vqrshrn_high_n_s64(int32x2_t r, int64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vnclip_wx_i32m1_mu(neon2rvv_high_half_b32(), r, a_hi, n, __RISCV_VXRM_RNU, 4);
+#else
   vint32m1_t vqrshrn = __riscv_vnclip_wx_i32m1(__riscv_vlmul_ext_v_i64m1_i64m2(a), n, __RISCV_VXRM_RNU, 2);
   return __riscv_vslideup_vx_i32m1(r, vqrshrn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vqrshrn_high_n_u16(uint8x8_t r, uint16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vnclipu_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_hi, n, __RISCV_VXRM_RNU, 16);
+#else
   vuint8m1_t vqrshrn = __riscv_vnclipu_wx_u8m1(__riscv_vlmul_ext_v_u16m1_u16m2(a), n, __RISCV_VXRM_RNU, 8);
   return __riscv_vslideup_vx_u8m1(r, vqrshrn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vqrshrn_high_n_u32(uint16x4_t r, uint32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vnclipu_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_hi, n, __RISCV_VXRM_RNU, 8);
+#else
   vuint16m1_t vqrshrn = __riscv_vnclipu_wx_u16m1(__riscv_vlmul_ext_v_u32m1_u32m2(a), n, __RISCV_VXRM_RNU, 4);
   return __riscv_vslideup_vx_u16m1(r, vqrshrn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vqrshrn_high_n_u64(uint32x2_t r, uint64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vnclipu_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_hi, n, __RISCV_VXRM_RNU, 4);
+#else
   vuint32m1_t vqrshrn = __riscv_vnclipu_wx_u32m1(__riscv_vlmul_ext_v_u64m1_u64m2(a), n, __RISCV_VXRM_RNU, 2);
   return __riscv_vslideup_vx_u32m1(r, vqrshrn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x8_t vqshrun_n_s16(int16x8_t a, const int b) {
@@ -6542,24 +6992,42 @@ FORCE_INLINE uint32_t vqshrund_n_s64(int64_t a, const int n) {
 }
 
 FORCE_INLINE uint8x16_t vqshrun_high_n_s16(uint8x8_t r, int16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t a_non_neg = __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vmax_vx_i16m1(a, 0, 8));
+  vuint16m2_t a_non_neg_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_non_neg_hi, n, __RISCV_VXRM_RDN, 16);
+#else
   vint16m2_t a_eliminate_neg = __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vmax_vx_i16m1(a, 0, 8));
   vuint8m1_t vqshrun =
       __riscv_vnclipu_wx_u8m1(__riscv_vreinterpret_v_i16m2_u16m2(a_eliminate_neg), n, __RISCV_VXRM_RDN, 8);
   return __riscv_vslideup_vx_u8m1(r, vqshrun, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vqshrun_high_n_s32(uint16x4_t r, int32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t a_non_neg = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vmax_vx_i32m1(a, 0, 4));
+  vuint32m2_t a_non_neg_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_non_neg_hi, n, __RISCV_VXRM_RDN, 8);
+#else
   vint32m2_t a_eliminate_neg = __riscv_vlmul_ext_v_i32m1_i32m2(__riscv_vmax_vx_i32m1(a, 0, 4));
   vuint16m1_t vqshrun =
       __riscv_vnclipu_wx_u16m1(__riscv_vreinterpret_v_i32m2_u32m2(a_eliminate_neg), n, __RISCV_VXRM_RDN, 4);
   return __riscv_vslideup_vx_u16m1(r, vqshrun, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vqshrun_high_n_s64(uint32x2_t r, int64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t a_non_neg = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vmax_vx_i64m1(a, 0, 2));
+  vuint64m2_t a_non_neg_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_non_neg_hi, n, __RISCV_VXRM_RDN, 4);
+#else
   vint64m2_t a_eliminate_neg = __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vmax_vx_i64m1(a, 0, 2));
   vuint32m1_t vqshrun =
       __riscv_vnclipu_wx_u32m1(__riscv_vreinterpret_v_i64m2_u64m2(a_eliminate_neg), n, __RISCV_VXRM_RDN, 2);
   return __riscv_vslideup_vx_u32m1(r, vqshrun, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x8_t vqrshrun_n_s16(int16x8_t a, const int b) {
@@ -6598,24 +7066,42 @@ FORCE_INLINE uint32_t vqrshrund_n_s64(int64_t a, const int n) {
 }
 
 FORCE_INLINE uint8x16_t vqrshrun_high_n_s16(uint8x8_t r, int16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t a_non_neg = __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vmax_vx_i16m1(a, 0, 8));
+  vuint16m2_t a_non_neg_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_non_neg_hi, n, __RISCV_VXRM_RNU, 16);
+#else
   vint16m2_t a_eliminate_neg = __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vmax_vx_i16m1(a, 0, 8));
   vuint8m1_t vqrshrun =
       __riscv_vnclipu_wx_u8m1(__riscv_vreinterpret_v_i16m2_u16m2(a_eliminate_neg), n, __RISCV_VXRM_RNU, 8);
   return __riscv_vslideup_vx_u8m1(r, vqrshrun, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vqrshrun_high_n_s32(uint16x4_t r, int32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t a_non_neg = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vmax_vx_i32m1(a, 0, 4));
+  vuint32m2_t a_non_neg_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_non_neg_hi, n, __RISCV_VXRM_RNU, 8);
+#else
   vint32m2_t a_eliminate_neg = __riscv_vlmul_ext_v_i32m1_i32m2(__riscv_vmax_vx_i32m1(a, 0, 4));
   vuint16m1_t vqrshrun =
       __riscv_vnclipu_wx_u16m1(__riscv_vreinterpret_v_i32m2_u32m2(a_eliminate_neg), n, __RISCV_VXRM_RNU, 4);
   return __riscv_vslideup_vx_u16m1(r, vqrshrun, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vqrshrun_high_n_s64(uint32x2_t r, int64x2_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t a_non_neg = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vmax_vx_i64m1(a, 0, 2));
+  vuint64m2_t a_non_neg_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_non_neg_hi, n, __RISCV_VXRM_RNU, 4);
+#else
   vint64m2_t a_eliminate_neg = __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vmax_vx_i64m1(a, 0, 2));
   vuint32m1_t vqrshrun =
       __riscv_vnclipu_wx_u32m1(__riscv_vreinterpret_v_i64m2_u64m2(a_eliminate_neg), n, __RISCV_VXRM_RNU, 2);
   return __riscv_vslideup_vx_u32m1(r, vqrshrun, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vshl_n_s8(int8x8_t a, const int b) { return __riscv_vsll_vx_i8m1(a, b, 8); }
@@ -6773,17 +7259,9 @@ FORCE_INLINE int16_t vqshlh_n_s16(int16_t a, const int n) { return neon2rvv_satu
 FORCE_INLINE int32_t vqshls_n_s32(int32_t a, const int n) { return neon2rvv_saturate_int32((int64_t)a << n); }
 
 FORCE_INLINE int64_t vqshld_n_s64(int64_t a, const int n) {
-  if (a > 0) {
-    if (a > (INT64_MAX >> n)) {
-      return INT64_MAX;
-    } else {
-      return a << n;
-    }
-  }
-  if (a < (INT64_MIN >> n)) {
-    return INT64_MIN;
-  }
-  return a << n;
+  int64_t shl = (int64_t)((uint64_t)a << n);
+  int64_t sat = (a >> 63) ^ INT64_MAX;
+  return (shl >> n) == a ? shl : sat;
 }
 
 FORCE_INLINE uint8_t vqshlb_n_u8(uint8_t a, const int n) { return neon2rvv_saturate_uint8(a << n); }
@@ -6793,10 +7271,7 @@ FORCE_INLINE uint16_t vqshlh_n_u16(uint16_t a, const int n) { return neon2rvv_sa
 FORCE_INLINE uint32_t vqshls_n_u32(uint32_t a, const int n) { return neon2rvv_saturate_uint32((uint64_t)a << n); }
 
 FORCE_INLINE uint64_t vqshld_n_u64(uint64_t a, const int n) {
-  if (a > (UINT64_MAX >> n)) {
-    return UINT64_MAX;
-  }
-  return a << n;
+  return (a << n) | -(uint64_t)(a > (UINT64_MAX >> n));
 }
 
 FORCE_INLINE uint8x8_t vqshlu_n_s8(int8x8_t a, const int b) {
@@ -6874,13 +7349,8 @@ FORCE_INLINE uint32_t vqshlus_n_s32(int32_t a, const int n) {
 }
 
 FORCE_INLINE uint64_t vqshlud_n_s64(int64_t a, const int n) {
-  if (a < 0) {
-    return 0;
-  }
-  if ((uint64_t)a > (UINT64_MAX >> n)) {
-    return UINT64_MAX;
-  }
-  return a << n;
+  uint64_t a_non_neg = a & ~(a >> 63);
+  return (a_non_neg << n) | -(uint64_t)(a_non_neg > (UINT64_MAX >> n));
 }
 
 FORCE_INLINE int16x8_t vshll_n_s8(int8x8_t a, const int b) {
@@ -6914,39 +7384,69 @@ FORCE_INLINE uint64x2_t vshll_n_u32(uint32x2_t a, const int b) {
 }
 
 FORCE_INLINE int16x8_t vshll_high_n_s8(int8x16_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t a_ext = __riscv_vget_v_i16m2_i16m1(__riscv_vsext_vf2_i16m2(a, 16), 1);
+  return __riscv_vsll_vx_i16m1(a_ext, n, 8);
+#else
   vint8m1_t _a = __riscv_vslidedown_vx_i8m1(a, 8, 16);
   vint16m1_t a_ext = __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vsext_vf2_i16m2(_a, 8));
   return __riscv_vsll_vx_i16m1(a_ext, n, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vshll_high_n_s16(int16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t a_ext = __riscv_vget_v_i32m2_i32m1(__riscv_vsext_vf2_i32m2(a, 8), 1);
+  return __riscv_vsll_vx_i32m1(a_ext, n, 4);
+#else
   vint16m1_t _a = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   vint32m1_t a_ext = __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vsext_vf2_i32m2(_a, 4));
   return __riscv_vsll_vx_i32m1(a_ext, n, 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vshll_high_n_s32(int32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t a_ext = __riscv_vget_v_i64m2_i64m1(__riscv_vsext_vf2_i64m2(a, 4), 1);
+  return __riscv_vsll_vx_i64m1(a_ext, n, 2);
+#else
   vint32m1_t _a = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   vint64m1_t a_ext = __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vsext_vf2_i64m2(_a, 2));
   return __riscv_vsll_vx_i64m1(a_ext, n, 2);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vshll_high_n_u8(uint8x16_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t a_ext = __riscv_vget_v_u16m2_u16m1(__riscv_vzext_vf2_u16m2(a, 16), 1);
+  return __riscv_vsll_vx_u16m1(a_ext, n, 8);
+#else
   vuint8m1_t _a = __riscv_vslidedown_vx_u8m1(a, 8, 16);
   vuint16m1_t a_ext = __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vzext_vf2_u16m2(_a, 8));
   return __riscv_vsll_vx_u16m1(a_ext, n, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vshll_high_n_u16(uint16x8_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t a_ext = __riscv_vget_v_u32m2_u32m1(__riscv_vzext_vf2_u32m2(a, 8), 1);
+  return __riscv_vsll_vx_u32m1(a_ext, n, 4);
+#else
   vuint16m1_t _a = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   vuint32m1_t a_ext = __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vzext_vf2_u32m2(_a, 4));
   return __riscv_vsll_vx_u32m1(a_ext, n, 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vshll_high_n_u32(uint32x4_t a, const int n) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t a_ext = __riscv_vget_v_u64m2_u64m1(__riscv_vzext_vf2_u64m2(a, 4), 1);
+  return __riscv_vsll_vx_u64m1(a_ext, n, 2);
+#else
   vuint32m1_t _a = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   vuint64m1_t a_ext = __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vzext_vf2_u64m2(_a, 2));
   return __riscv_vsll_vx_u64m1(a_ext, n, 2);
+#endif
 }
 
 FORCE_INLINE int8x8_t vsra_n_s8(int8x8_t a, int8x8_t b, const int c) {
@@ -7559,37 +8059,13 @@ FORCE_INLINE int64x2_t vqnegq_s64(int64x2_t a) {
   return __riscv_vmerge_vxm_i64m1(a_neg, INT64_MAX, min_mask, 2);
 }
 
-FORCE_INLINE int8_t vqnegb_s8(int8_t a) {
-  if (a == INT8_MIN) {
-    return INT8_MAX;
-  } else {
-    return -a;
-  }
-}
+FORCE_INLINE int8_t vqnegb_s8(int8_t a) { return sat_sub_int8(0, a); }
 
-FORCE_INLINE int16_t vqnegh_s16(int16_t a) {
-  if (a == INT16_MIN) {
-    return INT16_MAX;
-  } else {
-    return -a;
-  }
-}
+FORCE_INLINE int16_t vqnegh_s16(int16_t a) { return sat_sub_int16(0, a); }
 
-FORCE_INLINE int32_t vqnegs_s32(int32_t a) {
-  if (a == INT32_MIN) {
-    return INT32_MAX;
-  } else {
-    return -a;
-  }
-}
+FORCE_INLINE int32_t vqnegs_s32(int32_t a) { return sat_sub_int32(0, a); }
 
-FORCE_INLINE int64_t vqnegd_s64(int64_t a) {
-  if (a == INT64_MIN) {
-    return INT64_MAX;
-  } else {
-    return -a;
-  }
-}
+FORCE_INLINE int64_t vqnegd_s64(int64_t a) { return sat_sub_int64(0, a); }
 
 FORCE_INLINE int8x8_t vmvn_s8(int8x8_t a) { return __riscv_vnot_v_i8m1(a, 8); }
 
@@ -7619,62 +8095,108 @@ FORCE_INLINE uint32x4_t vmvnq_u32(uint32x4_t a) { return __riscv_vnot_v_u32m1(a,
 
 // FORCE_INLINE poly8x16_t vmvnq_p8(poly8x16_t a);
 
-// FORCE_INLINE int8x8_t vcls_s8(int8x8_t a);
+// Count leading zeros without Zvbb. 8-bit lanes look up both nibbles in a 4-bit clz table. 16/32-bit lanes are
+// converted to float and read back from the exponent field: u16 widens to f32 exactly, and u32 converts with RTZ so
+// rounding can never carry into the next exponent. Zero has a zero exponent, which the vminu clamps to the lane width.
+static inline vuint8m1_t neon2rvv_clz_u8(vuint8m1_t a, size_t vl) {
+  const uint8_t clz_lookup_arr[16] = {4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+  vuint8m1_t lookup = __riscv_vle8_v_u8m1(clz_lookup_arr, 16);
+  vuint8m1_t clz_high = __riscv_vrgather_vv_u8m1(lookup, __riscv_vsrl_vx_u8m1(a, 4, vl), vl);
+  vuint8m1_t clz_low = __riscv_vrgather_vv_u8m1(lookup, __riscv_vand_vx_u8m1(a, 0xf, vl), vl);
+  vbool8_t high_zero = __riscv_vmseq_vx_u8m1_b8(clz_high, 4, vl);
+  return __riscv_vadd_vv_u8m1_mu(high_zero, clz_high, clz_high, clz_low, vl);
+}
+
+static inline vuint16m1_t neon2rvv_clz_u16(vuint16m1_t a, size_t vl) {
+  vuint32m2_t a_f = __riscv_vreinterpret_v_f32m2_u32m2(__riscv_vfwcvt_f_xu_v_f32m2(a, vl));
+  vuint16m1_t exp = __riscv_vnsrl_wx_u16m1(a_f, 23, vl);
+  return __riscv_vminu_vx_u16m1(__riscv_vrsub_vx_u16m1(exp, 127 + 15, vl), 16, vl);
+}
+
+static inline vuint32m1_t neon2rvv_clz_u32(vuint32m1_t a, size_t vl) {
+  vuint32m1_t a_f = __riscv_vreinterpret_v_f32m1_u32m1(__riscv_vfcvt_f_xu_v_f32m1_rm(a, __RISCV_FRM_RTZ, vl));
+  vuint32m1_t exp = __riscv_vsrl_vx_u32m1(a_f, 23, vl);
+  return __riscv_vminu_vx_u32m1(__riscv_vrsub_vx_u32m1(exp, 127 + 31, vl), 32, vl);
+}
+
+// cls(x) = clz(x ^ (x >> 1)) - 1 with an arithmetic shift, which also gives width - 1 for 0 and -1.
+static inline vint8m1_t neon2rvv_cls_i8(vint8m1_t a, size_t vl) {
+  vint8m1_t a_xor = __riscv_vxor_vv_i8m1(a, __riscv_vsra_vx_i8m1(a, 1, vl), vl);
+  vuint8m1_t clz = neon2rvv_clz_u8(__riscv_vreinterpret_v_i8m1_u8m1(a_xor), vl);
+  return __riscv_vsub_vx_i8m1(__riscv_vreinterpret_v_u8m1_i8m1(clz), 1, vl);
+}
+
+static inline vint16m1_t neon2rvv_cls_i16(vint16m1_t a, size_t vl) {
+  vint16m1_t a_xor = __riscv_vxor_vv_i16m1(a, __riscv_vsra_vx_i16m1(a, 1, vl), vl);
+  vuint16m1_t clz = neon2rvv_clz_u16(__riscv_vreinterpret_v_i16m1_u16m1(a_xor), vl);
+  return __riscv_vsub_vx_i16m1(__riscv_vreinterpret_v_u16m1_i16m1(clz), 1, vl);
+}
+
+static inline vint32m1_t neon2rvv_cls_i32(vint32m1_t a, size_t vl) {
+  vint32m1_t a_xor = __riscv_vxor_vv_i32m1(a, __riscv_vsra_vx_i32m1(a, 1, vl), vl);
+  vuint32m1_t clz = neon2rvv_clz_u32(__riscv_vreinterpret_v_i32m1_u32m1(a_xor), vl);
+  return __riscv_vsub_vx_i32m1(__riscv_vreinterpret_v_u32m1_i32m1(clz), 1, vl);
+}
+
+FORCE_INLINE int8x8_t vcls_s8(int8x8_t a) { return neon2rvv_cls_i8(a, 8); }
 
-// FORCE_INLINE int16x4_t vcls_s16(int16x4_t a);
+FORCE_INLINE int16x4_t vcls_s16(int16x4_t a) { return neon2rvv_cls_i16(a, 4); }
 
-// FORCE_INLINE int32x2_t vcls_s32(int32x2_t a);
+FORCE_INLINE int32x2_t vcls_s32(int32x2_t a) { return neon2rvv_cls_i32(a, 2); }
 
-// FORCE_INLINE int8x16_t vclsq_s8(int8x16_t a);
+FORCE_INLINE int8x16_t vclsq_s8(int8x16_t a) { return neon2rvv_cls_i8(a, 16); }
 
-// FORCE_INLINE int16x8_t vclsq_s16(int16x8_t a);
+FORCE_INLINE int16x8_t vclsq_s16(int16x8_t a) { return neon2rvv_cls_i16(a, 8); }
 
-// FORCE_INLINE int32x4_t vclsq_s32(int32x4_t a);
+FORCE_INLINE int32x4_t vclsq_s32(int32x4_t a) { return neon2rvv_cls_i32(a, 4); }
 
-// FORCE_INLINE int8x8_t vcls_u8(uint8x8_t a);
+FORCE_INLINE int8x8_t vcls_u8(uint8x8_t a) { return neon2rvv_cls_i8(__riscv_vreinterpret_v_u8m1_i8m1(a), 8); }
 
-// FORCE_INLINE int8x16_t vclsq_u8(uint8x16_t a);
+FORCE_INLINE int8x16_t vclsq_u8(uint8x16_t a) { return neon2rvv_cls_i8(__riscv_vreinterpret_v_u8m1_i8m1(a), 16); }
 
-// FORCE_INLINE int16x4_t vcls_u16(uint16x4_t a);
+FORCE_INLINE int16x4_t vcls_u16(uint16x4_t a) { return neon2rvv_cls_i16(__riscv_vreinterpret_v_u16m1_i16m1(a), 4); }
 
-// FORCE_INLINE int16x8_t vclsq_u16(uint16x8_t a);
+FORCE_INLINE int16x8_t vclsq_u16(uint16x8_t a) { return neon2rvv_cls_i16(__riscv_vreinterpret_v_u16m1_i16m1(a), 8); }
 
-// FORCE_INLINE int32x2_t vcls_u32(uint32x2_t a);
+FORCE_INLINE int32x2_t vcls_u32(uint32x2_t a) { return neon2rvv_cls_i32(__riscv_vreinterpret_v_u32m1_i32m1(a), 2); }
 
-// FORCE_INLINE int32x4_t vclsq_u32(uint32x4_t a);
+FORCE_INLINE int32x4_t vclsq_u32(uint32x4_t a) { return neon2rvv_cls_i32(__riscv_vreinterpret_v_u32m1_i32m1(a), 4); }
 
 FORCE_INLINE int8x8_t vclz_s8(int8x8_t a) {
-  // refer
-  // https://stackoverflow.com/questions/23856596/how-to-count-leading-zeros-in-a-32-bit-unsigned-integer
-  vuint8m1_t a_u = __riscv_vreinterpret_v_i8m1_u8m1(a);
-  a_u = __riscv_vor_vv_u8m1(__riscv_vsrl_vx_u8m1(a_u, 1, 8), a_u, 8);
-  a_u = __riscv_vor_vv_u8m1(__riscv_vsrl_vx_u8m1(a_u, 2, 8), a_u, 8);
-  a_u = __riscv_vor_vv_u8m1(__riscv_vsrl_vx_u8m1(a_u, 4, 8), a_u, 8);
-  vuint8m1_t a_not = __riscv_vnot_v_u8m1(a_u, 8);
-  return vcnt_s8(__riscv_vreinterpret_v_u8m1_i8m1(a_not));
+  return __riscv_vreinterpret_v_u8m1_i8m1(neon2rvv_clz_u8(__riscv_vreinterpret_v_i8m1_u8m1(a), 8));
 }
 
-// FORCE_INLINE int16x4_t vclz_s16(int16x4_t a);
+FORCE_INLINE int16x4_t vclz_s16(int16x4_t a) {
+  return __riscv_vreinterpret_v_u16m1_i16m1(neon2rvv_clz_u16(__riscv_vreinterpret_v_i16m1_u16m1(a), 4));
+}
 
-// FORCE_INLINE int32x2_t vclz_s32(int32x2_t a);
+FORCE_INLINE int32x2_t vclz_s32(int32x2_t a) {
+  return __riscv_vreinterpret_v_u32m1_i32m1(neon2rvv_clz_u32(__riscv_vreinterpret_v_i32m1_u32m1(a), 2));
+}
 
-// FORCE_INLINE uint8x8_t vclz_u8(uint8x8_t a);
+FORCE_INLINE uint8x8_t vclz_u8(uint8x8_t a) { return neon2rvv_clz_u8(a, 8); }
 
-// FORCE_INLINE uint16x4_t vclz_u16(uint16x4_t a);
+FORCE_INLINE uint16x4_t vclz_u16(uint16x4_t a) { return neon2rvv_clz_u16(a, 4); }
 
-// FORCE_INLINE uint32x2_t vclz_u32(uint32x2_t a);
+FORCE_INLINE uint32x2_t vclz_u32(uint32x2_t a) { return neon2rvv_clz_u32(a, 2); }
 
-// FORCE_INLINE int8x16_t vclzq_s8(int8x16_t a);
+FORCE_INLINE int8x16_t vclzq_s8(int8x16_t a) {
+  return __riscv_vreinterpret_v_u8m1_i8m1(neon2rvv_clz_u8(__riscv_vreinterpret_v_i8m1_u8m1(a), 16));
+}
 
-// FORCE_INLINE int16x8_t vclzq_s16(int16x8_t a);
+FORCE_INLINE int16x8_t vclzq_s16(int16x8_t a) {
+  return __riscv_vreinterpret_v_u16m1_i16m1(neon2rvv_clz_u16(__riscv_vreinterpret_v_i16m1_u16m1(a), 8));
+}
 
-// FORCE_INLINE int32x4_t vclzq_s32(int32x4_t a);
+FORCE_INLINE int32x4_t vclzq_s32(int32x4_t a) {
+  return __riscv_vreinterpret_v_u32m1_i32m1(neon2rvv_clz_u32(__riscv_vreinterpret_v_i32m1_u32m1(a), 4));
+}
 
-// FORCE_INLINE uint8x16_t vclzq_u8(uint8x16_t a);
+FORCE_INLINE uint8x16_t vclzq_u8(uint8x16_t a) { return neon2rvv_clz_u8(a, 16); }
 
-// FORCE_INLINE uint16x8_t vclzq_u16(uint16x8_t a);
+FORCE_INLINE uint16x8_t vclzq_u16(uint16x8_t a) { return neon2rvv_clz_u16(a, 8); }
 
-// FORCE_INLINE uint32x4_t vclzq_u32(uint32x4_t a);
+FORCE_INLINE uint32x4_t vclzq_u32(uint32x4_t a) { return neon2rvv_clz_u32(a, 4); }
 
 FORCE_INLINE int8x8_t vcnt_s8(int8x8_t a) {
   const int8_t bit_population_lookup_arr[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
@@ -7718,91 +8240,245 @@ FORCE_INLINE uint8x16_t vcntq_u8(uint8x16_t a) {
 
 // FORCE_INLINE poly8x16_t vcntq_p8(poly8x16_t a);
 
-FORCE_INLINE float32x2_t vrecpe_f32(float32x2_t a) { return __riscv_vfrec7_v_f32m1(a, 2); }
-
-FORCE_INLINE uint32_t vrecpe_u32_scalar_impl(uint32_t a) {
-  static const uint32_t kVrecpeU32Top9Lut[256] = {
-      0xff800000u, 0xfe800000u, 0xfd800000u, 0xfc800000u, 0xfb800000u, 0xfa800000u, 0xf9800000u, 0xf8800000u,
-      0xf8000000u, 0xf7000000u, 0xf6000000u, 0xf5000000u, 0xf4000000u, 0xf3000000u, 0xf2800000u, 0xf1800000u,
-      0xf0800000u, 0xef800000u, 0xee800000u, 0xee000000u, 0xed000000u, 0xec000000u, 0xeb800000u, 0xea800000u,
-      0xe9800000u, 0xe9000000u, 0xe8000000u, 0xe7000000u, 0xe6800000u, 0xe5800000u, 0xe4800000u, 0xe4000000u,
-      0xe3000000u, 0xe2800000u, 0xe1800000u, 0xe1000000u, 0xe0000000u, 0xdf800000u, 0xde800000u, 0xde000000u,
-      0xdd000000u, 0xdc800000u, 0xdb800000u, 0xdb000000u, 0xda000000u, 0xd9800000u, 0xd8800000u, 0xd8000000u,
-      0xd7000000u, 0xd6800000u, 0xd6000000u, 0xd5000000u, 0xd4800000u, 0xd3800000u, 0xd3000000u, 0xd2800000u,
-      0xd1800000u, 0xd1000000u, 0xd0800000u, 0xcf800000u, 0xcf000000u, 0xce800000u, 0xce000000u, 0xcd000000u,
-      0xcc800000u, 0xcc000000u, 0xcb000000u, 0xca800000u, 0xca000000u, 0xc9800000u, 0xc8800000u, 0xc8000000u,
-      0xc7800000u, 0xc7000000u, 0xc6800000u, 0xc5800000u, 0xc5000000u, 0xc4800000u, 0xc4000000u, 0xc3800000u,
-      0xc3000000u, 0xc2000000u, 0xc1800000u, 0xc1000000u, 0xc0800000u, 0xc0000000u, 0xbf800000u, 0xbf000000u,
-      0xbe000000u, 0xbd800000u, 0xbd000000u, 0xbc800000u, 0xbc000000u, 0xbb800000u, 0xbb000000u, 0xba800000u,
-      0xba000000u, 0xb9800000u, 0xb9000000u, 0xb8800000u, 0xb8000000u, 0xb7800000u, 0xb7000000u, 0xb6800000u,
-      0xb6000000u, 0xb5800000u, 0xb5000000u, 0xb4800000u, 0xb4000000u, 0xb3800000u, 0xb3000000u, 0xb2800000u,
-      0xb2000000u, 0xb1800000u, 0xb1000000u, 0xb0800000u, 0xb0000000u, 0xaf800000u, 0xaf000000u, 0xae800000u,
-      0xae000000u, 0xad800000u, 0xad000000u, 0xac800000u, 0xac000000u, 0xac000000u, 0xab800000u, 0xab000000u,
-      0xaa800000u, 0xaa000000u, 0xa9800000u, 0xa9000000u, 0xa8800000u, 0xa8800000u, 0xa8000000u, 0xa7800000u,
-      0xa7000000u, 0xa6800000u, 0xa6000000u, 0xa5800000u, 0xa5800000u, 0xa5000000u, 0xa4800000u, 0xa4000000u,
-      0xa3800000u, 0xa3000000u, 0xa3000000u, 0xa2800000u, 0xa2000000u, 0xa1800000u, 0xa1000000u, 0xa1000000u,
-      0xa0800000u, 0xa0000000u, 0x9f800000u, 0x9f800000u, 0x9f000000u, 0x9e800000u, 0x9e000000u, 0x9d800000u,
-      0x9d800000u, 0x9d000000u, 0x9c800000u, 0x9c000000u, 0x9c000000u, 0x9b800000u, 0x9b000000u, 0x9a800000u,
-      0x9a800000u, 0x9a000000u, 0x99800000u, 0x99800000u, 0x99000000u, 0x98800000u, 0x98000000u, 0x98000000u,
-      0x97800000u, 0x97000000u, 0x97000000u, 0x96800000u, 0x96000000u, 0x96000000u, 0x95800000u, 0x95000000u,
-      0x95000000u, 0x94800000u, 0x94000000u, 0x94000000u, 0x93800000u, 0x93000000u, 0x93000000u, 0x92800000u,
-      0x92000000u, 0x92000000u, 0x91800000u, 0x91000000u, 0x91000000u, 0x90800000u, 0x90000000u, 0x90000000u,
-      0x8f800000u, 0x8f000000u, 0x8f000000u, 0x8e800000u, 0x8e800000u, 0x8e000000u, 0x8d800000u, 0x8d800000u,
-      0x8d000000u, 0x8d000000u, 0x8c800000u, 0x8c000000u, 0x8c000000u, 0x8b800000u, 0x8b800000u, 0x8b000000u,
-      0x8a800000u, 0x8a800000u, 0x8a000000u, 0x8a000000u, 0x89800000u, 0x89000000u, 0x89000000u, 0x88800000u,
-      0x88800000u, 0x88000000u, 0x88000000u, 0x87800000u, 0x87800000u, 0x87000000u, 0x86800000u, 0x86800000u,
-      0x86000000u, 0x86000000u, 0x85800000u, 0x85800000u, 0x85000000u, 0x85000000u, 0x84800000u, 0x84800000u,
-      0x84000000u, 0x83800000u, 0x83800000u, 0x83000000u, 0x83000000u, 0x82800000u, 0x82800000u, 0x82000000u,
-      0x82000000u, 0x81800000u, 0x81800000u, 0x81000000u, 0x81000000u, 0x80800000u, 0x80800000u, 0x80000000u};
-  if (a < 0x80000000u) {
-    return UINT32_MAX;
-  }
-  return kVrecpeU32Top9Lut[(a >> 23) - 256];
+// RecipEstimate(): 'a' in [256, 512) is a fraction in [0.5, 1) and the result is ((2^19 / (2 * a + 1)) + 1) >> 1
+static inline vuint32m1_t neon2rvv_recip_estimate_u32(vuint32m1_t a, size_t vl) {
+  vuint32m1_t den = __riscv_vor_vx_u32m1(__riscv_vsll_vx_u32m1(a, 1, vl), 1, vl);
+  vuint32m1_t est = __riscv_vdivu_vv_u32m1(__riscv_vmv_v_x_u32m1(1u << 19, vl), den, vl);
+  return __riscv_vsrl_vx_u32m1(__riscv_vadd_vx_u32m1(est, 1, vl), 1, vl);
+}
+
+// RecipSqrtEstimate(): 'a' in [128, 512) is a fraction in [0.25, 1). With d = 2 * a + 1 below 0.5 and
+// d = 2 * (a | 1) above, k is the smallest integer with d * k^2 >= 2^28 and the result is k >> 1
+static inline vuint32m1_t neon2rvv_rsqrt_estimate_u32(vuint32m1_t a, size_t vl) {
+  vbool32_t low_mask = __riscv_vmsltu_vx_u32m1_b32(a, 256, vl);
+  vuint32m1_t d = __riscv_vsll_vx_u32m1(__riscv_vor_vx_u32m1(a, 1, vl), 1, vl);
+  d = __riscv_vmerge_vvm_u32m1(d, __riscv_vor_vx_u32m1(__riscv_vsll_vx_u32m1(a, 1, vl), 1, vl), low_mask, vl);
+  vfloat32m1_t d_f = __riscv_vfcvt_f_xu_v_f32m1(d, vl);
+  vfloat32m1_t root = __riscv_vfsqrt_v_f32m1(__riscv_vfrdiv_vf_f32m1(d_f, (float)(1u << 28), vl), vl);
+  // the truncated root is within one of floor(root), so at most two steps reach k
+  vuint32m1_t k = __riscv_vfcvt_rtz_xu_f_v_u32m1(root, vl);
+  vbool32_t under_mask =
+      __riscv_vmsltu_vx_u32m1_b32(__riscv_vmul_vv_u32m1(d, __riscv_vmul_vv_u32m1(k, k, vl), vl), 1u << 28, vl);
+  k = __riscv_vadd_vx_u32m1_mu(under_mask, k, k, 1, vl);
+  under_mask =
+      __riscv_vmsltu_vx_u32m1_b32(__riscv_vmul_vv_u32m1(d, __riscv_vmul_vv_u32m1(k, k, vl), vl), 1u << 28, vl);
+  k = __riscv_vadd_vx_u32m1_mu(under_mask, k, k, 1, vl);
+  return __riscv_vsrl_vx_u32m1(k, 1, vl);
+}
+
+// The float estimates follow FPRecipEstimate()/FPRSqrtEstimate() with round to nearest and no flush to zero: the
+// 8 fraction bits below the leading one pick the estimate, and the exponent is reflected around 253 (recpe) or
+// halved from 380 (rsqrte). Subnormal inputs are first scaled by 2^63, which is exact.
+static inline vfloat32m1_t neon2rvv_recpe_f32(vfloat32m1_t a, size_t vl) {
+#if !NEON2RVV_STRICT_ESTIMATE
+  return __riscv_vfrec7_v_f32m1(a, vl);
+#else
+  vuint32m1_t bits = __riscv_vreinterpret_v_f32m1_u32m1(a);
+  vuint32m1_t sign = __riscv_vand_vx_u32m1(bits, 0x80000000u, vl);
+  vuint32m1_t abs = __riscv_vand_vx_u32m1(bits, 0x7fffffffu, vl);
+  vbool32_t sub_mask = __riscv_vmsltu_vx_u32m1_b32(abs, 0x00800000u, vl);
+  vfloat32m1_t abs_f = __riscv_vreinterpret_v_u32m1_f32m1(abs);
+  vuint32m1_t norm = __riscv_vreinterpret_v_f32m1_u32m1(
+      __riscv_vfmul_vf_f32m1_mu(sub_mask, abs_f, abs_f, (float)(UINT64_C(1) << 63), vl));
+  vint32m1_t exp = __riscv_vreinterpret_v_u32m1_i32m1(__riscv_vsrl_vx_u32m1(norm, 23, vl));
+  exp = __riscv_vsub_vx_i32m1_mu(sub_mask, exp, exp, 63, vl);
+  vuint32m1_t idx =
+      __riscv_vor_vx_u32m1(__riscv_vand_vx_u32m1(__riscv_vsrl_vx_u32m1(norm, 15, vl), 0xff, vl), 0x100, vl);
+  vuint32m1_t frac =
+      __riscv_vsll_vx_u32m1(__riscv_vand_vx_u32m1(neon2rvv_recip_estimate_u32(idx, vl), 0xff, vl), 15, vl);
+  // a result exponent of 0 or -1 gives a subnormal result with the leading one shifted in
+  vint32m1_t res_exp = __riscv_vrsub_vx_i32m1(exp, 253, vl);
+  vbool32_t den_mask = __riscv_vmsle_vx_i32m1_b32(res_exp, 0, vl);
+  vuint32m1_t den_shift = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vrsub_vx_i32m1(res_exp, 1, vl));
+  frac = __riscv_vmerge_vvm_u32m1(
+      frac, __riscv_vsrl_vv_u32m1(__riscv_vor_vx_u32m1(frac, 0x00800000u, vl), den_shift, vl), den_mask, vl);
+  res_exp = __riscv_vmax_vx_i32m1(res_exp, 0, vl);
+  vuint32m1_t res = __riscv_vor_vv_u32m1(
+      __riscv_vor_vv_u32m1(sign, frac, vl),
+      __riscv_vsll_vx_u32m1(__riscv_vreinterpret_v_i32m1_u32m1(res_exp), 23, vl), vl);
+  // 1 / a overflows below 2^-128 (zeros included), infinities give zeros and NaNs are quietened
+  res = __riscv_vmerge_vvm_u32m1(res, __riscv_vor_vx_u32m1(sign, 0x7f800000u, vl),
+                                 __riscv_vmsltu_vx_u32m1_b32(abs, 0x00200000u, vl), vl);
+  res = __riscv_vmerge_vvm_u32m1(res, sign, __riscv_vmseq_vx_u32m1_b32(abs, 0x7f800000u, vl), vl);
+  res = __riscv_vmerge_vvm_u32m1(res, __riscv_vor_vx_u32m1(bits, 0x00400000u, vl),
+                                 __riscv_vmsgtu_vx_u32m1_b32(abs, 0x7f800000u, vl), vl);
+  return __riscv_vreinterpret_v_u32m1_f32m1(res);
+#endif
+}
+
+static inline vfloat64m1_t neon2rvv_recpe_f64(vfloat64m1_t a, size_t vl) {
+#if !NEON2RVV_STRICT_ESTIMATE
+  return __riscv_vfrec7_v_f64m1(a, vl);
+#else
+  vuint64m1_t bits = __riscv_vreinterpret_v_f64m1_u64m1(a);
+  vuint64m1_t sign = __riscv_vand_vx_u64m1(bits, UINT64_C(0x8000000000000000), vl);
+  vuint64m1_t abs = __riscv_vand_vx_u64m1(bits, UINT64_C(0x7fffffffffffffff), vl);
+  vbool64_t sub_mask = __riscv_vmsltu_vx_u64m1_b64(abs, UINT64_C(0x0010000000000000), vl);
+  vfloat64m1_t abs_f = __riscv_vreinterpret_v_u64m1_f64m1(abs);
+  vuint64m1_t norm = __riscv_vreinterpret_v_f64m1_u64m1(
+      __riscv_vfmul_vf_f64m1_mu(sub_mask, abs_f, abs_f, (double)(UINT64_C(1) << 63), vl));
+  vint64m1_t exp = __riscv_vreinterpret_v_u64m1_i64m1(__riscv_vsrl_vx_u64m1(norm, 52, vl));
+  exp = __riscv_vsub_vx_i64m1_mu(sub_mask, exp, exp, 63, vl);
+  vuint32m1_t idx = __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vncvt_x_x_w_u32mf2(
+      __riscv_vor_vx_u64m1(__riscv_vand_vx_u64m1(__riscv_vsrl_vx_u64m1(norm, 44, vl), 0xff, vl), 0x100, vl), vl));
+  vuint64m1_t est =
+      __riscv_vzext_vf2_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(neon2rvv_recip_estimate_u32(idx, vl)), vl);
+  vuint64m1_t frac = __riscv_vsll_vx_u64m1(__riscv_vand_vx_u64m1(est, 0xff, vl), 44, vl);
+  vint64m1_t res_exp = __riscv_vrsub_vx_i64m1(exp, 2045, vl);
+  vbool64_t den_mask = __riscv_vmsle_vx_i64m1_b64(res_exp, 0, vl);
+  vuint64m1_t den_shift = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vrsub_vx_i64m1(res_exp, 1, vl));
+  frac = __riscv_vmerge_vvm_u64m1(
+      frac, __riscv_vsrl_vv_u64m1(__riscv_vor_vx_u64m1(frac, UINT64_C(0x0010000000000000), vl), den_shift, vl),
+      den_mask, vl);
+  res_exp = __riscv_vmax_vx_i64m1(res_exp, 0, vl);
+  vuint64m1_t res = __riscv_vor_vv_u64m1(
+      __riscv_vor_vv_u64m1(sign, frac, vl),
+      __riscv_vsll_vx_u64m1(__riscv_vreinterpret_v_i64m1_u64m1(res_exp), 52, vl), vl);
+  // 1 / a overflows below 2^-1024 (zeros included), infinities give zeros and NaNs are quietened
+  res = __riscv_vmerge_vvm_u64m1(res, __riscv_vor_vx_u64m1(sign, UINT64_C(0x7ff0000000000000), vl),
+                                 __riscv_vmsltu_vx_u64m1_b64(abs, UINT64_C(0x0004000000000000), vl), vl);
+  res = __riscv_vmerge_vvm_u64m1(res, sign, __riscv_vmseq_vx_u64m1_b64(abs, UINT64_C(0x7ff0000000000000), vl), vl);
+  res = __riscv_vmerge_vvm_u64m1(res, __riscv_vor_vx_u64m1(bits, UINT64_C(0x0008000000000000), vl),
+                                 __riscv_vmsgtu_vx_u64m1_b64(abs, UINT64_C(0x7ff0000000000000), vl), vl);
+  return __riscv_vreinterpret_v_u64m1_f64m1(res);
+#endif
 }
 
-FORCE_INLINE uint32x2_t vrecpe_u32(uint32x2_t a) {
-  uint32_t input[2], output[2];
-  __riscv_vse32_v_u32m1(input, a, 2);
-  output[0] = vrecpe_u32_scalar_impl(input[0]);
-  output[1] = vrecpe_u32_scalar_impl(input[1]);
-  return __riscv_vle32_v_u32m1(output, 2);
+static inline vfloat32m1_t neon2rvv_rsqrte_f32(vfloat32m1_t a, size_t vl) {
+#if !NEON2RVV_STRICT_ESTIMATE
+  return __riscv_vfrsqrt7_v_f32m1(a, vl);
+#else
+  vuint32m1_t bits = __riscv_vreinterpret_v_f32m1_u32m1(a);
+  vuint32m1_t sign = __riscv_vand_vx_u32m1(bits, 0x80000000u, vl);
+  vuint32m1_t abs = __riscv_vand_vx_u32m1(bits, 0x7fffffffu, vl);
+  vbool32_t sub_mask = __riscv_vmsltu_vx_u32m1_b32(abs, 0x00800000u, vl);
+  vfloat32m1_t abs_f = __riscv_vreinterpret_v_u32m1_f32m1(abs);
+  vuint32m1_t norm = __riscv_vreinterpret_v_f32m1_u32m1(
+      __riscv_vfmul_vf_f32m1_mu(sub_mask, abs_f, abs_f, (float)(UINT64_C(1) << 63), vl));
+  vint32m1_t exp = __riscv_vreinterpret_v_u32m1_i32m1(__riscv_vsrl_vx_u32m1(norm, 23, vl));
+  exp = __riscv_vsub_vx_i32m1_mu(sub_mask, exp, exp, 63, vl);
+  // an odd exponent leaves the fraction in [0.25, 0.5)
+  vuint32m1_t idx =
+      __riscv_vor_vx_u32m1(__riscv_vand_vx_u32m1(__riscv_vsrl_vx_u32m1(norm, 15, vl), 0xff, vl), 0x100, vl);
+  vbool32_t odd_mask = __riscv_vmsne_vx_i32m1_b32(__riscv_vand_vx_i32m1(exp, 1, vl), 0, vl);
+  idx = __riscv_vsrl_vx_u32m1_mu(odd_mask, idx, idx, 1, vl);
+  vuint32m1_t frac =
+      __riscv_vsll_vx_u32m1(__riscv_vand_vx_u32m1(neon2rvv_rsqrt_estimate_u32(idx, vl), 0xff, vl), 15, vl);
+  vuint32m1_t res_exp =
+      __riscv_vsrl_vx_u32m1(__riscv_vreinterpret_v_i32m1_u32m1(__riscv_vrsub_vx_i32m1(exp, 380, vl)), 1, vl);
+  vuint32m1_t res = __riscv_vor_vv_u32m1(frac, __riscv_vsll_vx_u32m1(res_exp, 23, vl), vl);
+  // zeros give infinities of the same sign, other negative inputs the default NaN, +inf gives zero and NaNs are
+  // quietened
+  res = __riscv_vmerge_vxm_u32m1(res, 0x7fc00000u, __riscv_vmsgtu_vx_u32m1_b32(bits, 0x80000000u, vl), vl);
+  res = __riscv_vmerge_vvm_u32m1(res, __riscv_vor_vx_u32m1(sign, 0x7f800000u, vl),
+                                 __riscv_vmseq_vx_u32m1_b32(abs, 0, vl), vl);
+  res = __riscv_vmerge_vxm_u32m1(res, 0, __riscv_vmseq_vx_u32m1_b32(bits, 0x7f800000u, vl), vl);
+  res = __riscv_vmerge_vvm_u32m1(res, __riscv_vor_vx_u32m1(bits, 0x00400000u, vl),
+                                 __riscv_vmsgtu_vx_u32m1_b32(abs, 0x7f800000u, vl), vl);
+  return __riscv_vreinterpret_v_u32m1_f32m1(res);
+#endif
+}
+
+static inline vfloat64m1_t neon2rvv_rsqrte_f64(vfloat64m1_t a, size_t vl) {
+#if !NEON2RVV_STRICT_ESTIMATE
+  return __riscv_vfrsqrt7_v_f64m1(a, vl);
+#else
+  vuint64m1_t bits = __riscv_vreinterpret_v_f64m1_u64m1(a);
+  vuint64m1_t sign = __riscv_vand_vx_u64m1(bits, UINT64_C(0x8000000000000000), vl);
+  vuint64m1_t abs = __riscv_vand_vx_u64m1(bits, UINT64_C(0x7fffffffffffffff), vl);
+  vbool64_t sub_mask = __riscv_vmsltu_vx_u64m1_b64(abs, UINT64_C(0x0010000000000000), vl);
+  vfloat64m1_t abs_f = __riscv_vreinterpret_v_u64m1_f64m1(abs);
+  vuint64m1_t norm = __riscv_vreinterpret_v_f64m1_u64m1(
+      __riscv_vfmul_vf_f64m1_mu(sub_mask, abs_f, abs_f, (double)(UINT64_C(1) << 63), vl));
+  vint64m1_t exp = __riscv_vreinterpret_v_u64m1_i64m1(__riscv_vsrl_vx_u64m1(norm, 52, vl));
+  exp = __riscv_vsub_vx_i64m1_mu(sub_mask, exp, exp, 63, vl);
+  vuint64m1_t idx =
+      __riscv_vor_vx_u64m1(__riscv_vand_vx_u64m1(__riscv_vsrl_vx_u64m1(norm, 44, vl), 0xff, vl), 0x100, vl);
+  vbool64_t odd_mask = __riscv_vmsne_vx_i64m1_b64(__riscv_vand_vx_i64m1(exp, 1, vl), 0, vl);
+  idx = __riscv_vsrl_vx_u64m1_mu(odd_mask, idx, idx, 1, vl);
+  vuint32m1_t est = neon2rvv_rsqrt_estimate_u32(
+      __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vncvt_x_x_w_u32mf2(idx, vl)), vl);
+  vuint64m1_t frac = __riscv_vsll_vx_u64m1(
+      __riscv_vand_vx_u64m1(__riscv_vzext_vf2_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(est), vl), 0xff, vl), 44, vl);
+  vuint64m1_t res_exp =
+      __riscv_vsrl_vx_u64m1(__riscv_vreinterpret_v_i64m1_u64m1(__riscv_vrsub_vx_i64m1(exp, 3068, vl)), 1, vl);
+  vuint64m1_t res = __riscv_vor_vv_u64m1(frac, __riscv_vsll_vx_u64m1(res_exp, 52, vl), vl);
+  res = __riscv_vmerge_vxm_u64m1(res, UINT64_C(0x7ff8000000000000),
+                                 __riscv_vmsgtu_vx_u64m1_b64(bits, UINT64_C(0x8000000000000000), vl), vl);
+  res = __riscv_vmerge_vvm_u64m1(res, __riscv_vor_vx_u64m1(sign, UINT64_C(0x7ff0000000000000), vl),
+                                 __riscv_vmseq_vx_u64m1_b64(abs, 0, vl), vl);
+  res = __riscv_vmerge_vxm_u64m1(res, 0, __riscv_vmseq_vx_u64m1_b64(bits, UINT64_C(0x7ff0000000000000), vl), vl);
+  res = __riscv_vmerge_vvm_u64m1(res, __riscv_vor_vx_u64m1(bits, UINT64_C(0x0008000000000000), vl),
+                                 __riscv_vmsgtu_vx_u64m1_b64(abs, UINT64_C(0x7ff0000000000000), vl), vl);
+  return __riscv_vreinterpret_v_u64m1_f64m1(res);
+#endif
+}
+
+FORCE_INLINE float32x2_t vrecpe_f32(float32x2_t a) { return neon2rvv_recpe_f32(a, 2); }
+
+// The unsigned estimates treat 'a' as a fixed-point fraction in [0.5, 1) for vrecpe and [0.25, 1) for vrsqrte, and
+// return a 9-bit estimate in the top bits of each lane.
+static inline vuint32m1_t neon2rvv_recpe_u32(vuint32m1_t a, size_t vl) {
+  vbool32_t small_mask = __riscv_vmsltu_vx_u32m1_b32(a, 0x80000000u, vl);
+#if !NEON2RVV_STRICT_ESTIMATE
+  vfloat32m1_t est = __riscv_vfrec7_v_f32m1(__riscv_vfcvt_f_xu_v_f32m1(a, vl), vl);
+  vuint32m1_t res = __riscv_vfcvt_rtz_xu_f_v_u32m1(__riscv_vfmul_vf_f32m1(est, (float)(UINT64_C(1) << 63), vl), vl);
+#else
+  vuint32m1_t res =
+      __riscv_vsll_vx_u32m1(neon2rvv_recip_estimate_u32(__riscv_vsrl_vx_u32m1(a, 23, vl), vl), 23, vl);
+#endif
+  return __riscv_vmerge_vxm_u32m1(res, UINT32_MAX, small_mask, vl);
+}
+
+static inline vuint32m1_t neon2rvv_rsqrte_u32(vuint32m1_t a, size_t vl) {
+  vbool32_t small_mask = __riscv_vmsltu_vx_u32m1_b32(a, 0x40000000u, vl);
+#if !NEON2RVV_STRICT_ESTIMATE
+  vfloat32m1_t est = __riscv_vfrsqrt7_v_f32m1(__riscv_vfcvt_f_xu_v_f32m1(a, vl), vl);
+  vuint32m1_t res = __riscv_vfcvt_rtz_xu_f_v_u32m1(__riscv_vfmul_vf_f32m1(est, (float)(UINT64_C(1) << 47), vl), vl);
+#else
+  vuint32m1_t res =
+      __riscv_vsll_vx_u32m1(neon2rvv_rsqrt_estimate_u32(__riscv_vsrl_vx_u32m1(a, 23, vl), vl), 23, vl);
+#endif
+  return __riscv_vmerge_vxm_u32m1(res, UINT32_MAX, small_mask, vl);
 }
 
-FORCE_INLINE float32x4_t vrecpeq_f32(float32x4_t a) { return __riscv_vfrec7_v_f32m1(a, 4); }
+FORCE_INLINE uint32x2_t vrecpe_u32(uint32x2_t a) { return neon2rvv_recpe_u32(a, 2); }
 
-FORCE_INLINE float64x1_t vrecpe_f64(float64x1_t a) { return __riscv_vfrec7_v_f64m1(a, 1); }
+FORCE_INLINE float32x4_t vrecpeq_f32(float32x4_t a) { return neon2rvv_recpe_f32(a, 4); }
 
-FORCE_INLINE float64x2_t vrecpeq_f64(float64x2_t a) { return __riscv_vfrec7_v_f64m1(a, 2); }
+FORCE_INLINE float64x1_t vrecpe_f64(float64x1_t a) { return neon2rvv_recpe_f64(a, 1); }
 
-FORCE_INLINE float32_t vrecpes_f32(float32_t a) { return 1.0f / a; }
+FORCE_INLINE float64x2_t vrecpeq_f64(float64x2_t a) { return neon2rvv_recpe_f64(a, 2); }
 
-FORCE_INLINE float64_t vrecped_f64(float64_t a) { return 1.0f / a; }
+FORCE_INLINE float32_t vrecpes_f32(float32_t a) {
+  return __riscv_vfmv_f_s_f32m1_f32(neon2rvv_recpe_f32(__riscv_vfmv_s_f_f32m1(a, 1), 1));
+}
 
-FORCE_INLINE uint32x4_t vrecpeq_u32(uint32x4_t a) {
-  uint32_t input[4], output[4];
-  __riscv_vse32_v_u32m1(input, a, 4);
-  output[0] = vrecpe_u32_scalar_impl(input[0]);
-  output[1] = vrecpe_u32_scalar_impl(input[1]);
-  output[2] = vrecpe_u32_scalar_impl(input[2]);
-  output[3] = vrecpe_u32_scalar_impl(input[3]);
-  return __riscv_vle32_v_u32m1(output, 4);
+FORCE_INLINE float64_t vrecped_f64(float64_t a) {
+  return __riscv_vfmv_f_s_f64m1_f64(neon2rvv_recpe_f64(__riscv_vfmv_s_f_f64m1(a, 1), 1));
 }
 
-FORCE_INLINE float32x2_t vrsqrte_f32(float32x2_t a) { return __riscv_vfrsqrt7_v_f32m1(a, 2); }
+FORCE_INLINE uint32x4_t vrecpeq_u32(uint32x4_t a) { return neon2rvv_recpe_u32(a, 4); }
 
-// FORCE_INLINE uint32x2_t vrsqrte_u32(uint32x2_t a);
+FORCE_INLINE float32x2_t vrsqrte_f32(float32x2_t a) { return neon2rvv_rsqrte_f32(a, 2); }
 
-FORCE_INLINE float32x4_t vrsqrteq_f32(float32x4_t a) { return __riscv_vfrsqrt7_v_f32m1(a, 4); }
+FORCE_INLINE uint32x2_t vrsqrte_u32(uint32x2_t a) { return neon2rvv_rsqrte_u32(a, 2); }
 
-FORCE_INLINE float64x1_t vrsqrte_f64(float64x1_t a) { return __riscv_vfrsqrt7_v_f64m1(a, 1); }
+FORCE_INLINE float32x4_t vrsqrteq_f32(float32x4_t a) { return neon2rvv_rsqrte_f32(a, 4); }
 
-FORCE_INLINE float64x2_t vrsqrteq_f64(float64x2_t a) { return __riscv_vfrsqrt7_v_f64m1(a, 2); }
+FORCE_INLINE float64x1_t vrsqrte_f64(float64x1_t a) { return neon2rvv_rsqrte_f64(a, 1); }
 
-FORCE_INLINE float32_t vrsqrtes_f32(float32_t a) { return 1 / sqrtf(a); }
+FORCE_INLINE float64x2_t vrsqrteq_f64(float64x2_t a) { return neon2rvv_rsqrte_f64(a, 2); }
 
-FORCE_INLINE float64_t vrsqrted_f64(float64_t a) { return 1 / sqrt(a); }
+FORCE_INLINE float32_t vrsqrtes_f32(float32_t a) {
+  return __riscv_vfmv_f_s_f32m1_f32(neon2rvv_rsqrte_f32(__riscv_vfmv_s_f_f32m1(a, 1), 1));
+}
+
+FORCE_INLINE float64_t vrsqrted_f64(float64_t a) {
+  return __riscv_vfmv_f_s_f64m1_f64(neon2rvv_rsqrte_f64(__riscv_vfmv_s_f_f64m1(a, 1), 1));
+}
 
-// FORCE_INLINE uint32x4_t vrsqrteq_u32(uint32x4_t a);
+FORCE_INLINE uint32x4_t vrsqrteq_u32(uint32x4_t a) { return neon2rvv_rsqrte_u32(a, 4); }
 
 FORCE_INLINE int8_t vget_lane_s8(int8x8_t a, const int b) {
   return __riscv_vmv_x_s_i8m1_i8(__riscv_vslidedown_vx_i8m1(a, b, 8));
@@ -8502,57 +9178,81 @@ FORCE_INLINE float64_t vcvtd_f64_u64(uint64_t a) { return (float64_t)a; }
 
 FORCE_INLINE uint32x4_t vcvtq_u32_f32(float32x4_t a) { return __riscv_vfcvt_rtz_xu_f_v_u32m1(a, 4); }
 
-// FORCE_INLINE int32x2_t vcvtn_s32_f32(float32x2_t a);
+FORCE_INLINE int32x2_t vcvtn_s32_f32(float32x2_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RNE, 2); }
 
-// FORCE_INLINE int32x4_t vcvtnq_s32_f32(float32x4_t a);
+FORCE_INLINE int32x4_t vcvtnq_s32_f32(float32x4_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RNE, 4); }
 
-// FORCE_INLINE uint32x2_t vcvtn_u32_f32(float32x2_t a);
+FORCE_INLINE uint32x2_t vcvtn_u32_f32(float32x2_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RNE, 2); }
 
-// FORCE_INLINE uint32x4_t vcvtnq_u32_f32(float32x4_t a);
+FORCE_INLINE uint32x4_t vcvtnq_u32_f32(float32x4_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RNE, 4); }
 
-// FORCE_INLINE int32x2_t vcvtm_s32_f32(float32x2_t a);
+FORCE_INLINE int32x2_t vcvtm_s32_f32(float32x2_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RDN, 2); }
 
-// FORCE_INLINE int32x4_t vcvtmq_s32_f32(float32x4_t a);
+FORCE_INLINE int32x4_t vcvtmq_s32_f32(float32x4_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RDN, 4); }
 
-// FORCE_INLINE uint32x2_t vcvtm_u32_f32(float32x2_t a);
+FORCE_INLINE uint32x2_t vcvtm_u32_f32(float32x2_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RDN, 2); }
 
-// FORCE_INLINE uint32x4_t vcvtmq_u32_f32(float32x4_t a);
+FORCE_INLINE uint32x4_t vcvtmq_u32_f32(float32x4_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RDN, 4); }
 
-// FORCE_INLINE int32x2_t vcvtp_s32_f32(float32x2_t a);
+FORCE_INLINE int32x2_t vcvtp_s32_f32(float32x2_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RUP, 2); }
 
-// FORCE_INLINE int32x4_t vcvtpq_s32_f32(float32x4_t a);
+FORCE_INLINE int32x4_t vcvtpq_s32_f32(float32x4_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RUP, 4); }
 
-// FORCE_INLINE uint32x2_t vcvtp_u32_f32(float32x2_t a);
+FORCE_INLINE uint32x2_t vcvtp_u32_f32(float32x2_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RUP, 2); }
 
-// FORCE_INLINE uint32x4_t vcvtpq_u32_f32(float32x4_t a);
+FORCE_INLINE uint32x4_t vcvtpq_u32_f32(float32x4_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RUP, 4); }
 
-// FORCE_INLINE int32x2_t vcvta_s32_f32(float32x2_t a);
+FORCE_INLINE int32x2_t vcvta_s32_f32(float32x2_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RMM, 2); }
 
-// FORCE_INLINE int32x4_t vcvtaq_s32_f32(float32x4_t a);
+FORCE_INLINE int32x4_t vcvtaq_s32_f32(float32x4_t a) { return __riscv_vfcvt_x_f_v_i32m1_rm(a, __RISCV_FRM_RMM, 4); }
 
-// FORCE_INLINE uint32x2_t vcvta_u32_f32(float32x2_t a);
+FORCE_INLINE uint32x2_t vcvta_u32_f32(float32x2_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RMM, 2); }
 
-// FORCE_INLINE uint32x4_t vcvtaq_u32_f32(float32x4_t a);
+FORCE_INLINE uint32x4_t vcvtaq_u32_f32(float32x4_t a) { return __riscv_vfcvt_xu_f_v_u32m1_rm(a, __RISCV_FRM_RMM, 4); }
 
 // FORCE_INLINE int32_t vcvts_s32_f32(float32_t a);
 
 // FORCE_INLINE uint32_t vcvts_u32_f32(float32_t a);
 
-// FORCE_INLINE int32_t vcvtns_s32_f32(float32_t a);
+FORCE_INLINE int32_t vcvtns_s32_f32(float32_t a) {
+  vint32m1_t r = __riscv_vfcvt_x_f_v_i32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RNE, 1);
+  return __riscv_vmv_x_s_i32m1_i32(r);
+}
 
-// FORCE_INLINE uint32_t vcvtns_u32_f32(float32_t a);
+FORCE_INLINE uint32_t vcvtns_u32_f32(float32_t a) {
+  vuint32m1_t r = __riscv_vfcvt_xu_f_v_u32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RNE, 1);
+  return __riscv_vmv_x_s_u32m1_u32(r);
+}
 
-// FORCE_INLINE int32_t vcvtms_s32_f32(float32_t a);
+FORCE_INLINE int32_t vcvtms_s32_f32(float32_t a) {
+  vint32m1_t r = __riscv_vfcvt_x_f_v_i32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RDN, 1);
+  return __riscv_vmv_x_s_i32m1_i32(r);
+}
 
-// FORCE_INLINE uint32_t vcvtms_u32_f32(float32_t a);
+FORCE_INLINE uint32_t vcvtms_u32_f32(float32_t a) {
+  vuint32m1_t r = __riscv_vfcvt_xu_f_v_u32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RDN, 1);
+  return __riscv_vmv_x_s_u32m1_u32(r);
+}
 
-// FORCE_INLINE int32_t vcvtps_s32_f32(float32_t a);
+FORCE_INLINE int32_t vcvtps_s32_f32(float32_t a) {
+  vint32m1_t r = __riscv_vfcvt_x_f_v_i32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RUP, 1);
+  return __riscv_vmv_x_s_i32m1_i32(r);
+}
 
-// FORCE_INLINE uint32_t vcvtps_u32_f32(float32_t a);
+FORCE_INLINE uint32_t vcvtps_u32_f32(float32_t a) {
+  vuint32m1_t r = __riscv_vfcvt_xu_f_v_u32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RUP, 1);
+  return __riscv_vmv_x_s_u32m1_u32(r);
+}
 
-// FORCE_INLINE int32_t vcvtas_s32_f32(float32_t a);
+FORCE_INLINE int32_t vcvtas_s32_f32(float32_t a) {
+  vint32m1_t r = __riscv_vfcvt_x_f_v_i32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RMM, 1);
+  return __riscv_vmv_x_s_i32m1_i32(r);
+}
 
-// FORCE_INLINE uint32_t vcvtas_u32_f32(float32_t a);
+FORCE_INLINE uint32_t vcvtas_u32_f32(float32_t a) {
+  vuint32m1_t r = __riscv_vfcvt_xu_f_v_u32m1_rm(__riscv_vfmv_s_f_f32m1(a, 1), __RISCV_FRM_RMM, 1);
+  return __riscv_vmv_x_s_u32m1_u32(r);
+}
 
 FORCE_INLINE int64x1_t vcvt_s64_f64(float64x1_t a) { return __riscv_vfcvt_rtz_x_f_v_i64m1(a, 1); }
 
@@ -8562,130 +9262,225 @@ FORCE_INLINE uint64x1_t vcvt_u64_f64(float64x1_t a) { return __riscv_vfcvt_rtz_x
 
 FORCE_INLINE uint64x2_t vcvtq_u64_f64(float64x2_t a) { return __riscv_vfcvt_rtz_xu_f_v_u64m1(a, 2); }
 
-// FORCE_INLINE int64x1_t vcvtn_s64_f64(float64x1_t a);
+FORCE_INLINE int64x1_t vcvtn_s64_f64(float64x1_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RNE, 1); }
 
-// FORCE_INLINE int64x2_t vcvtnq_s64_f64(float64x2_t a);
+FORCE_INLINE int64x2_t vcvtnq_s64_f64(float64x2_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RNE, 2); }
 
-// FORCE_INLINE uint64x1_t vcvtn_u64_f64(float64x1_t a);
+FORCE_INLINE uint64x1_t vcvtn_u64_f64(float64x1_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RNE, 1); }
 
-// FORCE_INLINE uint64x2_t vcvtnq_u64_f64(float64x2_t a);
+FORCE_INLINE uint64x2_t vcvtnq_u64_f64(float64x2_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RNE, 2); }
 
-// FORCE_INLINE int64x1_t vcvtm_s64_f64(float64x1_t a);
+FORCE_INLINE int64x1_t vcvtm_s64_f64(float64x1_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RDN, 1); }
 
-// FORCE_INLINE int64x2_t vcvtmq_s64_f64(float64x2_t a);
+FORCE_INLINE int64x2_t vcvtmq_s64_f64(float64x2_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RDN, 2); }
 
-// FORCE_INLINE uint64x1_t vcvtm_u64_f64(float64x1_t a);
+FORCE_INLINE uint64x1_t vcvtm_u64_f64(float64x1_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RDN, 1); }
 
-// FORCE_INLINE uint64x2_t vcvtmq_u64_f64(float64x2_t a);
+FORCE_INLINE uint64x2_t vcvtmq_u64_f64(float64x2_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RDN, 2); }
 
-// FORCE_INLINE int64x1_t vcvtp_s64_f64(float64x1_t a);
+FORCE_INLINE int64x1_t vcvtp_s64_f64(float64x1_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RUP, 1); }
 
-// FORCE_INLINE int64x2_t vcvtpq_s64_f64(float64x2_t a);
+FORCE_INLINE int64x2_t vcvtpq_s64_f64(float64x2_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RUP, 2); }
 
-// FORCE_INLINE uint64x1_t vcvtp_u64_f64(float64x1_t a);
+FORCE_INLINE uint64x1_t vcvtp_u64_f64(float64x1_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RUP, 1); }
 
-// FORCE_INLINE uint64x2_t vcvtpq_u64_f64(float64x2_t a);
+FORCE_INLINE uint64x2_t vcvtpq_u64_f64(float64x2_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RUP, 2); }
 
-// FORCE_INLINE int64x1_t vcvta_s64_f64(float64x1_t a);
+FORCE_INLINE int64x1_t vcvta_s64_f64(float64x1_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RMM, 1); }
 
-// FORCE_INLINE int64x2_t vcvtaq_s64_f64(float64x2_t a);
+FORCE_INLINE int64x2_t vcvtaq_s64_f64(float64x2_t a) { return __riscv_vfcvt_x_f_v_i64m1_rm(a, __RISCV_FRM_RMM, 2); }
 
-// FORCE_INLINE uint64x1_t vcvta_u64_f64(float64x1_t a);
+FORCE_INLINE uint64x1_t vcvta_u64_f64(float64x1_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RMM, 1); }
 
-// FORCE_INLINE uint64x2_t vcvtaq_u64_f64(float64x2_t a);
+FORCE_INLINE uint64x2_t vcvtaq_u64_f64(float64x2_t a) { return __riscv_vfcvt_xu_f_v_u64m1_rm(a, __RISCV_FRM_RMM, 2); }
 
 FORCE_INLINE int64_t vcvtd_s64_f64(float64_t a) { return (int64_t)a; }
 
 FORCE_INLINE uint64_t vcvtd_u64_f64(float64_t a) { return (uint64_t)a; }
 
-// FORCE_INLINE int64_t vcvtnd_s64_f64(float64_t a);
+FORCE_INLINE int64_t vcvtnd_s64_f64(float64_t a) {
+  vint64m1_t r = __riscv_vfcvt_x_f_v_i64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RNE, 1);
+  return __riscv_vmv_x_s_i64m1_i64(r);
+}
+
+FORCE_INLINE uint64_t vcvtnd_u64_f64(float64_t a) {
+  vuint64m1_t r = __riscv_vfcvt_xu_f_v_u64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RNE, 1);
+  return __riscv_vmv_x_s_u64m1_u64(r);
+}
 
-// FORCE_INLINE uint64_t vcvtnd_u64_f64(float64_t a);
+FORCE_INLINE int64_t vcvtmd_s64_f64(float64_t a) {
+  vint64m1_t r = __riscv_vfcvt_x_f_v_i64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RDN, 1);
+  return __riscv_vmv_x_s_i64m1_i64(r);
+}
 
-// FORCE_INLINE int64_t vcvtmd_s64_f64(float64_t a);
+FORCE_INLINE uint64_t vcvtmd_u64_f64(float64_t a) {
+  vuint64m1_t r = __riscv_vfcvt_xu_f_v_u64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RDN, 1);
+  return __riscv_vmv_x_s_u64m1_u64(r);
+}
 
-// FORCE_INLINE uint64_t vcvtmd_u64_f64(float64_t a);
+FORCE_INLINE int64_t vcvtpd_s64_f64(float64_t a) {
+  vint64m1_t r = __riscv_vfcvt_x_f_v_i64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RUP, 1);
+  return __riscv_vmv_x_s_i64m1_i64(r);
+}
 
-// FORCE_INLINE int64_t vcvtpd_s64_f64(float64_t a);
+FORCE_INLINE uint64_t vcvtpd_u64_f64(float64_t a) {
+  vuint64m1_t r = __riscv_vfcvt_xu_f_v_u64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RUP, 1);
+  return __riscv_vmv_x_s_u64m1_u64(r);
+}
 
-// FORCE_INLINE uint64_t vcvtpd_u64_f64(float64_t a);
+FORCE_INLINE int64_t vcvtad_s64_f64(float64_t a) {
+  vint64m1_t r = __riscv_vfcvt_x_f_v_i64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RMM, 1);
+  return __riscv_vmv_x_s_i64m1_i64(r);
+}
 
-// FORCE_INLINE int64_t vcvtad_s64_f64(float64_t a);
+FORCE_INLINE uint64_t vcvtad_u64_f64(float64_t a) {
+  vuint64m1_t r = __riscv_vfcvt_xu_f_v_u64m1_rm(__riscv_vfmv_s_f_f64m1(a, 1), __RISCV_FRM_RMM, 1);
+  return __riscv_vmv_x_s_u64m1_u64(r);
+}
 
-// FORCE_INLINE uint64_t vcvtad_u64_f64(float64_t a);
+// 2^n for the fixed-point conversions, n in [1, 64]. It folds to a constant for an immediate n, and scaling by a power
+// of two is exact, so the vfcvt stays the only rounding step.
+static inline float64_t neon2rvv_fixed_scale(const int n) { return (float64_t)(UINT64_C(1) << (n - 1)) * 2.0; }
 
 FORCE_INLINE int32x2_t vcvt_n_s32_f32(float32x2_t a, const int b) {
   vfloat32m1_t a_mul_pow2_b = __riscv_vfmul_vf_f32m1(a, (uint64_t)1 << b, 2);
   return __riscv_vfcvt_rtz_x_f_v_i32m1(a_mul_pow2_b, 2);
 }
 
-// FORCE_INLINE float32x2_t vcvt_n_f32_s32(int32x2_t a, const int b);
+FORCE_INLINE float32x2_t vcvt_n_f32_s32(int32x2_t a, const int b) {
+  return __riscv_vfmul_vf_f32m1(__riscv_vfcvt_f_x_v_f32m1(a, 2), 1.0 / neon2rvv_fixed_scale(b), 2);
+}
 
-// FORCE_INLINE float32x2_t vcvt_n_f32_u32(uint32x2_t a, const int b);
+FORCE_INLINE float32x2_t vcvt_n_f32_u32(uint32x2_t a, const int b) {
+  return __riscv_vfmul_vf_f32m1(__riscv_vfcvt_f_xu_v_f32m1(a, 2), 1.0 / neon2rvv_fixed_scale(b), 2);
+}
 
-// FORCE_INLINE uint32x2_t vcvt_n_u32_f32(float32x2_t a, const int b);
+FORCE_INLINE uint32x2_t vcvt_n_u32_f32(float32x2_t a, const int b) {
+  return __riscv_vfcvt_rtz_xu_f_v_u32m1(__riscv_vfmul_vf_f32m1(a, neon2rvv_fixed_scale(b), 2), 2);
+}
 
-// FORCE_INLINE int32x4_t vcvtq_n_s32_f32(float32x4_t a, const int b);
+FORCE_INLINE int32x4_t vcvtq_n_s32_f32(float32x4_t a, const int b) {
+  return __riscv_vfcvt_rtz_x_f_v_i32m1(__riscv_vfmul_vf_f32m1(a, neon2rvv_fixed_scale(b), 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vcvtq_n_f32_s32(int32x4_t a, const int b);
+FORCE_INLINE float32x4_t vcvtq_n_f32_s32(int32x4_t a, const int b) {
+  return __riscv_vfmul_vf_f32m1(__riscv_vfcvt_f_x_v_f32m1(a, 4), 1.0 / neon2rvv_fixed_scale(b), 4);
+}
 
-// FORCE_INLINE float32x4_t vcvtq_n_f32_u32(uint32x4_t a, const int b);
+FORCE_INLINE float32x4_t vcvtq_n_f32_u32(uint32x4_t a, const int b) {
+  return __riscv_vfmul_vf_f32m1(__riscv_vfcvt_f_xu_v_f32m1(a, 4), 1.0 / neon2rvv_fixed_scale(b), 4);
+}
 
-// FORCE_INLINE float32_t vcvts_n_f32_s32(int32_t a, const int n);
+FORCE_INLINE float32_t vcvts_n_f32_s32(int32_t a, const int n) {
+  return (float32_t)a * (float32_t)(1.0 / neon2rvv_fixed_scale(n));
+}
 
-// FORCE_INLINE float32_t vcvts_n_f32_u32(uint32_t a, const int n);
+FORCE_INLINE float32_t vcvts_n_f32_u32(uint32_t a, const int n) {
+  return (float32_t)a * (float32_t)(1.0 / neon2rvv_fixed_scale(n));
+}
 
-// FORCE_INLINE float64x1_t vcvt_n_f64_s64(int64x1_t a, const int n);
+FORCE_INLINE float64x1_t vcvt_n_f64_s64(int64x1_t a, const int n) {
+  return __riscv_vfmul_vf_f64m1(__riscv_vfcvt_f_x_v_f64m1(a, 1), 1.0 / neon2rvv_fixed_scale(n), 1);
+}
 
-// FORCE_INLINE float64x2_t vcvtq_n_f64_s64(int64x2_t a, const int n);
+FORCE_INLINE float64x2_t vcvtq_n_f64_s64(int64x2_t a, const int n) {
+  return __riscv_vfmul_vf_f64m1(__riscv_vfcvt_f_x_v_f64m1(a, 2), 1.0 / neon2rvv_fixed_scale(n), 2);
+}
 
-// FORCE_INLINE float64x1_t vcvt_n_f64_u64(uint64x1_t a, const int n);
+FORCE_INLINE float64x1_t vcvt_n_f64_u64(uint64x1_t a, const int n) {
+  return __riscv_vfmul_vf_f64m1(__riscv_vfcvt_f_xu_v_f64m1(a, 1), 1.0 / neon2rvv_fixed_scale(n), 1);
+}
 
-// FORCE_INLINE float64x2_t vcvtq_n_f64_u64(uint64x2_t a, const int n);
+FORCE_INLINE float64x2_t vcvtq_n_f64_u64(uint64x2_t a, const int n) {
+  return __riscv_vfmul_vf_f64m1(__riscv_vfcvt_f_xu_v_f64m1(a, 2), 1.0 / neon2rvv_fixed_scale(n), 2);
+}
 
-// FORCE_INLINE float64_t vcvtd_n_f64_s64(int64_t a, const int n);
+FORCE_INLINE float64_t vcvtd_n_f64_s64(int64_t a, const int n) {
+  return (float64_t)a * (float64_t)(1.0 / neon2rvv_fixed_scale(n));
+}
 
-// FORCE_INLINE float64_t vcvtd_n_f64_u64(uint64_t a, const int n);
+FORCE_INLINE float64_t vcvtd_n_f64_u64(uint64_t a, const int n) {
+  return (float64_t)a * (float64_t)(1.0 / neon2rvv_fixed_scale(n));
+}
 
 // FORCE_INLINE float16x4_t vcvt_f16_f32(float32x4_t a);
 
 // FORCE_INLINE float16x8_t vcvt_high_f16_f32(float16x4_t r, float32x4_t a);
 
-// FORCE_INLINE float32x2_t vcvt_f32_f64(float64x2_t a);
+FORCE_INLINE float32x2_t vcvt_f32_f64(float64x2_t a) {
+  return __riscv_vlmul_ext_v_f32mf2_f32m1(__riscv_vfncvt_f_f_w_f32mf2(a, 2));
+}
 
-// FORCE_INLINE float32x4_t vcvt_high_f32_f64(float32x2_t r, float64x2_t a);
+FORCE_INLINE float32x4_t vcvt_high_f32_f64(float32x2_t r, float64x2_t a) {
+  vfloat32m1_t cvt = __riscv_vlmul_ext_v_f32mf2_f32m1(__riscv_vfncvt_f_f_w_f32mf2(a, 2));
+  return __riscv_vslideup_vx_f32m1(r, cvt, 2, 4);
+}
 
 // FORCE_INLINE float32x4_t vcvt_f32_f16(float16x4_t a);
 
 // FORCE_INLINE float32x4_t vcvt_high_f32_f16(float16x8_t a);
 
-// FORCE_INLINE float64x2_t vcvt_f64_f32(float32x2_t a);
+FORCE_INLINE float64x2_t vcvt_f64_f32(float32x2_t a) {
+  return __riscv_vfwcvt_f_f_v_f64m1(__riscv_vlmul_trunc_v_f32m1_f32mf2(a), 2);
+}
 
-// FORCE_INLINE float64x2_t vcvt_high_f64_f32(float32x4_t a);
+FORCE_INLINE float64x2_t vcvt_high_f64_f32(float32x4_t a) {
+  vfloat32m1_t a_high = __riscv_vslidedown_vx_f32m1(a, 2, 4);
+  return __riscv_vfwcvt_f_f_v_f64m1(__riscv_vlmul_trunc_v_f32m1_f32mf2(a_high), 2);
+}
 
-// FORCE_INLINE float32x2_t vcvtx_f32_f64(float64x2_t a);
+FORCE_INLINE float32x2_t vcvtx_f32_f64(float64x2_t a) {
+  return __riscv_vlmul_ext_v_f32mf2_f32m1(__riscv_vfncvt_rod_f_f_w_f32mf2(a, 2));
+}
 
-// FORCE_INLINE float32_t vcvtxd_f32_f64(float64_t a);
+FORCE_INLINE float32_t vcvtxd_f32_f64(float64_t a) {
+  return __riscv_vfmv_f_s_f32mf2_f32(__riscv_vfncvt_rod_f_f_w_f32mf2(__riscv_vfmv_s_f_f64m1(a, 1), 1));
+}
 
-// FORCE_INLINE float32x4_t vcvtx_high_f32_f64(float32x2_t r, float64x2_t a);
+FORCE_INLINE float32x4_t vcvtx_high_f32_f64(float32x2_t r, float64x2_t a) {
+  vfloat32m1_t cvt = __riscv_vlmul_ext_v_f32mf2_f32m1(__riscv_vfncvt_rod_f_f_w_f32mf2(a, 2));
+  return __riscv_vslideup_vx_f32m1(r, cvt, 2, 4);
+}
 
-// FORCE_INLINE uint32x4_t vcvtq_n_u32_f32(float32x4_t a, const int b);
+FORCE_INLINE uint32x4_t vcvtq_n_u32_f32(float32x4_t a, const int b) {
+  return __riscv_vfcvt_rtz_xu_f_v_u32m1(__riscv_vfmul_vf_f32m1(a, neon2rvv_fixed_scale(b), 4), 4);
+}
 
-// FORCE_INLINE int32_t vcvts_n_s32_f32(float32_t a, const int n);
+FORCE_INLINE int32_t vcvts_n_s32_f32(float32_t a, const int n) {
+  vfloat32m1_t scaled = __riscv_vfmv_s_f_f32m1(a * (float32_t)neon2rvv_fixed_scale(n), 1);
+  return __riscv_vmv_x_s_i32m1_i32(__riscv_vfcvt_rtz_x_f_v_i32m1(scaled, 1));
+}
 
-// FORCE_INLINE uint32_t vcvts_n_u32_f32(float32_t a, const int n);
+FORCE_INLINE uint32_t vcvts_n_u32_f32(float32_t a, const int n) {
+  vfloat32m1_t scaled = __riscv_vfmv_s_f_f32m1(a * (float32_t)neon2rvv_fixed_scale(n), 1);
+  return __riscv_vmv_x_s_u32m1_u32(__riscv_vfcvt_rtz_xu_f_v_u32m1(scaled, 1));
+}
 
-// FORCE_INLINE int64x1_t vcvt_n_s64_f64(float64x1_t a, const int n);
+FORCE_INLINE int64x1_t vcvt_n_s64_f64(float64x1_t a, const int n) {
+  return __riscv_vfcvt_rtz_x_f_v_i64m1(__riscv_vfmul_vf_f64m1(a, neon2rvv_fixed_scale(n), 1), 1);
+}
 
-// FORCE_INLINE int64x2_t vcvtq_n_s64_f64(float64x2_t a, const int n);
+FORCE_INLINE int64x2_t vcvtq_n_s64_f64(float64x2_t a, const int n) {
+  return __riscv_vfcvt_rtz_x_f_v_i64m1(__riscv_vfmul_vf_f64m1(a, neon2rvv_fixed_scale(n), 2), 2);
+}
 
-// FORCE_INLINE uint64x1_t vcvt_n_u64_f64(float64x1_t a, const int n);
+FORCE_INLINE uint64x1_t vcvt_n_u64_f64(float64x1_t a, const int n) {
+  return __riscv_vfcvt_rtz_xu_f_v_u64m1(__riscv_vfmul_vf_f64m1(a, neon2rvv_fixed_scale(n), 1), 1);
+}
 
-// FORCE_INLINE uint64x2_t vcvtq_n_u64_f64(float64x2_t a, const int n);
+FORCE_INLINE uint64x2_t vcvtq_n_u64_f64(float64x2_t a, const int n) {
+  return __riscv_vfcvt_rtz_xu_f_v_u64m1(__riscv_vfmul_vf_f64m1(a, neon2rvv_fixed_scale(n), 2), 2);
+}
 
-// FORCE_INLINE int64_t vcvtd_n_s64_f64(float64_t a, const int n);
+FORCE_INLINE int64_t vcvtd_n_s64_f64(float64_t a, const int n) {
+  vfloat64m1_t scaled = __riscv_vfmv_s_f_f64m1(a * (float64_t)neon2rvv_fixed_scale(n), 1);
+  return __riscv_vmv_x_s_i64m1_i64(__riscv_vfcvt_rtz_x_f_v_i64m1(scaled, 1));
+}
 
-// FORCE_INLINE uint64_t vcvtd_n_u64_f64(float64_t a, const int n);
+FORCE_INLINE uint64_t vcvtd_n_u64_f64(float64_t a, const int n) {
+  vfloat64m1_t scaled = __riscv_vfmv_s_f_f64m1(a * (float64_t)neon2rvv_fixed_scale(n), 1);
+  return __riscv_vmv_x_s_u64m1_u64(__riscv_vfcvt_rtz_xu_f_v_u64m1(scaled, 1));
+}
 
 FORCE_INLINE int8x8_t vmovn_s16(int16x8_t a) { return __riscv_vnsra_wx_i8m1(__riscv_vlmul_ext_v_i16m1_i16m2(a), 0, 8); }
 
@@ -8710,33 +9505,63 @@ FORCE_INLINE uint32x2_t vmovn_u64(uint64x2_t a) {
 }
 
 FORCE_INLINE int8x16_t vmovn_high_s16(int8x8_t r, int16x8_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vnsra_wx_i8m1_mu(neon2rvv_high_half_b8(), r, a_hi, 0, 16);
+#else
   vint8m1_t movn = __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vnsra_wx_i8mf2(a, 0, 8));
   return __riscv_vslideup_vx_i8m1(r, movn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vmovn_high_s32(int16x4_t r, int32x4_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vnsra_wx_i16m1_mu(neon2rvv_high_half_b16(), r, a_hi, 0, 8);
+#else
   vint16m1_t movn = __riscv_vlmul_ext_v_i16mf2_i16m1(__riscv_vnsra_wx_i16mf2(a, 0, 4));
   return __riscv_vslideup_vx_i16m1(r, movn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vmovn_high_s64(int32x2_t r, int64x2_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vnsra_wx_i32m1_mu(neon2rvv_high_half_b32(), r, a_hi, 0, 4);
+#else
   vint32m1_t movn = __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vnsra_wx_i32mf2(a, 0, 2));
   return __riscv_vslideup_vx_i32m1(r, movn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vmovn_high_u16(uint8x8_t r, uint16x8_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vnsrl_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_hi, 0, 16);
+#else
   vuint8m1_t movn = __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vnsrl_wx_u8mf2(a, 0, 8));
   return __riscv_vslideup_vx_u8m1(r, movn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vmovn_high_u32(uint16x4_t r, uint32x4_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vnsrl_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_hi, 0, 8);
+#else
   vuint16m1_t movn = __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnsrl_wx_u16mf2(a, 0, 4));
   return __riscv_vslideup_vx_u16m1(r, movn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmovn_high_u64(uint32x2_t r, uint64x2_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vnsrl_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_hi, 0, 4);
+#else
   vuint32m1_t movn = __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnsrl_wx_u32mf2(a, 0, 2));
   return __riscv_vslideup_vx_u32m1(r, movn, 2, 4);
+#endif
 }
 
 FORCE_INLINE int8x8_t vqmovn_s16(int16x8_t a) {
@@ -8763,85 +9588,76 @@ FORCE_INLINE uint32x2_t vqmovn_u64(uint64x2_t a) {
   return __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnclipu_wx_u32mf2(a, 0, __RISCV_VXRM_RDN, 2));
 }
 
-FORCE_INLINE int8_t vqmovnh_s16(int16_t a) {
-  if (a > INT8_MAX)
-    return (int8_t)INT8_MAX;
-  if (a < INT8_MIN)
-    return (int8_t)INT8_MIN;
-  return (int8_t)a;
-}
+FORCE_INLINE int8_t vqmovnh_s16(int16_t a) { return neon2rvv_saturate_int8(a); }
 
-FORCE_INLINE int16_t vqmovns_s32(int32_t a) {
-  if (a > INT16_MAX)
-    return (int16_t)INT16_MAX;
-  if (a < INT16_MIN)
-    return (int16_t)INT16_MIN;
-  return (int16_t)a;
-}
+FORCE_INLINE int16_t vqmovns_s32(int32_t a) { return neon2rvv_saturate_int16(a); }
 
-FORCE_INLINE int32_t vqmovnd_s64(int64_t a) {
-  if (a > INT32_MAX)
-    return (int32_t)INT32_MAX;
-  if (a < INT32_MIN)
-    return (int32_t)INT32_MIN;
-  return (int32_t)a;
-}
+FORCE_INLINE int32_t vqmovnd_s64(int64_t a) { return neon2rvv_saturate_int32(a); }
 
-FORCE_INLINE uint8_t vqmovnh_u16(uint16_t a) {
-  if (a > UINT8_MAX) {
-    return (uint8_t)UINT8_MAX;
-  } else if (a < 0) {
-    return 0;
-  }
-  return (uint8_t)a;
-}
+FORCE_INLINE uint8_t vqmovnh_u16(uint16_t a) { return neon2rvv_saturate_uint8(a); }
 
-FORCE_INLINE uint16_t vqmovns_u32(uint32_t a) {
-  if (a > UINT16_MAX) {
-    return (uint16_t)UINT16_MAX;
-  } else if (a < 0) {
-    return 0;
-  }
-  return a;
-}
+FORCE_INLINE uint16_t vqmovns_u32(uint32_t a) { return neon2rvv_saturate_uint16(a); }
 
-FORCE_INLINE uint32_t vqmovnd_u64(uint64_t a) {
-  if (a > UINT32_MAX) {
-    return (uint32_t)UINT32_MAX;
-  } else if (a < 0) {
-    return 0;
-  }
-  return a;
-}
+FORCE_INLINE uint32_t vqmovnd_u64(uint64_t a) { return neon2rvv_saturate_uint32(a); }
 
 FORCE_INLINE int8x16_t vqmovn_high_s16(int8x8_t r, int16x8_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t a_hi = __riscv_vset_v_i16m1_i16m2(__riscv_vlmul_ext_v_i16m1_i16m2(a), 1, a);
+  return __riscv_vnclip_wx_i8m1_mu(neon2rvv_high_half_b8(), r, a_hi, 0, __RISCV_VXRM_RDN, 16);
+#else
   vint8m1_t qmovn = __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vnclip_wx_i8mf2(a, 0, __RISCV_VXRM_RDN, 8));
   return __riscv_vslideup_vx_i8m1(r, qmovn, 8, 16);
+#endif
 }
 
 FORCE_INLINE int16x8_t vqmovn_high_s32(int16x4_t r, int32x4_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_hi = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vnclip_wx_i16m1_mu(neon2rvv_high_half_b16(), r, a_hi, 0, __RISCV_VXRM_RDN, 8);
+#else
   vint16m1_t qmovn = __riscv_vlmul_ext_v_i16mf2_i16m1(__riscv_vnclip_wx_i16mf2(a, 0, __RISCV_VXRM_RDN, 4));
   return __riscv_vslideup_vx_i16m1(r, qmovn, 4, 8);
+#endif
 }
 
 FORCE_INLINE int32x4_t vqmovn_high_s64(int32x2_t r, int64x2_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_hi = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vnclip_wx_i32m1_mu(neon2rvv_high_half_b32(), r, a_hi, 0, __RISCV_VXRM_RDN, 4);
+#else
   vint32m1_t qmovn = __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vnclip_wx_i32mf2(a, 0, __RISCV_VXRM_RDN, 2));
   return __riscv_vslideup_vx_i32m1(r, qmovn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x16_t vqmovn_high_u16(uint8x8_t r, uint16x8_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t a_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a), 1, a);
+  return __riscv_vnclipu_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_hi, 0, __RISCV_VXRM_RDN, 16);
+#else
   vuint8m1_t qmovn = __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vnclipu_wx_u8mf2(a, 0, __RISCV_VXRM_RDN, 8));
   return __riscv_vslideup_vx_u8m1(r, qmovn, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vqmovn_high_u32(uint16x4_t r, uint32x4_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vnclipu_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_hi, 0, __RISCV_VXRM_RDN, 8);
+#else
   vuint16m1_t qmovn = __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnclipu_wx_u16mf2(a, 0, __RISCV_VXRM_RDN, 4));
   return __riscv_vslideup_vx_u16m1(r, qmovn, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vqmovn_high_u64(uint32x2_t r, uint64x2_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vnclipu_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_hi, 0, __RISCV_VXRM_RDN, 4);
+#else
   vuint32m1_t qmovn = __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnclipu_wx_u32mf2(a, 0, __RISCV_VXRM_RDN, 2));
   return __riscv_vslideup_vx_u32m1(r, qmovn, 2, 4);
+#endif
 }
 
 FORCE_INLINE uint8x8_t vqmovun_s16(int16x8_t a) {
@@ -8859,46 +9675,46 @@ FORCE_INLINE uint32x2_t vqmovun_s64(int64x2_t a) {
   return __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnclipu_wx_u32mf2(a_non_neg, 0, __RISCV_VXRM_RDN, 2));
 }
 
-FORCE_INLINE uint8_t vqmovunh_s16(int16_t a) {
-  if (a > UINT8_MAX) {
-    return UINT8_MAX;
-  }
-  int16_t a_sign = ~(a >> 15);
-  return a & a_sign;
-}
+FORCE_INLINE uint8_t vqmovunh_s16(int16_t a) { return neon2rvv_saturate_uint8(a); }
 
-FORCE_INLINE uint16_t vqmovuns_s32(int32_t a) {
-  if (a > UINT16_MAX) {
-    return UINT16_MAX;
-  }
-  int32_t a_sign = ~(a >> 31);
-  return a & a_sign;
-}
+FORCE_INLINE uint16_t vqmovuns_s32(int32_t a) { return neon2rvv_saturate_uint16(a); }
 
-FORCE_INLINE uint32_t vqmovund_s64(int64_t a) {
-  if (a > UINT32_MAX) {
-    return UINT32_MAX;
-  }
-  int64_t a_sign = ~(a >> 63);
-  return a & a_sign;
-}
+FORCE_INLINE uint32_t vqmovund_s64(int64_t a) { return neon2rvv_saturate_uint32(a > 0 ? a : 0); }
 
 FORCE_INLINE uint8x16_t vqmovun_high_s16(uint8x8_t r, int16x8_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t a_non_neg = __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vmax_vx_i16m1(a, 0, 8));
+  vuint16m2_t a_non_neg_hi = __riscv_vset_v_u16m1_u16m2(__riscv_vlmul_ext_v_u16m1_u16m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u8m1_mu(neon2rvv_high_half_b8(), r, a_non_neg_hi, 0, __RISCV_VXRM_RDN, 16);
+#else
   vuint16m1_t a_non_neg = __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vmax_vx_i16m1(a, 0, 8));
   vuint8m1_t vqmovun = __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vnclipu_wx_u8mf2(a_non_neg, 0, __RISCV_VXRM_RDN, 8));
   return __riscv_vslideup_vx_u8m1(r, vqmovun, 8, 16);
+#endif
 }
 
 FORCE_INLINE uint16x8_t vqmovun_high_s32(uint16x4_t r, int32x4_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t a_non_neg = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vmax_vx_i32m1(a, 0, 4));
+  vuint32m2_t a_non_neg_hi = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u16m1_mu(neon2rvv_high_half_b16(), r, a_non_neg_hi, 0, __RISCV_VXRM_RDN, 8);
+#else
   vuint32m1_t a_non_neg = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vmax_vx_i32m1(a, 0, 4));
   vuint16m1_t vqmovun = __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnclipu_wx_u16mf2(a_non_neg, 0, __RISCV_VXRM_RDN, 4));
   return __riscv_vslideup_vx_u16m1(r, vqmovun, 4, 8);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vqmovun_high_s64(uint32x2_t r, int64x2_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t a_non_neg = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vmax_vx_i64m1(a, 0, 2));
+  vuint64m2_t a_non_neg_hi = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a_non_neg), 1, a_non_neg);
+  return __riscv_vnclipu_wx_u32m1_mu(neon2rvv_high_half_b32(), r, a_non_neg_hi, 0, __RISCV_VXRM_RDN, 4);
+#else
   vuint64m1_t a_non_neg = __riscv_vreinterpret_v_i64m1_u64m1(__riscv_vmax_vx_i64m1(a, 0, 2));
   vuint32m1_t vqmovun = __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnclipu_wx_u32mf2(a_non_neg, 0, __RISCV_VXRM_RDN, 2));
   return __riscv_vslideup_vx_u32m1(r, vqmovun, 2, 4);
+#endif
 }
 
 FORCE_INLINE int16x8_t vmovl_s8(int8x8_t a) { return __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vsext_vf2_i16m2(a, 8)); }
@@ -8924,33 +9740,57 @@ FORCE_INLINE uint64x2_t vmovl_u32(uint32x2_t a) {
 }
 
 FORCE_INLINE int16x8_t vmovl_high_s8(int8x16_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i16m2_i16m1(__riscv_vsext_vf2_i16m2(a, 16), 1);
+#else
   vint8m1_t a_high = __riscv_vslidedown_vx_i8m1(a, 8, 16);
   return __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vsext_vf2_i16m2(a_high, 8));
+#endif
 }
 
 FORCE_INLINE int32x4_t vmovl_high_s16(int16x8_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vsext_vf2_i32m2(a, 8), 1);
+#else
   vint16m1_t a_high = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vsext_vf2_i32m2(a_high, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vmovl_high_s32(int32x4_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vsext_vf2_i64m2(a, 4), 1);
+#else
   vint32m1_t a_high = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vsext_vf2_i64m2(a_high, 2));
+#endif
 }
 
 FORCE_INLINE uint16x8_t vmovl_high_u8(uint8x16_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u16m2_u16m1(__riscv_vzext_vf2_u16m2(a, 16), 1);
+#else
   vuint8m1_t a_high = __riscv_vslidedown_vx_u8m1(a, 8, 16);
   return __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vzext_vf2_u16m2(a_high, 8));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmovl_high_u16(uint16x8_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vzext_vf2_u32m2(a, 8), 1);
+#else
   vuint16m1_t a_high = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vzext_vf2_u32m2(a_high, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmovl_high_u32(uint32x4_t a) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vzext_vf2_u64m2(a, 4), 1);
+#else
   vuint32m1_t a_high = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vzext_vf2_u64m2(a_high, 2));
+#endif
 }
 
 FORCE_INLINE int8x8_t vtbl1_s8(int8x8_t a, int8x8_t b) {
@@ -9569,31 +10409,55 @@ FORCE_INLINE uint64x2_t vmlal_lane_u32(uint64x2_t a, uint32x2_t b, uint32x2_t c,
 }
 
 FORCE_INLINE int32x4_t vmlal_high_lane_s16(int32x4_t a, int16x8_t b, int16x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 8);
+  vint32m2_t a_wide = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmacc_vv_i32m2(a_wide, b, c_dup, 8), 1);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 4);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(
       __riscv_vwmacc_vv_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), b_high, c_dup, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlal_high_lane_s32(int64x2_t a, int32x4_t b, int32x2_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 4);
+  vint64m2_t a_wide = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmacc_vv_i64m2(a_wide, b, c_dup, 4), 1);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 2);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(
       __riscv_vwmacc_vv_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), b_high, c_dup, 2));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlal_high_lane_u16(uint32x4_t a, uint16x8_t b, uint16x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 8);
+  vuint32m2_t a_wide = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmaccu_vv_u32m2(a_wide, b, c_dup, 8), 1);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 4);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(
       __riscv_vwmaccu_vv_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), b_high, c_dup, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlal_high_lane_u32(uint64x2_t a, uint32x4_t b, uint32x2_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 4);
+  vuint64m2_t a_wide = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmaccu_vv_u64m2(a_wide, b, c_dup, 4), 1);
+#else
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 2);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(
       __riscv_vwmaccu_vv_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), b_high, c_dup, 2));
+#endif
 }
 
 FORCE_INLINE int32x4_t vmlal_laneq_s16(int32x4_t a, int16x4_t b, int16x8_t c, const int lane) {
@@ -9617,31 +10481,55 @@ FORCE_INLINE uint64x2_t vmlal_laneq_u32(uint64x2_t a, uint32x2_t b, uint32x4_t c
 }
 
 FORCE_INLINE int32x4_t vmlal_high_laneq_s16(int32x4_t a, int16x8_t b, int16x8_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 8);
+  vint32m2_t a_wide = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmacc_vv_i32m2(a_wide, b, c_dup, 8), 1);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 4);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(
       __riscv_vwmacc_vv_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), b_high, c_dup, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlal_high_laneq_s32(int64x2_t a, int32x4_t b, int32x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 4);
+  vint64m2_t a_wide = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmacc_vv_i64m2(a_wide, b, c_dup, 4), 1);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 2);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(
       __riscv_vwmacc_vv_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), b_high, c_dup, 2));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlal_high_laneq_u16(uint32x4_t a, uint16x8_t b, uint16x8_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 8);
+  vuint32m2_t a_wide = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmaccu_vv_u32m2(a_wide, b, c_dup, 8), 1);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 4);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(
       __riscv_vwmaccu_vv_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), b_high, c_dup, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlal_high_laneq_u32(uint64x2_t a, uint32x4_t b, uint32x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 4);
+  vuint64m2_t a_wide = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmaccu_vv_u64m2(a_wide, b, c_dup, 4), 1);
+#else
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 2);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(
       __riscv_vwmaccu_vv_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), b_high, c_dup, 2));
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmlal_lane_s16(int32x4_t a, int16x4_t b, int16x4_t c, const int lane) {
@@ -9661,14 +10549,14 @@ FORCE_INLINE int64x2_t vqdmlal_lane_s32(int64x2_t a, int32x2_t b, int32x2_t c, c
 FORCE_INLINE int32_t vqdmlalh_lane_s16(int32_t a, int16_t b, int16x4_t c, const int lane) {
   int16_t c_lane = vget_lane_s16(c, lane);
   int32_t dmull = (int32_t)b * (int32_t)c_lane;
-  dmull = dmull > INT32_MAX / 2 ? INT32_MAX : dmull < INT32_MIN / 2 ? INT32_MIN : dmull * 2;
+  dmull = sat_add_int32(dmull, dmull);
   return sat_add_int32(a, dmull);
 }
 
 FORCE_INLINE int64_t vqdmlals_lane_s32(int64_t a, int32_t b, int32x2_t c, const int lane) {
   int32_t c_lane = vget_lane_s32(c, lane);
   int64_t dmull = (int64_t)b * (int64_t)c_lane;
-  dmull = dmull > INT64_MAX / 2 ? INT64_MAX : dmull < INT64_MIN / 2 ? INT64_MIN : dmull * 2;
+  dmull = sat_add_int64(dmull, dmull);
   return sat_add_int64(a, dmull);
 }
 
@@ -9705,14 +10593,14 @@ FORCE_INLINE int64x2_t vqdmlal_laneq_s32(int64x2_t a, int32x2_t b, int32x4_t c,
 FORCE_INLINE int32_t vqdmlalh_laneq_s16(int32_t a, int16_t b, int16x8_t c, const int lane) {
   int16_t c_lane = vgetq_lane_s16(c, lane);
   int32_t dmull = (int32_t)b * (int32_t)c_lane;
-  dmull = dmull > INT32_MAX / 2 ? INT32_MAX : dmull < INT32_MIN / 2 ? INT32_MIN : dmull * 2;
+  dmull = sat_add_int32(dmull, dmull);
   return sat_add_int32(a, dmull);
 }
 
 FORCE_INLINE int64_t vqdmlals_laneq_s32(int64_t a, int32_t b, int32x4_t c, const int lane) {
   int32_t c_lane = vgetq_lane_s32(c, lane);
   int64_t dmull = (int64_t)b * (int64_t)c_lane;
-  dmull = dmull > INT64_MAX / 2 ? INT64_MAX : dmull < INT64_MIN / 2 ? INT64_MIN : dmull * 2;
+  dmull = sat_add_int64(dmull, dmull);
   return sat_add_int64(a, dmull);
 }
 
@@ -9853,27 +10741,51 @@ FORCE_INLINE uint64x2_t vmlsl_lane_u32(uint64x2_t a, uint32x2_t b, uint32x2_t c,
 }
 
 FORCE_INLINE int32x4_t vmlsl_high_lane_s16(int32x4_t a, int16x8_t b, int16x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 8);
+  vint32m1_t bc_mul = __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(b, c_dup, 8), 1);
+  return __riscv_vsub_vv_i32m1(a, bc_mul, 4);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 4);
   return __riscv_vsub_vv_i32m1(a, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(b_high, c_dup, 4)), 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlsl_high_lane_s32(int64x2_t a, int32x4_t b, int32x2_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 4);
+  vint64m1_t bc_mul = __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(b, c_dup, 4), 1);
+  return __riscv_vsub_vv_i64m1(a, bc_mul, 2);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 2);
   return __riscv_vsub_vv_i64m1(a, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(b_high, c_dup, 2)), 2);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlsl_high_lane_u16(uint32x4_t a, uint16x8_t b, uint16x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 8);
+  vuint32m1_t bc_mul = __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(b, c_dup, 8), 1);
+  return __riscv_vsub_vv_u32m1(a, bc_mul, 4);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 8);
   return __riscv_vsub_vv_u32m1(a, __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(b_high, c_dup, 4)), 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlsl_high_lane_u32(uint64x2_t a, uint32x4_t b, uint32x2_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 4);
+  vuint64m1_t bc_mul = __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(b, c_dup, 4), 1);
+  return __riscv_vsub_vv_u64m1(a, bc_mul, 2);
+#else
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 4);
   return __riscv_vsub_vv_u64m1(a, __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(b_high, c_dup, 2)), 2);
+#endif
 }
 
 FORCE_INLINE int32x4_t vmlsl_laneq_s16(int32x4_t a, int16x4_t b, int16x8_t c, const int lane) {
@@ -9897,27 +10809,51 @@ FORCE_INLINE uint64x2_t vmlsl_laneq_u32(uint64x2_t a, uint32x2_t b, uint32x4_t c
 }
 
 FORCE_INLINE int32x4_t vmlsl_high_laneq_s16(int32x4_t a, int16x8_t b, int16x8_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 8);
+  vint32m1_t bc_mul = __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(b, c_dup, 8), 1);
+  return __riscv_vsub_vv_i32m1(a, bc_mul, 4);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, lane, 4);
   return __riscv_vsub_vv_i32m1(a, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(b_high, c_dup, 8)), 8);
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlsl_high_laneq_s32(int64x2_t a, int32x4_t b, int32x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 4);
+  vint64m1_t bc_mul = __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(b, c_dup, 4), 1);
+  return __riscv_vsub_vv_i64m1(a, bc_mul, 2);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, lane, 2);
   return __riscv_vsub_vv_i64m1(a, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(b_high, c_dup, 4)), 4);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlsl_high_laneq_u16(uint32x4_t a, uint16x8_t b, uint16x8_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 8);
+  vuint32m1_t bc_mul = __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(b, c_dup, 8), 1);
+  return __riscv_vsub_vv_u32m1(a, bc_mul, 4);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   vuint16m1_t c_dup = __riscv_vrgather_vx_u16m1(c, lane, 8);
   return __riscv_vsub_vv_u32m1(a, __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(b_high, c_dup, 8)), 8);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlsl_high_laneq_u32(uint64x2_t a, uint32x4_t b, uint32x4_t c, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 4);
+  vuint64m1_t bc_mul = __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(b, c_dup, 4), 1);
+  return __riscv_vsub_vv_u64m1(a, bc_mul, 2);
+#else
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   vuint32m1_t c_dup = __riscv_vrgather_vx_u32m1(c, lane, 4);
   return __riscv_vsub_vv_u64m1(a, __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(b_high, c_dup, 4)), 4);
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmlsl_lane_s16(int32x4_t a, int16x4_t b, int16x4_t c, const int lane) {
@@ -9937,14 +10873,14 @@ FORCE_INLINE int64x2_t vqdmlsl_lane_s32(int64x2_t a, int32x2_t b, int32x2_t c, c
 FORCE_INLINE int32_t vqdmlslh_lane_s16(int32_t a, int16_t b, int16x4_t c, const int lane) {
   int16_t c_lane = vget_lane_s16(c, lane);
   int32_t dmull = (int32_t)b * (int32_t)c_lane;
-  dmull = dmull > INT32_MAX / 2 ? INT32_MAX : dmull < INT32_MIN / 2 ? INT32_MIN : dmull * 2;
+  dmull = sat_add_int32(dmull, dmull);
   return sat_sub_int32(a, dmull);
 }
 
 FORCE_INLINE int64_t vqdmlsls_lane_s32(int64_t a, int32_t b, int32x2_t c, const int lane) {
   int32_t c_lane = vget_lane_s32(c, lane);
   int64_t dmull = (int64_t)b * (int64_t)c_lane;
-  dmull = dmull > INT64_MAX / 2 ? INT64_MAX : dmull < INT64_MIN / 2 ? INT64_MIN : dmull * 2;
+  dmull = sat_add_int64(dmull, dmull);
   return sat_sub_int64(a, dmull);
 }
 
@@ -9981,14 +10917,14 @@ FORCE_INLINE int64x2_t vqdmlsl_laneq_s32(int64x2_t a, int32x2_t b, int32x4_t c,
 FORCE_INLINE int32_t vqdmlslh_laneq_s16(int32_t a, int16_t b, int16x8_t c, const int lane) {
   int16_t c_lane = vgetq_lane_s16(c, lane);
   int32_t dmull = (int32_t)b * (int32_t)c_lane;
-  dmull = dmull > INT32_MAX / 2 ? INT32_MAX : dmull < INT32_MIN / 2 ? INT32_MIN : dmull * 2;
+  dmull = sat_add_int32(dmull, dmull);
   return sat_sub_int32(a, dmull);
 }
 
 FORCE_INLINE int64_t vqdmlsls_laneq_s32(int64_t a, int32_t b, int32x4_t c, const int lane) {
   int32_t c_lane = vgetq_lane_s32(c, lane);
   int64_t dmull = (int64_t)b * (int64_t)c_lane;
-  dmull = dmull > INT64_MAX / 2 ? INT64_MAX : dmull < INT64_MIN / 2 ? INT64_MIN : dmull * 2;
+  dmull = sat_add_int64(dmull, dmull);
   return sat_sub_int64(a, dmull);
 }
 
@@ -10029,27 +10965,47 @@ FORCE_INLINE uint64x2_t vmull_lane_u32(uint32x2_t a, uint32x2_t b, const int c)
 }
 
 FORCE_INLINE int32x4_t vmull_high_lane_s16(int16x8_t a, int16x4_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t b_dup = __riscv_vrgather_vx_i16m1(b, lane, 8);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(a, b_dup, 8), 1);
+#else
   vint16m1_t a_high = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   vint16m1_t b_dup = __riscv_vrgather_vx_i16m1(b, lane, 4);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(a_high, b_dup, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vmull_high_lane_s32(int32x4_t a, int32x2_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t b_dup = __riscv_vrgather_vx_i32m1(b, lane, 4);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(a, b_dup, 4), 1);
+#else
   vint32m1_t a_high = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   vint32m1_t b_dup = __riscv_vrgather_vx_i32m1(b, lane, 2);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(a_high, b_dup, 2));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmull_high_lane_u16(uint16x8_t a, uint16x4_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t b_dup = __riscv_vrgather_vx_u16m1(b, lane, 8);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(a, b_dup, 8), 1);
+#else
   vuint16m1_t a_high = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   vuint16m1_t b_dup = __riscv_vrgather_vx_u16m1(b, lane, 4);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(a_high, b_dup, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmull_high_lane_u32(uint32x4_t a, uint32x2_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t b_dup = __riscv_vrgather_vx_u32m1(b, lane, 4);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(a, b_dup, 4), 1);
+#else
   vuint32m1_t a_high = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   vuint32m1_t b_dup = __riscv_vrgather_vx_u32m1(b, lane, 2);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(a_high, b_dup, 2));
+#endif
 }
 
 FORCE_INLINE int32x4_t vmull_laneq_s16(int16x4_t a, int16x8_t b, const int lane) {
@@ -10073,27 +11029,47 @@ FORCE_INLINE uint64x2_t vmull_laneq_u32(uint32x2_t a, uint32x4_t b, const int la
 }
 
 FORCE_INLINE int32x4_t vmull_high_laneq_s16(int16x8_t a, int16x8_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m1_t b_dup = __riscv_vrgather_vx_i16m1(b, lane, 8);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(a, b_dup, 8), 1);
+#else
   vint16m1_t a_high = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   vint16m1_t b_dup = __riscv_vrgather_vx_i16m1(b, lane, 8);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(a_high, b_dup, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vmull_high_laneq_s32(int32x4_t a, int32x4_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t b_dup = __riscv_vrgather_vx_i32m1(b, lane, 4);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(a, b_dup, 4), 1);
+#else
   vint32m1_t a_high = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   vint32m1_t b_dup = __riscv_vrgather_vx_i32m1(b, lane, 4);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(a_high, b_dup, 2));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmull_high_laneq_u16(uint16x8_t a, uint16x8_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m1_t b_dup = __riscv_vrgather_vx_u16m1(b, lane, 8);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(a, b_dup, 8), 1);
+#else
   vuint16m1_t a_high = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   vuint16m1_t b_dup = __riscv_vrgather_vx_u16m1(b, lane, 8);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(a_high, b_dup, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmull_high_laneq_u32(uint32x4_t a, uint32x4_t b, const int lane) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t b_dup = __riscv_vrgather_vx_u32m1(b, lane, 4);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(a, b_dup, 4), 1);
+#else
   vuint32m1_t a_high = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   vuint32m1_t b_dup = __riscv_vrgather_vx_u32m1(b, lane, 4);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmulu_vv_u64m2(a_high, b_dup, 2));
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmull_lane_s16(int16x4_t a, int16x4_t b, const int lane) {
@@ -10111,13 +11087,13 @@ FORCE_INLINE int64x2_t vqdmull_lane_s32(int32x2_t a, int32x2_t b, const int lane
 FORCE_INLINE int32_t vqdmullh_lane_s16(int16_t a, int16x4_t b, const int lane) {
   int16_t b_lane = vget_lane_s16(b, lane);
   int32_t dmull = (int32_t)a * (int32_t)b_lane;
-  return dmull > INT32_MAX / 2 ? INT32_MAX : dmull < INT32_MIN / 2 ? INT32_MIN : dmull * 2;
+  return sat_add_int32(dmull, dmull);
 }
 
 FORCE_INLINE int64_t vqdmulls_lane_s32(int32_t a, int32x2_t b, const int lane) {
   int32_t b_lane = vget_lane_s32(b, lane);
   int64_t dmull = (int64_t)a * (int64_t)b_lane;
-  return dmull > INT64_MAX / 2 ? INT64_MAX : dmull < INT64_MIN / 2 ? INT64_MIN : dmull * 2;
+  return sat_add_int64(dmull, dmull);
 }
 
 FORCE_INLINE int32x4_t vqdmull_high_lane_s16(int16x8_t a, int16x4_t b, const int lane) {
@@ -10149,13 +11125,13 @@ FORCE_INLINE int64x2_t vqdmull_laneq_s32(int32x2_t a, int32x4_t b, const int lan
 FORCE_INLINE int32_t vqdmullh_laneq_s16(int16_t a, int16x8_t b, const int lane) {
   int16_t b_lane = vgetq_lane_s16(b, lane);
   int32_t dmull = (int32_t)a * (int32_t)b_lane;
-  return dmull > INT32_MAX / 2 ? INT32_MAX : dmull < INT32_MIN / 2 ? INT32_MIN : dmull * 2;
+  return sat_add_int32(dmull, dmull);
 }
 
 FORCE_INLINE int64_t vqdmulls_laneq_s32(int32_t a, int32x4_t b, const int lane) {
   int32_t b_lane = vgetq_lane_s32(b, lane);
   int64_t dmull = (int64_t)a * (int64_t)b_lane;
-  return dmull > INT64_MAX / 2 ? INT64_MAX : dmull < INT64_MIN / 2 ? INT64_MIN : dmull * 2;
+  return sat_add_int64(dmull, dmull);
 }
 
 FORCE_INLINE int32x4_t vqdmull_high_laneq_s16(int16x8_t a, int16x8_t b, const int lane) {
@@ -10172,226 +11148,214 @@ FORCE_INLINE int64x2_t vqdmull_high_laneq_s32(int32x4_t a, int32x4_t b, const in
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vsll_vx_i64m2(ab_mul, 1, 2));
 }
 
-FORCE_INLINE int16x8_t vqdmulhq_lane_s16(int16x8_t a, int16x4_t b, const int c) {
-  vint16m1_t b_dup_lane = __riscv_vrgather_vx_i16m1(b, c, 8);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup_lane, 8);
-  return __riscv_vnclip_wx_i16m1(ab_mul, 15, __RISCV_VXRM_RDN, 8);
+FORCE_INLINE int16x8_t vqdmulhq_lane_s16(int16x8_t a, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RDN, 8);
 }
 
-FORCE_INLINE int32x4_t vqdmulhq_lane_s32(int32x4_t a, int32x2_t b, const int c) {
-  vint32m1_t b_dup_lane = __riscv_vrgather_vx_i32m1(b, c, 4);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup_lane, 4);
-  return __riscv_vnclip_wx_i32m1(ab_mul, 31, __RISCV_VXRM_RDN, 4);
+FORCE_INLINE int32x4_t vqdmulhq_lane_s32(int32x4_t a, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RDN, 4);
 }
 
 FORCE_INLINE int16_t vqdmulhh_lane_s16(int16_t a, int16x4_t v, const int lane) {
-  int16_t v_lane = vget_lane_s16(v, lane);
-  int32_t product = (int32_t)a * (int32_t)v_lane;
-  int32_t result = product >> 15;
-  return result > INT16_MAX ? INT16_MAX : (int16_t)result;
+  vint16m1_t v_lane = __riscv_vslidedown_vx_i16m1(v, lane, 4);
+  return __riscv_vmv_x_s_i16m1_i16(__riscv_vsmul_vx_i16m1(v_lane, a, __RISCV_VXRM_RDN, 1));
 }
 
 FORCE_INLINE int32_t vqdmulhs_lane_s32(int32_t a, int32x2_t v, const int lane) {
-  int32_t v_lane = vget_lane_s32(v, lane);
-  int64_t product = (int64_t)a * (int64_t)v_lane;
-  int64_t result = product >> 31;
-  return result > INT32_MAX ? INT32_MAX : (int32_t)result;
+  vint32m1_t v_lane = __riscv_vslidedown_vx_i32m1(v, lane, 2);
+  return __riscv_vmv_x_s_i32m1_i32(__riscv_vsmul_vx_i32m1(v_lane, a, __RISCV_VXRM_RDN, 1));
 }
 
 FORCE_INLINE int16x4_t vqdmulh_laneq_s16(int16x4_t a, int16x8_t v, const int lane) {
-  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
-  vint32m2_t av_mul = __riscv_vwmul_vv_i32m2(a, v_dup_lane, 4);
-  return __riscv_vnclip_wx_i16m1(av_mul, 15, __RISCV_VXRM_RDN, 4);
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RDN, 4);
 }
 
 FORCE_INLINE int16x8_t vqdmulhq_laneq_s16(int16x8_t a, int16x8_t v, const int lane) {
   vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
-  vint32m2_t av_mul = __riscv_vwmul_vv_i32m2(a, v_dup_lane, 8);
-  return __riscv_vnclip_wx_i16m1(av_mul, 15, __RISCV_VXRM_RDN, 8);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RDN, 8);
 }
 
 FORCE_INLINE int32x2_t vqdmulh_laneq_s32(int32x2_t a, int32x4_t v, const int lane) {
-  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
-  vint64m2_t av_mul = __riscv_vwmul_vv_i64m2(a, v_dup_lane, 2);
-  return __riscv_vnclip_wx_i32m1(av_mul, 31, __RISCV_VXRM_RDN, 2);
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RDN, 2);
 }
 
 FORCE_INLINE int32x4_t vqdmulhq_laneq_s32(int32x4_t a, int32x4_t v, const int lane) {
   vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
-  vint64m2_t av_mul = __riscv_vwmul_vv_i64m2(a, v_dup_lane, 4);
-  return __riscv_vnclip_wx_i32m1(av_mul, 31, __RISCV_VXRM_RDN, 4);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RDN, 4);
 }
 
 FORCE_INLINE int16_t vqdmulhh_laneq_s16(int16_t a, int16x8_t v, const int lane) {
-  int16_t v_lane = vgetq_lane_s16(v, lane);
-  int32_t product = (int32_t)a * (int32_t)v_lane;
-  int32_t result = product >> 15;
-  return result > INT16_MAX ? INT16_MAX : (int16_t)result;
+  vint16m1_t v_lane = __riscv_vslidedown_vx_i16m1(v, lane, 8);
+  return __riscv_vmv_x_s_i16m1_i16(__riscv_vsmul_vx_i16m1(v_lane, a, __RISCV_VXRM_RDN, 1));
 }
 
 FORCE_INLINE int32_t vqdmulhs_laneq_s32(int32_t a, int32x4_t v, const int lane) {
-  int32_t v_lane = vgetq_lane_s32(v, lane);
-  int64_t product = (int64_t)a * (int64_t)v_lane;
-  int64_t result = product >> 31;
-  return result > INT32_MAX ? INT32_MAX : (int32_t)result;
+  vint32m1_t v_lane = __riscv_vslidedown_vx_i32m1(v, lane, 4);
+  return __riscv_vmv_x_s_i32m1_i32(__riscv_vsmul_vx_i32m1(v_lane, a, __RISCV_VXRM_RDN, 1));
 }
 
-FORCE_INLINE int16x4_t vqdmulh_lane_s16(int16x4_t a, int16x4_t b, const int c) {
-  vint16m1_t b_dup_lane = __riscv_vrgather_vx_i16m1(b, c, 4);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup_lane, 4);
-  return __riscv_vnclip_wx_i16m1(ab_mul, 15, __RISCV_VXRM_RDN, 4);
+FORCE_INLINE int16x4_t vqdmulh_lane_s16(int16x4_t a, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RDN, 4);
 }
 
-FORCE_INLINE int32x2_t vqdmulh_lane_s32(int32x2_t a, int32x2_t b, const int c) {
-  vint32m1_t b_dup_lane = __riscv_vrgather_vx_i32m1(b, c, 2);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup_lane, 2);
-  return __riscv_vnclip_wx_i32m1(ab_mul, 31, __RISCV_VXRM_RDN, 2);
+FORCE_INLINE int32x2_t vqdmulh_lane_s32(int32x2_t a, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RDN, 2);
 }
 
-FORCE_INLINE int16x8_t vqrdmulhq_lane_s16(int16x8_t a, int16x4_t b, const int c) {
-  vint16m1_t b_dup_lane = __riscv_vrgather_vx_i16m1(b, c, 8);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup_lane, 8);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 8);
-  return __riscv_vnclip_wx_i16m1(ab_mulx2, 16, __RISCV_VXRM_RNU, 8);
+FORCE_INLINE int16x8_t vqrdmulhq_lane_s16(int16x8_t a, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RNU, 8);
 }
 
-FORCE_INLINE int32x4_t vqrdmulhq_lane_s32(int32x4_t a, int32x2_t b, const int c) {
-  vint32m1_t b_dup_lane = __riscv_vrgather_vx_i32m1(b, c, 4);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup_lane, 4);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 4);
-  return __riscv_vnclip_wx_i32m1(ab_mulx2, 32, __RISCV_VXRM_RNU, 4);
+FORCE_INLINE int32x4_t vqrdmulhq_lane_s32(int32x4_t a, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RNU, 4);
 }
 
-// FORCE_INLINE int16_t vqrdmulhh_lane_s16(int16_t a, int16x4_t v, const int lane);
+FORCE_INLINE int16_t vqrdmulhh_lane_s16(int16_t a, int16x4_t v, const int lane) {
+  vint16m1_t v_lane = __riscv_vslidedown_vx_i16m1(v, lane, 4);
+  return __riscv_vmv_x_s_i16m1_i16(__riscv_vsmul_vx_i16m1(v_lane, a, __RISCV_VXRM_RNU, 1));
+}
 
-// FORCE_INLINE int32_t vqrdmulhs_lane_s32(int32_t a, int32x2_t v, const int lane);
+FORCE_INLINE int32_t vqrdmulhs_lane_s32(int32_t a, int32x2_t v, const int lane) {
+  vint32m1_t v_lane = __riscv_vslidedown_vx_i32m1(v, lane, 2);
+  return __riscv_vmv_x_s_i32m1_i32(__riscv_vsmul_vx_i32m1(v_lane, a, __RISCV_VXRM_RNU, 1));
+}
 
-// FORCE_INLINE int16x4_t vqrdmulh_laneq_s16(int16x4_t a, int16x8_t v, const int lane);
+FORCE_INLINE int16x4_t vqrdmulh_laneq_s16(int16x4_t a, int16x8_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RNU, 4);
+}
 
-// FORCE_INLINE int16x8_t vqrdmulhq_laneq_s16(int16x8_t a, int16x8_t v, const int lane);
+FORCE_INLINE int16x8_t vqrdmulhq_laneq_s16(int16x8_t a, int16x8_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RNU, 8);
+}
 
-// FORCE_INLINE int32x2_t vqrdmulh_laneq_s32(int32x2_t a, int32x4_t v, const int lane);
+FORCE_INLINE int32x2_t vqrdmulh_laneq_s32(int32x2_t a, int32x4_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RNU, 2);
+}
 
-// FORCE_INLINE int32x4_t vqrdmulhq_laneq_s32(int32x4_t a, int32x4_t v, const int lane);
+FORCE_INLINE int32x4_t vqrdmulhq_laneq_s32(int32x4_t a, int32x4_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RNU, 4);
+}
 
-// FORCE_INLINE int16_t vqrdmulhh_laneq_s16(int16_t a, int16x8_t v, const int lane);
+FORCE_INLINE int16_t vqrdmulhh_laneq_s16(int16_t a, int16x8_t v, const int lane) {
+  vint16m1_t v_lane = __riscv_vslidedown_vx_i16m1(v, lane, 8);
+  return __riscv_vmv_x_s_i16m1_i16(__riscv_vsmul_vx_i16m1(v_lane, a, __RISCV_VXRM_RNU, 1));
+}
 
-// FORCE_INLINE int32_t vqrdmulhs_laneq_s32(int32_t a, int32x4_t v, const int lane);
+FORCE_INLINE int32_t vqrdmulhs_laneq_s32(int32_t a, int32x4_t v, const int lane) {
+  vint32m1_t v_lane = __riscv_vslidedown_vx_i32m1(v, lane, 4);
+  return __riscv_vmv_x_s_i32m1_i32(__riscv_vsmul_vx_i32m1(v_lane, a, __RISCV_VXRM_RNU, 1));
+}
 
-FORCE_INLINE int16x4_t vqrdmulh_lane_s16(int16x4_t a, int16x4_t b, const int c) {
-  vint16m1_t b_dup_lane = __riscv_vrgather_vx_i16m1(b, c, 4);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup_lane, 4);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 4);
-  return __riscv_vnclip_wx_i16m1(ab_mulx2, 16, __RISCV_VXRM_RNU, 4);
+FORCE_INLINE int16x4_t vqrdmulh_lane_s16(int16x4_t a, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return __riscv_vsmul_vv_i16m1(a, v_dup_lane, __RISCV_VXRM_RNU, 4);
 }
 
-FORCE_INLINE int32x2_t vqrdmulh_lane_s32(int32x2_t a, int32x2_t b, const int c) {
-  vint32m1_t b_dup_lane = __riscv_vrgather_vx_i32m1(b, c, 2);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup_lane, 2);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 2);
-  return __riscv_vnclip_wx_i32m1(ab_mulx2, 32, __RISCV_VXRM_RNU, 2);
+FORCE_INLINE int32x2_t vqrdmulh_lane_s32(int32x2_t a, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  return __riscv_vsmul_vv_i32m1(a, v_dup_lane, __RISCV_VXRM_RNU, 2);
 }
 
-FORCE_INLINE int16x8_t vqrdmlahq_lane_s16(int16x8_t a, int16x8_t b, int16x4_t c, const int __d) {
-  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, __d, 8);
-  vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c_dup, 8);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 8);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 8);
-  return __riscv_vsadd_vv_i16m1(a, bc_s, 8);
+FORCE_INLINE int16x8_t vqrdmlahq_lane_s16(int16x8_t a, int16x8_t b, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
+  return vqrdmlahq_s16(a, b, v_dup_lane);
 }
 
-// FORCE_INLINE int16x4_t vqrdmlah_laneq_s16(int16x4_t a, int16x4_t b, int16x8_t v, const int lane);
+FORCE_INLINE int16x4_t vqrdmlah_laneq_s16(int16x4_t a, int16x4_t b, int16x8_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return vqrdmlah_s16(a, b, v_dup_lane);
+}
 
-// FORCE_INLINE int16x8_t vqrdmlahq_laneq_s16(int16x8_t a, int16x8_t b, int16x8_t v, const int lane);
+FORCE_INLINE int16x8_t vqrdmlahq_laneq_s16(int16x8_t a, int16x8_t b, int16x8_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
+  return vqrdmlahq_s16(a, b, v_dup_lane);
+}
 
-FORCE_INLINE int32x4_t vqrdmlahq_lane_s32(int32x4_t a, int32x4_t b, int32x2_t c, const int __d) {
-  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, __d, 4);
-  vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c_dup, 4);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 4);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 4);
-  return __riscv_vsadd_vv_i32m1(a, bc_s, 4);
+FORCE_INLINE int32x4_t vqrdmlahq_lane_s32(int32x4_t a, int32x4_t b, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
+  return vqrdmlahq_s32(a, b, v_dup_lane);
 }
 
-// FORCE_INLINE int32x2_t vqrdmlah_laneq_s32(int32x2_t a, int32x2_t b, int32x4_t v, const int lane);
+FORCE_INLINE int32x2_t vqrdmlah_laneq_s32(int32x2_t a, int32x2_t b, int32x4_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  return vqrdmlah_s32(a, b, v_dup_lane);
+}
 
-// FORCE_INLINE int32x4_t vqrdmlahq_laneq_s32(int32x4_t a, int32x4_t b, int32x4_t v, const int lane);
+FORCE_INLINE int32x4_t vqrdmlahq_laneq_s32(int32x4_t a, int32x4_t b, int32x4_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
+  return vqrdmlahq_s32(a, b, v_dup_lane);
+}
 
-FORCE_INLINE int16x4_t vqrdmlah_lane_s16(int16x4_t a, int16x4_t b, int16x4_t c, const int __d) {
-  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, __d, 4);
-  vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c_dup, 4);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 4);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 4);
-  return __riscv_vsadd_vv_i16m1(a, bc_s, 4);
+FORCE_INLINE int16x4_t vqrdmlah_lane_s16(int16x4_t a, int16x4_t b, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return vqrdmlah_s16(a, b, v_dup_lane);
 }
 
-FORCE_INLINE int32x2_t vqrdmlah_lane_s32(int32x2_t a, int32x2_t b, int32x2_t c, const int __d) {
-  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, __d, 2);
-  vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c_dup, 2);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 2);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 2);
-  return __riscv_vsadd_vv_i32m1(a, bc_s, 2);
+FORCE_INLINE int32x2_t vqrdmlah_lane_s32(int32x2_t a, int32x2_t b, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  return vqrdmlah_s32(a, b, v_dup_lane);
 }
 
-FORCE_INLINE int16x8_t vqrdmlshq_lane_s16(int16x8_t a, int16x8_t b, int16x4_t c, const int __d) {
-  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, __d, 4);
-  vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c_dup, 4);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 4);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 4);
-  return __riscv_vssub_vv_i16m1(a, bc_s, 4);
+FORCE_INLINE int16x8_t vqrdmlshq_lane_s16(int16x8_t a, int16x8_t b, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
+  return vqrdmlshq_s16(a, b, v_dup_lane);
 }
 
-// FORCE_INLINE int16x4_t vqrdmlsh_laneq_s16(int16x4_t a, int16x4_t b, int16x8_t v, const int lane);
+FORCE_INLINE int16x4_t vqrdmlsh_laneq_s16(int16x4_t a, int16x4_t b, int16x8_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return vqrdmlsh_s16(a, b, v_dup_lane);
+}
 
-// FORCE_INLINE int16x8_t vqrdmlshq_laneq_s16(int16x8_t a, int16x8_t b, int16x8_t v, const int lane);
+FORCE_INLINE int16x8_t vqrdmlshq_laneq_s16(int16x8_t a, int16x8_t b, int16x8_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 8);
+  return vqrdmlshq_s16(a, b, v_dup_lane);
+}
 
-FORCE_INLINE int32x4_t vqrdmlshq_lane_s32(int32x4_t a, int32x4_t b, int32x2_t c, const int __d) {
-  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, __d, 2);
-  vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c_dup, 2);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 2);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 2);
-  return __riscv_vssub_vv_i32m1(a, bc_s, 2);
+FORCE_INLINE int32x4_t vqrdmlshq_lane_s32(int32x4_t a, int32x4_t b, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
+  return vqrdmlshq_s32(a, b, v_dup_lane);
 }
 
 FORCE_INLINE int32x2_t vqrdmlsh_laneq_s32(int32x2_t a, int32x2_t b, int32x4_t v, const int lane) {
-  int32x2_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
   return vqrdmlsh_s32(a, b, v_dup_lane);
 }
 
 FORCE_INLINE int32x4_t vqrdmlshq_laneq_s32(int32x4_t a, int32x4_t b, int32x4_t v, const int lane) {
-  int32x4_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 4);
   return vqrdmlshq_s32(a, b, v_dup_lane);
 }
 
 FORCE_INLINE int16_t vqrdmlahh_s16(int16_t a, int16_t b, int16_t c) {
-  int32_t bc_mul = (int32_t)b * (int32_t)c;
-  int32_t bc_mulx2 = bc_mul > INT32_MAX / 2 ? INT32_MAX : bc_mul < INT32_MIN / 2 ? INT32_MIN : bc_mul * 2;
-  int32_t bc_round = (bc_mulx2 >> 15) + 1;
-  int16_t bc_rdmulh = neon2rvv_saturate_int16(bc_round >> 1);
-  return sat_add_int16(a, bc_rdmulh);
+  int32_t abc_acc = (int32_t)a * ((int32_t)1 << 15) + (int32_t)b * (int32_t)c + ((int32_t)1 << 14);
+  return neon2rvv_saturate_int16(abc_acc >> 15);
 }
 
 FORCE_INLINE int32_t vqrdmlahs_s32(int32_t a, int32_t b, int32_t c) {
-  int64_t bc_mul = (int64_t)b * (int64_t)c;
-  int64_t bc_mulx2 = bc_mul > INT64_MAX / 2 ? INT64_MAX : bc_mul < INT64_MIN / 2 ? INT64_MIN : bc_mul * 2;
-  int64_t bc_round = (bc_mulx2 >> 31) + 1;
-  int32_t bc_rdmulh = neon2rvv_saturate_int32(bc_round >> 1);
-  return sat_add_int32(a, bc_rdmulh);
+  int64_t abc_acc = (int64_t)a * ((int64_t)1 << 31) + (int64_t)b * (int64_t)c + ((int64_t)1 << 30);
+  return neon2rvv_saturate_int32(abc_acc >> 31);
 }
 
 FORCE_INLINE int16_t vqrdmlshh_s16(int16_t a, int16_t b, int16_t c) {
-  int32_t bc_mul = (int32_t)b * (int32_t)c;
-  int32_t bc_mulx2 = bc_mul > INT32_MAX / 2 ? INT32_MAX : bc_mul < INT32_MIN / 2 ? INT32_MIN : bc_mul * 2;
-  int32_t bc_round = (bc_mulx2 >> 15) + 1;
-  int16_t bc_rdmulh = neon2rvv_saturate_int16(bc_round >> 1);
-  return sat_sub_int16(a, bc_rdmulh);
+  int32_t abc_acc = (int32_t)a * ((int32_t)1 << 15) - (int32_t)b * (int32_t)c + ((int32_t)1 << 14);
+  return neon2rvv_saturate_int16(abc_acc >> 15);
 }
 
 FORCE_INLINE int32_t vqrdmlshs_s32(int32_t a, int32_t b, int32_t c) {
-  int64_t bc_mul = (int64_t)b * (int64_t)c;
-  int64_t bc_mulx2 = bc_mul > INT64_MAX / 2 ? INT64_MAX : bc_mul < INT64_MIN / 2 ? INT64_MIN : bc_mul * 2;
-  int64_t bc_round = (bc_mulx2 >> 31) + 1;
-  int32_t bc_rdmulh = neon2rvv_saturate_int32(bc_round >> 1);
-  return sat_sub_int32(a, bc_rdmulh);
+  int64_t abc_acc = (int64_t)a * ((int64_t)1 << 31) - (int64_t)b * (int64_t)c + ((int64_t)1 << 30);
+  return neon2rvv_saturate_int32(abc_acc >> 31);
 }
 
 FORCE_INLINE int16_t vqrdmlahh_lane_s16(int16_t a, int16_t b, int16x4_t v, const int lane) {
@@ -11111,25 +12075,95 @@ FORCE_INLINE int64x2_t veor3q_s64(int64x2_t a, int64x2_t b, int64x2_t c) {
   return __riscv_vxor_vv_i64m1(a, __riscv_vxor_vv_i64m1(b, c, 2), 2);
 }
 
-// FORCE_INLINE uint64x2_t vrax1q_u64(uint64x2_t a, uint64x2_t b);
+FORCE_INLINE uint64x2_t vrax1q_u64(uint64x2_t a, uint64x2_t b) {
+#if defined(__riscv_zvbb)
+  return __riscv_vxor_vv_u64m1(a, __riscv_vrol_vx_u64m1(b, 1, 2), 2);
+#else
+  vuint64m1_t b_rol = __riscv_vor_vv_u64m1(__riscv_vsll_vx_u64m1(b, 1, 2), __riscv_vsrl_vx_u64m1(b, 63, 2), 2);
+  return __riscv_vxor_vv_u64m1(a, b_rol, 2);
+#endif
+}
 
-// FORCE_INLINE uint64x2_t vxarq_u64(uint64x2_t a, uint64x2_t b, const int imm6);
+FORCE_INLINE uint64x2_t vxarq_u64(uint64x2_t a, uint64x2_t b, const int imm6) {
+  vuint64m1_t ab = __riscv_vxor_vv_u64m1(a, b, 2);
+#if defined(__riscv_zvbb)
+  return __riscv_vror_vx_u64m1(ab, imm6, 2);
+#else
+  return __riscv_vor_vv_u64m1(__riscv_vsrl_vx_u64m1(ab, imm6, 2), __riscv_vsll_vx_u64m1(ab, (64 - imm6) & 63, 2), 2);
+#endif
+}
 
-// FORCE_INLINE uint8x16_t vbcaxq_u8(uint8x16_t a, uint8x16_t b, uint8x16_t c);
+FORCE_INLINE uint8x16_t vbcaxq_u8(uint8x16_t a, uint8x16_t b, uint8x16_t c) {
+#if defined(__riscv_zvbb)
+  return __riscv_vxor_vv_u8m1(a, __riscv_vandn_vv_u8m1(b, c, 16), 16);
+#else
+  return __riscv_vxor_vv_u8m1(a, __riscv_vand_vv_u8m1(b, __riscv_vnot_v_u8m1(c, 16), 16), 16);
+#endif
+}
 
-// FORCE_INLINE uint16x8_t vbcaxq_u16(uint16x8_t a, uint16x8_t b, uint16x8_t c);
+FORCE_INLINE uint16x8_t vbcaxq_u16(uint16x8_t a, uint16x8_t b, uint16x8_t c) {
+#if defined(__riscv_zvbb)
+  return __riscv_vxor_vv_u16m1(a, __riscv_vandn_vv_u16m1(b, c, 8), 8);
+#else
+  return __riscv_vxor_vv_u16m1(a, __riscv_vand_vv_u16m1(b, __riscv_vnot_v_u16m1(c, 8), 8), 8);
+#endif
+}
 
-// FORCE_INLINE uint32x4_t vbcaxq_u32(uint32x4_t a, uint32x4_t b, uint32x4_t c);
+FORCE_INLINE uint32x4_t vbcaxq_u32(uint32x4_t a, uint32x4_t b, uint32x4_t c) {
+#if defined(__riscv_zvbb)
+  return __riscv_vxor_vv_u32m1(a, __riscv_vandn_vv_u32m1(b, c, 4), 4);
+#else
+  return __riscv_vxor_vv_u32m1(a, __riscv_vand_vv_u32m1(b, __riscv_vnot_v_u32m1(c, 4), 4), 4);
+#endif
+}
 
-// FORCE_INLINE uint64x2_t vbcaxq_u64(uint64x2_t a, uint64x2_t b, uint64x2_t c);
+FORCE_INLINE uint64x2_t vbcaxq_u64(uint64x2_t a, uint64x2_t b, uint64x2_t c) {
+#if defined(__riscv_zvbb)
+  return __riscv_vxor_vv_u64m1(a, __riscv_vandn_vv_u64m1(b, c, 2), 2);
+#else
+  return __riscv_vxor_vv_u64m1(a, __riscv_vand_vv_u64m1(b, __riscv_vnot_v_u64m1(c, 2), 2), 2);
+#endif
+}
 
-// FORCE_INLINE int8x16_t vbcaxq_s8(int8x16_t a, int8x16_t b, int8x16_t c);
+FORCE_INLINE int8x16_t vbcaxq_s8(int8x16_t a, int8x16_t b, int8x16_t c) {
+#if defined(__riscv_zvbb)
+  vuint8m1_t b_andn = __riscv_vandn_vv_u8m1(__riscv_vreinterpret_v_i8m1_u8m1(b),
+                                            __riscv_vreinterpret_v_i8m1_u8m1(c), 16);
+  return __riscv_vxor_vv_i8m1(a, __riscv_vreinterpret_v_u8m1_i8m1(b_andn), 16);
+#else
+  return __riscv_vxor_vv_i8m1(a, __riscv_vand_vv_i8m1(b, __riscv_vnot_v_i8m1(c, 16), 16), 16);
+#endif
+}
 
-// FORCE_INLINE int16x8_t vbcaxq_s16(int16x8_t a, int16x8_t b, int16x8_t c);
+FORCE_INLINE int16x8_t vbcaxq_s16(int16x8_t a, int16x8_t b, int16x8_t c) {
+#if defined(__riscv_zvbb)
+  vuint16m1_t b_andn = __riscv_vandn_vv_u16m1(__riscv_vreinterpret_v_i16m1_u16m1(b),
+                                              __riscv_vreinterpret_v_i16m1_u16m1(c), 8);
+  return __riscv_vxor_vv_i16m1(a, __riscv_vreinterpret_v_u16m1_i16m1(b_andn), 8);
+#else
+  return __riscv_vxor_vv_i16m1(a, __riscv_vand_vv_i16m1(b, __riscv_vnot_v_i16m1(c, 8), 8), 8);
+#endif
+}
 
-// FORCE_INLINE int32x4_t vbcaxq_s32(int32x4_t a, int32x4_t b, int32x4_t c);
+FORCE_INLINE int32x4_t vbcaxq_s32(int32x4_t a, int32x4_t b, int32x4_t c) {
+#if defined(__riscv_zvbb)
+  vuint32m1_t b_andn = __riscv_vandn_vv_u32m1(__riscv_vreinterpret_v_i32m1_u32m1(b),
+                                              __riscv_vreinterpret_v_i32m1_u32m1(c), 4);
+  return __riscv_vxor_vv_i32m1(a, __riscv_vreinterpret_v_u32m1_i32m1(b_andn), 4);
+#else
+  return __riscv_vxor_vv_i32m1(a, __riscv_vand_vv_i32m1(b, __riscv_vnot_v_i32m1(c, 4), 4), 4);
+#endif
+}
 
-// FORCE_INLINE int64x2_t vbcaxq_s64(int64x2_t a, int64x2_t b, int64x2_t c);
+FORCE_INLINE int64x2_t vbcaxq_s64(int64x2_t a, int64x2_t b, int64x2_t c) {
+#if defined(__riscv_zvbb)
+  vuint64m1_t b_andn = __riscv_vandn_vv_u64m1(__riscv_vreinterpret_v_i64m1_u64m1(b),
+                                              __riscv_vreinterpret_v_i64m1_u64m1(c), 2);
+  return __riscv_vxor_vv_i64m1(a, __riscv_vreinterpret_v_u64m1_i64m1(b_andn), 2);
+#else
+  return __riscv_vxor_vv_i64m1(a, __riscv_vand_vv_i64m1(b, __riscv_vnot_v_i64m1(c, 2), 2), 2);
+#endif
+}
 
 // FORCE_INLINE uint32x4_t vsm3ss1q_u32(uint32x4_t a, uint32x4_t b, uint32x4_t c);
 
@@ -11149,177 +12183,339 @@ FORCE_INLINE int64x2_t veor3q_s64(int64x2_t a, int64x2_t b, int64x2_t c) {
 
 // FORCE_INLINE uint32x4_t vsm4ekeyq_u32(uint32x4_t a, uint32x4_t b);
 
-// FORCE_INLINE float32x2_t vfmlal_low_f16(float32x2_t r, float16x4_t a, float16x4_t b);
+#if defined(__riscv_zvfh)
+// The low half of an f16 register is just its mf2 view, so only the _high forms need a slide.
+static inline vfloat16mf2_t neon2rvv_half_f16(vfloat16m1_t a, const int high, size_t vl) {
+  return __riscv_vlmul_trunc_v_f16m1_f16mf2(high ? __riscv_vslidedown_vx_f16m1(a, vl, vl * 2) : a);
+}
+
+static inline float16_t neon2rvv_lane_f16(vfloat16m1_t a, const int lane) {
+  return __riscv_vfmv_f_s_f16m1_f16(__riscv_vslidedown_vx_f16m1(a, lane, lane + 1));
+}
+
+FORCE_INLINE float32x2_t vfmlal_low_f16(float32x2_t r, float16x4_t a, float16x4_t b) {
+  return __riscv_vfwmacc_vv_f32m1(r, neon2rvv_half_f16(a, 0, 2), neon2rvv_half_f16(b, 0, 2), 2);
+}
+
+FORCE_INLINE float32x2_t vfmlsl_low_f16(float32x2_t r, float16x4_t a, float16x4_t b) {
+  return __riscv_vfwnmsac_vv_f32m1(r, neon2rvv_half_f16(a, 0, 2), neon2rvv_half_f16(b, 0, 2), 2);
+}
+
+FORCE_INLINE float32x4_t vfmlalq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b) {
+  return __riscv_vfwmacc_vv_f32m1(r, neon2rvv_half_f16(a, 0, 4), neon2rvv_half_f16(b, 0, 4), 4);
+}
+
+FORCE_INLINE float32x4_t vfmlslq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b) {
+  return __riscv_vfwnmsac_vv_f32m1(r, neon2rvv_half_f16(a, 0, 4), neon2rvv_half_f16(b, 0, 4), 4);
+}
+
+FORCE_INLINE float32x2_t vfmlal_high_f16(float32x2_t r, float16x4_t a, float16x4_t b) {
+  return __riscv_vfwmacc_vv_f32m1(r, neon2rvv_half_f16(a, 1, 2), neon2rvv_half_f16(b, 1, 2), 2);
+}
+
+FORCE_INLINE float32x2_t vfmlsl_high_f16(float32x2_t r, float16x4_t a, float16x4_t b) {
+  return __riscv_vfwnmsac_vv_f32m1(r, neon2rvv_half_f16(a, 1, 2), neon2rvv_half_f16(b, 1, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlsl_low_f16(float32x2_t r, float16x4_t a, float16x4_t b);
+FORCE_INLINE float32x4_t vfmlalq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b) {
+  return __riscv_vfwmacc_vv_f32m1(r, neon2rvv_half_f16(a, 1, 4), neon2rvv_half_f16(b, 1, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlalq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b);
+FORCE_INLINE float32x4_t vfmlslq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b) {
+  return __riscv_vfwnmsac_vv_f32m1(r, neon2rvv_half_f16(a, 1, 4), neon2rvv_half_f16(b, 1, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlslq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b);
+FORCE_INLINE float32x2_t vfmlal_lane_low_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlal_high_f16(float32x2_t r, float16x4_t a, float16x4_t b);
+FORCE_INLINE float32x2_t vfmlal_laneq_low_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlsl_high_f16(float32x2_t r, float16x4_t a, float16x4_t b);
+FORCE_INLINE float32x4_t vfmlalq_lane_low_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlalq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b);
+FORCE_INLINE float32x4_t vfmlalq_laneq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlslq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b);
+FORCE_INLINE float32x2_t vfmlsl_lane_low_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlal_lane_low_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane);
+FORCE_INLINE float32x2_t vfmlsl_laneq_low_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlal_laneq_low_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane);
+FORCE_INLINE float32x4_t vfmlslq_lane_low_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlalq_lane_low_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane);
+FORCE_INLINE float32x4_t vfmlslq_laneq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 0, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlalq_laneq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane);
+FORCE_INLINE float32x2_t vfmlal_lane_high_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlsl_lane_low_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane);
+FORCE_INLINE float32x2_t vfmlsl_lane_high_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlsl_laneq_low_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane);
+FORCE_INLINE float32x4_t vfmlalq_lane_high_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlslq_lane_low_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane);
+FORCE_INLINE float32x4_t vfmlslq_lane_high_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlslq_laneq_low_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane);
+FORCE_INLINE float32x2_t vfmlal_laneq_high_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlal_lane_high_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane);
+FORCE_INLINE float32x2_t vfmlsl_laneq_high_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 2), 2);
+}
 
-// FORCE_INLINE float32x2_t vfmlsl_lane_high_f16(float32x2_t r, float16x4_t a, float16x4_t b, const int lane);
+FORCE_INLINE float32x4_t vfmlalq_laneq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwmacc_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 4), 4);
+}
 
-// FORCE_INLINE float32x4_t vfmlalq_lane_high_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane);
+FORCE_INLINE float32x4_t vfmlslq_laneq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane) {
+  return __riscv_vfwnmsac_vf_f32m1(r, neon2rvv_lane_f16(b, lane), neon2rvv_half_f16(a, 1, 4), 4);
+}
+#endif  // defined(__riscv_zvfh)
 
-// FORCE_INLINE float32x4_t vfmlslq_lane_high_f16(float32x4_t r, float16x8_t a, float16x4_t b, const int lane);
+// Complex lanes are interleaved (re, im) pairs. A rotation needs at most two vrgathers, one to broadcast the real or
+// imaginary part of a and one to swap b, and the sign flip is a masked vfneg ahead of a single fused multiply-add. The
+// gather indices depend only on vl, so a rot0 + rot90 pair in a loop shares them once the calls are inlined.
+static inline vfloat32m1_t neon2rvv_cmla_f32(vfloat32m1_t r, vfloat32m1_t a, vfloat32m1_t b, const int rot, size_t vl) {
+  vuint32m1_t idx = __riscv_vid_v_u32m1(vl);
+  if (rot == 0 || rot == 180) {
+    vfloat32m1_t a_re = __riscv_vrgather_vv_f32m1(a, __riscv_vand_vx_u32m1(idx, ~(uint32_t)1, vl), vl);
+    return rot == 0 ? __riscv_vfmacc_vv_f32m1(r, a_re, b, vl) : __riscv_vfnmsac_vv_f32m1(r, a_re, b, vl);
+  }
+  vfloat32m1_t a_im = __riscv_vrgather_vv_f32m1(a, __riscv_vor_vx_u32m1(idx, 1, vl), vl);
+  vfloat32m1_t b_swap = __riscv_vrgather_vv_f32m1(b, __riscv_vxor_vx_u32m1(idx, 1, vl), vl);
+  vbool32_t neg = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(idx, 1, vl), rot == 90 ? 0 : 1, vl);
+  return __riscv_vfmacc_vv_f32m1(r, a_im, __riscv_vfneg_v_f32m1_mu(neg, b_swap, b_swap, vl), vl);
+}
 
-// FORCE_INLINE float32x2_t vfmlal_laneq_high_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane);
+static inline vfloat32m1_t neon2rvv_cmla_lane_f32(vfloat32m1_t r, vfloat32m1_t a, vfloat32m1_t b, const int lane,
+                                                  const int rot, size_t vl) {
+  vuint32m1_t lane_idx = __riscv_vadd_vx_u32m1(__riscv_vand_vx_u32m1(__riscv_vid_v_u32m1(vl), 1, vl), lane * 2, vl);
+  return neon2rvv_cmla_f32(r, a, __riscv_vrgather_vv_f32m1(b, lane_idx, vl), rot, vl);
+}
 
-// FORCE_INLINE float32x2_t vfmlsl_laneq_high_f16(float32x2_t r, float16x4_t a, float16x8_t b, const int lane);
+static inline vfloat32m1_t neon2rvv_cadd_f32(vfloat32m1_t a, vfloat32m1_t b, const int rot, size_t vl) {
+  vuint32m1_t idx = __riscv_vid_v_u32m1(vl);
+  vfloat32m1_t b_swap = __riscv_vrgather_vv_f32m1(b, __riscv_vxor_vx_u32m1(idx, 1, vl), vl);
+  vbool32_t neg = __riscv_vmseq_vx_u32m1_b32(__riscv_vand_vx_u32m1(idx, 1, vl), rot == 90 ? 0 : 1, vl);
+  return __riscv_vfadd_vv_f32m1(a, __riscv_vfneg_v_f32m1_mu(neg, b_swap, b_swap, vl), vl);
+}
 
-// FORCE_INLINE float32x4_t vfmlalq_laneq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane);
+static inline vfloat64m1_t neon2rvv_cmla_f64(vfloat64m1_t r, vfloat64m1_t a, vfloat64m1_t b, const int rot, size_t vl) {
+  vuint64m1_t idx = __riscv_vid_v_u64m1(vl);
+  if (rot == 0 || rot == 180) {
+    vfloat64m1_t a_re = __riscv_vrgather_vv_f64m1(a, __riscv_vand_vx_u64m1(idx, ~(uint64_t)1, vl), vl);
+    return rot == 0 ? __riscv_vfmacc_vv_f64m1(r, a_re, b, vl) : __riscv_vfnmsac_vv_f64m1(r, a_re, b, vl);
+  }
+  vfloat64m1_t a_im = __riscv_vrgather_vv_f64m1(a, __riscv_vor_vx_u64m1(idx, 1, vl), vl);
+  vfloat64m1_t b_swap = __riscv_vrgather_vv_f64m1(b, __riscv_vxor_vx_u64m1(idx, 1, vl), vl);
+  vbool64_t neg = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(idx, 1, vl), rot == 90 ? 0 : 1, vl);
+  return __riscv_vfmacc_vv_f64m1(r, a_im, __riscv_vfneg_v_f64m1_mu(neg, b_swap, b_swap, vl), vl);
+}
 
-// FORCE_INLINE float32x4_t vfmlslq_laneq_high_f16(float32x4_t r, float16x8_t a, float16x8_t b, const int lane);
+static inline vfloat64m1_t neon2rvv_cadd_f64(vfloat64m1_t a, vfloat64m1_t b, const int rot, size_t vl) {
+  vuint64m1_t idx = __riscv_vid_v_u64m1(vl);
+  vfloat64m1_t b_swap = __riscv_vrgather_vv_f64m1(b, __riscv_vxor_vx_u64m1(idx, 1, vl), vl);
+  vbool64_t neg = __riscv_vmseq_vx_u64m1_b64(__riscv_vand_vx_u64m1(idx, 1, vl), rot == 90 ? 0 : 1, vl);
+  return __riscv_vfadd_vv_f64m1(a, __riscv_vfneg_v_f64m1_mu(neg, b_swap, b_swap, vl), vl);
+}
 
 // FORCE_INLINE float16x4_t vcadd_rot90_f16(float16x4_t a, float16x4_t b);
 
-// FORCE_INLINE float32x2_t vcadd_rot90_f32(float32x2_t a, float32x2_t b);
+FORCE_INLINE float32x2_t vcadd_rot90_f32(float32x2_t a, float32x2_t b) { return neon2rvv_cadd_f32(a, b, 90, 2); }
 
 // FORCE_INLINE float16x8_t vcaddq_rot90_f16(float16x8_t a, float16x8_t b);
 
-// FORCE_INLINE float32x4_t vcaddq_rot90_f32(float32x4_t a, float32x4_t b);
+FORCE_INLINE float32x4_t vcaddq_rot90_f32(float32x4_t a, float32x4_t b) { return neon2rvv_cadd_f32(a, b, 90, 4); }
 
-// FORCE_INLINE float64x2_t vcaddq_rot90_f64(float64x2_t a, float64x2_t b);
+FORCE_INLINE float64x2_t vcaddq_rot90_f64(float64x2_t a, float64x2_t b) { return neon2rvv_cadd_f64(a, b, 90, 2); }
 
 // FORCE_INLINE float16x4_t vcadd_rot270_f16(float16x4_t a, float16x4_t b);
 
-// FORCE_INLINE float32x2_t vcadd_rot270_f32(float32x2_t a, float32x2_t b);
+FORCE_INLINE float32x2_t vcadd_rot270_f32(float32x2_t a, float32x2_t b) { return neon2rvv_cadd_f32(a, b, 270, 2); }
 
 // FORCE_INLINE float16x8_t vcaddq_rot270_f16(float16x8_t a, float16x8_t b);
 
-// FORCE_INLINE float32x4_t vcaddq_rot270_f32(float32x4_t a, float32x4_t b);
+FORCE_INLINE float32x4_t vcaddq_rot270_f32(float32x4_t a, float32x4_t b) { return neon2rvv_cadd_f32(a, b, 270, 4); }
 
-// FORCE_INLINE float64x2_t vcaddq_rot270_f64(float64x2_t a, float64x2_t b);
+FORCE_INLINE float64x2_t vcaddq_rot270_f64(float64x2_t a, float64x2_t b) { return neon2rvv_cadd_f64(a, b, 270, 2); }
 
 // FORCE_INLINE float16x4_t vcmla_f16(float16x4_t r, float16x4_t a, float16x4_t b);
 
-// FORCE_INLINE float32x2_t vcmla_f32(float32x2_t r, float32x2_t a, float32x2_t b);
+FORCE_INLINE float32x2_t vcmla_f32(float32x2_t r, float32x2_t a, float32x2_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 0, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_lane_f16(float16x4_t r, float16x4_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 0, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_laneq_f16(float16x4_t r, float16x4_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 0, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_f16(float16x8_t r, float16x8_t a, float16x8_t b);
 
-// FORCE_INLINE float32x4_t vcmlaq_f32(float32x4_t r, float32x4_t a, float32x4_t b);
+FORCE_INLINE float32x4_t vcmlaq_f32(float32x4_t r, float32x4_t a, float32x4_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 0, 4);
+}
 
-// FORCE_INLINE float64x2_t vcmlaq_f64(float64x2_t r, float64x2_t a, float64x2_t b);
+FORCE_INLINE float64x2_t vcmlaq_f64(float64x2_t r, float64x2_t a, float64x2_t b) {
+  return neon2rvv_cmla_f64(r, a, b, 0, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_lane_f16(float16x8_t r, float16x8_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 0, 4);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_laneq_f16(float16x8_t r, float16x8_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 0, 4);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot90_f16(float16x4_t r, float16x4_t a, float16x4_t b);
 
-// FORCE_INLINE float32x2_t vcmla_rot90_f32(float32x2_t r, float32x2_t a, float32x2_t b);
+FORCE_INLINE float32x2_t vcmla_rot90_f32(float32x2_t r, float32x2_t a, float32x2_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 90, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot90_lane_f16(float16x4_t r, float16x4_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_rot90_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_rot90_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 90, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot90_laneq_f16(float16x4_t r, float16x4_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_rot90_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_rot90_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 90, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot90_f16(float16x8_t r, float16x8_t a, float16x8_t b);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot90_f32(float32x4_t r, float32x4_t a, float32x4_t b);
+FORCE_INLINE float32x4_t vcmlaq_rot90_f32(float32x4_t r, float32x4_t a, float32x4_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 90, 4);
+}
 
-// FORCE_INLINE float64x2_t vcmlaq_rot90_f64(float64x2_t r, float64x2_t a, float64x2_t b);
+FORCE_INLINE float64x2_t vcmlaq_rot90_f64(float64x2_t r, float64x2_t a, float64x2_t b) {
+  return neon2rvv_cmla_f64(r, a, b, 90, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot90_lane_f16(float16x8_t r, float16x8_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot90_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_rot90_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 90, 4);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot90_laneq_f16(float16x8_t r, float16x8_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot90_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_rot90_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 90, 4);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot180_f16(float16x4_t r, float16x4_t a, float16x4_t b);
 
-// FORCE_INLINE float32x2_t vcmla_rot180_f32(float32x2_t r, float32x2_t a, float32x2_t b);
+FORCE_INLINE float32x2_t vcmla_rot180_f32(float32x2_t r, float32x2_t a, float32x2_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 180, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot180_lane_f16(float16x4_t r, float16x4_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_rot180_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_rot180_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 180, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot180_laneq_f16(float16x4_t r, float16x4_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_rot180_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_rot180_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 180, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot180_f16(float16x8_t r, float16x8_t a, float16x8_t b);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot180_f32(float32x4_t r, float32x4_t a, float32x4_t b);
+FORCE_INLINE float32x4_t vcmlaq_rot180_f32(float32x4_t r, float32x4_t a, float32x4_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 180, 4);
+}
 
-// FORCE_INLINE float64x2_t vcmlaq_rot180_f64(float64x2_t r, float64x2_t a, float64x2_t b);
+FORCE_INLINE float64x2_t vcmlaq_rot180_f64(float64x2_t r, float64x2_t a, float64x2_t b) {
+  return neon2rvv_cmla_f64(r, a, b, 180, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot180_lane_f16(float16x8_t r, float16x8_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot180_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_rot180_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 180, 4);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot180_laneq_f16(float16x8_t r, float16x8_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot180_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_rot180_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 180, 4);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot270_f16(float16x4_t r, float16x4_t a, float16x4_t b);
 
-// FORCE_INLINE float32x2_t vcmla_rot270_f32(float32x2_t r, float32x2_t a, float32x2_t b);
+FORCE_INLINE float32x2_t vcmla_rot270_f32(float32x2_t r, float32x2_t a, float32x2_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 270, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot270_lane_f16(float16x4_t r, float16x4_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_rot270_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_rot270_lane_f32(float32x2_t r, float32x2_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 270, 2);
+}
 
 // FORCE_INLINE float16x4_t vcmla_rot270_laneq_f16(float16x4_t r, float16x4_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x2_t vcmla_rot270_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x2_t vcmla_rot270_laneq_f32(float32x2_t r, float32x2_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 270, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot270_f16(float16x8_t r, float16x8_t a, float16x8_t b);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot270_f32(float32x4_t r, float32x4_t a, float32x4_t b);
+FORCE_INLINE float32x4_t vcmlaq_rot270_f32(float32x4_t r, float32x4_t a, float32x4_t b) {
+  return neon2rvv_cmla_f32(r, a, b, 270, 4);
+}
 
-// FORCE_INLINE float64x2_t vcmlaq_rot270_f64(float64x2_t r, float64x2_t a, float64x2_t b);
+FORCE_INLINE float64x2_t vcmlaq_rot270_f64(float64x2_t r, float64x2_t a, float64x2_t b) {
+  return neon2rvv_cmla_f64(r, a, b, 270, 2);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot270_lane_f16(float16x8_t r, float16x8_t a, float16x4_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot270_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_rot270_lane_f32(float32x4_t r, float32x4_t a, float32x2_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 270, 4);
+}
 
 // FORCE_INLINE float16x8_t vcmlaq_rot270_laneq_f16(float16x8_t r, float16x8_t a, float16x8_t b, const int lane);
 
-// FORCE_INLINE float32x4_t vcmlaq_rot270_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane);
+FORCE_INLINE float32x4_t vcmlaq_rot270_laneq_f32(float32x4_t r, float32x4_t a, float32x4_t b, const int lane) {
+  return neon2rvv_cmla_lane_f32(r, a, b, lane, 270, 4);
+}
 
 // FORCE_INLINE float32x2_t vrnd32z_f32(float32x2_t a);
 
@@ -11716,20 +12912,14 @@ FORCE_INLINE int32x4_t vusdotq_laneq_s32(int32x4_t r, uint8x16_t a, int8x16_t b,
 
 // FORCE_INLINE float32x4_t vbfmlaltq_laneq_f32(float32x4_t r, bfloat16x8_t a, bfloat16x8_t b, const int lane);
 
-FORCE_INLINE int16x4_t vqrdmlsh_lane_s16(int16x4_t a, int16x4_t b, int16x4_t c, const int __d) {
-  vint16m1_t c_dup = __riscv_vrgather_vx_i16m1(c, __d, 4);
-  vint32m2_t bc_mul = __riscv_vwmul_vv_i32m2(b, c_dup, 4);
-  vint32m2_t bc_mulx2 = __riscv_vsll_vx_i32m2(bc_mul, 1, 4);
-  vint16m1_t bc_s = __riscv_vnclip_wx_i16m1(bc_mulx2, 16, __RISCV_VXRM_RNU, 4);
-  return __riscv_vssub_vv_i16m1(a, bc_s, 4);
+FORCE_INLINE int16x4_t vqrdmlsh_lane_s16(int16x4_t a, int16x4_t b, int16x4_t v, const int lane) {
+  vint16m1_t v_dup_lane = __riscv_vrgather_vx_i16m1(v, lane, 4);
+  return vqrdmlsh_s16(a, b, v_dup_lane);
 }
 
-FORCE_INLINE int32x2_t vqrdmlsh_lane_s32(int32x2_t a, int32x2_t b, int32x2_t c, const int __d) {
-  vint32m1_t c_dup = __riscv_vrgather_vx_i32m1(c, __d, 2);
-  vint64m2_t bc_mul = __riscv_vwmul_vv_i64m2(b, c_dup, 2);
-  vint64m2_t bc_mulx2 = __riscv_vsll_vx_i64m2(bc_mul, 1, 2);
-  vint32m1_t bc_s = __riscv_vnclip_wx_i32m1(bc_mulx2, 32, __RISCV_VXRM_RNU, 2);
-  return __riscv_vssub_vv_i32m1(a, bc_s, 2);
+FORCE_INLINE int32x2_t vqrdmlsh_lane_s32(int32x2_t a, int32x2_t b, int32x2_t v, const int lane) {
+  vint32m1_t v_dup_lane = __riscv_vrgather_vx_i32m1(v, lane, 2);
+  return vqrdmlsh_s32(a, b, v_dup_lane);
 }
 
 FORCE_INLINE int16x4_t vmul_n_s16(int16x4_t a, int16_t b) { return __riscv_vmul_vx_i16m1(a, b, 4); }
@@ -11773,23 +12963,39 @@ FORCE_INLINE uint64x2_t vmull_n_u32(uint32x2_t a, uint32_t b) {
 }
 
 FORCE_INLINE int32x4_t vmull_high_n_s16(int16x8_t a, int16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vx_i32m2(a, b, 8), 1);
+#else
   vint16m1_t a_high = __riscv_vslidedown_vx_i16m1(a, 4, 8);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vx_i32m2(a_high, b, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vmull_high_n_s32(int32x4_t a, int32_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vx_i64m2(a, b, 4), 1);
+#else
   vint32m1_t a_high = __riscv_vslidedown_vx_i32m1(a, 2, 4);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vx_i64m2(a_high, b, 2));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmull_high_n_u16(uint16x8_t a, uint16_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vx_u32m2(a, b, 8), 1);
+#else
   vuint16m1_t a_high = __riscv_vslidedown_vx_u16m1(a, 4, 8);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmulu_vx_u32m2(a_high, b, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmull_high_n_u32(uint32x4_t a, uint32_t b) {
+#if NEON2RVV_FIXED_VLEN_128
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vx_u64m2(a, b, 4), 1);
+#else
   vuint32m1_t a_high = __riscv_vslidedown_vx_u32m1(a, 2, 4);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmulu_vx_u64m2(a_high, b, 4));
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmull_n_s16(int16x4_t a, int16_t b) {
@@ -11815,59 +13021,35 @@ FORCE_INLINE int64x2_t vqdmull_high_n_s32(int32x4_t a, int32_t b) {
 }
 
 FORCE_INLINE int16x8_t vqdmulhq_n_s16(int16x8_t a, int16_t b) {
-  vint16m1_t b_dup = vdupq_n_s16(b);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup, 8);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 8);
-  return __riscv_vnsra_wx_i16m1(ab_mulx2, 16, 8);
+  return __riscv_vsmul_vx_i16m1(a, b, __RISCV_VXRM_RDN, 8);
 }
 
 FORCE_INLINE int32x4_t vqdmulhq_n_s32(int32x4_t a, int32_t b) {
-  vint32m1_t b_dup = vdupq_n_s32(b);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup, 4);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 4);
-  return __riscv_vnsra_wx_i32m1(ab_mulx2, 32, 4);
+  return __riscv_vsmul_vx_i32m1(a, b, __RISCV_VXRM_RDN, 4);
 }
 
 FORCE_INLINE int16x4_t vqdmulh_n_s16(int16x4_t a, int16_t b) {
-  vint16m1_t b_dup = vdup_n_s16(b);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup, 4);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 4);
-  return __riscv_vnsra_wx_i16m1(ab_mulx2, 16, 4);
+  return __riscv_vsmul_vx_i16m1(a, b, __RISCV_VXRM_RDN, 4);
 }
 
 FORCE_INLINE int32x2_t vqdmulh_n_s32(int32x2_t a, int32_t b) {
-  vint32m1_t b_dup = vdup_n_s32(b);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup, 2);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 2);
-  return __riscv_vnsra_wx_i32m1(ab_mulx2, 32, 2);
+  return __riscv_vsmul_vx_i32m1(a, b, __RISCV_VXRM_RDN, 2);
 }
 
 FORCE_INLINE int16x8_t vqrdmulhq_n_s16(int16x8_t a, int16_t b) {
-  vint16m1_t b_dup = vdupq_n_s16(b);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup, 8);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 8);
-  return __riscv_vnclip_wx_i16m1(ab_mulx2, 16, __RISCV_VXRM_RNU, 8);
+  return __riscv_vsmul_vx_i16m1(a, b, __RISCV_VXRM_RNU, 8);
 }
 
 FORCE_INLINE int32x4_t vqrdmulhq_n_s32(int32x4_t a, int32_t b) {
-  vint32m1_t b_dup = vdupq_n_s32(b);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup, 4);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 4);
-  return __riscv_vnclip_wx_i32m1(ab_mulx2, 32, __RISCV_VXRM_RNU, 4);
+  return __riscv_vsmul_vx_i32m1(a, b, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int16x4_t vqrdmulh_n_s16(int16x4_t a, int16_t b) {
-  vint16m1_t b_dup = vdup_n_s16(b);
-  vint32m2_t ab_mul = __riscv_vwmul_vv_i32m2(a, b_dup, 4);
-  vint32m2_t ab_mulx2 = __riscv_vmul_vx_i32m2(ab_mul, 2, 4);
-  return __riscv_vnclip_wx_i16m1(ab_mulx2, 16, __RISCV_VXRM_RNU, 4);
+  return __riscv_vsmul_vx_i16m1(a, b, __RISCV_VXRM_RNU, 4);
 }
 
 FORCE_INLINE int32x2_t vqrdmulh_n_s32(int32x2_t a, int32_t b) {
-  vint32m1_t b_dup = vdup_n_s32(b);
-  vint64m2_t ab_mul = __riscv_vwmul_vv_i64m2(a, b_dup, 2);
-  vint64m2_t ab_mulx2 = __riscv_vmul_vx_i64m2(ab_mul, 2, 2);
-  return __riscv_vnclip_wx_i32m1(ab_mulx2, 32, __RISCV_VXRM_RNU, 2);
+  return __riscv_vsmul_vx_i32m1(a, b, __RISCV_VXRM_RNU, 2);
 }
 
 FORCE_INLINE int16x4_t vmla_n_s16(int16x4_t a, int16x4_t b, int16_t c) { return __riscv_vmacc_vx_i16m1(a, c, b, 4); }
@@ -11919,23 +13101,43 @@ FORCE_INLINE uint64x2_t vmlal_n_u32(uint64x2_t a, uint32x2_t b, uint32_t c) {
 }
 
 FORCE_INLINE int32x4_t vmlal_high_n_s16(int32x4_t a, int16x8_t b, int16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t a_wide = __riscv_vset_v_i32m1_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), 1, a);
+  return __riscv_vget_v_i32m2_i32m1(__riscv_vwmacc_vx_i32m2(a_wide, c, b, 8), 1);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmacc_vx_i32m2(__riscv_vlmul_ext_v_i32m1_i32m2(a), c, b_high, 4));
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlal_high_n_s32(int64x2_t a, int32x4_t b, int32_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t a_wide = __riscv_vset_v_i64m1_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), 1, a);
+  return __riscv_vget_v_i64m2_i64m1(__riscv_vwmacc_vx_i64m2(a_wide, c, b, 4), 1);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmacc_vx_i64m2(__riscv_vlmul_ext_v_i64m1_i64m2(a), c, b_high, 2));
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlal_high_n_u16(uint32x4_t a, uint16x8_t b, uint16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t a_wide = __riscv_vset_v_u32m1_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), 1, a);
+  return __riscv_vget_v_u32m2_u32m1(__riscv_vwmaccu_vx_u32m2(a_wide, c, b, 8), 1);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmaccu_vx_u32m2(__riscv_vlmul_ext_v_u32m1_u32m2(a), c, b_high, 4));
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlal_high_n_u32(uint64x2_t a, uint32x4_t b, uint32_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t a_wide = __riscv_vset_v_u64m1_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), 1, a);
+  return __riscv_vget_v_u64m2_u64m1(__riscv_vwmaccu_vx_u64m2(a_wide, c, b, 4), 1);
+#else
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmaccu_vx_u64m2(__riscv_vlmul_ext_v_u64m1_u64m2(a), c, b_high, 2));
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmlal_n_s16(int32x4_t a, int16x4_t b, int16_t c) {
@@ -12017,23 +13219,43 @@ FORCE_INLINE uint64x2_t vmlsl_n_u32(uint64x2_t a, uint32x2_t b, uint32_t c) {
 }
 
 FORCE_INLINE int32x4_t vmlsl_high_n_s16(int32x4_t a, int16x8_t b, int16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m1_t bc_mul = __riscv_vget_v_i32m2_i32m1(__riscv_vwmul_vx_i32m2(b, c, 8), 1);
+  return __riscv_vsub_vv_i32m1(a, bc_mul, 4);
+#else
   vint16m1_t b_high = __riscv_vslidedown_vx_i16m1(b, 4, 8);
   return __riscv_vsub_vv_i32m1(a, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vx_i32m2(b_high, c, 4)), 4);
+#endif
 }
 
 FORCE_INLINE int64x2_t vmlsl_high_n_s32(int64x2_t a, int32x4_t b, int32_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m1_t bc_mul = __riscv_vget_v_i64m2_i64m1(__riscv_vwmul_vx_i64m2(b, c, 4), 1);
+  return __riscv_vsub_vv_i64m1(a, bc_mul, 2);
+#else
   vint32m1_t b_high = __riscv_vslidedown_vx_i32m1(b, 2, 4);
   return __riscv_vsub_vv_i64m1(a, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vx_i64m2(b_high, c, 2)), 2);
+#endif
 }
 
 FORCE_INLINE uint32x4_t vmlsl_high_n_u16(uint32x4_t a, uint16x8_t b, uint16_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m1_t bc_mul = __riscv_vget_v_u32m2_u32m1(__riscv_vwmulu_vx_u32m2(b, c, 8), 1);
+  return __riscv_vsub_vv_u32m1(a, bc_mul, 4);
+#else
   vuint16m1_t b_high = __riscv_vslidedown_vx_u16m1(b, 4, 8);
   return __riscv_vsub_vv_u32m1(a, __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmulu_vx_u32m2(b_high, c, 4)), 4);
+#endif
 }
 
 FORCE_INLINE uint64x2_t vmlsl_high_n_u32(uint64x2_t a, uint32x4_t b, uint32_t c) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m1_t bc_mul = __riscv_vget_v_u64m2_u64m1(__riscv_vwmulu_vx_u64m2(b, c, 4), 1);
+  return __riscv_vsub_vv_u64m1(a, bc_mul, 2);
+#else
   vuint32m1_t b_high = __riscv_vslidedown_vx_u32m1(b, 2, 4);
   return __riscv_vsub_vv_u64m1(a, __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmulu_vx_u64m2(b_high, c, 2)), 2);
+#endif
 }
 
 FORCE_INLINE int32x4_t vqdmlsl_n_s16(int32x4_t a, int16x4_t b, int16_t c) {
@@ -15952,10 +17174,16 @@ FORCE_INLINE void vst1_s8_x2(int8_t *ptr, int8x8x2_t val) {
 }
 
 FORCE_INLINE void vst1q_s8_x2(int8_t *ptr, int8x16x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint8m2_t v = __riscv_vlmul_ext_v_i8m1_i8m2(__riscv_vget_v_i8m1x2_i8m1(val, 0));
+  v = __riscv_vset_v_i8m1_i8m2(v, 1, __riscv_vget_v_i8m1x2_i8m1(val, 1));
+  __riscv_vse8_v_i8m2(ptr, v, 32);
+#else
   vint8m2_t val0 = __riscv_vlmul_ext_v_i8m1_i8m2(__riscv_vget_v_i8m1x2_i8m1(val, 0));
   vint8m2_t val1 = __riscv_vlmul_ext_v_i8m1_i8m2(__riscv_vget_v_i8m1x2_i8m1(val, 1));
   vint8m2_t v = __riscv_vslideup_vx_i8m2(val0, val1, 16, 32);
   __riscv_vse8_v_i8m2(ptr, v, 32);
+#endif
 }
 
 FORCE_INLINE void vst1_s16_x2(int16_t *ptr, int16x4x2_t val) {
@@ -15966,10 +17194,16 @@ FORCE_INLINE void vst1_s16_x2(int16_t *ptr, int16x4x2_t val) {
 }
 
 FORCE_INLINE void vst1q_s16_x2(int16_t *ptr, int16x8x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t v = __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vget_v_i16m1x2_i16m1(val, 0));
+  v = __riscv_vset_v_i16m1_i16m2(v, 1, __riscv_vget_v_i16m1x2_i16m1(val, 1));
+  __riscv_vse16_v_i16m2(ptr, v, 16);
+#else
   vint16m2_t val0 = __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vget_v_i16m1x2_i16m1(val, 0));
   vint16m2_t val1 = __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vget_v_i16m1x2_i16m1(val, 1));
   vint16m2_t v = __riscv_vslideup_vx_i16m2(val0, val1, 8, 16);
   __riscv_vse16_v_i16m2(ptr, v, 16);
+#endif
 }
 
 FORCE_INLINE void vst1_s32_x2(int32_t *ptr, int32x2x2_t val) {
@@ -15980,10 +17214,16 @@ FORCE_INLINE void vst1_s32_x2(int32_t *ptr, int32x2x2_t val) {
 }
 
 FORCE_INLINE void vst1q_s32_x2(int32_t *ptr, int32x4x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t v = __riscv_vlmul_ext_v_i32m1_i32m2(__riscv_vget_v_i32m1x2_i32m1(val, 0));
+  v = __riscv_vset_v_i32m1_i32m2(v, 1, __riscv_vget_v_i32m1x2_i32m1(val, 1));
+  __riscv_vse32_v_i32m2(ptr, v, 8);
+#else
   vint32m2_t val0 = __riscv_vlmul_ext_v_i32m1_i32m2(__riscv_vget_v_i32m1x2_i32m1(val, 0));
   vint32m2_t val1 = __riscv_vlmul_ext_v_i32m1_i32m2(__riscv_vget_v_i32m1x2_i32m1(val, 1));
   vint32m2_t v = __riscv_vslideup_vx_i32m2(val0, val1, 4, 8);
   __riscv_vse32_v_i32m2(ptr, v, 8);
+#endif
 }
 
 FORCE_INLINE void vst1_u8_x2(uint8_t *ptr, uint8x8x2_t val) {
@@ -15994,10 +17234,16 @@ FORCE_INLINE void vst1_u8_x2(uint8_t *ptr, uint8x8x2_t val) {
 }
 
 FORCE_INLINE void vst1q_u8_x2(uint8_t *ptr, uint8x16x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m2_t v = __riscv_vlmul_ext_v_u8m1_u8m2(__riscv_vget_v_u8m1x2_u8m1(val, 0));
+  v = __riscv_vset_v_u8m1_u8m2(v, 1, __riscv_vget_v_u8m1x2_u8m1(val, 1));
+  __riscv_vse8_v_u8m2(ptr, v, 32);
+#else
   vuint8m2_t val0 = __riscv_vlmul_ext_v_u8m1_u8m2(__riscv_vget_v_u8m1x2_u8m1(val, 0));
   vuint8m2_t val1 = __riscv_vlmul_ext_v_u8m1_u8m2(__riscv_vget_v_u8m1x2_u8m1(val, 1));
   vuint8m2_t v = __riscv_vslideup_vx_u8m2(val0, val1, 16, 32);
   __riscv_vse8_v_u8m2(ptr, v, 32);
+#endif
 }
 
 FORCE_INLINE void vst1_u16_x2(uint16_t *ptr, uint16x4x2_t val) {
@@ -16008,10 +17254,16 @@ FORCE_INLINE void vst1_u16_x2(uint16_t *ptr, uint16x4x2_t val) {
 }
 
 FORCE_INLINE void vst1q_u16_x2(uint16_t *ptr, uint16x8x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t v = __riscv_vlmul_ext_v_u16m1_u16m2(__riscv_vget_v_u16m1x2_u16m1(val, 0));
+  v = __riscv_vset_v_u16m1_u16m2(v, 1, __riscv_vget_v_u16m1x2_u16m1(val, 1));
+  __riscv_vse16_v_u16m2(ptr, v, 16);
+#else
   vuint16m2_t val0 = __riscv_vlmul_ext_v_u16m1_u16m2(__riscv_vget_v_u16m1x2_u16m1(val, 0));
   vuint16m2_t val1 = __riscv_vlmul_ext_v_u16m1_u16m2(__riscv_vget_v_u16m1x2_u16m1(val, 1));
   vuint16m2_t v = __riscv_vslideup_vx_u16m2(val0, val1, 8, 16);
   __riscv_vse16_v_u16m2(ptr, v, 16);
+#endif
 }
 
 FORCE_INLINE void vst1_u32_x2(uint32_t *ptr, uint32x2x2_t val) {
@@ -16022,10 +17274,16 @@ FORCE_INLINE void vst1_u32_x2(uint32_t *ptr, uint32x2x2_t val) {
 }
 
 FORCE_INLINE void vst1q_u32_x2(uint32_t *ptr, uint32x4x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t v = __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x2_u32m1(val, 0));
+  v = __riscv_vset_v_u32m1_u32m2(v, 1, __riscv_vget_v_u32m1x2_u32m1(val, 1));
+  __riscv_vse32_v_u32m2(ptr, v, 8);
+#else
   vuint32m2_t val0 = __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x2_u32m1(val, 0));
   vuint32m2_t val1 = __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x2_u32m1(val, 1));
   vuint32m2_t v = __riscv_vslideup_vx_u32m2(val0, val1, 4, 8);
   __riscv_vse32_v_u32m2(ptr, v, 8);
+#endif
 }
 
 // FORCE_INLINE void vst1_f16_x2(float16_t * ptr, float16x4x2_t val);
@@ -16040,10 +17298,16 @@ FORCE_INLINE void vst1_f32_x2(float32_t *ptr, float32x2x2_t val) {
 }
 
 FORCE_INLINE void vst1q_f32_x2(float32_t *ptr, float32x4x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat32m2_t v = __riscv_vlmul_ext_v_f32m1_f32m2(__riscv_vget_v_f32m1x2_f32m1(val, 0));
+  v = __riscv_vset_v_f32m1_f32m2(v, 1, __riscv_vget_v_f32m1x2_f32m1(val, 1));
+  __riscv_vse32_v_f32m2(ptr, v, 8);
+#else
   vfloat32m2_t val0 = __riscv_vlmul_ext_v_f32m1_f32m2(__riscv_vget_v_f32m1x2_f32m1(val, 0));
   vfloat32m2_t val1 = __riscv_vlmul_ext_v_f32m1_f32m2(__riscv_vget_v_f32m1x2_f32m1(val, 1));
   vfloat32m2_t v = __riscv_vslideup_vx_f32m2(val0, val1, 4, 8);
   __riscv_vse32_v_f32m2(ptr, v, 8);
+#endif
 }
 
 // FORCE_INLINE void vst1_p8_x2(poly8_t * ptr, poly8x8x2_t val);
@@ -16071,17 +17335,29 @@ FORCE_INLINE void vst1_u64_x2(uint64_t *ptr, uint64x1x2_t val) {
 // FORCE_INLINE void vst1_p64_x2(poly64_t * ptr, poly64x1x2_t val);
 
 FORCE_INLINE void vst1q_s64_x2(int64_t *ptr, int64x2x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t v = __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x2_i64m1(val, 0));
+  v = __riscv_vset_v_i64m1_i64m2(v, 1, __riscv_vget_v_i64m1x2_i64m1(val, 1));
+  __riscv_vse64_v_i64m2(ptr, v, 4);
+#else
   vint64m2_t val0 = __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x2_i64m1(val, 0));
   vint64m2_t val1 = __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x2_i64m1(val, 1));
   vint64m2_t v = __riscv_vslideup_vx_i64m2(val0, val1, 2, 4);
   __riscv_vse64_v_i64m2(ptr, v, 4);
+#endif
 }
 
 FORCE_INLINE void vst1q_u64_x2(uint64_t *ptr, uint64x2x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t v = __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x2_u64m1(val, 0));
+  v = __riscv_vset_v_u64m1_u64m2(v, 1, __riscv_vget_v_u64m1x2_u64m1(val, 1));
+  __riscv_vse64_v_u64m2(ptr, v, 4);
+#else
   vuint64m2_t val0 = __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x2_u64m1(val, 0));
   vuint64m2_t val1 = __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x2_u64m1(val, 1));
   vuint64m2_t v = __riscv_vslideup_vx_u64m2(val0, val1, 2, 4);
   __riscv_vse64_v_u64m2(ptr, v, 4);
+#endif
 }
 
 // FORCE_INLINE void vst1q_p64_x2(poly64_t * ptr, poly64x2x2_t val);
@@ -16094,10 +17370,16 @@ FORCE_INLINE void vst1_f64_x2(float64_t *ptr, float64x1x2_t val) {
 }
 
 FORCE_INLINE void vst1q_f64_x2(float64_t *ptr, float64x2x2_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat64m2_t v = __riscv_vlmul_ext_v_f64m1_f64m2(__riscv_vget_v_f64m1x2_f64m1(val, 0));
+  v = __riscv_vset_v_f64m1_f64m2(v, 1, __riscv_vget_v_f64m1x2_f64m1(val, 1));
+  __riscv_vse64_v_f64m2(ptr, v, 4);
+#else
   vfloat64m2_t val0 = __riscv_vlmul_ext_v_f64m1_f64m2(__riscv_vget_v_f64m1x2_f64m1(val, 0));
   vfloat64m2_t val1 = __riscv_vlmul_ext_v_f64m1_f64m2(__riscv_vget_v_f64m1x2_f64m1(val, 1));
   vfloat64m2_t v = __riscv_vslideup_vx_f64m2(val0, val1, 2, 4);
   __riscv_vse64_v_f64m2(ptr, v, 4);
+#endif
 }
 
 FORCE_INLINE void vst1_s8_x3(int8_t *ptr, int8x8x3_t val) {
@@ -16107,9 +17389,16 @@ FORCE_INLINE void vst1_s8_x3(int8_t *ptr, int8x8x3_t val) {
 }
 
 FORCE_INLINE void vst1q_s8_x3(int8_t *ptr, int8x16x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint8m4_t v = __riscv_vlmul_ext_v_i8m1_i8m4(__riscv_vget_v_i8m1x3_i8m1(val, 0));
+  v = __riscv_vset_v_i8m1_i8m4(v, 1, __riscv_vget_v_i8m1x3_i8m1(val, 1));
+  v = __riscv_vset_v_i8m1_i8m4(v, 2, __riscv_vget_v_i8m1x3_i8m1(val, 2));
+  __riscv_vse8_v_i8m4(ptr, v, 48);
+#else
   vst1q_s8(ptr, __riscv_vget_v_i8m1x3_i8m1(val, 0));
   vst1q_s8(ptr + 16, __riscv_vget_v_i8m1x3_i8m1(val, 1));
   vst1q_s8(ptr + 32, __riscv_vget_v_i8m1x3_i8m1(val, 2));
+#endif
 }
 
 FORCE_INLINE void vst1_s16_x3(int16_t *ptr, int16x4x3_t val) {
@@ -16119,9 +17408,16 @@ FORCE_INLINE void vst1_s16_x3(int16_t *ptr, int16x4x3_t val) {
 }
 
 FORCE_INLINE void vst1q_s16_x3(int16_t *ptr, int16x8x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m4_t v = __riscv_vlmul_ext_v_i16m1_i16m4(__riscv_vget_v_i16m1x3_i16m1(val, 0));
+  v = __riscv_vset_v_i16m1_i16m4(v, 1, __riscv_vget_v_i16m1x3_i16m1(val, 1));
+  v = __riscv_vset_v_i16m1_i16m4(v, 2, __riscv_vget_v_i16m1x3_i16m1(val, 2));
+  __riscv_vse16_v_i16m4(ptr, v, 24);
+#else
   vst1q_s16(ptr, __riscv_vget_v_i16m1x3_i16m1(val, 0));
   vst1q_s16(ptr + 8, __riscv_vget_v_i16m1x3_i16m1(val, 1));
   vst1q_s16(ptr + 16, __riscv_vget_v_i16m1x3_i16m1(val, 2));
+#endif
 }
 
 FORCE_INLINE void vst1_s32_x3(int32_t *ptr, int32x2x3_t val) {
@@ -16131,9 +17427,16 @@ FORCE_INLINE void vst1_s32_x3(int32_t *ptr, int32x2x3_t val) {
 }
 
 FORCE_INLINE void vst1q_s32_x3(int32_t *ptr, int32x4x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m4_t v = __riscv_vlmul_ext_v_i32m1_i32m4(__riscv_vget_v_i32m1x3_i32m1(val, 0));
+  v = __riscv_vset_v_i32m1_i32m4(v, 1, __riscv_vget_v_i32m1x3_i32m1(val, 1));
+  v = __riscv_vset_v_i32m1_i32m4(v, 2, __riscv_vget_v_i32m1x3_i32m1(val, 2));
+  __riscv_vse32_v_i32m4(ptr, v, 12);
+#else
   vst1q_s32(ptr, __riscv_vget_v_i32m1x3_i32m1(val, 0));
   vst1q_s32(ptr + 4, __riscv_vget_v_i32m1x3_i32m1(val, 1));
   vst1q_s32(ptr + 8, __riscv_vget_v_i32m1x3_i32m1(val, 2));
+#endif
 }
 
 FORCE_INLINE void vst1_u8_x3(uint8_t *ptr, uint8x8x3_t val) {
@@ -16143,9 +17446,16 @@ FORCE_INLINE void vst1_u8_x3(uint8_t *ptr, uint8x8x3_t val) {
 }
 
 FORCE_INLINE void vst1q_u8_x3(uint8_t *ptr, uint8x16x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m4_t v = __riscv_vlmul_ext_v_u8m1_u8m4(__riscv_vget_v_u8m1x3_u8m1(val, 0));
+  v = __riscv_vset_v_u8m1_u8m4(v, 1, __riscv_vget_v_u8m1x3_u8m1(val, 1));
+  v = __riscv_vset_v_u8m1_u8m4(v, 2, __riscv_vget_v_u8m1x3_u8m1(val, 2));
+  __riscv_vse8_v_u8m4(ptr, v, 48);
+#else
   vst1q_u8(ptr, __riscv_vget_v_u8m1x3_u8m1(val, 0));
   vst1q_u8(ptr + 16, __riscv_vget_v_u8m1x3_u8m1(val, 1));
   vst1q_u8(ptr + 32, __riscv_vget_v_u8m1x3_u8m1(val, 2));
+#endif
 }
 
 FORCE_INLINE void vst1_u16_x3(uint16_t *ptr, uint16x4x3_t val) {
@@ -16155,9 +17465,16 @@ FORCE_INLINE void vst1_u16_x3(uint16_t *ptr, uint16x4x3_t val) {
 }
 
 FORCE_INLINE void vst1q_u16_x3(uint16_t *ptr, uint16x8x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m4_t v = __riscv_vlmul_ext_v_u16m1_u16m4(__riscv_vget_v_u16m1x3_u16m1(val, 0));
+  v = __riscv_vset_v_u16m1_u16m4(v, 1, __riscv_vget_v_u16m1x3_u16m1(val, 1));
+  v = __riscv_vset_v_u16m1_u16m4(v, 2, __riscv_vget_v_u16m1x3_u16m1(val, 2));
+  __riscv_vse16_v_u16m4(ptr, v, 24);
+#else
   vst1q_u16(ptr, __riscv_vget_v_u16m1x3_u16m1(val, 0));
   vst1q_u16(ptr + 8, __riscv_vget_v_u16m1x3_u16m1(val, 1));
   vst1q_u16(ptr + 16, __riscv_vget_v_u16m1x3_u16m1(val, 2));
+#endif
 }
 
 FORCE_INLINE void vst1_u32_x3(uint32_t *ptr, uint32x2x3_t val) {
@@ -16167,9 +17484,16 @@ FORCE_INLINE void vst1_u32_x3(uint32_t *ptr, uint32x2x3_t val) {
 }
 
 FORCE_INLINE void vst1q_u32_x3(uint32_t *ptr, uint32x4x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m4_t v = __riscv_vlmul_ext_v_u32m1_u32m4(__riscv_vget_v_u32m1x3_u32m1(val, 0));
+  v = __riscv_vset_v_u32m1_u32m4(v, 1, __riscv_vget_v_u32m1x3_u32m1(val, 1));
+  v = __riscv_vset_v_u32m1_u32m4(v, 2, __riscv_vget_v_u32m1x3_u32m1(val, 2));
+  __riscv_vse32_v_u32m4(ptr, v, 12);
+#else
   vst1q_u32(ptr, __riscv_vget_v_u32m1x3_u32m1(val, 0));
   vst1q_u32(ptr + 4, __riscv_vget_v_u32m1x3_u32m1(val, 1));
   vst1q_u32(ptr + 8, __riscv_vget_v_u32m1x3_u32m1(val, 2));
+#endif
 }
 
 // FORCE_INLINE void vst1_f16_x3(float16_t * ptr, float16x4x3_t val);
@@ -16183,9 +17507,16 @@ FORCE_INLINE void vst1_f32_x3(float32_t *ptr, float32x2x3_t val) {
 }
 
 FORCE_INLINE void vst1q_f32_x3(float32_t *ptr, float32x4x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat32m4_t v = __riscv_vlmul_ext_v_f32m1_f32m4(__riscv_vget_v_f32m1x3_f32m1(val, 0));
+  v = __riscv_vset_v_f32m1_f32m4(v, 1, __riscv_vget_v_f32m1x3_f32m1(val, 1));
+  v = __riscv_vset_v_f32m1_f32m4(v, 2, __riscv_vget_v_f32m1x3_f32m1(val, 2));
+  __riscv_vse32_v_f32m4(ptr, v, 12);
+#else
   vst1q_f32(ptr, __riscv_vget_v_f32m1x3_f32m1(val, 0));
   vst1q_f32(ptr + 4, __riscv_vget_v_f32m1x3_f32m1(val, 1));
   vst1q_f32(ptr + 8, __riscv_vget_v_f32m1x3_f32m1(val, 2));
+#endif
 }
 
 // FORCE_INLINE void vst1_p8_x3(poly8_t * ptr, poly8x8x3_t val);
@@ -16211,15 +17542,29 @@ FORCE_INLINE void vst1_u64_x3(uint64_t *ptr, uint64x1x3_t val) {
 // FORCE_INLINE void vst1_p64_x3(poly64_t * ptr, poly64x1x3_t val);
 
 FORCE_INLINE void vst1q_s64_x3(int64_t *ptr, int64x2x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m4_t v = __riscv_vlmul_ext_v_i64m1_i64m4(__riscv_vget_v_i64m1x3_i64m1(val, 0));
+  v = __riscv_vset_v_i64m1_i64m4(v, 1, __riscv_vget_v_i64m1x3_i64m1(val, 1));
+  v = __riscv_vset_v_i64m1_i64m4(v, 2, __riscv_vget_v_i64m1x3_i64m1(val, 2));
+  __riscv_vse64_v_i64m4(ptr, v, 6);
+#else
   vst1q_s64(ptr, __riscv_vget_v_i64m1x3_i64m1(val, 0));
   vst1q_s64(ptr + 2, __riscv_vget_v_i64m1x3_i64m1(val, 1));
   vst1q_s64(ptr + 4, __riscv_vget_v_i64m1x3_i64m1(val, 2));
+#endif
 }
 
 FORCE_INLINE void vst1q_u64_x3(uint64_t *ptr, uint64x2x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m4_t v = __riscv_vlmul_ext_v_u64m1_u64m4(__riscv_vget_v_u64m1x3_u64m1(val, 0));
+  v = __riscv_vset_v_u64m1_u64m4(v, 1, __riscv_vget_v_u64m1x3_u64m1(val, 1));
+  v = __riscv_vset_v_u64m1_u64m4(v, 2, __riscv_vget_v_u64m1x3_u64m1(val, 2));
+  __riscv_vse64_v_u64m4(ptr, v, 6);
+#else
   vst1q_u64(ptr, __riscv_vget_v_u64m1x3_u64m1(val, 0));
   vst1q_u64(ptr + 2, __riscv_vget_v_u64m1x3_u64m1(val, 1));
   vst1q_u64(ptr + 4, __riscv_vget_v_u64m1x3_u64m1(val, 2));
+#endif
 }
 
 // FORCE_INLINE void vst1q_p64_x3(poly64_t * ptr, poly64x2x3_t val);
@@ -16231,9 +17576,16 @@ FORCE_INLINE void vst1_f64_x3(float64_t *ptr, float64x1x3_t val) {
 }
 
 FORCE_INLINE void vst1q_f64_x3(float64_t *ptr, float64x2x3_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat64m4_t v = __riscv_vlmul_ext_v_f64m1_f64m4(__riscv_vget_v_f64m1x3_f64m1(val, 0));
+  v = __riscv_vset_v_f64m1_f64m4(v, 1, __riscv_vget_v_f64m1x3_f64m1(val, 1));
+  v = __riscv_vset_v_f64m1_f64m4(v, 2, __riscv_vget_v_f64m1x3_f64m1(val, 2));
+  __riscv_vse64_v_f64m4(ptr, v, 6);
+#else
   vst1q_f64(ptr, __riscv_vget_v_f64m1x3_f64m1(val, 0));
   vst1q_f64(ptr + 2, __riscv_vget_v_f64m1x3_f64m1(val, 1));
   vst1q_f64(ptr + 4, __riscv_vget_v_f64m1x3_f64m1(val, 2));
+#endif
 }
 
 FORCE_INLINE void vst1_s8_x4(int8_t *ptr, int8x8x4_t val) {
@@ -16244,10 +17596,18 @@ FORCE_INLINE void vst1_s8_x4(int8_t *ptr, int8x8x4_t val) {
 }
 
 FORCE_INLINE void vst1q_s8_x4(int8_t *ptr, int8x16x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint8m4_t v = __riscv_vlmul_ext_v_i8m1_i8m4(__riscv_vget_v_i8m1x4_i8m1(val, 0));
+  v = __riscv_vset_v_i8m1_i8m4(v, 1, __riscv_vget_v_i8m1x4_i8m1(val, 1));
+  v = __riscv_vset_v_i8m1_i8m4(v, 2, __riscv_vget_v_i8m1x4_i8m1(val, 2));
+  v = __riscv_vset_v_i8m1_i8m4(v, 3, __riscv_vget_v_i8m1x4_i8m1(val, 3));
+  __riscv_vse8_v_i8m4(ptr, v, 64);
+#else
   vst1q_s8(ptr, __riscv_vget_v_i8m1x4_i8m1(val, 0));
   vst1q_s8(ptr + 16, __riscv_vget_v_i8m1x4_i8m1(val, 1));
   vst1q_s8(ptr + 32, __riscv_vget_v_i8m1x4_i8m1(val, 2));
   vst1q_s8(ptr + 48, __riscv_vget_v_i8m1x4_i8m1(val, 3));
+#endif
 }
 
 FORCE_INLINE void vst1_s16_x4(int16_t *ptr, int16x4x4_t val) {
@@ -16258,10 +17618,18 @@ FORCE_INLINE void vst1_s16_x4(int16_t *ptr, int16x4x4_t val) {
 }
 
 FORCE_INLINE void vst1q_s16_x4(int16_t *ptr, int16x8x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m4_t v = __riscv_vlmul_ext_v_i16m1_i16m4(__riscv_vget_v_i16m1x4_i16m1(val, 0));
+  v = __riscv_vset_v_i16m1_i16m4(v, 1, __riscv_vget_v_i16m1x4_i16m1(val, 1));
+  v = __riscv_vset_v_i16m1_i16m4(v, 2, __riscv_vget_v_i16m1x4_i16m1(val, 2));
+  v = __riscv_vset_v_i16m1_i16m4(v, 3, __riscv_vget_v_i16m1x4_i16m1(val, 3));
+  __riscv_vse16_v_i16m4(ptr, v, 32);
+#else
   vst1q_s16(ptr, __riscv_vget_v_i16m1x4_i16m1(val, 0));
   vst1q_s16(ptr + 8, __riscv_vget_v_i16m1x4_i16m1(val, 1));
   vst1q_s16(ptr + 16, __riscv_vget_v_i16m1x4_i16m1(val, 2));
   vst1q_s16(ptr + 24, __riscv_vget_v_i16m1x4_i16m1(val, 3));
+#endif
 }
 
 FORCE_INLINE void vst1_s32_x4(int32_t *ptr, int32x2x4_t val) {
@@ -16272,10 +17640,18 @@ FORCE_INLINE void vst1_s32_x4(int32_t *ptr, int32x2x4_t val) {
 }
 
 FORCE_INLINE void vst1q_s32_x4(int32_t *ptr, int32x4x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m4_t v = __riscv_vlmul_ext_v_i32m1_i32m4(__riscv_vget_v_i32m1x4_i32m1(val, 0));
+  v = __riscv_vset_v_i32m1_i32m4(v, 1, __riscv_vget_v_i32m1x4_i32m1(val, 1));
+  v = __riscv_vset_v_i32m1_i32m4(v, 2, __riscv_vget_v_i32m1x4_i32m1(val, 2));
+  v = __riscv_vset_v_i32m1_i32m4(v, 3, __riscv_vget_v_i32m1x4_i32m1(val, 3));
+  __riscv_vse32_v_i32m4(ptr, v, 16);
+#else
   vst1q_s32(ptr, __riscv_vget_v_i32m1x4_i32m1(val, 0));
   vst1q_s32(ptr + 4, __riscv_vget_v_i32m1x4_i32m1(val, 1));
   vst1q_s32(ptr + 8, __riscv_vget_v_i32m1x4_i32m1(val, 2));
   vst1q_s32(ptr + 12, __riscv_vget_v_i32m1x4_i32m1(val, 3));
+#endif
 }
 
 FORCE_INLINE void vst1_u8_x4(uint8_t *ptr, uint8x8x4_t val) {
@@ -16286,10 +17662,18 @@ FORCE_INLINE void vst1_u8_x4(uint8_t *ptr, uint8x8x4_t val) {
 }
 
 FORCE_INLINE void vst1q_u8_x4(uint8_t *ptr, uint8x16x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m4_t v = __riscv_vlmul_ext_v_u8m1_u8m4(__riscv_vget_v_u8m1x4_u8m1(val, 0));
+  v = __riscv_vset_v_u8m1_u8m4(v, 1, __riscv_vget_v_u8m1x4_u8m1(val, 1));
+  v = __riscv_vset_v_u8m1_u8m4(v, 2, __riscv_vget_v_u8m1x4_u8m1(val, 2));
+  v = __riscv_vset_v_u8m1_u8m4(v, 3, __riscv_vget_v_u8m1x4_u8m1(val, 3));
+  __riscv_vse8_v_u8m4(ptr, v, 64);
+#else
   vst1q_u8(ptr, __riscv_vget_v_u8m1x4_u8m1(val, 0));
   vst1q_u8(ptr + 16, __riscv_vget_v_u8m1x4_u8m1(val, 1));
   vst1q_u8(ptr + 32, __riscv_vget_v_u8m1x4_u8m1(val, 2));
   vst1q_u8(ptr + 48, __riscv_vget_v_u8m1x4_u8m1(val, 3));
+#endif
 }
 
 FORCE_INLINE void vst1_u16_x4(uint16_t *ptr, uint16x4x4_t val) {
@@ -16300,10 +17684,18 @@ FORCE_INLINE void vst1_u16_x4(uint16_t *ptr, uint16x4x4_t val) {
 }
 
 FORCE_INLINE void vst1q_u16_x4(uint16_t *ptr, uint16x8x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m4_t v = __riscv_vlmul_ext_v_u16m1_u16m4(__riscv_vget_v_u16m1x4_u16m1(val, 0));
+  v = __riscv_vset_v_u16m1_u16m4(v, 1, __riscv_vget_v_u16m1x4_u16m1(val, 1));
+  v = __riscv_vset_v_u16m1_u16m4(v, 2, __riscv_vget_v_u16m1x4_u16m1(val, 2));
+  v = __riscv_vset_v_u16m1_u16m4(v, 3, __riscv_vget_v_u16m1x4_u16m1(val, 3));
+  __riscv_vse16_v_u16m4(ptr, v, 32);
+#else
   vst1q_u16(ptr, __riscv_vget_v_u16m1x4_u16m1(val, 0));
   vst1q_u16(ptr + 8, __riscv_vget_v_u16m1x4_u16m1(val, 1));
   vst1q_u16(ptr + 16, __riscv_vget_v_u16m1x4_u16m1(val, 2));
   vst1q_u16(ptr + 24, __riscv_vget_v_u16m1x4_u16m1(val, 3));
+#endif
 }
 
 FORCE_INLINE void vst1_u32_x4(uint32_t *ptr, uint32x2x4_t val) {
@@ -16314,10 +17706,18 @@ FORCE_INLINE void vst1_u32_x4(uint32_t *ptr, uint32x2x4_t val) {
 }
 
 FORCE_INLINE void vst1q_u32_x4(uint32_t *ptr, uint32x4x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m4_t v = __riscv_vlmul_ext_v_u32m1_u32m4(__riscv_vget_v_u32m1x4_u32m1(val, 0));
+  v = __riscv_vset_v_u32m1_u32m4(v, 1, __riscv_vget_v_u32m1x4_u32m1(val, 1));
+  v = __riscv_vset_v_u32m1_u32m4(v, 2, __riscv_vget_v_u32m1x4_u32m1(val, 2));
+  v = __riscv_vset_v_u32m1_u32m4(v, 3, __riscv_vget_v_u32m1x4_u32m1(val, 3));
+  __riscv_vse32_v_u32m4(ptr, v, 16);
+#else
   vst1q_u32(ptr, __riscv_vget_v_u32m1x4_u32m1(val, 0));
   vst1q_u32(ptr + 4, __riscv_vget_v_u32m1x4_u32m1(val, 1));
   vst1q_u32(ptr + 8, __riscv_vget_v_u32m1x4_u32m1(val, 2));
   vst1q_u32(ptr + 12, __riscv_vget_v_u32m1x4_u32m1(val, 3));
+#endif
 }
 
 // FORCE_INLINE void vst1_f16_x4(float16_t * ptr, float16x4x4_t val);
@@ -16332,10 +17732,18 @@ FORCE_INLINE void vst1_f32_x4(float32_t *ptr, float32x2x4_t val) {
 }
 
 FORCE_INLINE void vst1q_f32_x4(float32_t *ptr, float32x4x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat32m4_t v = __riscv_vlmul_ext_v_f32m1_f32m4(__riscv_vget_v_f32m1x4_f32m1(val, 0));
+  v = __riscv_vset_v_f32m1_f32m4(v, 1, __riscv_vget_v_f32m1x4_f32m1(val, 1));
+  v = __riscv_vset_v_f32m1_f32m4(v, 2, __riscv_vget_v_f32m1x4_f32m1(val, 2));
+  v = __riscv_vset_v_f32m1_f32m4(v, 3, __riscv_vget_v_f32m1x4_f32m1(val, 3));
+  __riscv_vse32_v_f32m4(ptr, v, 16);
+#else
   vst1q_f32(ptr, __riscv_vget_v_f32m1x4_f32m1(val, 0));
   vst1q_f32(ptr + 4, __riscv_vget_v_f32m1x4_f32m1(val, 1));
   vst1q_f32(ptr + 8, __riscv_vget_v_f32m1x4_f32m1(val, 2));
   vst1q_f32(ptr + 12, __riscv_vget_v_f32m1x4_f32m1(val, 3));
+#endif
 }
 
 // FORCE_INLINE void vst1_p8_x4(poly8_t * ptr, poly8x8x4_t val);
@@ -16363,17 +17771,33 @@ FORCE_INLINE void vst1_u64_x4(uint64_t *ptr, uint64x1x4_t val) {
 // FORCE_INLINE void vst1_p64_x4(poly64_t * ptr, poly64x1x4_t val);
 
 FORCE_INLINE void vst1q_s64_x4(int64_t *ptr, int64x2x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m4_t v = __riscv_vlmul_ext_v_i64m1_i64m4(__riscv_vget_v_i64m1x4_i64m1(val, 0));
+  v = __riscv_vset_v_i64m1_i64m4(v, 1, __riscv_vget_v_i64m1x4_i64m1(val, 1));
+  v = __riscv_vset_v_i64m1_i64m4(v, 2, __riscv_vget_v_i64m1x4_i64m1(val, 2));
+  v = __riscv_vset_v_i64m1_i64m4(v, 3, __riscv_vget_v_i64m1x4_i64m1(val, 3));
+  __riscv_vse64_v_i64m4(ptr, v, 8);
+#else
   vst1q_s64(ptr, __riscv_vget_v_i64m1x4_i64m1(val, 0));
   vst1q_s64(ptr + 2, __riscv_vget_v_i64m1x4_i64m1(val, 1));
   vst1q_s64(ptr + 4, __riscv_vget_v_i64m1x4_i64m1(val, 2));
   vst1q_s64(ptr + 6, __riscv_vget_v_i64m1x4_i64m1(val, 3));
+#endif
 }
 
 FORCE_INLINE void vst1q_u64_x4(uint64_t *ptr, uint64x2x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m4_t v = __riscv_vlmul_ext_v_u64m1_u64m4(__riscv_vget_v_u64m1x4_u64m1(val, 0));
+  v = __riscv_vset_v_u64m1_u64m4(v, 1, __riscv_vget_v_u64m1x4_u64m1(val, 1));
+  v = __riscv_vset_v_u64m1_u64m4(v, 2, __riscv_vget_v_u64m1x4_u64m1(val, 2));
+  v = __riscv_vset_v_u64m1_u64m4(v, 3, __riscv_vget_v_u64m1x4_u64m1(val, 3));
+  __riscv_vse64_v_u64m4(ptr, v, 8);
+#else
   vst1q_u64(ptr, __riscv_vget_v_u64m1x4_u64m1(val, 0));
   vst1q_u64(ptr + 2, __riscv_vget_v_u64m1x4_u64m1(val, 1));
   vst1q_u64(ptr + 4, __riscv_vget_v_u64m1x4_u64m1(val, 2));
   vst1q_u64(ptr + 6, __riscv_vget_v_u64m1x4_u64m1(val, 3));
+#endif
 }
 
 // FORCE_INLINE void vst1q_p64_x4(poly64_t * ptr, poly64x2x4_t val);
@@ -16386,10 +17810,18 @@ FORCE_INLINE void vst1_f64_x4(float64_t *ptr, float64x1x4_t val) {
 }
 
 FORCE_INLINE void vst1q_f64_x4(float64_t *ptr, float64x2x4_t val) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat64m4_t v = __riscv_vlmul_ext_v_f64m1_f64m4(__riscv_vget_v_f64m1x4_f64m1(val, 0));
+  v = __riscv_vset_v_f64m1_f64m4(v, 1, __riscv_vget_v_f64m1x4_f64m1(val, 1));
+  v = __riscv_vset_v_f64m1_f64m4(v, 2, __riscv_vget_v_f64m1x4_f64m1(val, 2));
+  v = __riscv_vset_v_f64m1_f64m4(v, 3, __riscv_vget_v_f64m1x4_f64m1(val, 3));
+  __riscv_vse64_v_f64m4(ptr, v, 8);
+#else
   vst1q_f64(ptr, __riscv_vget_v_f64m1x4_f64m1(val, 0));
   vst1q_f64(ptr + 2, __riscv_vget_v_f64m1x4_f64m1(val, 1));
   vst1q_f64(ptr + 4, __riscv_vget_v_f64m1x4_f64m1(val, 2));
   vst1q_f64(ptr + 6, __riscv_vget_v_f64m1x4_f64m1(val, 3));
+#endif
 }
 
 FORCE_INLINE int8x8x2_t vld1_s8_x2(const int8_t *ptr) {
@@ -16397,7 +17829,12 @@ FORCE_INLINE int8x8x2_t vld1_s8_x2(const int8_t *ptr) {
 }
 
 FORCE_INLINE int8x16x2_t vld1q_s8_x2(int8_t const *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint8m2_t v = __riscv_vle8_v_i8m2(ptr, 32);
+  return __riscv_vcreate_v_i8m1x2(__riscv_vget_v_i8m2_i8m1(v, 0), __riscv_vget_v_i8m2_i8m1(v, 1));
+#else
   return __riscv_vcreate_v_i8m1x2(__riscv_vle8_v_i8m1(ptr, 16), __riscv_vle8_v_i8m1(ptr + 16, 16));
+#endif
 }
 
 FORCE_INLINE int16x4x2_t vld1_s16_x2(const int16_t *ptr) {
@@ -16405,7 +17842,12 @@ FORCE_INLINE int16x4x2_t vld1_s16_x2(const int16_t *ptr) {
 }
 
 FORCE_INLINE int16x8x2_t vld1q_s16_x2(const int16_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m2_t v = __riscv_vle16_v_i16m2(ptr, 16);
+  return __riscv_vcreate_v_i16m1x2(__riscv_vget_v_i16m2_i16m1(v, 0), __riscv_vget_v_i16m2_i16m1(v, 1));
+#else
   return __riscv_vcreate_v_i16m1x2(__riscv_vle16_v_i16m1(ptr, 8), __riscv_vle16_v_i16m1(ptr + 8, 8));
+#endif
 }
 
 FORCE_INLINE int32x2x2_t vld1_s32_x2(const int32_t *ptr) {
@@ -16413,7 +17855,12 @@ FORCE_INLINE int32x2x2_t vld1_s32_x2(const int32_t *ptr) {
 }
 
 FORCE_INLINE int32x4x2_t vld1q_s32_x2(const int32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m2_t v = __riscv_vle32_v_i32m2(ptr, 8);
+  return __riscv_vcreate_v_i32m1x2(__riscv_vget_v_i32m2_i32m1(v, 0), __riscv_vget_v_i32m2_i32m1(v, 1));
+#else
   return __riscv_vcreate_v_i32m1x2(__riscv_vle32_v_i32m1(ptr, 4), __riscv_vle32_v_i32m1(ptr + 4, 4));
+#endif
 }
 
 FORCE_INLINE uint8x8x2_t vld1_u8_x2(const uint8_t *ptr) {
@@ -16421,7 +17868,12 @@ FORCE_INLINE uint8x8x2_t vld1_u8_x2(const uint8_t *ptr) {
 }
 
 FORCE_INLINE uint8x16x2_t vld1q_u8_x2(uint8_t const *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m2_t v = __riscv_vle8_v_u8m2(ptr, 32);
+  return __riscv_vcreate_v_u8m1x2(__riscv_vget_v_u8m2_u8m1(v, 0), __riscv_vget_v_u8m2_u8m1(v, 1));
+#else
   return __riscv_vcreate_v_u8m1x2(__riscv_vle8_v_u8m1(ptr, 16), __riscv_vle8_v_u8m1(ptr + 16, 16));
+#endif
 }
 
 FORCE_INLINE uint16x4x2_t vld1_u16_x2(const uint16_t *ptr) {
@@ -16429,7 +17881,12 @@ FORCE_INLINE uint16x4x2_t vld1_u16_x2(const uint16_t *ptr) {
 }
 
 FORCE_INLINE uint16x8x2_t vld1q_u16_x2(uint16_t const *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m2_t v = __riscv_vle16_v_u16m2(ptr, 16);
+  return __riscv_vcreate_v_u16m1x2(__riscv_vget_v_u16m2_u16m1(v, 0), __riscv_vget_v_u16m2_u16m1(v, 1));
+#else
   return __riscv_vcreate_v_u16m1x2(__riscv_vle16_v_u16m1(ptr, 8), __riscv_vle16_v_u16m1(ptr + 8, 8));
+#endif
 }
 
 FORCE_INLINE uint32x2x2_t vld1_u32_x2(const uint32_t *ptr) {
@@ -16437,7 +17894,12 @@ FORCE_INLINE uint32x2x2_t vld1_u32_x2(const uint32_t *ptr) {
 }
 
 FORCE_INLINE uint32x4x2_t vld1q_u32_x2(const uint32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m2_t v = __riscv_vle32_v_u32m2(ptr, 8);
+  return __riscv_vcreate_v_u32m1x2(__riscv_vget_v_u32m2_u32m1(v, 0), __riscv_vget_v_u32m2_u32m1(v, 1));
+#else
   return __riscv_vcreate_v_u32m1x2(__riscv_vle32_v_u32m1(ptr, 4), __riscv_vle32_v_u32m1(ptr + 4, 4));
+#endif
 }
 
 // FORCE_INLINE float16x4x2_t vld1_f16_x2(float16_t const * ptr);
@@ -16449,7 +17911,12 @@ FORCE_INLINE float32x2x2_t vld1_f32_x2(const float32_t *ptr) {
 }
 
 FORCE_INLINE float32x4x2_t vld1q_f32_x2(const float32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat32m2_t v = __riscv_vle32_v_f32m2(ptr, 8);
+  return __riscv_vcreate_v_f32m1x2(__riscv_vget_v_f32m2_f32m1(v, 0), __riscv_vget_v_f32m2_f32m1(v, 1));
+#else
   return __riscv_vcreate_v_f32m1x2(__riscv_vle32_v_f32m1(ptr, 4), __riscv_vle32_v_f32m1(ptr + 4, 4));
+#endif
 }
 
 // FORCE_INLINE poly8x8x2_t vld1_p8_x2(poly8_t const * ptr);
@@ -16471,11 +17938,21 @@ FORCE_INLINE uint64x1x2_t vld1_u64_x2(const uint64_t *ptr) {
 // FORCE_INLINE poly64x1x2_t vld1_p64_x2(poly64_t const * ptr);
 
 FORCE_INLINE int64x2x2_t vld1q_s64_x2(const int64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m2_t v = __riscv_vle64_v_i64m2(ptr, 4);
+  return __riscv_vcreate_v_i64m1x2(__riscv_vget_v_i64m2_i64m1(v, 0), __riscv_vget_v_i64m2_i64m1(v, 1));
+#else
   return __riscv_vcreate_v_i64m1x2(__riscv_vle64_v_i64m1(ptr, 2), __riscv_vle64_v_i64m1(ptr + 2, 2));
+#endif
 }
 
 FORCE_INLINE uint64x2x2_t vld1q_u64_x2(const uint64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m2_t v = __riscv_vle64_v_u64m2(ptr, 4);
+  return __riscv_vcreate_v_u64m1x2(__riscv_vget_v_u64m2_u64m1(v, 0), __riscv_vget_v_u64m2_u64m1(v, 1));
+#else
   return __riscv_vcreate_v_u64m1x2(__riscv_vle64_v_u64m1(ptr, 2), __riscv_vle64_v_u64m1(ptr + 2, 2));
+#endif
 }
 
 // FORCE_INLINE poly64x2x2_t vld1q_p64_x2(poly64_t const * ptr);
@@ -16485,7 +17962,12 @@ FORCE_INLINE float64x1x2_t vld1_f64_x2(const float64_t *ptr) {
 }
 
 FORCE_INLINE float64x2x2_t vld1q_f64_x2(const float64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat64m2_t v = __riscv_vle64_v_f64m2(ptr, 4);
+  return __riscv_vcreate_v_f64m1x2(__riscv_vget_v_f64m2_f64m1(v, 0), __riscv_vget_v_f64m2_f64m1(v, 1));
+#else
   return __riscv_vcreate_v_f64m1x2(__riscv_vle64_v_f64m1(ptr, 2), __riscv_vle64_v_f64m1(ptr + 2, 2));
+#endif
 }
 
 FORCE_INLINE int8x8x3_t vld1_s8_x3(const int8_t *ptr) {
@@ -16494,8 +17976,14 @@ FORCE_INLINE int8x8x3_t vld1_s8_x3(const int8_t *ptr) {
 }
 
 FORCE_INLINE int8x16x3_t vld1q_s8_x3(const int8_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint8m4_t v = __riscv_vle8_v_i8m4(ptr, 48);
+  return __riscv_vcreate_v_i8m1x3(__riscv_vget_v_i8m4_i8m1(v, 0), __riscv_vget_v_i8m4_i8m1(v, 1),
+                                  __riscv_vget_v_i8m4_i8m1(v, 2));
+#else
   return __riscv_vcreate_v_i8m1x3(__riscv_vle8_v_i8m1(ptr, 16), __riscv_vle8_v_i8m1(ptr + 16, 16),
                                   __riscv_vle8_v_i8m1(ptr + 32, 16));
+#endif
 }
 
 FORCE_INLINE int16x4x3_t vld1_s16_x3(const int16_t *ptr) {
@@ -16504,8 +17992,14 @@ FORCE_INLINE int16x4x3_t vld1_s16_x3(const int16_t *ptr) {
 }
 
 FORCE_INLINE int16x8x3_t vld1q_s16_x3(const int16_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m4_t v = __riscv_vle16_v_i16m4(ptr, 24);
+  return __riscv_vcreate_v_i16m1x3(__riscv_vget_v_i16m4_i16m1(v, 0), __riscv_vget_v_i16m4_i16m1(v, 1),
+                                   __riscv_vget_v_i16m4_i16m1(v, 2));
+#else
   return __riscv_vcreate_v_i16m1x3(__riscv_vle16_v_i16m1(ptr, 8), __riscv_vle16_v_i16m1(ptr + 8, 8),
                                    __riscv_vle16_v_i16m1(ptr + 16, 8));
+#endif
 }
 
 FORCE_INLINE int32x2x3_t vld1_s32_x3(const int32_t *ptr) {
@@ -16514,8 +18008,14 @@ FORCE_INLINE int32x2x3_t vld1_s32_x3(const int32_t *ptr) {
 }
 
 FORCE_INLINE int32x4x3_t vld1q_s32_x3(const int32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m4_t v = __riscv_vle32_v_i32m4(ptr, 12);
+  return __riscv_vcreate_v_i32m1x3(__riscv_vget_v_i32m4_i32m1(v, 0), __riscv_vget_v_i32m4_i32m1(v, 1),
+                                   __riscv_vget_v_i32m4_i32m1(v, 2));
+#else
   return __riscv_vcreate_v_i32m1x3(__riscv_vle32_v_i32m1(ptr, 4), __riscv_vle32_v_i32m1(ptr + 4, 4),
                                    __riscv_vle32_v_i32m1(ptr + 8, 4));
+#endif
 }
 
 FORCE_INLINE uint8x8x3_t vld1_u8_x3(const uint8_t *ptr) {
@@ -16524,8 +18024,14 @@ FORCE_INLINE uint8x8x3_t vld1_u8_x3(const uint8_t *ptr) {
 }
 
 FORCE_INLINE uint8x16x3_t vld1q_u8_x3(uint8_t const *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m4_t v = __riscv_vle8_v_u8m4(ptr, 48);
+  return __riscv_vcreate_v_u8m1x3(__riscv_vget_v_u8m4_u8m1(v, 0), __riscv_vget_v_u8m4_u8m1(v, 1),
+                                  __riscv_vget_v_u8m4_u8m1(v, 2));
+#else
   return __riscv_vcreate_v_u8m1x3(__riscv_vle8_v_u8m1(ptr, 16), __riscv_vle8_v_u8m1(ptr + 16, 16),
                                   __riscv_vle8_v_u8m1(ptr + 32, 16));
+#endif
 }
 
 FORCE_INLINE uint16x4x3_t vld1_u16_x3(const uint16_t *ptr) {
@@ -16534,8 +18040,14 @@ FORCE_INLINE uint16x4x3_t vld1_u16_x3(const uint16_t *ptr) {
 }
 
 FORCE_INLINE uint16x8x3_t vld1q_u16_x3(uint16_t const *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m4_t v = __riscv_vle16_v_u16m4(ptr, 24);
+  return __riscv_vcreate_v_u16m1x3(__riscv_vget_v_u16m4_u16m1(v, 0), __riscv_vget_v_u16m4_u16m1(v, 1),
+                                   __riscv_vget_v_u16m4_u16m1(v, 2));
+#else
   return __riscv_vcreate_v_u16m1x3(__riscv_vle16_v_u16m1(ptr, 8), __riscv_vle16_v_u16m1(ptr + 8, 8),
                                    __riscv_vle16_v_u16m1(ptr + 16, 8));
+#endif
 }
 
 FORCE_INLINE uint32x2x3_t vld1_u32_x3(const uint32_t *ptr) {
@@ -16544,8 +18056,14 @@ FORCE_INLINE uint32x2x3_t vld1_u32_x3(const uint32_t *ptr) {
 }
 
 FORCE_INLINE uint32x4x3_t vld1q_u32_x3(const uint32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m4_t v = __riscv_vle32_v_u32m4(ptr, 12);
+  return __riscv_vcreate_v_u32m1x3(__riscv_vget_v_u32m4_u32m1(v, 0), __riscv_vget_v_u32m4_u32m1(v, 1),
+                                   __riscv_vget_v_u32m4_u32m1(v, 2));
+#else
   return __riscv_vcreate_v_u32m1x3(__riscv_vle32_v_u32m1(ptr, 4), __riscv_vle32_v_u32m1(ptr + 4, 4),
                                    __riscv_vle32_v_u32m1(ptr + 8, 4));
+#endif
 }
 
 // FORCE_INLINE float16x4x3_t vld1_f16_x3(float16_t const * ptr);
@@ -16558,8 +18076,14 @@ FORCE_INLINE float32x2x3_t vld1_f32_x3(const float32_t *ptr) {
 }
 
 FORCE_INLINE float32x4x3_t vld1q_f32_x3(const float32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat32m4_t v = __riscv_vle32_v_f32m4(ptr, 12);
+  return __riscv_vcreate_v_f32m1x3(__riscv_vget_v_f32m4_f32m1(v, 0), __riscv_vget_v_f32m4_f32m1(v, 1),
+                                   __riscv_vget_v_f32m4_f32m1(v, 2));
+#else
   return __riscv_vcreate_v_f32m1x3(__riscv_vle32_v_f32m1(ptr, 4), __riscv_vle32_v_f32m1(ptr + 4, 4),
                                    __riscv_vle32_v_f32m1(ptr + 8, 4));
+#endif
 }
 
 // FORCE_INLINE poly8x8x3_t vld1_p8_x3(poly8_t const * ptr);
@@ -16583,13 +18107,25 @@ FORCE_INLINE uint64x1x3_t vld1_u64_x3(const uint64_t *ptr) {
 // FORCE_INLINE poly64x1x3_t vld1_p64_x3(poly64_t const * ptr);
 
 FORCE_INLINE int64x2x3_t vld1q_s64_x3(const int64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m4_t v = __riscv_vle64_v_i64m4(ptr, 6);
+  return __riscv_vcreate_v_i64m1x3(__riscv_vget_v_i64m4_i64m1(v, 0), __riscv_vget_v_i64m4_i64m1(v, 1),
+                                   __riscv_vget_v_i64m4_i64m1(v, 2));
+#else
   return __riscv_vcreate_v_i64m1x3(__riscv_vle64_v_i64m1(ptr, 2), __riscv_vle64_v_i64m1(ptr + 2, 2),
                                    __riscv_vle64_v_i64m1(ptr + 4, 2));
+#endif
 }
 
 FORCE_INLINE uint64x2x3_t vld1q_u64_x3(const uint64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m4_t v = __riscv_vle64_v_u64m4(ptr, 6);
+  return __riscv_vcreate_v_u64m1x3(__riscv_vget_v_u64m4_u64m1(v, 0), __riscv_vget_v_u64m4_u64m1(v, 1),
+                                   __riscv_vget_v_u64m4_u64m1(v, 2));
+#else
   return __riscv_vcreate_v_u64m1x3(__riscv_vle64_v_u64m1(ptr, 2), __riscv_vle64_v_u64m1(ptr + 2, 2),
                                    __riscv_vle64_v_u64m1(ptr + 4, 2));
+#endif
 }
 
 // FORCE_INLINE poly64x2x3_t vld1q_p64_x3(poly64_t const * ptr);
@@ -16600,8 +18136,14 @@ FORCE_INLINE float64x1x3_t vld1_f64_x3(const float64_t *ptr) {
 }
 
 FORCE_INLINE float64x2x3_t vld1q_f64_x3(const float64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat64m4_t v = __riscv_vle64_v_f64m4(ptr, 6);
+  return __riscv_vcreate_v_f64m1x3(__riscv_vget_v_f64m4_f64m1(v, 0), __riscv_vget_v_f64m4_f64m1(v, 1),
+                                   __riscv_vget_v_f64m4_f64m1(v, 2));
+#else
   return __riscv_vcreate_v_f64m1x3(__riscv_vle64_v_f64m1(ptr, 2), __riscv_vle64_v_f64m1(ptr + 2, 2),
                                    __riscv_vle64_v_f64m1(ptr + 4, 2));
+#endif
 }
 
 FORCE_INLINE int8x8x4_t vld1_s8_x4(const int8_t *ptr) {
@@ -16610,8 +18152,14 @@ FORCE_INLINE int8x8x4_t vld1_s8_x4(const int8_t *ptr) {
 }
 
 FORCE_INLINE int8x16x4_t vld1q_s8_x4(const int8_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint8m4_t v = __riscv_vle8_v_i8m4(ptr, 64);
+  return __riscv_vcreate_v_i8m1x4(__riscv_vget_v_i8m4_i8m1(v, 0), __riscv_vget_v_i8m4_i8m1(v, 1),
+                                  __riscv_vget_v_i8m4_i8m1(v, 2), __riscv_vget_v_i8m4_i8m1(v, 3));
+#else
   return __riscv_vcreate_v_i8m1x4(__riscv_vle8_v_i8m1(ptr, 16), __riscv_vle8_v_i8m1(ptr + 16, 16),
                                   __riscv_vle8_v_i8m1(ptr + 32, 16), __riscv_vle8_v_i8m1(ptr + 48, 16));
+#endif
 }
 
 FORCE_INLINE int16x4x4_t vld1_s16_x4(const int16_t *ptr) {
@@ -16620,8 +18168,14 @@ FORCE_INLINE int16x4x4_t vld1_s16_x4(const int16_t *ptr) {
 }
 
 FORCE_INLINE int16x8x4_t vld1q_s16_x4(const int16_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint16m4_t v = __riscv_vle16_v_i16m4(ptr, 32);
+  return __riscv_vcreate_v_i16m1x4(__riscv_vget_v_i16m4_i16m1(v, 0), __riscv_vget_v_i16m4_i16m1(v, 1),
+                                   __riscv_vget_v_i16m4_i16m1(v, 2), __riscv_vget_v_i16m4_i16m1(v, 3));
+#else
   return __riscv_vcreate_v_i16m1x4(__riscv_vle16_v_i16m1(ptr, 8), __riscv_vle16_v_i16m1(ptr + 8, 8),
                                    __riscv_vle16_v_i16m1(ptr + 16, 8), __riscv_vle16_v_i16m1(ptr + 24, 8));
+#endif
 }
 
 FORCE_INLINE int32x2x4_t vld1_s32_x4(const int32_t *ptr) {
@@ -16630,8 +18184,14 @@ FORCE_INLINE int32x2x4_t vld1_s32_x4(const int32_t *ptr) {
 }
 
 FORCE_INLINE int32x4x4_t vld1q_s32_x4(const int32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint32m4_t v = __riscv_vle32_v_i32m4(ptr, 16);
+  return __riscv_vcreate_v_i32m1x4(__riscv_vget_v_i32m4_i32m1(v, 0), __riscv_vget_v_i32m4_i32m1(v, 1),
+                                   __riscv_vget_v_i32m4_i32m1(v, 2), __riscv_vget_v_i32m4_i32m1(v, 3));
+#else
   return __riscv_vcreate_v_i32m1x4(__riscv_vle32_v_i32m1(ptr, 4), __riscv_vle32_v_i32m1(ptr + 4, 4),
                                    __riscv_vle32_v_i32m1(ptr + 8, 4), __riscv_vle32_v_i32m1(ptr + 12, 4));
+#endif
 }
 
 FORCE_INLINE uint8x8x4_t vld1_u8_x4(const uint8_t *ptr) {
@@ -16640,8 +18200,14 @@ FORCE_INLINE uint8x8x4_t vld1_u8_x4(const uint8_t *ptr) {
 }
 
 FORCE_INLINE uint8x16x4_t vld1q_u8_x4(uint8_t const *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint8m4_t v = __riscv_vle8_v_u8m4(ptr, 64);
+  return __riscv_vcreate_v_u8m1x4(__riscv_vget_v_u8m4_u8m1(v, 0), __riscv_vget_v_u8m4_u8m1(v, 1),
+                                  __riscv_vget_v_u8m4_u8m1(v, 2), __riscv_vget_v_u8m4_u8m1(v, 3));
+#else
   return __riscv_vcreate_v_u8m1x4(__riscv_vle8_v_u8m1(ptr, 16), __riscv_vle8_v_u8m1(ptr + 16, 16),
                                   __riscv_vle8_v_u8m1(ptr + 32, 16), __riscv_vle8_v_u8m1(ptr + 48, 16));
+#endif
 }
 
 FORCE_INLINE uint16x4x4_t vld1_u16_x4(const uint16_t *ptr) {
@@ -16650,8 +18216,14 @@ FORCE_INLINE uint16x4x4_t vld1_u16_x4(const uint16_t *ptr) {
 }
 
 FORCE_INLINE uint16x8x4_t vld1q_u16_x4(uint16_t const *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint16m4_t v = __riscv_vle16_v_u16m4(ptr, 32);
+  return __riscv_vcreate_v_u16m1x4(__riscv_vget_v_u16m4_u16m1(v, 0), __riscv_vget_v_u16m4_u16m1(v, 1),
+                                   __riscv_vget_v_u16m4_u16m1(v, 2), __riscv_vget_v_u16m4_u16m1(v, 3));
+#else
   return __riscv_vcreate_v_u16m1x4(__riscv_vle16_v_u16m1(ptr, 8), __riscv_vle16_v_u16m1(ptr + 8, 8),
                                    __riscv_vle16_v_u16m1(ptr + 16, 8), __riscv_vle16_v_u16m1(ptr + 24, 8));
+#endif
 }
 
 FORCE_INLINE uint32x2x4_t vld1_u32_x4(const uint32_t *ptr) {
@@ -16660,8 +18232,14 @@ FORCE_INLINE uint32x2x4_t vld1_u32_x4(const uint32_t *ptr) {
 }
 
 FORCE_INLINE uint32x4x4_t vld1q_u32_x4(const uint32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint32m4_t v = __riscv_vle32_v_u32m4(ptr, 16);
+  return __riscv_vcreate_v_u32m1x4(__riscv_vget_v_u32m4_u32m1(v, 0), __riscv_vget_v_u32m4_u32m1(v, 1),
+                                   __riscv_vget_v_u32m4_u32m1(v, 2), __riscv_vget_v_u32m4_u32m1(v, 3));
+#else
   return __riscv_vcreate_v_u32m1x4(__riscv_vle32_v_u32m1(ptr, 4), __riscv_vle32_v_u32m1(ptr + 4, 4),
                                    __riscv_vle32_v_u32m1(ptr + 8, 4), __riscv_vle32_v_u32m1(ptr + 12, 4));
+#endif
 }
 
 // FORCE_INLINE float16x4x4_t vld1_f16_x4(float16_t const * ptr);
@@ -16674,8 +18252,14 @@ FORCE_INLINE float32x2x4_t vld1_f32_x4(const float32_t *ptr) {
 }
 
 FORCE_INLINE float32x4x4_t vld1q_f32_x4(const float32_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat32m4_t v = __riscv_vle32_v_f32m4(ptr, 16);
+  return __riscv_vcreate_v_f32m1x4(__riscv_vget_v_f32m4_f32m1(v, 0), __riscv_vget_v_f32m4_f32m1(v, 1),
+                                   __riscv_vget_v_f32m4_f32m1(v, 2), __riscv_vget_v_f32m4_f32m1(v, 3));
+#else
   return __riscv_vcreate_v_f32m1x4(__riscv_vle32_v_f32m1(ptr, 4), __riscv_vle32_v_f32m1(ptr + 4, 4),
                                    __riscv_vle32_v_f32m1(ptr + 8, 4), __riscv_vle32_v_f32m1(ptr + 12, 4));
+#endif
 }
 
 // FORCE_INLINE poly8x8x4_t vld1_p8_x4(poly8_t const * ptr);
@@ -16699,13 +18283,25 @@ FORCE_INLINE uint64x1x4_t vld1_u64_x4(const uint64_t *ptr) {
 // FORCE_INLINE poly64x1x4_t vld1_p64_x4(poly64_t const * ptr);
 
 FORCE_INLINE int64x2x4_t vld1q_s64_x4(const int64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vint64m4_t v = __riscv_vle64_v_i64m4(ptr, 8);
+  return __riscv_vcreate_v_i64m1x4(__riscv_vget_v_i64m4_i64m1(v, 0), __riscv_vget_v_i64m4_i64m1(v, 1),
+                                   __riscv_vget_v_i64m4_i64m1(v, 2), __riscv_vget_v_i64m4_i64m1(v, 3));
+#else
   return __riscv_vcreate_v_i64m1x4(__riscv_vle64_v_i64m1(ptr, 2), __riscv_vle64_v_i64m1(ptr + 2, 2),
                                    __riscv_vle64_v_i64m1(ptr + 4, 2), __riscv_vle64_v_i64m1(ptr + 6, 2));
+#endif
 }
 
 FORCE_INLINE uint64x2x4_t vld1q_u64_x4(const uint64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vuint64m4_t v = __riscv_vle64_v_u64m4(ptr, 8);
+  return __riscv_vcreate_v_u64m1x4(__riscv_vget_v_u64m4_u64m1(v, 0), __riscv_vget_v_u64m4_u64m1(v, 1),
+                                   __riscv_vget_v_u64m4_u64m1(v, 2), __riscv_vget_v_u64m4_u64m1(v, 3));
+#else
   return __riscv_vcreate_v_u64m1x4(__riscv_vle64_v_u64m1(ptr, 2), __riscv_vle64_v_u64m1(ptr + 2, 2),
                                    __riscv_vle64_v_u64m1(ptr + 4, 2), __riscv_vle64_v_u64m1(ptr + 6, 2));
+#endif
 }
 
 // FORCE_INLINE poly64x2x4_t vld1q_p64_x4(poly64_t const * ptr);
@@ -16716,8 +18312,14 @@ FORCE_INLINE float64x1x4_t vld1_f64_x4(const float64_t *ptr) {
 }
 
 FORCE_INLINE float64x2x4_t vld1q_f64_x4(const float64_t *ptr) {
+#if NEON2RVV_FIXED_VLEN_128
+  vfloat64m4_t v = __riscv_vle64_v_f64m4(ptr, 8);
+  return __riscv_vcreate_v_f64m1x4(__riscv_vget_v_f64m4_f64m1(v, 0), __riscv_vget_v_f64m4_f64m1(v, 1),
+                                   __riscv_vget_v_f64m4_f64m1(v, 2), __riscv_vget_v_f64m4_f64m1(v, 3));
+#else
   return __riscv_vcreate_v_f64m1x4(__riscv_vle64_v_f64m1(ptr, 2), __riscv_vle64_v_f64m1(ptr + 2, 2),
                                    __riscv_vle64_v_f64m1(ptr + 4, 2), __riscv_vle64_v_f64m1(ptr + 6, 2));
+#endif
 }
 
 FORCE_INLINE void vst4q_lane_u16(uint16_t *a, uint16x8x4_t b, const int c) {
@@ -17996,26 +19598,678 @@ FORCE_INLINE uint32x4_t vreinterpretq_u32_u16(uint16x8_t a) { return __riscv_vre
 
 // FORCE_INLINE poly128_t vaddq_p128(poly128_t a, poly128_t b);
 
-// FORCE_INLINE uint32_t __crc32b(uint32_t a, uint8_t b);
+// The CRC32 intrinsics (__crc32b ... __crc32cd) are declared by <arm_acle.h>, see acle2rvv.h
 
-// FORCE_INLINE uint32_t __crc32h(uint32_t a, uint16_t b);
+/* neon2rvv helpers */
+// Mask-register answers to the movemask/any/all idioms of ported NEON scanners, which would otherwise go through a
+// narrowing shift plus lane extraction or a full reduction. The input is usually a comparison result.
 
-// FORCE_INLINE uint32_t __crc32w(uint32_t a, uint32_t b);
+// bit i of the result is the most significant bit of lane i, like x86 movemask
+static inline uint16_t neon2rvv_movemask_u8(uint8x16_t a) {
+  vbool8_t mask = __riscv_vmslt_vx_i8m1_b8(__riscv_vreinterpret_v_u8m1_i8m1(a), 0, 16);
+  return __riscv_vmv_x_s_u16m1_u16(__riscv_vreinterpret_v_b8_u16m1(mask));
+}
 
-// FORCE_INLINE uint32_t __crc32d(uint32_t a, uint64_t b);
+// same value as vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(a), 4)), 0)
+static inline uint64_t neon2rvv_nibblemask_u8(uint8x16_t a) {
+  vuint16m2_t a_ext = __riscv_vlmul_ext_v_u16m1_u16m2(__riscv_vreinterpret_v_u8m1_u16m1(a));
+  return __riscv_vmv_x_s_u64m1_u64(__riscv_vreinterpret_v_u8m1_u64m1(__riscv_vnsrl_wx_u8m1(a_ext, 4, 8)));
+}
 
-// FORCE_INLINE uint32_t __crc32cb(uint32_t a, uint8_t b);
+static inline int neon2rvv_any_nonzero(uint8x16_t a) {
+  return __riscv_vfirst_m_b8(__riscv_vmsne_vx_u8m1_b8(a, 0, 16), 16) >= 0;
+}
 
-// FORCE_INLINE uint32_t __crc32ch(uint32_t a, uint16_t b);
+static inline int neon2rvv_all_ones(uint8x16_t a) {
+  return __riscv_vfirst_m_b8(__riscv_vmsne_vx_u8m1_b8(a, UINT8_MAX, 16), 16) < 0;
+}
 
-// FORCE_INLINE uint32_t __crc32cw(uint32_t a, uint32_t b);
+// index of the first nonzero lane, or -1 if every lane is zero
+static inline int neon2rvv_first_set_lane(uint8x16_t a) {
+  return (int)__riscv_vfirst_m_b8(__riscv_vmsne_vx_u8m1_b8(a, 0, 16), 16);
+}
 
-// FORCE_INLINE uint32_t __crc32cd(uint32_t a, uint64_t b);
+/* neon2rvv bulk kernels */
+// Whole-array forms of the element-wise intrinsics, for the `vld1q -> op -> vst1q` loops of ported code. They
+// strip-mine with vsetvl at the largest LMUL the element widths allow, so one iteration covers up to 8 vector
+// registers instead of one 128-bit lane group. Each element gets exactly the result of the intrinsic named above the
+// function, so a loop can be replaced by one call without changing its output.
+
+// vaddq_u8
+static inline void neon2rvv_bulk_add_u8(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m8(n);
+    vuint8m8_t a_vec = __riscv_vle8_v_u8m8(a, vl);
+    vuint8m8_t b_vec = __riscv_vle8_v_u8m8(b, vl);
+    __riscv_vse8_v_u8m8(dst, __riscv_vadd_vv_u8m8(a_vec, b_vec, vl), vl);
+  }
+}
+
+// vaddq_f32
+static inline void neon2rvv_bulk_add_f32(float32_t *dst, const float32_t *a, const float32_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e32m8(n);
+    vfloat32m8_t a_vec = __riscv_vle32_v_f32m8(a, vl);
+    vfloat32m8_t b_vec = __riscv_vle32_v_f32m8(b, vl);
+    __riscv_vse32_v_f32m8(dst, __riscv_vfadd_vv_f32m8(a_vec, b_vec, vl), vl);
+  }
+}
+
+// vqaddq_u8
+static inline void neon2rvv_bulk_qadd_u8(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m8(n);
+    vuint8m8_t a_vec = __riscv_vle8_v_u8m8(a, vl);
+    vuint8m8_t b_vec = __riscv_vle8_v_u8m8(b, vl);
+    __riscv_vse8_v_u8m8(dst, __riscv_vsaddu_vv_u8m8(a_vec, b_vec, vl), vl);
+  }
+}
+
+// vqaddq_s16
+static inline void neon2rvv_bulk_qadd_s16(int16_t *dst, const int16_t *a, const int16_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e16m8(n);
+    vint16m8_t a_vec = __riscv_vle16_v_i16m8(a, vl);
+    vint16m8_t b_vec = __riscv_vle16_v_i16m8(b, vl);
+    __riscv_vse16_v_i16m8(dst, __riscv_vsadd_vv_i16m8(a_vec, b_vec, vl), vl);
+  }
+}
+
+// vminq_u8
+static inline void neon2rvv_bulk_min_u8(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m8(n);
+    vuint8m8_t a_vec = __riscv_vle8_v_u8m8(a, vl);
+    vuint8m8_t b_vec = __riscv_vle8_v_u8m8(b, vl);
+    __riscv_vse8_v_u8m8(dst, __riscv_vminu_vv_u8m8(a_vec, b_vec, vl), vl);
+  }
+}
+
+// vmaxq_u8
+static inline void neon2rvv_bulk_max_u8(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m8(n);
+    vuint8m8_t a_vec = __riscv_vle8_v_u8m8(a, vl);
+    vuint8m8_t b_vec = __riscv_vle8_v_u8m8(b, vl);
+    __riscv_vse8_v_u8m8(dst, __riscv_vmaxu_vv_u8m8(a_vec, b_vec, vl), vl);
+  }
+}
+
+// vabdq_u8
+static inline void neon2rvv_bulk_abd_u8(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m8(n);
+    vuint8m8_t a_vec = __riscv_vle8_v_u8m8(a, vl);
+    vuint8m8_t b_vec = __riscv_vle8_v_u8m8(b, vl);
+    vuint8m8_t ab_max = __riscv_vmaxu_vv_u8m8(a_vec, b_vec, vl);
+    vuint8m8_t ab_min = __riscv_vminu_vv_u8m8(a_vec, b_vec, vl);
+    __riscv_vse8_v_u8m8(dst, __riscv_vsub_vv_u8m8(ab_max, ab_min, vl), vl);
+  }
+}
+
+// vmlal_u8, accumulating into acc in place
+static inline void neon2rvv_bulk_mlal_u8(uint16_t *acc, const uint8_t *a, const uint8_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, acc += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m4(n);
+    vuint16m8_t acc_vec = __riscv_vle16_v_u16m8(acc, vl);
+    vuint8m4_t a_vec = __riscv_vle8_v_u8m4(a, vl);
+    vuint8m4_t b_vec = __riscv_vle8_v_u8m4(b, vl);
+    __riscv_vse16_v_u16m8(acc, __riscv_vwmaccu_vv_u16m8(acc_vec, a_vec, b_vec, vl), vl);
+  }
+}
+
+// vcvtq_f32_s32
+static inline void neon2rvv_bulk_cvt_f32_s32(float32_t *dst, const int32_t *a, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl) {
+    vl = __riscv_vsetvl_e32m8(n);
+    __riscv_vse32_v_f32m8(dst, __riscv_vfcvt_f_x_v_f32m8(__riscv_vle32_v_i32m8(a, vl), vl), vl);
+  }
+}
+
+// vcvtq_s32_f32
+static inline void neon2rvv_bulk_cvt_s32_f32(int32_t *dst, const float32_t *a, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl) {
+    vl = __riscv_vsetvl_e32m8(n);
+    __riscv_vse32_v_i32m8(dst, __riscv_vfcvt_rtz_x_f_v_i32m8(__riscv_vle32_v_f32m8(a, vl), vl), vl);
+  }
+}
+
+// vcgtq_u8
+static inline void neon2rvv_bulk_cgt_u8(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m8(n);
+    vbool1_t cmp_res = __riscv_vmsgtu_vv_u8m8_b1(__riscv_vle8_v_u8m8(a, vl), __riscv_vle8_v_u8m8(b, vl), vl);
+    __riscv_vse8_v_u8m8(dst, __riscv_vmerge_vxm_u8m8(__riscv_vmv_v_x_u8m8(0, vl), UINT8_MAX, cmp_res, vl), vl);
+  }
+}
+
+// vbslq_u8
+static inline void neon2rvv_bulk_bsl_u8(uint8_t *dst, const uint8_t *mask, const uint8_t *a, const uint8_t *b,
+                                        size_t n) {
+  for (size_t vl; n > 0; n -= vl, dst += vl, mask += vl, a += vl, b += vl) {
+    vl = __riscv_vsetvl_e8m8(n);
+    vuint8m8_t mask_vec = __riscv_vle8_v_u8m8(mask, vl);
+    vuint8m8_t a_vec = __riscv_vle8_v_u8m8(a, vl);
+    vuint8m8_t b_vec = __riscv_vle8_v_u8m8(b, vl);
+    vuint8m8_t ab_xor = __riscv_vxor_vv_u8m8(b_vec, a_vec, vl);
+    __riscv_vse8_v_u8m8(dst, __riscv_vxor_vv_u8m8(__riscv_vand_vv_u8m8(ab_xor, mask_vec, vl), b_vec, vl), vl);
+  }
+}
+
+// the sum of vaddlvq_u8 over the array, without its 16-bit wraparound
+static inline uint64_t neon2rvv_bulk_addlv_u8(const uint8_t *a, size_t n) {
+  uint64_t sum = 0;
+  for (size_t vl; n > 0; n -= vl, a += vl) {
+    vl = __riscv_vsetvl_e8m4(n);
+    // a 16-bit partial sum could overflow on long vectors, so the strip is summed at 32 bits
+    vuint16m8_t a_ext = __riscv_vzext_vf2_u16m8(__riscv_vle8_v_u8m4(a, vl), vl);
+    sum += __riscv_vmv_x_s_u32m1_u32(__riscv_vwredsumu_vs_u16m8_u32m1(a_ext, __riscv_vmv_s_x_u32m1(0, 1), vl));
+  }
+  return sum;
+}
+
+// the sum of vaddlvq_s16 over the array, without its 32-bit wraparound
+static inline int64_t neon2rvv_bulk_addlv_s16(const int16_t *a, size_t n) {
+  int64_t sum = 0;
+  for (size_t vl; n > 0; n -= vl, a += vl) {
+    vl = __riscv_vsetvl_e16m8(n);
+    sum += __riscv_vmv_x_s_i32m1_i32(__riscv_vwredsum_vs_i16m8_i32m1(__riscv_vle16_v_i16m8(a, vl),
+                                                                       __riscv_vmv_s_x_i32m1(0, 1), vl));
+  }
+  return sum;
+}
 
 #ifdef __cplusplus
 }
 #endif
 
+#ifdef __cplusplus
+// C++ API with the lane index or immediate as a template parameter, e.g. `neon2rvv::vgetq_lane<3>(v)`. The operand is
+// then a constant even where the C intrinsic is not inlined, so the slides, gathers and shifts use their `.vi` forms,
+// lane 0 needs no slide at all and an out of range operand is rejected by a static_assert. Each function is overloaded
+// on the vector type and named like the intrinsic without its type suffix. The 64-bit and 128-bit NEON types share one
+// RVV type, so the `q` in the name picks the lane count.
+namespace neon2rvv {
+namespace detail {
+template <typename V>
+struct vec_traits;
+
+#define NEON2RVV_VEC_TRAITS(V, T)                                                     \
+  template <>                                                                         \
+  struct vec_traits<V> {                                                              \
+    typedef T elem_type;                                                              \
+    enum { bits = sizeof(T) * 8, d_lanes = 8 / sizeof(T), q_lanes = 16 / sizeof(T) }; \
+    enum { is_signed = (T)-1 < 0 };                                                   \
+  };
+NEON2RVV_VEC_TRAITS(vint8m1_t, int8_t)
+NEON2RVV_VEC_TRAITS(vint16m1_t, int16_t)
+NEON2RVV_VEC_TRAITS(vint32m1_t, int32_t)
+NEON2RVV_VEC_TRAITS(vint64m1_t, int64_t)
+NEON2RVV_VEC_TRAITS(vuint8m1_t, uint8_t)
+NEON2RVV_VEC_TRAITS(vuint16m1_t, uint16_t)
+NEON2RVV_VEC_TRAITS(vuint32m1_t, uint32_t)
+NEON2RVV_VEC_TRAITS(vuint64m1_t, uint64_t)
+NEON2RVV_VEC_TRAITS(vfloat32m1_t, float32_t)
+NEON2RVV_VEC_TRAITS(vfloat64m1_t, float64_t)
+#undef NEON2RVV_VEC_TRAITS
+
+template <bool B>
+struct bool_constant_tag {};
+
+template <typename V>
+FORCE_INLINE typename vec_traits<V>::elem_type first_lane(V v) {
+  return __riscv_vmv_x(v);
+}
+FORCE_INLINE float32_t first_lane(vfloat32m1_t v) { return __riscv_vfmv_f(v); }
+FORCE_INLINE float64_t first_lane(vfloat64m1_t v) { return __riscv_vfmv_f(v); }
+
+template <typename V>
+FORCE_INLINE V set_first_lane(V v, typename vec_traits<V>::elem_type a) {
+  return __riscv_vmv_s_tu(v, a, 1);
+}
+FORCE_INLINE vfloat32m1_t set_first_lane(vfloat32m1_t v, float32_t a) { return __riscv_vfmv_s_tu(v, a, 1); }
+FORCE_INLINE vfloat64m1_t set_first_lane(vfloat64m1_t v, float64_t a) { return __riscv_vfmv_s_tu(v, a, 1); }
+
+template <typename V>
+FORCE_INLINE V mul(V a, V b, size_t vl) {
+  return __riscv_vmul(a, b, vl);
+}
+FORCE_INLINE vfloat32m1_t mul(vfloat32m1_t a, vfloat32m1_t b, size_t vl) { return __riscv_vfmul(a, b, vl); }
+FORCE_INLINE vfloat64m1_t mul(vfloat64m1_t a, vfloat64m1_t b, size_t vl) { return __riscv_vfmul(a, b, vl); }
+
+template <int lane, int lanes, typename V>
+FORCE_INLINE typename vec_traits<V>::elem_type get_lane(V v) {
+  static_assert(lane >= 0 && lane < lanes, "lane index out of range");
+  return lane == 0 ? first_lane(v) : first_lane(__riscv_vslidedown(v, lane, lanes));
+}
+
+// a single element slide with vl = lane + 1 and an undisturbed tail writes lane 'lane' only
+template <int lane, int lanes, typename V>
+FORCE_INLINE V set_lane(typename vec_traits<V>::elem_type a, V v) {
+  static_assert(lane >= 0 && lane < lanes, "lane index out of range");
+  V a_first = set_first_lane(v, a);
+  return lane == 0 ? a_first : __riscv_vslideup_tu(v, a_first, lane, lane + 1);
+}
+
+template <int lane, int src_lanes, int vl, typename V>
+FORCE_INLINE V dup_lane(V v) {
+  static_assert(lane >= 0 && lane < src_lanes, "lane index out of range");
+  return __riscv_vrgather(v, lane, vl);
+}
+
+template <int n, int lanes, typename V>
+FORCE_INLINE V ext(V a, V b) {
+  static_assert(n >= 0 && n < lanes, "immediate out of range");
+  return n == 0 ? a : __riscv_vslideup(__riscv_vslidedown(a, n, lanes), b, lanes - n, lanes);
+}
+
+template <int n, int lanes, typename V>
+FORCE_INLINE V shl_n(V a) {
+  static_assert(n >= 0 && n < vec_traits<V>::bits, "shift out of range");
+  return __riscv_vsll(a, n, lanes);
+}
+
+// a shift by the full element width leaves the sign for signed lanes and 0 for unsigned ones
+template <int n, int lanes, typename V>
+FORCE_INLINE V shr_n(V a, bool_constant_tag<true>) {
+  return __riscv_vsra(a, n < vec_traits<V>::bits ? n : vec_traits<V>::bits - 1, lanes);
+}
+template <int n, int lanes, typename V>
+FORCE_INLINE V shr_n(V a, bool_constant_tag<false>) {
+  return n < vec_traits<V>::bits ? __riscv_vsrl(a, n, lanes) : __riscv_vand(a, 0, lanes);
+}
+template <int n, int lanes, typename V>
+FORCE_INLINE V shr_n(V a) {
+  static_assert(n >= 1 && n <= vec_traits<V>::bits, "shift out of range");
+  return shr_n<n, lanes>(a, bool_constant_tag<vec_traits<V>::is_signed>());
+}
+
+template <int lane, int src_lanes, int vl, typename V>
+FORCE_INLINE V mul_lane(V a, V v) {
+  return mul(a, dup_lane<lane, src_lanes, vl>(v), vl);
+}
+
+template <int lane, int src_lanes, int vl, typename V>
+FORCE_INLINE V fma_lane(V a, V b, V v) {
+  return __riscv_vfmacc(a, b, dup_lane<lane, src_lanes, vl>(v), vl);
+}
+}  // namespace detail
+
+#define NEON2RVV_TRAIT(V, X) detail::vec_traits<V>::X
+
+template <int lane, typename V>
+FORCE_INLINE typename detail::vec_traits<V>::elem_type vget_lane(V v) {
+  return detail::get_lane<lane, NEON2RVV_TRAIT(V, d_lanes)>(v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE typename detail::vec_traits<V>::elem_type vgetq_lane(V v) {
+  return detail::get_lane<lane, NEON2RVV_TRAIT(V, q_lanes)>(v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vset_lane(typename detail::vec_traits<V>::elem_type a, V v) {
+  return detail::set_lane<lane, NEON2RVV_TRAIT(V, d_lanes)>(a, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vsetq_lane(typename detail::vec_traits<V>::elem_type a, V v) {
+  return detail::set_lane<lane, NEON2RVV_TRAIT(V, q_lanes)>(a, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vdup_lane(V v) {
+  return detail::dup_lane<lane, NEON2RVV_TRAIT(V, d_lanes), NEON2RVV_TRAIT(V, d_lanes)>(v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vdupq_lane(V v) {
+  return detail::dup_lane<lane, NEON2RVV_TRAIT(V, d_lanes), NEON2RVV_TRAIT(V, q_lanes)>(v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vdup_laneq(V v) {
+  return detail::dup_lane<lane, NEON2RVV_TRAIT(V, q_lanes), NEON2RVV_TRAIT(V, d_lanes)>(v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vdupq_laneq(V v) {
+  return detail::dup_lane<lane, NEON2RVV_TRAIT(V, q_lanes), NEON2RVV_TRAIT(V, q_lanes)>(v);
+}
+
+template <int n, typename V>
+FORCE_INLINE V vext(V a, V b) {
+  return detail::ext<n, NEON2RVV_TRAIT(V, d_lanes)>(a, b);
+}
+
+template <int n, typename V>
+FORCE_INLINE V vextq(V a, V b) {
+  return detail::ext<n, NEON2RVV_TRAIT(V, q_lanes)>(a, b);
+}
+
+template <int n, typename V>
+FORCE_INLINE V vshl_n(V a) {
+  return detail::shl_n<n, NEON2RVV_TRAIT(V, d_lanes)>(a);
+}
+
+template <int n, typename V>
+FORCE_INLINE V vshlq_n(V a) {
+  return detail::shl_n<n, NEON2RVV_TRAIT(V, q_lanes)>(a);
+}
+
+template <int n, typename V>
+FORCE_INLINE V vshr_n(V a) {
+  return detail::shr_n<n, NEON2RVV_TRAIT(V, d_lanes)>(a);
+}
+
+template <int n, typename V>
+FORCE_INLINE V vshrq_n(V a) {
+  return detail::shr_n<n, NEON2RVV_TRAIT(V, q_lanes)>(a);
+}
+
+#define NEON2RVV_SHRN_N(W, N, WIDE_M2, NSHR)                                     \
+  template <int n>                                                               \
+  FORCE_INLINE N vshrn_n(W a) {                                                  \
+    static_assert(n >= 1 && n <= NEON2RVV_TRAIT(N, bits), "shift out of range"); \
+    return NSHR(WIDE_M2(a), n, NEON2RVV_TRAIT(N, d_lanes));                      \
+  }
+NEON2RVV_SHRN_N(vint16m1_t, vint8m1_t, __riscv_vlmul_ext_i16m2, __riscv_vnsra)
+NEON2RVV_SHRN_N(vint32m1_t, vint16m1_t, __riscv_vlmul_ext_i32m2, __riscv_vnsra)
+NEON2RVV_SHRN_N(vint64m1_t, vint32m1_t, __riscv_vlmul_ext_i64m2, __riscv_vnsra)
+NEON2RVV_SHRN_N(vuint16m1_t, vuint8m1_t, __riscv_vlmul_ext_u16m2, __riscv_vnsrl)
+NEON2RVV_SHRN_N(vuint32m1_t, vuint16m1_t, __riscv_vlmul_ext_u32m2, __riscv_vnsrl)
+NEON2RVV_SHRN_N(vuint64m1_t, vuint32m1_t, __riscv_vlmul_ext_u64m2, __riscv_vnsrl)
+#undef NEON2RVV_SHRN_N
+
+template <int lane, typename V>
+FORCE_INLINE V vmul_lane(V a, V v) {
+  return detail::mul_lane<lane, NEON2RVV_TRAIT(V, d_lanes), NEON2RVV_TRAIT(V, d_lanes)>(a, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vmulq_lane(V a, V v) {
+  return detail::mul_lane<lane, NEON2RVV_TRAIT(V, d_lanes), NEON2RVV_TRAIT(V, q_lanes)>(a, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vmul_laneq(V a, V v) {
+  return detail::mul_lane<lane, NEON2RVV_TRAIT(V, q_lanes), NEON2RVV_TRAIT(V, d_lanes)>(a, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vmulq_laneq(V a, V v) {
+  return detail::mul_lane<lane, NEON2RVV_TRAIT(V, q_lanes), NEON2RVV_TRAIT(V, q_lanes)>(a, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vfma_lane(V a, V b, V v) {
+  return detail::fma_lane<lane, NEON2RVV_TRAIT(V, d_lanes), NEON2RVV_TRAIT(V, d_lanes)>(a, b, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vfmaq_lane(V a, V b, V v) {
+  return detail::fma_lane<lane, NEON2RVV_TRAIT(V, d_lanes), NEON2RVV_TRAIT(V, q_lanes)>(a, b, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vfma_laneq(V a, V b, V v) {
+  return detail::fma_lane<lane, NEON2RVV_TRAIT(V, q_lanes), NEON2RVV_TRAIT(V, d_lanes)>(a, b, v);
+}
+
+template <int lane, typename V>
+FORCE_INLINE V vfmaq_laneq(V a, V b, V v) {
+  return detail::fma_lane<lane, NEON2RVV_TRAIT(V, q_lanes), NEON2RVV_TRAIT(V, q_lanes)>(a, b, v);
+}
+
+#undef NEON2RVV_TRAIT
+
+// Lazy element-wise expressions over float32 arrays. `neon2rvv::vld1q(p)` and `neon2rvv::vdupq_n(k)` are the leaves and
+// the NEON-named functions below build a tree out of them; nothing is computed until a terminal (`vst1q`, `vaddvq`,
+// `vmaxvq`, `vminvq`) runs the whole tree in one strip-mined loop, e.g.
+//   neon2rvv::vst1q(out, neon2rvv::vfmaq(neon2rvv::vmulq(neon2rvv::vld1q(a), neon2rvv::vld1q(b)), neon2rvv::vld1q(c),
+//                                        neon2rvv::vdupq_n(k)), n);
+// Each node is the RVV instruction of the matching float32x4_t intrinsic, so every element is bit-identical to the
+// 4-lane translation, but the loop runs at the largest LMUL the tree's register need leaves room for and keeps the
+// intermediates in registers.
+namespace expr {
+template <int lmul>
+struct f32;
+
+#define NEON2RVV_EXPR_F32(L)                                                                  \
+  template <>                                                                                 \
+  struct f32<L> {                                                                             \
+    typedef vfloat32m##L##_t vec;                                                             \
+    static size_t setvl(size_t n) { return __riscv_vsetvl_e32m##L(n); }                       \
+    static vec load(const float32_t *p, size_t vl) { return __riscv_vle32_v_f32m##L(p, vl); } \
+    static void store(float32_t *p, vec v, size_t vl) { __riscv_vse32_v_f32m##L(p, v, vl); }  \
+    static vec dup(float32_t a, size_t vl) { return __riscv_vfmv_v_f_f32m##L(a, vl); }        \
+  };
+NEON2RVV_EXPR_F32(1)
+NEON2RVV_EXPR_F32(2)
+NEON2RVV_EXPR_F32(4)
+NEON2RVV_EXPR_F32(8)
+#undef NEON2RVV_EXPR_F32
+
+// `need` is the number of vector register groups the evaluation of a node keeps live (its Sethi-Ullman number). With
+// LMUL=8 there are 4 groups, so a tree with need <= 4 runs at m8, <= 8 at m4 and so on.
+template <int need>
+struct lmul_for {
+  enum { value = need <= 4 ? 8 : need <= 8 ? 4 : need <= 16 ? 2 : 1 };
+};
+
+struct load_f32 {
+  const float32_t *ptr;
+  enum { need = 1 };
+  template <int L>
+  typename f32<L>::vec eval(size_t i, size_t vl) const {
+    return f32<L>::load(ptr + i, vl);
+  }
+};
+
+struct dup_f32 {
+  float32_t value;
+  enum { need = 1 };
+  template <int L>
+  typename f32<L>::vec eval(size_t, size_t vl) const {
+    return f32<L>::dup(value, vl);
+  }
+};
+
+template <typename Op, typename A>
+struct unary {
+  A a;
+  enum { need = A::need };
+  template <int L>
+  typename f32<L>::vec eval(size_t i, size_t vl) const {
+    return Op::apply(a.template eval<L>(i, vl), vl);
+  }
+};
+
+template <typename Op, typename A, typename B>
+struct binary {
+  A a;
+  B b;
+  enum { need = A::need == B::need ? A::need + 1 : A::need > B::need ? A::need : B::need };
+  template <int L>
+  typename f32<L>::vec eval(size_t i, size_t vl) const {
+    return Op::apply(a.template eval<L>(i, vl), b.template eval<L>(i, vl), vl);
+  }
+};
+
+// the operands are evaluated in order, so the accumulator stays live while b and c are computed
+template <typename Op, typename A, typename B, typename C>
+struct ternary {
+  A a;
+  B b;
+  C c;
+  enum { need_bc = B::need + 1 > C::need + 2 ? B::need + 1 : C::need + 2 };
+  enum { need = A::need > need_bc ? A::need : need_bc };
+  template <int L>
+  typename f32<L>::vec eval(size_t i, size_t vl) const {
+    return Op::apply(a.template eval<L>(i, vl), b.template eval<L>(i, vl), c.template eval<L>(i, vl), vl);
+  }
+};
+
+#define NEON2RVV_EXPR_UNARY_OP(NAME, RVV) \
+  struct NAME {                           \
+    template <typename V>                 \
+    static V apply(V a, size_t vl) {      \
+      return RVV(a, vl);                  \
+    }                                     \
+  };
+#define NEON2RVV_EXPR_BINARY_OP(NAME, RVV) \
+  struct NAME {                            \
+    template <typename V>                  \
+    static V apply(V a, V b, size_t vl) {  \
+      return RVV(a, b, vl);                \
+    }                                      \
+  };
+#define NEON2RVV_EXPR_TERNARY_OP(NAME, RVV)    \
+  struct NAME {                                \
+    template <typename V>                      \
+    static V apply(V a, V b, V c, size_t vl) { \
+      return RVV(a, b, c, vl);                 \
+    }                                          \
+  };
+NEON2RVV_EXPR_UNARY_OP(op_abs, __riscv_vfabs)
+NEON2RVV_EXPR_UNARY_OP(op_neg, __riscv_vfneg)
+NEON2RVV_EXPR_UNARY_OP(op_sqrt, __riscv_vfsqrt)
+NEON2RVV_EXPR_BINARY_OP(op_add, __riscv_vfadd)
+NEON2RVV_EXPR_BINARY_OP(op_sub, __riscv_vfsub)
+NEON2RVV_EXPR_BINARY_OP(op_mul, __riscv_vfmul)
+NEON2RVV_EXPR_BINARY_OP(op_div, __riscv_vfdiv)
+NEON2RVV_EXPR_TERNARY_OP(op_fma, __riscv_vfmacc)
+NEON2RVV_EXPR_TERNARY_OP(op_fms, __riscv_vfnmsac)
+#undef NEON2RVV_EXPR_UNARY_OP
+#undef NEON2RVV_EXPR_BINARY_OP
+#undef NEON2RVV_EXPR_TERNARY_OP
+
+template <typename Op, typename E>
+FORCE_INLINE float32_t reduce(const E &e, size_t n, float32_t init) {
+  typedef f32<lmul_for<E::need + 1>::value> T;
+  vfloat32m1_t acc = __riscv_vfmv_s_f_f32m1(init, 1);
+  for (size_t i = 0, vl; i < n; i += vl) {
+    vl = T::setvl(n - i);
+    acc = Op::apply(e.template eval<lmul_for<E::need + 1>::value>(i, vl), acc, vl);
+  }
+  return __riscv_vfmv_f_s_f32m1_f32(acc);
+}
+
+// vfredmax/vfredmin skip NaN elements, so with NEON2RVV_STRICT_NAN every strip is scanned for NaN first and the result
+// is NaN as soon as one turns up, like vmaxvq_f32/vminvq_f32.
+template <typename Op, typename E>
+FORCE_INLINE float32_t reduce_nan(const E &e, size_t n, float32_t init) {
+#if !NEON2RVV_STRICT_NAN
+  return reduce<Op>(e, n, init);
+#else
+  typedef f32<lmul_for<E::need + 1>::value> T;
+  vfloat32m1_t acc = __riscv_vfmv_s_f_f32m1(init, 1);
+  for (size_t i = 0, vl; i < n; i += vl) {
+    vl = T::setvl(n - i);
+    typename T::vec v = e.template eval<lmul_for<E::need + 1>::value>(i, vl);
+    if (__riscv_vfirst(__riscv_vmfne(v, v, vl), vl) >= 0) {
+      return NAN;
+    }
+    acc = Op::apply(v, acc, vl);
+  }
+  return __riscv_vfmv_f_s_f32m1_f32(acc);
+#endif
+}
+
+struct op_redosum {
+  template <typename V>
+  static vfloat32m1_t apply(V v, vfloat32m1_t acc, size_t vl) {
+    return __riscv_vfredosum(v, acc, vl);
+  }
+};
+struct op_redmax {
+  template <typename V>
+  static vfloat32m1_t apply(V v, vfloat32m1_t acc, size_t vl) {
+    return __riscv_vfredmax(v, acc, vl);
+  }
+};
+struct op_redmin {
+  template <typename V>
+  static vfloat32m1_t apply(V v, vfloat32m1_t acc, size_t vl) {
+    return __riscv_vfredmin(v, acc, vl);
+  }
+};
+}  // namespace expr
+
+FORCE_INLINE expr::load_f32 vld1q(const float32_t *ptr) {
+  expr::load_f32 r = {ptr};
+  return r;
+}
+
+FORCE_INLINE expr::dup_f32 vdupq_n(float32_t value) {
+  expr::dup_f32 r = {value};
+  return r;
+}
+
+#define NEON2RVV_EXPR_UNARY(NAME, OP)                      \
+  template <typename A>                                    \
+  FORCE_INLINE expr::unary<expr::OP, A> NAME(const A &a) { \
+    expr::unary<expr::OP, A> r = {a};                      \
+    return r;                                              \
+  }
+#define NEON2RVV_EXPR_BINARY(NAME, OP)                                     \
+  template <typename A, typename B>                                        \
+  FORCE_INLINE expr::binary<expr::OP, A, B> NAME(const A &a, const B &b) { \
+    expr::binary<expr::OP, A, B> r = {a, b};                               \
+    return r;                                                              \
+  }
+#define NEON2RVV_EXPR_TERNARY(NAME, OP)                                                    \
+  template <typename A, typename B, typename C>                                            \
+  FORCE_INLINE expr::ternary<expr::OP, A, B, C> NAME(const A &a, const B &b, const C &c) { \
+    expr::ternary<expr::OP, A, B, C> r = {a, b, c};                                        \
+    return r;                                                                              \
+  }
+NEON2RVV_EXPR_UNARY(vabsq, op_abs)
+NEON2RVV_EXPR_UNARY(vnegq, op_neg)
+NEON2RVV_EXPR_UNARY(vsqrtq, op_sqrt)
+NEON2RVV_EXPR_BINARY(vaddq, op_add)
+NEON2RVV_EXPR_BINARY(vsubq, op_sub)
+NEON2RVV_EXPR_BINARY(vmulq, op_mul)
+NEON2RVV_EXPR_BINARY(vdivq, op_div)
+// vmlaq_f32 and vmlsq_f32 are fused in neon2rvv as well
+NEON2RVV_EXPR_TERNARY(vfmaq, op_fma)
+NEON2RVV_EXPR_TERNARY(vfmsq, op_fms)
+NEON2RVV_EXPR_TERNARY(vmlaq, op_fma)
+NEON2RVV_EXPR_TERNARY(vmlsq, op_fms)
+#undef NEON2RVV_EXPR_UNARY
+#undef NEON2RVV_EXPR_BINARY
+#undef NEON2RVV_EXPR_TERNARY
+
+template <typename E>
+FORCE_INLINE void vst1q(float32_t *out, const E &e, size_t n) {
+  typedef expr::f32<expr::lmul_for<E::need>::value> T;
+  for (size_t i = 0, vl; i < n; i += vl) {
+    vl = T::setvl(n - i);
+    T::store(out + i, e.template eval<expr::lmul_for<E::need>::value>(i, vl), vl);
+  }
+}
+
+// The sum is accumulated in element order, i.e. it equals `float s = 0; for (...) s += e[i];`. A NEON loop that keeps
+// four partial sums in a float32x4_t rounds differently.
+template <typename E>
+FORCE_INLINE float32_t vaddvq(const E &e, size_t n) {
+  return expr::reduce<expr::op_redosum>(e, n, 0.0f);
+}
+
+// NaN elements follow NEON2RVV_STRICT_NAN as in vmaxvq_f32/vminvq_f32: they make the result NaN, or are ignored when
+// it is 0.
+template <typename E>
+FORCE_INLINE float32_t vmaxvq(const E &e, size_t n) {
+  return expr::reduce_nan<expr::op_redmax>(e, n, -INFINITY);
+}
+
+template <typename E>
+FORCE_INLINE float32_t vminvq(const E &e, size_t n) {
+  return expr::reduce_nan<expr::op_redmin>(e, n, INFINITY);
+}
+}  // namespace neon2rvv
+#endif  // __cplusplus
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma pop_macro("ALIGN_STRUCT")
 #pragma pop_macro("FORCE_INLINE")
@@ -1,6 +1,8 @@
 #include "common.h"
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
+#include "corpus.h"
 
 namespace NEON2RVV {
 int32_t NaN = ~0;
@@ -8,12 +10,14 @@ int64_t NaN64 = ~0;
 
 result_t validate_int64(int64x2_t a, int64_t i0, int64_t i1) {
   const int64_t *t = (const int64_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 2);
   ASSERT_RETURN(t[0] == i0);
   ASSERT_RETURN(t[1] == i1);
   return TEST_SUCCESS;
 }
 result_t validate_uint64(uint64x2_t a, uint64_t i0, uint64_t i1) {
   const uint64_t *t = (const uint64_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 2);
   ASSERT_RETURN(t[0] == i0);
   ASSERT_RETURN(t[1] == i1);
   return TEST_SUCCESS;
@@ -28,6 +32,7 @@ result_t validate_int64(int64x2x2_t a, int64_t i0, int64_t i1, int64_t i2, int64
   const int64_t *t0 = (const int64_t *)&a.val[0];
   const int64_t *t1 = (const int64_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 2);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t0[1] == i1);
   ASSERT_RETURN(t1[0] == i2);
@@ -44,6 +49,7 @@ result_t validate_uint64(uint64x2x2_t a, uint64_t u0, uint64_t u1, uint64_t u2,
   const uint64_t *t0 = (const uint64_t *)&a.val[0];
   const uint64_t *t1 = (const uint64_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 2);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t0[1] == u1);
   ASSERT_RETURN(t1[0] == u2);
@@ -53,11 +59,13 @@ result_t validate_uint64(uint64x2x2_t a, uint64_t u0, uint64_t u1, uint64_t u2,
 
 result_t validate_int64(int64x1_t a, int64_t i0) {
   const int64_t *t = (const int64_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 1);
   ASSERT_RETURN(t[0] == i0);
   return TEST_SUCCESS;
 }
 result_t validate_uint64(uint64x1_t a, uint64_t u0) {
   const uint64_t *t = (const uint64_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 1);
   ASSERT_RETURN(t[0] == u0);
   return TEST_SUCCESS;
 }
@@ -71,6 +79,7 @@ result_t validate_int64(int64x1x2_t a, int64_t i0, int64_t i1) {
   const int64_t *t0 = (const int64_t *)&a.val[0];
   const int64_t *t1 = (const int64_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 1);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t1[0] == i1);
   return TEST_SUCCESS;
@@ -85,6 +94,7 @@ result_t validate_uint64(uint64x1x2_t a, uint64_t u0, uint64_t u1) {
   const uint64_t *t0 = (const uint64_t *)&a.val[0];
   const uint64_t *t1 = (const uint64_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 1);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t1[0] == u1);
   return TEST_SUCCESS;
@@ -92,6 +102,7 @@ result_t validate_uint64(uint64x1x2_t a, uint64_t u0, uint64_t u1) {
 
 result_t validate_int32(int32x4_t a, int32_t i0, int32_t i1, int32_t i2, int32_t i3) {
   const int32_t *t = (const int32_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 4);
   ASSERT_RETURN(t[0] == i0);
   ASSERT_RETURN(t[1] == i1);
   ASSERT_RETURN(t[2] == i2);
@@ -101,6 +112,7 @@ result_t validate_int32(int32x4_t a, int32_t i0, int32_t i1, int32_t i2, int32_t
 
 result_t validate_uint32(uint32x4_t a, uint32_t u0, uint32_t u1, uint32_t u2, uint32_t u3) {
   const uint32_t *t = (const uint32_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 4);
   ASSERT_RETURN(t[0] == u0);
   ASSERT_RETURN(t[1] == u1);
   ASSERT_RETURN(t[2] == u2);
@@ -119,6 +131,7 @@ result_t validate_int32(int32x4x2_t a, int32_t i0, int32_t i1, int32_t i2, int32
   const int32_t *t0 = (const int32_t *)&a.val[0];
   const int32_t *t1 = (const int32_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 4);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t0[1] == i1);
   ASSERT_RETURN(t0[2] == i2);
@@ -141,6 +154,7 @@ result_t validate_uint32(uint32x4x2_t a, uint32_t u0, uint32_t u1, uint32_t u2,
   const uint32_t *t0 = (const uint32_t *)&a.val[0];
   const uint32_t *t1 = (const uint32_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 4);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t0[1] == u1);
   ASSERT_RETURN(t0[2] == u2);
@@ -154,6 +168,7 @@ result_t validate_uint32(uint32x4x2_t a, uint32_t u0, uint32_t u1, uint32_t u2,
 
 result_t validate_int32(int32x2_t a, int32_t u0, int32_t u1) {
   const int32_t *t = (const int32_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 2);
   ASSERT_RETURN(t[0] == u0);
   ASSERT_RETURN(t[1] == u1);
   return TEST_SUCCESS;
@@ -161,6 +176,7 @@ result_t validate_int32(int32x2_t a, int32_t u0, int32_t u1) {
 
 result_t validate_uint32(uint32x2_t a, uint32_t u0, uint32_t u1) {
   const uint32_t *t = (const uint32_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 2);
   ASSERT_RETURN(t[0] == u0);
   ASSERT_RETURN(t[1] == u1);
   return TEST_SUCCESS;
@@ -176,6 +192,7 @@ result_t validate_int32(int32x2x2_t a, int32_t i0, int32_t i1, int32_t i2, int32
   const int32_t *t0 = (const int32_t *)&a.val[0];
   const int32_t *t1 = (const int32_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 2);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t0[1] == i1);
   ASSERT_RETURN(t1[0] == i2);
@@ -193,6 +210,7 @@ result_t validate_uint32(uint32x2x2_t a, uint32_t u0, uint32_t u1, uint32_t u2,
   const uint32_t *t0 = (const uint32_t *)&a.val[0];
   const uint32_t *t1 = (const uint32_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 2);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t0[1] == u1);
   ASSERT_RETURN(t1[0] == u2);
@@ -203,6 +221,7 @@ result_t validate_uint32(uint32x2x2_t a, uint32_t u0, uint32_t u1, uint32_t u2,
 result_t validate_int16(int16x8_t a, int16_t i0, int16_t i1, int16_t i2, int16_t i3, int16_t i4, int16_t i5, int16_t i6,
                         int16_t i7) {
   const int16_t *t = (const int16_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 8);
   ASSERT_RETURN(t[0] == i0);
   ASSERT_RETURN(t[1] == i1);
   ASSERT_RETURN(t[2] == i2);
@@ -217,6 +236,7 @@ result_t validate_int16(int16x8_t a, int16_t i0, int16_t i1, int16_t i2, int16_t
 result_t validate_uint16(uint16x8_t a, uint16_t u0, uint16_t u1, uint16_t u2, uint16_t u3, uint16_t u4, uint16_t u5,
                          uint16_t u6, uint16_t u7) {
   const uint16_t *t = (const uint16_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 8);
   ASSERT_RETURN(t[0] == u0);
   ASSERT_RETURN(t[1] == u1);
   ASSERT_RETURN(t[2] == u2);
@@ -240,6 +260,7 @@ result_t validate_int16(int16x8x2_t a, int16_t i0, int16_t i1, int16_t i2, int16
   const int16_t *t0 = (const int16_t *)&a.val[0];
   const int16_t *t1 = (const int16_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 8);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t0[1] == i1);
   ASSERT_RETURN(t0[2] == i2);
@@ -271,6 +292,7 @@ result_t validate_uint16(uint16x8x2_t a, uint16_t u0, uint16_t u1, uint16_t u2,
   const uint16_t *t0 = (const uint16_t *)&a.val[0];
   const uint16_t *t1 = (const uint16_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 8);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t0[1] == u1);
   ASSERT_RETURN(t0[2] == u2);
@@ -292,6 +314,7 @@ result_t validate_uint16(uint16x8x2_t a, uint16_t u0, uint16_t u1, uint16_t u2,
 
 result_t validate_int16(int16x4_t a, int16_t i0, int16_t i1, int16_t i2, int16_t i3) {
   const int16_t *t = (const int16_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 4);
   ASSERT_RETURN(t[0] == i0);
   ASSERT_RETURN(t[1] == i1);
   ASSERT_RETURN(t[2] == i2);
@@ -301,6 +324,7 @@ result_t validate_int16(int16x4_t a, int16_t i0, int16_t i1, int16_t i2, int16_t
 
 result_t validate_uint16(uint16x4_t a, uint16_t u0, uint16_t u1, uint16_t u2, uint16_t u3) {
   const uint16_t *t = (const uint16_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 4);
   ASSERT_RETURN(t[0] == u0);
   ASSERT_RETURN(t[1] == u1);
   ASSERT_RETURN(t[2] == u2);
@@ -319,6 +343,7 @@ result_t validate_int16(int16x4x2_t a, int16_t i0, int16_t i1, int16_t i2, int16
   const int16_t *t0 = (const int16_t *)&a.val[0];
   const int16_t *t1 = (const int16_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 4);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t0[1] == i1);
   ASSERT_RETURN(t0[2] == i2);
@@ -341,6 +366,7 @@ result_t validate_uint16(uint16x4x2_t a, uint16_t u0, uint16_t u1, uint16_t u2,
   const uint16_t *t0 = (const uint16_t *)&a.val[0];
   const uint16_t *t1 = (const uint16_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 4);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t0[1] == u1);
   ASSERT_RETURN(t0[2] == u2);
@@ -356,6 +382,7 @@ result_t validate_int8(int8x16_t a, int8_t i0, int8_t i1, int8_t i2, int8_t i3,
                        int8_t i7, int8_t i8, int8_t i9, int8_t i10, int8_t i11, int8_t i12, int8_t i13, int8_t i14,
                        int8_t i15) {
   const int8_t *t = (const int8_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 16);
   ASSERT_RETURN(t[0] == i0);
   ASSERT_RETURN(t[1] == i1);
   ASSERT_RETURN(t[2] == i2);
@@ -379,6 +406,7 @@ result_t validate_uint8(uint8x16_t a, uint8_t u0, uint8_t u1, uint8_t u2, uint8_
                         uint8_t u6, uint8_t u7, uint8_t u8, uint8_t u9, uint8_t u10, uint8_t u11, uint8_t u12,
                         uint8_t u13, uint8_t u14, uint8_t u15) {
   const uint8_t *t = (const uint8_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 16);
   ASSERT_RETURN(t[0] == u0);
   ASSERT_RETURN(t[1] == u1);
   ASSERT_RETURN(t[2] == u2);
@@ -401,6 +429,7 @@ result_t validate_uint8(uint8x16_t a, uint8_t u0, uint8_t u1, uint8_t u2, uint8_
 result_t validate_int8(int8x8_t a, int8_t i0, int8_t i1, int8_t i2, int8_t i3, int8_t i4, int8_t i5, int8_t i6,
                        int8_t i7) {
   const int8_t *t = (const int8_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 8);
   ASSERT_RETURN(t[0] == i0);
   ASSERT_RETURN(t[1] == i1);
   ASSERT_RETURN(t[2] == i2);
@@ -415,6 +444,7 @@ result_t validate_int8(int8x8_t a, int8_t i0, int8_t i1, int8_t i2, int8_t i3, i
 result_t validate_uint8(uint8x8_t a, uint8_t u0, uint8_t u1, uint8_t u2, uint8_t u3, uint8_t u4, uint8_t u5, uint8_t u6,
                         uint8_t u7) {
   const uint8_t *t = (const uint8_t *)&a;
+  CORPUS_CHECK(CORPUS_INT, t, NULL, sizeof(*t) * 8);
   ASSERT_RETURN(t[0] == u0);
   ASSERT_RETURN(t[1] == u1);
   ASSERT_RETURN(t[2] == u2);
@@ -437,6 +467,7 @@ result_t validate_int8(int8x8x2_t a, int8_t i0, int8_t i1, int8_t i2, int8_t i3,
   const int8_t *t0 = (const int8_t *)&a.val[0];
   const int8_t *t1 = (const int8_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 8);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t0[1] == i1);
   ASSERT_RETURN(t0[2] == i2);
@@ -467,6 +498,7 @@ result_t validate_uint8(uint8x8x2_t a, uint8_t u0, uint8_t u1, uint8_t u2, uint8
   const uint8_t *t0 = (const uint8_t *)&a.val[0];
   const uint8_t *t1 = (const uint8_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 8);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t0[1] == u1);
   ASSERT_RETURN(t0[2] == u2);
@@ -499,6 +531,7 @@ result_t validate_int8(int8x16x2_t a, int8_t i0, int8_t i1, int8_t i2, int8_t i3
   const int8_t *t0 = (const int8_t *)&a.val[0];
   const int8_t *t1 = (const int8_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 16);
   ASSERT_RETURN(t0[0] == i0);
   ASSERT_RETURN(t0[1] == i1);
   ASSERT_RETURN(t0[2] == i2);
@@ -547,6 +580,7 @@ result_t validate_uint8(uint8x16x2_t a, uint8_t u0, uint8_t u1, uint8_t u2, uint
   const uint8_t *t0 = (const uint8_t *)&a.val[0];
   const uint8_t *t1 = (const uint8_t *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_INT, t0, t1, sizeof(*t0) * 16);
   ASSERT_RETURN(t0[0] == u0);
   ASSERT_RETURN(t0[1] == u1);
   ASSERT_RETURN(t0[2] == u2);
@@ -605,6 +639,7 @@ result_t validate_double_pair(double a, double b) {
 
 result_t validate_float(float32x4_t a, float f0, float f1, float f2, float f3) {
   const float *t = (const float *)&a;
+  CORPUS_CHECK(CORPUS_F32, t, NULL, sizeof(*t) * 4);
   ASSERT_RETURN(validate_float_pair(t[0], f0));
   ASSERT_RETURN(validate_float_pair(t[1], f1));
   ASSERT_RETURN(validate_float_pair(t[2], f2));
@@ -623,6 +658,7 @@ result_t validate_float(float32x4x2_t a, float f0, float f1, float f2, float f3,
   const float *t0 = (const float *)&a.val[0];
   const float *t1 = (const float *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_F32, t0, t1, sizeof(*t0) * 4);
   ASSERT_RETURN(validate_float_pair(t0[0], f0));
   ASSERT_RETURN(validate_float_pair(t0[1], f1));
   ASSERT_RETURN(validate_float_pair(t0[2], f2));
@@ -636,6 +672,7 @@ result_t validate_float(float32x4x2_t a, float f0, float f1, float f2, float f3,
 
 result_t validate_float(float32x2_t a, float f0, float f1) {
   const float *t = (const float *)&a;
+  CORPUS_CHECK(CORPUS_F32, t, NULL, sizeof(*t) * 2);
   ASSERT_RETURN(validate_float_pair(t[0], f0));
   ASSERT_RETURN(validate_float_pair(t[1], f1));
   return TEST_SUCCESS;
@@ -651,6 +688,7 @@ result_t validate_float(float32x2x2_t a, float f0, float f1, float f2, float f3)
   const float *t0 = (const float *)&a.val[0];
   const float *t1 = (const float *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_F32, t0, t1, sizeof(*t0) * 2);
   ASSERT_RETURN(validate_float_pair(t0[0], f0));
   ASSERT_RETURN(validate_float_pair(t0[1], f1));
   ASSERT_RETURN(validate_float_pair(t1[0], f2));
@@ -709,6 +747,7 @@ result_t validate_float_error(float32_t a, float f0, float err) {
 
 result_t validate_double(float64x2_t a, double d0, double d1) {
   const double *t = (const double *)&a;
+  CORPUS_CHECK(CORPUS_F64, t, NULL, sizeof(*t) * 2);
   ASSERT_RETURN(validate_float_pair(t[0], d0));
   ASSERT_RETURN(validate_float_pair(t[1], d1));
   return TEST_SUCCESS;
@@ -724,6 +763,7 @@ result_t validate_double(float64x2x2_t a, double d0, double d1, double d2, doubl
   const double *t0 = (const double *)&a.val[0];
   const double *t1 = (const double *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_F64, t0, t1, sizeof(*t0) * 2);
   ASSERT_RETURN(validate_float_pair(t0[0], d0));
   ASSERT_RETURN(validate_float_pair(t0[1], d1));
   ASSERT_RETURN(validate_float_pair(t1[0], d2));
@@ -733,6 +773,7 @@ result_t validate_double(float64x2x2_t a, double d0, double d1, double d2, doubl
 
 result_t validate_double(float64x1_t a, double d0) {
   const double *t = (const double *)&a;
+  CORPUS_CHECK(CORPUS_F64, t, NULL, sizeof(*t) * 1);
   ASSERT_RETURN(validate_float_pair(t[0], d0));
   return TEST_SUCCESS;
 }
@@ -747,6 +788,7 @@ result_t validate_double(float64x1x2_t a, double d0, double d1) {
   const double *t0 = (const double *)&a.val[0];
   const double *t1 = (const double *)&a.val[1];
 #endif
+  CORPUS_CHECK(CORPUS_F64, t0, t1, sizeof(*t0) * 1);
   ASSERT_RETURN(validate_float_pair(t0[0], d0));
   ASSERT_RETURN(validate_float_pair(t1[0], d1));
   return TEST_SUCCESS;
@@ -832,8 +874,291 @@ uint32_t saturate_uint32(uint64_t a) {
   return a;
 }
 
-float ranf(float low, float high) {
-  float rand_float = (float)rand() / (float)RAND_MAX;
+int32_t convert_to_int32_sat(double a) {
+  if (a >= 2147483648.0) {
+    return INT32_MAX;
+  } else if (a <= -2147483649.0) {
+    return INT32_MIN;
+  }
+  return (int32_t)a;
+}
+uint32_t convert_to_uint32_sat(double a) {
+  if (a >= 4294967296.0) {
+    return UINT32_MAX;
+  } else if (a <= -1.0) {
+    return 0;
+  }
+  return (uint32_t)a;
+}
+int64_t convert_to_int64_sat(double a) {
+  if (a >= 9223372036854775808.0) {
+    return INT64_MAX;
+  } else if (a < -9223372036854775808.0) {
+    return INT64_MIN;
+  }
+  return (int64_t)a;
+}
+uint64_t convert_to_uint64_sat(double a) {
+  if (a >= 18446744073709551616.0) {
+    return UINT64_MAX;
+  } else if (a <= -1.0) {
+    return 0;
+  }
+  return (uint64_t)a;
+}
+
+// AArch64 UnsignedRSqrtEstimate()
+uint32_t rsqrt_estimate_uint32(uint32_t a) {
+  if (a < 0x40000000u) {
+    return UINT32_MAX;
+  }
+  uint32_t idx = a >> 23;
+  uint32_t d = idx < 256 ? idx * 2 + 1 : ((idx >> 1) * 2 + 1) * 2;
+  uint32_t b = 512;
+  while ((uint64_t)d * (b + 1) * (b + 1) < (UINT64_C(1) << 28)) {
+    b++;
+  }
+  return ((b + 1) / 2) << 23;
+}
+
+// AArch64 FPRecipEstimate() with round to nearest and no flush to zero
+float recip_estimate_float(float a) {
+  uint32_t bits;
+  memcpy(&bits, &a, sizeof(bits));
+  uint32_t sign = bits & 0x80000000u;
+  uint32_t abs = bits & 0x7fffffffu;
+  uint32_t res;
+  if (abs > 0x7f800000u) {
+    res = bits | 0x00400000u;
+  } else if (abs < 0x00200000u) {
+    res = sign | 0x7f800000u;
+  } else if (abs == 0x7f800000u) {
+    res = sign;
+  } else {
+    int32_t exp = (int32_t)(abs >> 23);
+    uint32_t frac = abs & 0x7fffffu;
+    if (exp == 0) {
+      if (frac & 0x400000u) {
+        frac = (frac << 1) & 0x7fffffu;
+      } else {
+        exp = -1;
+        frac = (frac << 2) & 0x7fffffu;
+      }
+    }
+    uint32_t scaled = 0x100u | (frac >> 15);
+    uint32_t est = ((1u << 19) / (scaled * 2 + 1) + 1) >> 1;
+    int32_t res_exp = 253 - exp;
+    frac = (est & 0xffu) << 15;
+    if (res_exp == 0) {
+      frac = 0x400000u | (frac >> 1);
+    } else if (res_exp == -1) {
+      frac = 0x200000u | (frac >> 2);
+      res_exp = 0;
+    }
+    res = sign | ((uint32_t)res_exp << 23) | frac;
+  }
+  float r;
+  memcpy(&r, &res, sizeof(r));
+  return r;
+}
+
+double recip_estimate_double(double a) {
+  uint64_t bits;
+  memcpy(&bits, &a, sizeof(bits));
+  uint64_t sign = bits & 0x8000000000000000ULL;
+  uint64_t abs = bits & 0x7fffffffffffffffULL;
+  uint64_t res;
+  if (abs > 0x7ff0000000000000ULL) {
+    res = bits | 0x0008000000000000ULL;
+  } else if (abs < 0x0004000000000000ULL) {
+    res = sign | 0x7ff0000000000000ULL;
+  } else if (abs == 0x7ff0000000000000ULL) {
+    res = sign;
+  } else {
+    int64_t exp = (int64_t)(abs >> 52);
+    uint64_t frac = abs & 0xfffffffffffffULL;
+    if (exp == 0) {
+      if (frac & 0x8000000000000ULL) {
+        frac = (frac << 1) & 0xfffffffffffffULL;
+      } else {
+        exp = -1;
+        frac = (frac << 2) & 0xfffffffffffffULL;
+      }
+    }
+    uint32_t scaled = 0x100u | (uint32_t)(frac >> 44);
+    uint32_t est = ((1u << 19) / (scaled * 2 + 1) + 1) >> 1;
+    int64_t res_exp = 2045 - exp;
+    frac = (uint64_t)(est & 0xffu) << 44;
+    if (res_exp == 0) {
+      frac = 0x8000000000000ULL | (frac >> 1);
+    } else if (res_exp == -1) {
+      frac = 0x4000000000000ULL | (frac >> 2);
+      res_exp = 0;
+    }
+    res = sign | ((uint64_t)res_exp << 52) | frac;
+  }
+  double r;
+  memcpy(&r, &res, sizeof(r));
+  return r;
+}
+
+// AArch64 FPRSqrtEstimate(), sharing RecipSqrtEstimate() with rsqrt_estimate_uint32()
+float rsqrt_estimate_float(float a) {
+  uint32_t bits;
+  memcpy(&bits, &a, sizeof(bits));
+  uint32_t abs = bits & 0x7fffffffu;
+  uint32_t res;
+  if (abs > 0x7f800000u) {
+    res = bits | 0x00400000u;
+  } else if (abs == 0) {
+    res = bits | 0x7f800000u;
+  } else if (bits & 0x80000000u) {
+    res = 0x7fc00000u;
+  } else if (abs == 0x7f800000u) {
+    res = 0;
+  } else {
+    int32_t exp = (int32_t)(abs >> 23);
+    uint32_t frac = abs & 0x7fffffu;
+    if (exp == 0) {
+      while (!(frac & 0x400000u)) {
+        frac <<= 1;
+        exp--;
+      }
+      frac = (frac << 1) & 0x7fffffu;
+    }
+    uint32_t scaled = (exp & 1) ? 0x80u | (frac >> 16) : 0x100u | (frac >> 15);
+    uint32_t est = rsqrt_estimate_uint32(scaled << 23) >> 23;
+    res = ((uint32_t)((380 - exp) / 2) << 23) | ((est & 0xffu) << 15);
+  }
+  float r;
+  memcpy(&r, &res, sizeof(r));
+  return r;
+}
+
+double rsqrt_estimate_double(double a) {
+  uint64_t bits;
+  memcpy(&bits, &a, sizeof(bits));
+  uint64_t abs = bits & 0x7fffffffffffffffULL;
+  uint64_t res;
+  if (abs > 0x7ff0000000000000ULL) {
+    res = bits | 0x0008000000000000ULL;
+  } else if (abs == 0) {
+    res = bits | 0x7ff0000000000000ULL;
+  } else if (bits & 0x8000000000000000ULL) {
+    res = 0x7ff8000000000000ULL;
+  } else if (abs == 0x7ff0000000000000ULL) {
+    res = 0;
+  } else {
+    int64_t exp = (int64_t)(abs >> 52);
+    uint64_t frac = abs & 0xfffffffffffffULL;
+    if (exp == 0) {
+      while (!(frac & 0x8000000000000ULL)) {
+        frac <<= 1;
+        exp--;
+      }
+      frac = (frac << 1) & 0xfffffffffffffULL;
+    }
+    uint32_t scaled = (exp & 1) ? 0x80u | (uint32_t)(frac >> 45) : 0x100u | (uint32_t)(frac >> 44);
+    uint32_t est = rsqrt_estimate_uint32(scaled << 23) >> 23;
+    res = ((uint64_t)((3068 - exp) / 2) << 52) | ((uint64_t)(est & 0xffu) << 44);
+  }
+  double r;
+  memcpy(&r, &res, sizeof(r));
+  return r;
+}
+
+// Without NEON2RVV_STRICT_ESTIMATE the vfrec7/vfrsqrt7 seed and the AArch64 estimate are each within about 2^-7 of
+// the exact result, so they only have to agree to within 2^-6.
+result_t validate_float_estimate(float a, float f) {
+  if ((isnan(a) && isnan(f)) || (isinf(a) && isinf(f) && signbit(a) == signbit(f))) {
+    return TEST_SUCCESS;
+  }
+#if NEON2RVV_STRICT_ESTIMATE
+  return validate_float_pair(a, f);
+#else
+  ASSERT_RETURN((a == 0 && f == 0) || fabsf((a - f) / f) < 1.0f / 64);
+  return TEST_SUCCESS;
+#endif
+}
+
+result_t validate_double_estimate(double a, double d) {
+  if ((isnan(a) && isnan(d)) || (isinf(a) && isinf(d) && signbit(a) == signbit(d))) {
+    return TEST_SUCCESS;
+  }
+#if NEON2RVV_STRICT_ESTIMATE
+  return validate_double_pair(a, d);
+#else
+  ASSERT_RETURN((a == 0 && d == 0) || fabs((a - d) / d) < 1.0 / 64);
+  return TEST_SUCCESS;
+#endif
+}
+
+result_t validate_float_estimate(float32x4_t a, float f0, float f1, float f2, float f3) {
+  const float *t = (const float *)&a;
+  ASSERT_RETURN(validate_float_estimate(t[0], f0) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_float_estimate(t[1], f1) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_float_estimate(t[2], f2) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_float_estimate(t[3], f3) == TEST_SUCCESS);
+  return TEST_SUCCESS;
+}
+
+result_t validate_float_estimate(float32x2_t a, float f0, float f1) {
+  const float *t = (const float *)&a;
+  ASSERT_RETURN(validate_float_estimate(t[0], f0) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_float_estimate(t[1], f1) == TEST_SUCCESS);
+  return TEST_SUCCESS;
+}
+
+result_t validate_double_estimate(float64x2_t a, double d0, double d1) {
+  const double *t = (const double *)&a;
+  ASSERT_RETURN(validate_double_estimate(t[0], d0) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_double_estimate(t[1], d1) == TEST_SUCCESS);
+  return TEST_SUCCESS;
+}
+
+result_t validate_double_estimate(float64x1_t a, double d0) {
+  const double *t = (const double *)&a;
+  ASSERT_RETURN(validate_double_estimate(t[0], d0) == TEST_SUCCESS);
+  return TEST_SUCCESS;
+}
+
+static result_t validate_uint32_estimate(uint32_t a, uint32_t u) {
+#if NEON2RVV_STRICT_ESTIMATE
+  ASSERT_RETURN(a == u);
+#else
+  // vfrec7/vfrsqrt7 only promise 7 bits
+  uint32_t diff = a > u ? a - u : u - a;
+  ASSERT_RETURN(diff <= (u >> 5));
+#endif
+  return TEST_SUCCESS;
+}
+
+result_t validate_uint32_estimate(uint32x4_t a, uint32_t u0, uint32_t u1, uint32_t u2, uint32_t u3) {
+  const uint32_t *t = (const uint32_t *)&a;
+  ASSERT_RETURN(validate_uint32_estimate(t[0], u0) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_uint32_estimate(t[1], u1) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_uint32_estimate(t[2], u2) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_uint32_estimate(t[3], u3) == TEST_SUCCESS);
+  return TEST_SUCCESS;
+}
+
+result_t validate_uint32_estimate(uint32x2_t a, uint32_t u0, uint32_t u1) {
+  const uint32_t *t = (const uint32_t *)&a;
+  ASSERT_RETURN(validate_uint32_estimate(t[0], u0) == TEST_SUCCESS);
+  ASSERT_RETURN(validate_uint32_estimate(t[1], u1) == TEST_SUCCESS);
+  return TEST_SUCCESS;
+}
+
+uint32_t rand_next(uint32_t *state) {
+  // splitmix32: every seed, including 0, gives a well mixed sequence.
+  uint32_t z = (*state += 0x9e3779b9);
+  z = (z ^ (z >> 16)) * 0x85ebca6b;
+  z = (z ^ (z >> 13)) * 0xc2b2ae35;
+  return z ^ (z >> 16);
+}
+
+float ranf(uint32_t *state, float low, float high) {
+  float rand_float = (float)rand_next(state) / (float)UINT32_MAX;
   return rand_float * (high - low) + low;
 }
 
@@ -896,6 +1221,22 @@ double bankers_rounding(double val) {
   return ret;
 }
 
+float round_to_odd(double val) {
+  // Truncate toward zero, then set the lowest mantissa bit if any of the discarded bits were nonzero.
+  float ret = (float)val;
+  if (isnan(val) || (double)ret == val) {
+    return ret;
+  }
+  uint32_t bits;
+  memcpy(&bits, &ret, sizeof(bits));
+  if (fabs((double)ret) > fabs(val)) {
+    bits -= 1;  // step the magnitude back toward zero
+  }
+  bits |= 1;
+  memcpy(&ret, &bits, sizeof(ret));
+  return ret;
+}
+
 float maxnm(float a, float b) {
   if (isnan(a) && !isnan(b)) {
     a = b;
@@ -929,4 +1270,20 @@ double minnm(double a, double b) {
   return a < b ? a : b;
 }
 
+uint32_t crc32_reflected(uint32_t crc, uint64_t data, int bits, uint32_t poly) {
+  for (int i = 0; i < bits; i++) {
+    crc ^= (data >> i) & 1;
+    crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+  }
+  return crc;
+}
+
+uint64_t reverse_bits(uint64_t a, int bits) {
+  uint64_t ret = 0;
+  for (int i = 0; i < bits; i++) {
+    ret |= ((a >> i) & 1) << (bits - 1 - i);
+  }
+  return ret;
+}
+
 }  // namespace NEON2RVV
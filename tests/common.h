@@ -3,12 +3,33 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <cstddef>
+
+// The half-precision tests need Zvfh on RISC-V and FEAT_FHM on AArch64.
+#if defined(__riscv_zvfh) || defined(__ARM_FEATURE_FP16_FML)
+#define NEON2RVV_TEST_F16 1
+#else
+#define NEON2RVV_TEST_F16 0
+#endif
 
 #if defined(__riscv) || defined(__riscv__)
+#include "acle2rvv.h"
 #include "neon2rvv.h"
+
+// FIXED_VLEN=1 must really compile the NEON2RVV_FIXED_VLEN_128 paths
+#if defined(NEON2RVV_TEST_FIXED_VLEN) && !NEON2RVV_FIXED_VLEN_128
+#error "FIXED_VLEN needs __riscv_v_fixed_vlen == 128, e.g. -march=rv64gcv -mrvv-vector-bits=zvl"
+#endif
 #elif (defined(__aarch64__) || defined(_M_ARM64)) || defined(__arm__)
+#include <arm_acle.h>
 #include <arm_neon.h>
 
+// native NEON always behaves like the strict neon2rvv paths
+#define NEON2RVV_STRICT_VMULX 1
+#define NEON2RVV_STRICT_NAN 1
+#define NEON2RVV_STRICT_REDUCTION 1
+#define NEON2RVV_STRICT_ESTIMATE 1
+
 #if defined(__GNUC__) || defined(__clang__)
 #pragma push_macro("ALIGN_STRUCT")
 #define ALIGN_STRUCT(x) __attribute__((aligned(x)))
@@ -33,6 +54,13 @@ typedef union ALIGN_STRUCT(16) SIMDVec {
 #endif  // defined(__GNUC__) || defined(__clang__)
 #endif  // defined(__riscv) || defined(__riscv__)
 
+// Newlib based toolchains build libstdc++ without std::thread.
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_HAS_GTHREADS)
+#define NEON2RVV_TEST_THREADS 0
+#else
+#define NEON2RVV_TEST_THREADS 1
+#endif
+
 #define ASSERT_RETURN(x) \
   if (!(x))              \
     return TEST_FAIL;
@@ -145,6 +173,7 @@ result_t validate_double_error(float64x2_t a, double d0, double d1, double err);
 result_t validate_double_error(float64x1_t a, double d0, double err);
 result_t validate_double_error(double a, double d0, double err);
 result_t validate_float_pair(float a, float b);
+result_t validate_double_pair(double a, double b);
 
 int8_t saturate_int8(int a);
 uint8_t saturate_uint8(unsigned int a);
@@ -152,6 +181,26 @@ int16_t saturate_int16(int a);
 uint16_t saturate_uint16(unsigned int a);
 int32_t saturate_int32(int64_t a);
 uint32_t saturate_uint32(uint64_t a);
+// truncate and saturate like the AArch64 FCVTZS/FCVTZU
+int32_t convert_to_int32_sat(double a);
+uint32_t convert_to_uint32_sat(double a);
+int64_t convert_to_int64_sat(double a);
+uint64_t convert_to_uint64_sat(double a);
+uint32_t rsqrt_estimate_uint32(uint32_t a);
+float recip_estimate_float(float a);
+double recip_estimate_double(double a);
+float rsqrt_estimate_float(float a);
+double rsqrt_estimate_double(double a);
+
+// the estimates are bit exact only with NEON2RVV_STRICT_ESTIMATE
+result_t validate_uint32_estimate(uint32x4_t a, uint32_t u0, uint32_t u1, uint32_t u2, uint32_t u3);
+result_t validate_uint32_estimate(uint32x2_t a, uint32_t u0, uint32_t u1);
+result_t validate_float_estimate(float a, float f);
+result_t validate_double_estimate(double a, double d);
+result_t validate_float_estimate(float32x4_t a, float f0, float f1, float f2, float f3);
+result_t validate_float_estimate(float32x2_t a, float f0, float f1);
+result_t validate_double_estimate(float64x2_t a, double d0, double d1);
+result_t validate_double_estimate(float64x1_t a, double d0);
 
 #define TEST_SATURATE_ADD_SUB(BIT)                                        \
   static inline int##BIT##_t sat_add(int##BIT##_t a, int##BIT##_t b) {    \
@@ -185,6 +234,24 @@ TEST_SATURATE_ADD_SUB(16)
 TEST_SATURATE_ADD_SUB(32)
 TEST_SATURATE_ADD_SUB(64)
 
+// saturating add of operands with opposite signedness, for vuqadd and vsqadd
+#define TEST_SATURATE_MIXED_ADD(BIT)                                                        \
+  static inline int##BIT##_t sat_uqadd(int##BIT##_t a, uint##BIT##_t b) {                   \
+    uint##BIT##_t room = (uint##BIT##_t)INT##BIT##_MAX - (uint##BIT##_t)a;                  \
+    return b > room ? INT##BIT##_MAX : (int##BIT##_t)((uint##BIT##_t)a + b);                \
+  }                                                                                         \
+  static inline uint##BIT##_t sat_sqadd(uint##BIT##_t a, int##BIT##_t b) {                  \
+    if (b < 0) {                                                                            \
+      uint##BIT##_t b_abs = (uint##BIT##_t)(0 - (uint##BIT##_t)b);                          \
+      return b_abs > a ? 0 : a - b_abs;                                                     \
+    }                                                                                       \
+    return a > UINT##BIT##_MAX - (uint##BIT##_t)b ? UINT##BIT##_MAX : a + (uint##BIT##_t)b; \
+  }
+TEST_SATURATE_MIXED_ADD(8)
+TEST_SATURATE_MIXED_ADD(16)
+TEST_SATURATE_MIXED_ADD(32)
+TEST_SATURATE_MIXED_ADD(64)
+
 // CBIT stands for current bit size, and HBIT stands for higher bit size
 #define TEST_SATURATE_DMUL(CBIT, HBIT)                                                                          \
   static inline int##HBIT##_t sat_dmull(int##CBIT##_t a, int##CBIT##_t b) {                                     \
@@ -201,14 +268,14 @@ TEST_SATURATE_ADD_SUB(64)
     return saturate_int##CBIT(tmp >> 1);                                                                        \
   }                                                                                                             \
   static inline int##CBIT##_t sat_rdmlah(int##CBIT##_t a, int##CBIT##_t b, int##CBIT##_t c) {                   \
-    int##HBIT##_t tmp = sat_dmull(b, c);                                                                        \
-    tmp = sat_add(tmp, (int##HBIT##_t)(1 << (CBIT - 1)));                                                       \
-    return sat_add(a, (int##CBIT##_t)(tmp >> CBIT));                                                            \
+    int##HBIT##_t tmp = (int##HBIT##_t)a * ((int##HBIT##_t)1 << (CBIT - 1)) + (int##HBIT##_t)b * c;             \
+    tmp += (int##HBIT##_t)1 << (CBIT - 2);                                                                      \
+    return saturate_int##CBIT(tmp >> (CBIT - 1));                                                               \
   }                                                                                                             \
   static inline int##CBIT##_t sat_rdmlsh(int##CBIT##_t a, int##CBIT##_t b, int##CBIT##_t c) {                   \
-    int##HBIT##_t tmp = sat_dmull(b, c);                                                                        \
-    tmp = sat_sub(tmp, (int##HBIT##_t)(1 << (CBIT - 1)));                                                       \
-    return sat_sub(a, (int##CBIT##_t)(tmp >> CBIT));                                                            \
+    int##HBIT##_t tmp = (int##HBIT##_t)a * ((int##HBIT##_t)1 << (CBIT - 1)) - (int##HBIT##_t)b * c;             \
+    tmp += (int##HBIT##_t)1 << (CBIT - 2);                                                                      \
+    return saturate_int##CBIT(tmp >> (CBIT - 1));                                                               \
   }
 TEST_SATURATE_DMUL(8, 16)
 TEST_SATURATE_DMUL(16, 32)
@@ -324,7 +391,10 @@ DEFINE_TUPLEx4_GET(int64, i, 64, 2);
 DEFINE_TUPLEx4_GET(uint64, u, 64, 2);
 #endif
 
-float ranf(float low, float high);
+// Each test instance owns its random stream so instances can run in parallel
+// and still see the same values.
+uint32_t rand_next(uint32_t *state);
+float ranf(uint32_t *state, float low, float high);
 
 template <typename T, typename U>
 static void merge_arrays(const T *arr1, const T *arr2, U *out, size_t single_arr_size) {
@@ -376,12 +446,17 @@ static void merge_arrays(const T *arr1, const T *arr2, const T *arr3, const T *a
 
 float bankers_rounding(float val);
 double bankers_rounding(double val);
+float round_to_odd(double val);
 
 float maxnm(float a, float b);
 float minnm(float a, float b);
 double maxnm(double a, double b);
 double minnm(double a, double b);
 
+// bit-reflected CRC32 of the low 'bits' bits of 'data', as computed by the Arm CRC32 instructions
+uint32_t crc32_reflected(uint32_t crc, uint64_t data, int bits, uint32_t poly);
+uint64_t reverse_bits(uint64_t a, int bits);
+
 #define CHECK_RESULT(EXP)      \
   if ((EXP) != TEST_SUCCESS) { \
     return TEST_FAIL;          \
@@ -0,0 +1,274 @@
+#include "corpus.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "impl.h"
+
+#if NEON2RVV_TEST_THREADS
+#include <mutex>
+#define CORPUS_THREAD_LOCAL thread_local
+#else
+#define CORPUS_THREAD_LOCAL
+#endif
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace NEON2RVV {
+
+static const char corpus_magic[8] = {'N', '2', 'R', 'V', 'G', 'O', 'L', 'D'};
+static const uint32_t corpus_version = 1;
+
+static corpus_mode_t mode = CORPUS_OFF;
+static std::vector<corpus_entry> entries;
+
+// record mode
+static FILE *record_file;
+static uint64_t record_offset;
+#if NEON2RVV_TEST_THREADS
+static std::mutex record_lock;
+#endif
+
+// compare mode
+static uint8_t *compare_base;
+static size_t compare_size;
+static bool compare_mapped;
+
+struct corpus_cursor {
+  uint32_t test;
+  uint64_t input_digest;
+  bool active;
+  std::vector<uint8_t> record;
+  const uint8_t *pos;
+  const uint8_t *end;
+};
+static CORPUS_THREAD_LOCAL corpus_cursor cursor;
+
+uint64_t corpus_digest(const void *data, size_t size, uint64_t seed) {
+  // FNV-1a
+  const uint8_t *p = (const uint8_t *)data;
+  uint64_t h = seed ^ 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < size; i++) {
+    h = (h ^ p[i]) * 0x100000001b3ULL;
+  }
+  return h;
+}
+
+static uint64_t name_digest(uint32_t test) {
+  const char *name = instruction_string[test];
+  return corpus_digest(name, strlen(name), 0);
+}
+
+static bool load_corpus(const char *path) {
+#if defined(__linux__)
+  int fd = open(path, O_RDONLY);
+  if (fd >= 0) {
+    struct stat st;
+    void *p = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (p != MAP_FAILED) {
+      compare_base = (uint8_t *)p;
+      compare_size = (size_t)st.st_size;
+      compare_mapped = true;
+      return true;
+    }
+  }
+#endif
+  // No mmap (e.g. spike + pk): read the whole file instead.
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    return false;
+  }
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t *p = size > 0 ? (uint8_t *)malloc((size_t)size) : NULL;
+  if (!p || fread(p, 1, (size_t)size, f) != (size_t)size) {
+    free(p);
+    fclose(f);
+    return false;
+  }
+  fclose(f);
+  compare_base = p;
+  compare_size = (size_t)size;
+  compare_mapped = false;
+  return true;
+}
+
+static void unload_corpus(void) {
+#if defined(__linux__)
+  if (compare_mapped) {
+    munmap(compare_base, compare_size);
+  }
+#endif
+  if (!compare_mapped) {
+    free(compare_base);
+  }
+  compare_base = NULL;
+  compare_size = 0;
+}
+
+bool corpus_open(const char *path, corpus_mode_t m) {
+  size_t index_size = sizeof(corpus_entry) * it_last;
+  entries.assign(it_last, corpus_entry());
+  if (m == CORPUS_RECORD) {
+    record_file = fopen(path, "wb");
+    if (!record_file) {
+      printf("corpus: cannot create %s\n", path);
+      return false;
+    }
+    // The header and index are rewritten by corpus_close().
+    corpus_header header = corpus_header();
+    fwrite(&header, sizeof(header), 1, record_file);
+    fwrite(entries.data(), index_size, 1, record_file);
+    record_offset = sizeof(header) + index_size;
+  } else if (m == CORPUS_COMPARE) {
+    if (!load_corpus(path)) {
+      printf("corpus: cannot read %s\n", path);
+      return false;
+    }
+    const corpus_header *header = (const corpus_header *)compare_base;
+    if (compare_size < sizeof(corpus_header) + index_size || memcmp(header->magic, corpus_magic, 8) ||
+        header->version != corpus_version || header->test_count != (uint32_t)it_last) {
+      printf("corpus: %s was not recorded from this test list\n", path);
+      unload_corpus();
+      return false;
+    }
+    memcpy(entries.data(), compare_base + sizeof(corpus_header), index_size);
+  }
+  mode = m;
+  return true;
+}
+
+void corpus_close(void) {
+  if (mode == CORPUS_RECORD) {
+    corpus_header header = corpus_header();
+    memcpy(header.magic, corpus_magic, 8);
+    header.version = corpus_version;
+    header.test_count = (uint32_t)it_last;
+    fseek(record_file, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, record_file);
+    fwrite(entries.data(), sizeof(corpus_entry) * entries.size(), 1, record_file);
+    fclose(record_file);
+    record_file = NULL;
+  } else if (mode == CORPUS_COMPARE) {
+    unload_corpus();
+  }
+  mode = CORPUS_OFF;
+}
+
+bool corpus_begin(uint32_t test, uint64_t input_digest) {
+  cursor.test = test;
+  cursor.input_digest = input_digest;
+  cursor.active = false;
+  if (mode == CORPUS_RECORD) {
+    cursor.record.clear();
+    cursor.active = true;
+  } else if (mode == CORPUS_COMPARE) {
+    const corpus_entry &e = entries[test];
+    if (e.size == 0) {
+      // Not recorded, e.g. skipped on AArch64: use the scalar reference.
+      return true;
+    }
+    if (e.name_digest != name_digest(test) || e.input_digest != input_digest ||
+        e.offset + e.size > compare_size) {
+      printf("corpus: record for %s does not match this build\n", instruction_string[test]);
+      return false;
+    }
+    cursor.pos = compare_base + e.offset;
+    cursor.end = cursor.pos + e.size;
+    cursor.active = true;
+  }
+  return true;
+}
+
+void corpus_end(void) {
+  if (mode == CORPUS_RECORD && !cursor.record.empty()) {
+#if NEON2RVV_TEST_THREADS
+    std::lock_guard<std::mutex> guard(record_lock);
+#endif
+    corpus_entry &e = entries[cursor.test];
+    e.offset = record_offset;
+    e.size = cursor.record.size();
+    e.input_digest = cursor.input_digest;
+    e.name_digest = name_digest(cursor.test);
+    fseek(record_file, (long)record_offset, SEEK_SET);
+    fwrite(cursor.record.data(), cursor.record.size(), 1, record_file);
+    record_offset += cursor.record.size();
+  }
+  cursor.active = false;
+}
+
+static bool lanes_equal(corpus_lane_t kind, const uint8_t *golden, const uint8_t *lanes, size_t size) {
+  if (kind == CORPUS_F32) {
+    for (size_t i = 0; i < size; i += 4) {
+      float g, v;
+      memcpy(&g, golden + i, 4);
+      memcpy(&v, lanes + i, 4);
+      if (memcmp(&g, &v, 4) && !(isnan(g) && isnan(v))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (kind == CORPUS_F64) {
+    for (size_t i = 0; i < size; i += 8) {
+      double g, v;
+      memcpy(&g, golden + i, 8);
+      memcpy(&v, lanes + i, 8);
+      if (memcmp(&g, &v, 8) && !(isnan(g) && isnan(v))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return memcmp(golden, lanes, size) == 0;
+}
+
+result_t corpus_check(corpus_lane_t kind, const void *lo, const void *hi, size_t size) {
+  if (!cursor.active) {
+    return TEST_UNIMPL;
+  }
+  uint16_t total = (uint16_t)(hi ? size * 2 : size);
+  if (mode == CORPUS_RECORD) {
+    const uint8_t *p = (const uint8_t *)&total;
+    cursor.record.insert(cursor.record.end(), p, p + sizeof(total));
+    cursor.record.insert(cursor.record.end(), (const uint8_t *)lo, (const uint8_t *)lo + size);
+    if (hi) {
+      cursor.record.insert(cursor.record.end(), (const uint8_t *)hi, (const uint8_t *)hi + size);
+    }
+    // Keep validating natively so reference bugs still show up.
+    return TEST_UNIMPL;
+  }
+
+  if (cursor.end - cursor.pos < (ptrdiff_t)sizeof(total)) {
+    // The native run stopped earlier than this one.
+    return TEST_UNIMPL;
+  }
+  uint16_t recorded;
+  memcpy(&recorded, cursor.pos, sizeof(recorded));
+  if (recorded != total || cursor.end - cursor.pos < (ptrdiff_t)(sizeof(total) + total)) {
+    cursor.active = false;
+    return TEST_FAIL;
+  }
+  const uint8_t *golden = cursor.pos + sizeof(total);
+  cursor.pos = golden + total;
+  if (!lanes_equal(kind, golden, (const uint8_t *)lo, size)) {
+    return TEST_FAIL;
+  }
+  if (hi && !lanes_equal(kind, golden + size, (const uint8_t *)hi, size)) {
+    return TEST_FAIL;
+  }
+  return TEST_SUCCESS;
+}
+
+}  // namespace NEON2RVV
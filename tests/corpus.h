@@ -0,0 +1,73 @@
+#ifndef NEON2RVV_CORPUS_H
+#define NEON2RVV_CORPUS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "common.h"
+
+// Golden-vector corpus for differential testing.
+//
+// Record mode runs the tests on native AArch64 and stores the lanes every
+// validate_* call sees, one stream per intrinsic. Compare mode maps that file
+// on RISC-V and checks the neon2rvv lanes against it instead of the scalar
+// reference. The inputs themselves are not stored: both sides regenerate them
+// from the same seeds, and a digest of the input tables guards against drift.
+//
+// File layout, all little-endian:
+//   corpus_header
+//   corpus_entry[test_count], indexed by INSTRUCTION_TEST
+//   per test: { uint16_t size; uint8_t lanes[size]; } records
+
+namespace NEON2RVV {
+
+enum corpus_mode_t {
+  CORPUS_OFF,
+  CORPUS_RECORD,
+  CORPUS_COMPARE,
+};
+
+enum corpus_lane_t {
+  CORPUS_INT,
+  CORPUS_F32,
+  CORPUS_F64,
+};
+
+struct corpus_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t test_count;
+};
+
+struct corpus_entry {
+  uint64_t offset;
+  uint64_t size;
+  uint64_t input_digest;
+  uint64_t name_digest;
+};
+
+bool corpus_open(const char *path, corpus_mode_t mode);
+void corpus_close(void);
+
+// Brackets one run_test() on the calling thread. Returns false when the
+// recorded inputs or intrinsic name do not match this build.
+bool corpus_begin(uint32_t test, uint64_t input_digest);
+void corpus_end(void);
+
+// Records or compares one result. `hi` is the second vector of an x2 tuple
+// or NULL; `size` is the byte size of one vector. Returns TEST_UNIMPL when the
+// caller should fall back to its scalar reference.
+result_t corpus_check(corpus_lane_t kind, const void *lo, const void *hi, size_t size);
+
+uint64_t corpus_digest(const void *data, size_t size, uint64_t seed);
+
+}  // namespace NEON2RVV
+
+#define CORPUS_CHECK(kind, lo, hi, size)                    \
+  do {                                                      \
+    result_t corpus_ret = corpus_check(kind, lo, hi, size); \
+    if (corpus_ret != TEST_UNIMPL)                          \
+      return corpus_ret;                                    \
+  } while (0)
+
+#endif  // NEON2RVV_CORPUS_H
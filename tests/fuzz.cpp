@@ -0,0 +1,86 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "impl.h"
+
+// Fuzzing harness over INTRIN_LIST. The test_* functions in impl.cpp act as
+// the scalar reference model: an input picks the intrinsic and the iteration,
+// and its remaining bytes replace that iteration's float and int inputs.
+//
+// Input layout (little-endian):
+//   uint16_t test;  // index into INTRIN_LIST, modulo it_last
+//   uint16_t iter;  // iteration passed to the test, selects immediates
+//   uint8_t bytes[];  // 256 bytes of floats, then 256 bytes of ints
+//
+// Set NEON2RVV_FUZZ_TARGET=<intrinsic> to pin every input to one intrinsic.
+// Inputs that a test clamps before use come back as skipped, and libFuzzer is
+// told not to keep them.
+
+static NEON2RVV::NEON2RVV_TEST *fuzz_test;
+static int fuzz_target = -1;
+
+extern "C" int LLVMFuzzerInitialize(int * /*argc*/, char *** /*argv*/) {
+  fuzz_test = NEON2RVV::NEON2RVV_TEST::create();
+  const char *target = getenv("NEON2RVV_FUZZ_TARGET");
+  if (target) {
+    for (uint32_t i = 0; i < NEON2RVV::it_last; i++) {
+      if (!strcmp(target, NEON2RVV::instruction_string[i])) {
+        fuzz_target = (int)i;
+      }
+    }
+    if (fuzz_target < 0) {
+      fprintf(stderr, "NEON2RVV_FUZZ_TARGET: unknown intrinsic %s\n", target);
+      exit(1);
+    }
+  }
+  return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  if (size < 4) {
+    return 0;
+  }
+  uint32_t test = fuzz_target >= 0 ? (uint32_t)fuzz_target : (uint32_t)(data[0] | data[1] << 8) % NEON2RVV::it_last;
+  uint32_t iter = (uint32_t)(data[2] | data[3] << 8);
+  NEON2RVV::result_t ret = fuzz_test->run_fuzz(NEON2RVV::INSTRUCTION_TEST(test), iter, data + 4, size - 4);
+  if (ret == NEON2RVV::TEST_FAIL) {
+    fprintf(stderr, "Test %s diverges from the reference (iter %u)\n", NEON2RVV::instruction_string[test], iter);
+    abort();
+  }
+  return ret == NEON2RVV::TEST_UNIMPL ? -1 : 0;
+}
+
+#ifndef NEON2RVV_LIBFUZZER
+// Without libFuzzer, run each file named on the command line, or stdin. This
+// is the entry point for AFL++ (afl-fuzz -Q runs it under qemu-user) and for
+// replaying crashes.
+static void run_file(FILE *f) {
+  std::vector<uint8_t> buf;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    buf.insert(buf.end(), chunk, chunk + n);
+  }
+  LLVMFuzzerTestOneInput(buf.data(), buf.size());
+}
+
+int main(int argc, char **argv) {
+  LLVMFuzzerInitialize(&argc, &argv);
+  if (argc < 2) {
+    run_file(stdin);
+  }
+  for (int i = 1; i < argc; i++) {
+    FILE *f = fopen(argv[i], "rb");
+    if (!f) {
+      fprintf(stderr, "cannot open %s\n", argv[i]);
+      return 1;
+    }
+    run_file(f);
+    fclose(f);
+  }
+  fuzz_test->release();
+  return 0;
+}
+#endif  // NEON2RVV_LIBFUZZER
@@ -9,10 +9,14 @@
 #include <string.h>
 
 #include "binding.h"
+#include "corpus.h"
 #include "impl.h"
 
-// Try 10,000 random floating point values for each test we run
+// Try 10,000 random floating point values for each test we run. Corpus runs
+// can raise this, e.g. -DMAX_TEST_VALUE=100000.
+#ifndef MAX_TEST_VALUE
 #define MAX_TEST_VALUE 10000
+#endif
 
 // This program a set of unit tests to ensure that each NEON call provide the
 // output we expect.  If this fires an assert, then something didn't match up.
@@ -25,6 +29,9 @@ namespace NEON2RVV {
 #elif defined(__aarch64__)
 #define REGISTER_SIZE 128
 #endif
+// the bytes load_test_*_pointers fill: 4 values in each of pointer1-4 of both
+// types and 20 in both huge pointers
+#define TEST_POINTERS_SIZE (sizeof(int32_t) * (8 * 4 + 2 * 20))
 
 class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
  public:
@@ -39,11 +46,13 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
     test_cases_int_pointer3 = (int32_t *)platform_aligned_alloc(REGISTER_SIZE);
     test_cases_int_pointer4 = (int32_t *)platform_aligned_alloc(REGISTER_SIZE);
     test_cases_int_pointer_huge = (int32_t *)platform_aligned_alloc(REGISTER_SIZE * 5);
-    srand(0);
+    rng_state = 0;
     for (uint32_t i = 0; i < MAX_TEST_VALUE; i++) {
-      test_cases_floats[i] = ranf(-100000, 100000);
-      test_cases_ints[i] = (int32_t)ranf(-100000, 100000);
+      test_cases_floats[i] = ranf(&rng_state, -100000, 100000);
+      test_cases_ints[i] = (int32_t)ranf(&rng_state, -100000, 100000);
     }
+    input_digest = corpus_digest(test_cases_floats, sizeof(test_cases_floats), 0);
+    input_digest = corpus_digest(test_cases_ints, sizeof(test_cases_ints), input_digest);
   }
   float *test_cases_float_pointer1;
   float *test_cases_float_pointer2;
@@ -57,6 +66,10 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
   int32_t *test_cases_int_pointer_huge;
   float test_cases_floats[MAX_TEST_VALUE];
   int32_t test_cases_ints[MAX_TEST_VALUE];
+  uint32_t rng_state;
+  uint64_t input_digest;
+
+  uint32_t next_rand(void) { return rand_next(&rng_state); }
 
   virtual ~NEON2RVV_TEST_IMPL(void) {
     platform_aligned_free(test_cases_float_pointer1);
@@ -93,6 +106,19 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
       test_cases_int_pointer_huge[i] = test_cases_ints[iter + i];
     }
   }
+  // Concatenates the filled part of every input buffer, TEST_POINTERS_SIZE bytes.
+  void save_test_pointers(uint8_t *out) const {
+    const void *pointers[] = {test_cases_float_pointer1, test_cases_float_pointer2, test_cases_float_pointer3,
+                              test_cases_float_pointer4, test_cases_int_pointer1,   test_cases_int_pointer2,
+                              test_cases_int_pointer3,   test_cases_int_pointer4};
+    const size_t size = 4 * sizeof(int32_t);
+    const size_t huge_size = 20 * sizeof(int32_t);
+    for (int i = 0; i < 8; i++) {
+      memcpy(out + i * size, pointers[i], size);
+    }
+    memcpy(out + 8 * size, test_cases_float_pointer_huge, huge_size);
+    memcpy(out + 8 * size + huge_size, test_cases_int_pointer_huge, huge_size);
+  }
 
   result_t run_single_test(INSTRUCTION_TEST test, uint32_t iter);
 
@@ -100,6 +126,13 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
   virtual result_t run_test(INSTRUCTION_TEST test) {
     result_t ret = TEST_SUCCESS;
 
+    // Reseed per test so the outcome does not depend on which tests ran
+    // before this one on the same instance.
+    rng_state = (uint32_t)test;
+    if (!corpus_begin(test, input_digest)) {
+      return TEST_FAIL;
+    }
+
     // Test a whole bunch of values
     for (uint32_t i = 0; i < (MAX_TEST_VALUE - 16); i++) {
       load_test_float_pointers(i);  // Load some random float values
@@ -117,15 +150,15 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
       if (test == it_vrecps_f32 || test == it_vrecpsq_f32 || test == it_vrecpe_f32 || test == it_vrecpe_u32 ||
           test == it_vrecpeq_f32 || test == it_vrecpeq_u32 || test == it_vrsqrts_f32 || test == it_vrsqrtsq_f32 ||
           test == it_vrsqrte_f32 || test == it_vrsqrte_u32 || test == it_vrsqrteq_f32 || test == it_vrsqrteq_u32) {
-        if ((rand() & 3) == 0) {
-          uint32_t r1 = rand() & 3;
-          uint32_t r2 = rand() & 3;
-          uint32_t r3 = rand() & 3;
-          uint32_t r4 = rand() & 3;
-          uint32_t r5 = rand() & 3;
-          uint32_t r6 = rand() & 3;
-          uint32_t r7 = rand() & 3;
-          uint32_t r8 = rand() & 3;
+        if ((next_rand() & 3) == 0) {
+          uint32_t r1 = next_rand() & 3;
+          uint32_t r2 = next_rand() & 3;
+          uint32_t r3 = next_rand() & 3;
+          uint32_t r4 = next_rand() & 3;
+          uint32_t r5 = next_rand() & 3;
+          uint32_t r6 = next_rand() & 3;
+          uint32_t r7 = next_rand() & 3;
+          uint32_t r8 = next_rand() & 3;
           test_cases_float_pointer1[r1] = 0.0f;
           test_cases_float_pointer1[r2] = 0.0f;
           test_cases_float_pointer1[r3] = 0.0f;
@@ -172,10 +205,10 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
           test == it_vcltq_u16 || test == it_vcltq_u32) {
         // Make sure the NaN values are included in the testing
         // one out of four times.
-        if ((rand() & 3) == 0) {
-          uint32_t r1 = rand() & 3;
-          uint32_t r2 = rand() & 3;
-          uint32_t r3 = rand() & 3;
+        if ((next_rand() & 3) == 0) {
+          uint32_t r1 = next_rand() & 3;
+          uint32_t r2 = next_rand() & 3;
+          uint32_t r3 = next_rand() & 3;
           test_cases_float_pointer1[r1] = nanf("");
           test_cases_float_pointer2[r2] = nanf("");
           test_cases_float_pointer3[r3] = nanf("");
@@ -192,13 +225,13 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
           test == it_vminq_u16 || test == it_vminq_u32) {
         // Make sure the positive/negative infinity values are included
         // in the testing one out of four times.
-        if ((rand() & 3) == 0) {
-          uint32_t r1 = ((rand() & 1) << 1) + 1;
-          uint32_t r2 = ((rand() & 1) << 1) + 1;
-          uint32_t r3 = ((rand() & 1) << 1) + 1;
-          uint32_t r4 = ((rand() & 1) << 1) + 1;
-          uint32_t r5 = ((rand() & 1) << 1) + 1;
-          uint32_t r6 = ((rand() & 1) << 1) + 1;
+        if ((next_rand() & 3) == 0) {
+          uint32_t r1 = ((next_rand() & 1) << 1) + 1;
+          uint32_t r2 = ((next_rand() & 1) << 1) + 1;
+          uint32_t r3 = ((next_rand() & 1) << 1) + 1;
+          uint32_t r4 = ((next_rand() & 1) << 1) + 1;
+          uint32_t r5 = ((next_rand() & 1) << 1) + 1;
+          uint32_t r6 = ((next_rand() & 1) << 1) + 1;
           test_cases_float_pointer1[r1] = INFINITY;
           test_cases_float_pointer2[r2] = INFINITY;
           test_cases_float_pointer3[r3] = INFINITY;
@@ -210,8 +243,8 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
 
       // one out of every random 64 times or so, mix up the test floats to
       // contain some integer values
-      if ((rand() & 63) == 0) {
-        uint32_t option = rand() & 3;
+      if ((next_rand() & 63) == 0) {
+        uint32_t option = next_rand() & 3;
         switch (option) {
           // All integers..
           case 0:
@@ -232,24 +265,24 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
 
             break;
           case 1: {
-            uint32_t index = rand() & 3;
+            uint32_t index = next_rand() & 3;
             test_cases_float_pointer1[index] = float(test_cases_int_pointer1[index]);
-            index = rand() & 3;
+            index = next_rand() & 3;
             test_cases_float_pointer2[index] = float(test_cases_int_pointer2[index]);
-            index = rand() & 3;
+            index = next_rand() & 3;
             test_cases_float_pointer3[index] = float(test_cases_int_pointer3[index]);
           } break;
           case 2: {
-            uint32_t index1 = rand() & 3;
-            uint32_t index2 = rand() & 3;
+            uint32_t index1 = next_rand() & 3;
+            uint32_t index2 = next_rand() & 3;
             test_cases_float_pointer1[index1] = float(test_cases_int_pointer1[index1]);
             test_cases_float_pointer1[index2] = float(test_cases_int_pointer1[index2]);
-            index1 = rand() & 3;
-            index2 = rand() & 3;
+            index1 = next_rand() & 3;
+            index2 = next_rand() & 3;
             test_cases_float_pointer2[index1] = float(test_cases_int_pointer2[index1]);
             test_cases_float_pointer2[index2] = float(test_cases_int_pointer2[index2]);
-            index1 = rand() & 3;
-            index2 = rand() & 3;
+            index1 = next_rand() & 3;
+            index2 = next_rand() & 3;
             test_cases_float_pointer3[index1] = float(test_cases_int_pointer3[index1]);
             test_cases_float_pointer3[index2] = float(test_cases_int_pointer3[index2]);
           } break;
@@ -260,7 +293,7 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
             test_cases_float_pointer1[3] = float(test_cases_int_pointer1[3]);
             break;
         }
-        if ((rand() & 3) == 0) {  // one out of 4 times, make halves
+        if ((next_rand() & 3) == 0) {  // one out of 4 times, make halves
           for (uint32_t j = 0; j < 4; j++) {
             test_cases_float_pointer1[j] *= 0.5f;
             test_cases_float_pointer2[j] *= 0.5f;
@@ -273,8 +306,131 @@ class NEON2RVV_TEST_IMPL : public NEON2RVV_TEST {
         break;
       }
     }
+    corpus_end();
+    return ret;
+  }
+
+  virtual result_t run_fuzz(INSTRUCTION_TEST test, uint32_t iter, const uint8_t *data, size_t size) {
+    // Overlay the raw bytes on the random tables at iter, so every bit
+    // pattern (NaN payloads, subnormals, INT_MIN, huge shift counts) can reach
+    // the test, then restore the tables for the next input.
+    const uint32_t window = 64;
+    float saved_floats[window];
+    int32_t saved_ints[window];
+    iter %= MAX_TEST_VALUE - window;
+    memcpy(saved_floats, test_cases_floats + iter, sizeof(saved_floats));
+    memcpy(saved_ints, test_cases_ints + iter, sizeof(saved_ints));
+    size_t n = size < sizeof(saved_floats) ? size : sizeof(saved_floats);
+    memcpy(test_cases_floats + iter, data, n);
+    data += n;
+    size -= n;
+    n = size < sizeof(saved_ints) ? size : sizeof(saved_ints);
+    memcpy(test_cases_ints + iter, data, n);
+
+    load_test_float_pointers(iter);
+    load_test_int_pointers(iter);
+    load_test_huge_pointers(iter);
+    uint8_t fuzzed[TEST_POINTERS_SIZE], tested[TEST_POINTERS_SIZE];
+    save_test_pointers(fuzzed);
+    result_t ret = run_single_test(test, iter);
+    // Some tests clamp their inputs in place, e.g. the shift counts of
+    // vshlq_s16. Both sides then ran on the clamped values, so a failure still
+    // counts, but a pass says nothing about the fuzzed ones.
+    save_test_pointers(tested);
+    if (ret == TEST_SUCCESS && memcmp(fuzzed, tested, sizeof(fuzzed))) {
+      ret = TEST_UNIMPL;
+    }
+
+    memcpy(test_cases_floats + iter, saved_floats, sizeof(saved_floats));
+    memcpy(test_cases_ints + iter, saved_ints, sizeof(saved_ints));
     return ret;
   }
+
+  static bool exhaustive_shape(INSTRUCTION_TEST test, uint32_t *bits, uint32_t *inputs, uint32_t *lanes,
+                               bool *pairwise) {
+    switch (test) {
+#define _(x, b, n, v)       \
+  case it_##x:              \
+    *bits = b;              \
+    *inputs = n;            \
+    *lanes = (v) * 8 / (b); \
+    *pairwise = false;      \
+    return true;
+      EXHAUSTIVE_LIST
+#undef _
+#define _(x, b, n, v)       \
+  case it_##x:              \
+    *bits = b;              \
+    *inputs = n;            \
+    *lanes = (v) * 8 / (b); \
+    *pairwise = true;       \
+    return true;
+      EXHAUSTIVE_PAIRWISE_LIST
+#undef _
+      default:
+        return false;
+    }
+  }
+
+  virtual uint64_t exhaustive_batches(INSTRUCTION_TEST test, bool wide) {
+    uint32_t bits, inputs, lanes;
+    bool pairwise;
+    if (!exhaustive_shape(test, &bits, &inputs, &lanes, &pairwise)) {
+      return 0;
+    }
+    // a pair slot holds both operands, so pairwise sweeps cover every pair
+    uint32_t operand_bits = bits * (pairwise ? 2 : inputs);
+    if (operand_bits >= 32 && !wide) {
+      return 0;
+    }
+    uint64_t cases = 1ULL << operand_bits;
+    uint32_t per_batch = pairwise ? inputs * lanes / 2 : lanes;
+    return (cases + per_batch - 1) / per_batch;
+  }
+
+  virtual result_t run_exhaustive(INSTRUCTION_TEST test, uint64_t first, uint64_t last) {
+    uint32_t bits, inputs, lanes;
+    bool pairwise;
+    if (!exhaustive_shape(test, &bits, &inputs, &lanes, &pairwise)) {
+      return TEST_UNIMPL;
+    }
+    uint64_t mask = (1ULL << bits) - 1;
+    uint32_t per_batch = pairwise ? inputs * lanes / 2 : lanes;
+    load_test_float_pointers(0);
+    load_test_int_pointers(0);
+    for (uint64_t k = first; k < last; k++) {
+      for (uint32_t j = 0; j < per_batch; j++) {
+        uint64_t p = k * per_batch + j;
+        // case j goes to lane j of both inputs, or for pairwise intrinsics to
+        // pair slot j of the first input and then of the second
+        int32_t *lo = test_cases_int_pointer1;
+        int32_t *hi = test_cases_int_pointer2;
+        uint32_t lo_lane = j;
+        uint32_t hi_lane = j;
+        if (pairwise) {
+          lo = hi = j < lanes / 2 ? test_cases_int_pointer1 : test_cases_int_pointer2;
+          lo_lane = 2 * (j % (lanes / 2));
+          hi_lane = lo_lane + 1;
+        }
+        if (bits == 8) {
+          ((uint8_t *)lo)[lo_lane] = (uint8_t)(p & mask);
+          ((uint8_t *)hi)[hi_lane] = (uint8_t)((p >> bits) & mask);
+        } else {
+          ((uint16_t *)lo)[lo_lane] = (uint16_t)(p & mask);
+          ((uint16_t *)hi)[hi_lane] = (uint16_t)((p >> bits) & mask);
+        }
+      }
+      // iter 0 keeps tests such as vclz from reshaping their inputs.
+      result_t ret = run_single_test(test, 0);
+      if (ret == TEST_FAIL) {
+        printf("Test %s failed on exhaustive batch %llu\n", instruction_string[test], (unsigned long long)k);
+      }
+      if (ret != TEST_SUCCESS) {
+        return ret;
+      }
+    }
+    return TEST_SUCCESS;
+  }
 };
 
 NEON2RVV_TEST *NEON2RVV_TEST::create(void) {
@@ -1925,53 +2081,399 @@ result_t test_vqaddd_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vuqadd_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vuqadd_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  int8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int8x8_t a = vld1_s8(_a);
+  uint8x8_t b = vld1_u8(_b);
+  int8x8_t c = vuqadd_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqaddq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  int8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int8x16_t a = vld1q_s8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  int8x16_t c = vuqaddq_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqadd_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int16x4_t a = vld1_s16(_a);
+  uint16x4_t b = vld1_u16(_b);
+  int16x4_t c = vuqadd_s16(a, b);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqaddq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int16x8_t a = vld1q_s16(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  int16x8_t c = vuqaddq_s16(a, b);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqadd_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int32x2_t a = vld1_s32(_a);
+  uint32x2_t b = vld1_u32(_b);
+  int32x2_t c = vuqadd_s32(a, b);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqaddq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int32x4_t a = vld1q_s32(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  int32x4_t c = vuqaddq_s32(a, b);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqadd_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  int64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int64x1_t a = vld1_s64(_a);
+  uint64x1_t b = vld1_u64(_b);
+  int64x1_t c = vuqadd_s64(a, b);
+  return validate_int64(c, _c[0]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqaddq_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = sat_uqadd(_a[i], _b[i]);
+  }
+
+  int64x2_t a = vld1q_s64(_a);
+  uint64x2_t b = vld1q_u64(_b);
+  int64x2_t c = vuqaddq_s64(a, b);
+  return validate_int64(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqaddb_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  int8_t _c = sat_uqadd(_a[0], _b[0]);
+
+  int8_t c = vuqaddb_s8(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqaddh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  int16_t _c = sat_uqadd(_a[0], _b[0]);
+
+  int16_t c = vuqaddh_s16(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqadds_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  int32_t _c = sat_uqadd(_a[0], _b[0]);
+
+  int32_t c = vuqadds_s32(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vuqaddd_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  int64_t _c = sat_uqadd(_a[0], _b[0]);
+
+  int64_t c = vuqaddd_s64(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vsqadd_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (const int8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vuqaddq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint8x8_t a = vld1_u8(_a);
+  int8x8_t b = vld1_s8(_b);
+  uint8x8_t c = vsqadd_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vuqadd_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqaddq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (const int8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vuqaddq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint8x16_t a = vld1q_u8(_a);
+  int8x16_t b = vld1q_s8(_b);
+  uint8x16_t c = vsqaddq_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vuqadd_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqadd_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  uint16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vuqaddq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint16x4_t a = vld1_u16(_a);
+  int16x4_t b = vld1_s16(_b);
+  uint16x4_t c = vsqadd_u16(a, b);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vuqadd_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqaddq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  uint16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vuqaddq_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint16x8_t a = vld1q_u16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  uint16x8_t c = vsqaddq_u16(a, b);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vuqaddb_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqadd_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vuqaddh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32x2_t a = vld1_u32(_a);
+  int32x2_t b = vld1_s32(_b);
+  uint32x2_t c = vsqadd_u32(a, b);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vuqadds_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqaddq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vuqaddd_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32x4_t a = vld1q_u32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  uint32x4_t c = vsqaddq_u32(a, b);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsqadd_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqadd_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const int64_t *_b = (const int64_t *)impl.test_cases_int_pointer2;
+  uint64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vsqaddq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint64x1_t a = vld1_u64(_a);
+  int64x1_t b = vld1_s64(_b);
+  uint64x1_t c = vsqadd_u64(a, b);
+  return validate_uint64(c, _c[0]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsqadd_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqaddq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const int64_t *_b = (const int64_t *)impl.test_cases_int_pointer2;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = sat_sqadd(_a[i], _b[i]);
+  }
 
-result_t test_vsqaddq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint64x2_t a = vld1q_u64(_a);
+  int64x2_t b = vld1q_s64(_b);
+  uint64x2_t c = vsqaddq_u64(a, b);
+  return validate_uint64(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsqadd_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqaddb_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (const int8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c = sat_sqadd(_a[0], _b[0]);
 
-result_t test_vsqaddq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint8_t c = vsqaddb_u8(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsqadd_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqaddh_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  uint16_t _c = sat_sqadd(_a[0], _b[0]);
 
-result_t test_vsqaddq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint16_t c = vsqaddh_u16(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsqaddb_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqadds_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = sat_sqadd(_a[0], _b[0]);
 
-result_t test_vsqaddh_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32_t c = vsqadds_u32(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsqadds_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vsqaddd_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const int64_t *_b = (const int64_t *)impl.test_cases_int_pointer2;
+  uint64_t _c = sat_sqadd(_a[0], _b[0]);
 
-result_t test_vsqaddd_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint64_t c = vsqaddd_u64(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vaddhn_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -2712,6 +3214,7 @@ result_t test_vmulx_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   float32x2_t c = vmulx_f32(a, b);
   CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
+#if NEON2RVV_STRICT_VMULX
   _a[0] = INFINITY;
   _b[0] = 0;
   _a[1] = 0;
@@ -2727,7 +3230,9 @@ result_t test_vmulx_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   a = vld1_f32(_a);
   b = vld1_f32(_b);
   c = vmulx_f32(a, b);
-  return validate_float(c, _c[0], _c[1]);
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
+#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -2751,6 +3256,7 @@ result_t test_vmulxq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   float32x4_t c = vmulxq_f32(a, b);
   CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
+#if NEON2RVV_STRICT_VMULX
   _a[0] = INFINITY;
   _b[0] = 0;
   _a[1] = 0;
@@ -2766,7 +3272,9 @@ result_t test_vmulxq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   a = vld1q_f32(_a);
   b = vld1q_f32(_b);
   c = vmulxq_f32(a, b);
-  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
+#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -2790,6 +3298,7 @@ result_t test_vmulx_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   float64x1_t c = vmulx_f64(a, b);
   CHECK_RESULT(validate_double(c, _c[0]))
 
+#if NEON2RVV_STRICT_VMULX
   _a[0] = INFINITY;
   _b[0] = 0;
   _a[1] = 0;
@@ -2805,7 +3314,9 @@ result_t test_vmulx_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   a = vld1_f64(_a);
   b = vld1_f64(_b);
   c = vmulx_f64(a, b);
-  return validate_double(c, _c[0]);
+  CHECK_RESULT(validate_double(c, _c[0]))
+#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -2829,6 +3340,7 @@ result_t test_vmulxq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   float64x2_t c = vmulxq_f64(a, b);
   CHECK_RESULT(validate_double(c, _c[0], _c[1]))
 
+#if NEON2RVV_STRICT_VMULX
   _a[0] = INFINITY;
   _b[0] = 0;
   _a[1] = 0;
@@ -2844,7 +3356,9 @@ result_t test_vmulxq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   a = vld1q_f64(_a);
   b = vld1q_f64(_b);
   c = vmulxq_f64(a, b);
-  return validate_double(c, _c[0], _c[1]);
+  CHECK_RESULT(validate_double(c, _c[0], _c[1]))
+#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3478,9 +3992,6 @@ result_t test_vqrdmulhs_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlah_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
@@ -3494,7 +4005,6 @@ result_t test_vqrdmlah_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int16x4_t c = vld1_s16(_c);
   int16x4_t d = vqrdmlah_s16(a, b, c);
   return validate_int16(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3502,9 +4012,6 @@ result_t test_vqrdmlah_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlah_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
@@ -3518,7 +4025,6 @@ result_t test_vqrdmlah_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int32x2_t c = vld1_s32(_c);
   int32x2_t d = vqrdmlah_s32(a, b, c);
   return validate_int32(d, _d[0], _d[1]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3526,9 +4032,6 @@ result_t test_vqrdmlah_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlahq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
@@ -3542,7 +4045,6 @@ result_t test_vqrdmlahq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int16x8_t c = vld1q_s16(_c);
   int16x8_t d = vqrdmlahq_s16(a, b, c);
   return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3550,9 +4052,6 @@ result_t test_vqrdmlahq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlahq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
@@ -3566,7 +4065,6 @@ result_t test_vqrdmlahq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int32x4_t c = vld1q_s32(_c);
   int32x4_t d = vqrdmlahq_s32(a, b, c);
   return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3574,9 +4072,6 @@ result_t test_vqrdmlahq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlsh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
@@ -3590,7 +4085,6 @@ result_t test_vqrdmlsh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int16x4_t c = vld1_s16(_c);
   int16x4_t d = vqrdmlsh_s16(a, b, c);
   return validate_int16(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3598,9 +4092,6 @@ result_t test_vqrdmlsh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlsh_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
@@ -3614,7 +4105,6 @@ result_t test_vqrdmlsh_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int32x2_t c = vld1_s32(_c);
   int32x2_t d = vqrdmlsh_s32(a, b, c);
   return validate_int32(d, _d[0], _d[1]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3622,9 +4112,6 @@ result_t test_vqrdmlsh_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlshq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
@@ -3638,7 +4125,6 @@ result_t test_vqrdmlshq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int16x8_t c = vld1q_s16(_c);
   int16x8_t d = vqrdmlshq_s16(a, b, c);
   return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -3646,9 +4132,6 @@ result_t test_vqrdmlshq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlshq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
@@ -3662,7 +4145,6 @@ result_t test_vqrdmlshq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   int32x4_t c = vld1q_s32(_c);
   int32x4_t d = vqrdmlshq_s32(a, b, c);
   return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -16227,14 +16709,11 @@ result_t test_vaddvq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 result_t test_vaddv_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = (float *)impl.test_cases_float_pointer1;
-  float _c = 0;
-  for (int i = 0; i < 2; i++) {
-    _c += _a[i];
-  }
+  float _c = _a[0] + _a[1];
 
   float32x2_t a = vld1_f32(_a);
   float c = vaddv_f32(a);
-  return validate_float_error(c, _c, 0.0001f);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -16243,14 +16722,15 @@ result_t test_vaddv_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 result_t test_vaddvq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = (float *)impl.test_cases_float_pointer1;
-  float _c = 0;
-  for (int i = 0; i < 4; i++) {
-    _c += _a[i];
-  }
+  float _c = (_a[0] + _a[1]) + (_a[2] + _a[3]);
 
   float32x4_t a = vld1q_f32(_a);
   float c = vaddvq_f32(a);
+#if NEON2RVV_STRICT_REDUCTION
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
   return validate_float_error(c, _c, 0.001f);
+#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -16259,14 +16739,11 @@ result_t test_vaddvq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 result_t test_vaddvq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const double *_a = (double *)impl.test_cases_float_pointer1;
-  double _c = 0;
-  for (int i = 0; i < 2; i++) {
-    _c += _a[i];
-  }
+  double _c = _a[0] + _a[1];
 
   float64x2_t a = vld1q_f64(_a);
   double c = vaddvq_f64(a);
-  return validate_double_error(c, _c, 0.0001f);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -18735,20 +19212,21 @@ result_t test_vqshlq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
   int64_t *_b = (int64_t *)impl.test_cases_int_pointer2;
+  // also cover shift counts of 64 and beyond
   for (int i = 0; i < 2; i++) {
-    _b[i] = _b[i] % 8;
+    _b[i] = _b[i] % 72;
   }
   uint64_t _c[2];
   for (int i = 0; i < 2; i++) {
     if (_b[i] < 0) {
-      uint64_t b_neg = -_b[i];
-      _c[i] = _a[i] >> b_neg;
+      int64_t b_neg = -_b[i];
+      _c[i] = b_neg >= 64 ? 0 : _a[i] >> b_neg;
+    } else if (_b[i] >= 64) {
+      _c[i] = _a[i] == 0 ? 0 : UINT64_MAX;
+    } else if ((UINT64_MAX >> _b[i]) < _a[i]) {
+      _c[i] = UINT64_MAX;
     } else {
-      if ((UINT64_MAX >> _b[i]) < _a[i]) {
-        _c[i] = UINT64_MAX;
-      } else {
-        _c[i] = (uint64_t)_a[i] << _b[i];
-      }
+      _c[i] = (uint64_t)_a[i] << _b[i];
     }
   }
   uint64x2_t a = vld1q_u64(_a);
@@ -19124,7 +19602,32 @@ result_t test_vqrshl_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrshl_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrshl_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  int64_t *_b = (int64_t *)impl.test_cases_int_pointer2;
+  for (int i = 0; i < 1; i++) {
+    _b[i] = _b[i] % 64;
+  }
+  uint64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    if (_b[i] < 0) {
+      uint64_t b_neg = (uint64_t)(-_b[i]);
+      _c[i] = (uint64_t)(((unsigned __int128)_a[i] + (((unsigned __int128)1) << (b_neg - 1))) >> b_neg);
+    } else if ((UINT64_MAX >> _b[i]) < _a[i]) {
+      _c[i] = UINT64_MAX;
+    } else {
+      _c[i] = _a[i] << _b[i];
+    }
+  }
+  uint64x1_t a = vld1_u64(_a);
+  int64x1_t b = vld1_s64(_b);
+  uint64x1_t c = vqrshl_u64(a, b);
+  return validate_uint64(c, _c[0]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vqrshlq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -19199,7 +19702,40 @@ result_t test_vqrshlq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrshlq_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrshlq_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  int64_t *_b = (int64_t *)impl.test_cases_int_pointer2;
+  // also cover shift counts of 64 and beyond
+  for (int i = 0; i < 2; i++) {
+    _b[i] = _b[i] % 72;
+  }
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    if (_b[i] < 0) {
+      uint64_t b_neg = (uint64_t)(-_b[i]);
+      _c[i] = (int64_t)(((__int128)_a[i] + (((__int128)1) << (b_neg - 1))) >> b_neg);
+    } else if (_b[i] >= 64) {
+      _c[i] = _a[i] > 0 ? INT64_MAX : (_a[i] < 0 ? INT64_MIN : 0);
+    } else {
+      __int128 shifted = ((__int128)_a[i]) << _b[i];
+      if (shifted > INT64_MAX) {
+        _c[i] = INT64_MAX;
+      } else if (shifted < INT64_MIN) {
+        _c[i] = INT64_MIN;
+      } else {
+        _c[i] = (int64_t)shifted;
+      }
+    }
+  }
+  int64x2_t a = vld1q_s64(_a);
+  int64x2_t b = vld1q_s64(_b);
+  int64x2_t c = vqrshlq_s64(a, b);
+  return validate_int64(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vqrshlq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -19274,7 +19810,35 @@ result_t test_vqrshlq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrshlq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrshlq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  int64_t *_b = (int64_t *)impl.test_cases_int_pointer2;
+  // also cover shift counts of 64 and beyond
+  for (int i = 0; i < 2; i++) {
+    _b[i] = _b[i] % 72;
+  }
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    if (_b[i] < 0) {
+      uint64_t b_neg = (uint64_t)(-_b[i]);
+      _c[i] = (uint64_t)(((unsigned __int128)_a[i] + (((unsigned __int128)1) << (b_neg - 1))) >> b_neg);
+    } else if (_b[i] >= 64) {
+      _c[i] = _a[i] == 0 ? 0 : UINT64_MAX;
+    } else if ((UINT64_MAX >> _b[i]) < _a[i]) {
+      _c[i] = UINT64_MAX;
+    } else {
+      _c[i] = _a[i] << _b[i];
+    }
+  }
+  uint64x2_t a = vld1q_u64(_a);
+  int64x2_t b = vld1q_s64(_b);
+  uint64x2_t c = vqrshlq_u64(a, b);
+  return validate_uint64(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vqrshlb_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -26669,29 +27233,319 @@ result_t test_vmvn_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TE
 
 result_t test_vmvnq_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcls_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcls_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  int8_t _in[8];
+  int8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _in[i] = (int8_t)((int8_t)_a[i] >> (iter % 8));
+    int sign = (_in[i] >> 7) & 0x1;
+    int sum = 0;
+    for (int j = 6; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vcls_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int8x8_t a = vld1_s8(_in);
+  int8x8_t c = vcls_s8(a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcls_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcls_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  int16_t _in[4];
+  int16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (int16_t)((int16_t)_a[i] >> (iter % 16));
+    int sign = (_in[i] >> 15) & 0x1;
+    int sum = 0;
+    for (int j = 14; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vclsq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int16x4_t a = vld1_s16(_in);
+  int16x4_t c = vcls_s16(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclsq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcls_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  int32_t _in[2];
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _in[i] = (int32_t)((int32_t)_a[i] >> (iter % 32));
+    int sign = (_in[i] >> 31) & 0x1;
+    int sum = 0;
+    for (int j = 30; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  int32x2_t a = vld1_s32(_in);
+  int32x2_t c = vcls_s32(a);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclsq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  int8_t _in[16];
+  int8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _in[i] = (int8_t)((int8_t)_a[i] >> (iter % 8));
+    int sign = (_in[i] >> 7) & 0x1;
+    int sum = 0;
+    for (int j = 6; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  int8x16_t a = vld1q_s8(_in);
+  int8x16_t c = vclsq_s8(a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclsq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  int16_t _in[8];
+  int16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _in[i] = (int16_t)((int16_t)_a[i] >> (iter % 16));
+    int sign = (_in[i] >> 15) & 0x1;
+    int sum = 0;
+    for (int j = 14; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  int16x8_t a = vld1q_s16(_in);
+  int16x8_t c = vclsq_s16(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclsq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  int32_t _in[4];
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (int32_t)((int32_t)_a[i] >> (iter % 32));
+    int sign = (_in[i] >> 31) & 0x1;
+    int sum = 0;
+    for (int j = 30; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  int32x4_t a = vld1q_s32(_in);
+  int32x4_t c = vclsq_s32(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcls_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _in[8];
+  int8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _in[i] = (uint8_t)((int8_t)_a[i] >> (iter % 8));
+    int sign = (_in[i] >> 7) & 0x1;
+    int sum = 0;
+    for (int j = 6; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  uint8x8_t a = vld1_u8(_in);
+  int8x8_t c = vcls_u8(a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclsq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclsq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _in[16];
+  int8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _in[i] = (uint8_t)((int8_t)_a[i] >> (iter % 8));
+    int sign = (_in[i] >> 7) & 0x1;
+    int sum = 0;
+    for (int j = 6; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vcls_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint8x16_t a = vld1q_u8(_in);
+  int8x16_t c = vclsq_u8(a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclsq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcls_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  uint16_t _in[4];
+  int16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (uint16_t)((int16_t)_a[i] >> (iter % 16));
+    int sign = (_in[i] >> 15) & 0x1;
+    int sum = 0;
+    for (int j = 14; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vcls_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint16x4_t a = vld1_u16(_in);
+  int16x4_t c = vcls_u16(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclsq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclsq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  uint16_t _in[8];
+  int16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _in[i] = (uint16_t)((int16_t)_a[i] >> (iter % 16));
+    int sign = (_in[i] >> 15) & 0x1;
+    int sum = 0;
+    for (int j = 14; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  uint16x8_t a = vld1q_u16(_in);
+  int16x8_t c = vclsq_u16(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcls_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _in[2];
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _in[i] = (uint32_t)((int32_t)_a[i] >> (iter % 32));
+    int sign = (_in[i] >> 31) & 0x1;
+    int sum = 0;
+    for (int j = 30; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  uint32x2_t a = vld1_u32(_in);
+  int32x2_t c = vcls_u32(a);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcls_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclsq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _in[4];
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (uint32_t)((int32_t)_a[i] >> (iter % 32));
+    int sign = (_in[i] >> 31) & 0x1;
+    int sum = 0;
+    for (int j = 30; j > -1; j--) {
+      if (((_in[i] >> j) & 0x1) != sign) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vclsq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32x4_t a = vld1q_u32(_in);
+  int32x4_t c = vclsq_u32(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vclz_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -26716,27 +27570,282 @@ result_t test_vclz_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vclz_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclz_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  int16_t _in[4];
+  int16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (int16_t)((uint16_t)_a[i] >> (iter % 16));
+    int sum = 0;
+    for (int j = 15; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  int16x4_t a = vld1_s16(_in);
+  int16x4_t c = vclz_s16(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclz_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  int32_t _in[2];
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _in[i] = (int32_t)((uint32_t)_a[i] >> (iter % 32));
+    int sum = 0;
+    for (int j = 31; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  int32x2_t a = vld1_s32(_in);
+  int32x2_t c = vclz_s32(a);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclz_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _in[8];
+  uint8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _in[i] = (uint8_t)(_a[i] >> (iter % 8));
+    int sum = 0;
+    for (int j = 7; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  uint8x8_t a = vld1_u8(_in);
+  uint8x8_t c = vclz_u8(a);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclz_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  uint16_t _in[4];
+  uint16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (uint16_t)(_a[i] >> (iter % 16));
+    int sum = 0;
+    for (int j = 15; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  uint16x4_t a = vld1_u16(_in);
+  uint16x4_t c = vclz_u16(a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclz_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _in[2];
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _in[i] = (uint32_t)(_a[i] >> (iter % 32));
+    int sum = 0;
+    for (int j = 31; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  uint32x2_t a = vld1_u32(_in);
+  uint32x2_t c = vclz_u32(a);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vclzq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  int8_t _in[16];
+  int8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _in[i] = (int8_t)((uint8_t)_a[i] >> (iter % 8));
+    int sum = 0;
+    for (int j = 7; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vclz_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int8x16_t a = vld1q_s8(_in);
+  int8x16_t c = vclzq_s8(a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclz_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclzq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  int16_t _in[8];
+  int16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _in[i] = (int16_t)((uint16_t)_a[i] >> (iter % 16));
+    int sum = 0;
+    for (int j = 15; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
+
+  int16x8_t a = vld1q_s16(_in);
+  int16x8_t c = vclzq_s16(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclz_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclzq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  int32_t _in[4];
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (int32_t)((uint32_t)_a[i] >> (iter % 32));
+    int sum = 0;
+    for (int j = 31; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vclz_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int32x4_t a = vld1q_s32(_in);
+  int32x4_t c = vclzq_s32(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclzq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclzq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _in[16];
+  uint8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _in[i] = (uint8_t)(_a[i] >> (iter % 8));
+    int sum = 0;
+    for (int j = 7; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vclzq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint8x16_t a = vld1q_u8(_in);
+  uint8x16_t c = vclzq_u8(a);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclzq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclzq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  uint16_t _in[8];
+  uint16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _in[i] = (uint16_t)(_a[i] >> (iter % 16));
+    int sum = 0;
+    for (int j = 15; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vclzq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint16x8_t a = vld1q_u16(_in);
+  uint16x8_t c = vclzq_u16(a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclzq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclzq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _in[4];
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _in[i] = (uint32_t)(_a[i] >> (iter % 32));
+    int sum = 0;
+    for (int j = 31; j > -1; j--) {
+      if ((_in[i] >> j) & 0x1) {
+        break;
+      }
+      sum++;
+    }
+    _c[i] = sum;
+  }
 
-result_t test_vclzq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32x4_t a = vld1q_u32(_in);
+  uint32x4_t c = vclzq_u32(a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vcnt_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -26816,12 +27925,12 @@ result_t test_vrecpe_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = impl.test_cases_float_pointer1;
   float _c[2];
-  _c[0] = 1.0f / _a[0];
-  _c[1] = 1.0f / _a[1];
+  _c[0] = recip_estimate_float(_a[0]);
+  _c[1] = recip_estimate_float(_a[1]);
 
   float32x2_t a = vld1_f32(_a);
   float32x2_t c = vrecpe_f32(a);
-  return validate_float_error(c, _c[0], _c[1], 0.01f);
+  return validate_float_estimate(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -26878,7 +27987,7 @@ result_t test_vrecpe_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   // print_u32_64("_a", _a);
   // print_u32_64("_c", _c);
   // print_u32_64("-c", c);
-  return validate_uint32(c, _c[0], _c[1]);
+  return validate_uint32_estimate(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -26889,12 +27998,12 @@ result_t test_vrecpeq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
   const float *_a = impl.test_cases_float_pointer1;
   float _c[4];
   for (int i = 0; i < 4; i++) {
-    _c[i] = 1.0f / _a[i];
+    _c[i] = recip_estimate_float(_a[i]);
   }
 
   float32x4_t a = vld1q_f32(_a);
   float32x4_t c = vrecpeq_f32(a);
-  return validate_float_error(c, _c[0], _c[1], _c[2], _c[3], 0.01f);
+  return validate_float_estimate(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -26904,11 +28013,11 @@ result_t test_vrecpe_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const double *_a = (const double *)impl.test_cases_float_pointer1;
   double _c[1];
-  _c[0] = 1.0f / _a[0];
+  _c[0] = recip_estimate_double(_a[0]);
 
   float64x1_t a = vld1_f64(_a);
   float64x1_t c = vrecpe_f64(a);
-  return validate_double_error(c, _c[0], 0.01f);
+  return validate_double_estimate(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -26918,12 +28027,12 @@ result_t test_vrecpeq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const double *_a = (const double *)impl.test_cases_float_pointer1;
   double _c[2];
-  _c[0] = 1.0f / _a[0];
-  _c[1] = 1.0f / _a[1];
+  _c[0] = recip_estimate_double(_a[0]);
+  _c[1] = recip_estimate_double(_a[1]);
 
   float64x2_t a = vld1q_f64(_a);
   float64x2_t c = vrecpeq_f64(a);
-  return validate_double_error(c, _c[0], _c[1], 0.01f);
+  return validate_double_estimate(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -26933,10 +28042,10 @@ result_t test_vrecpes_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = impl.test_cases_float_pointer1;
   float _c, c;
-  _c = 1.0f / _a[0];
+  _c = recip_estimate_float(_a[0]);
 
   c = vrecpes_f32(_a[0]);
-  return validate_float_error(c, _c, 0.01f);
+  return validate_float_estimate(c, _c);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -26946,10 +28055,10 @@ result_t test_vrecped_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const double *_a = (const double *)impl.test_cases_float_pointer1;
   double _c, c;
-  _c = 1.0f / _a[0];
+  _c = recip_estimate_double(_a[0]);
 
   c = vrecped_f64(_a[0]);
-  return validate_double_error(c, _c, 0.01f);
+  return validate_double_estimate(c, _c);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -26979,30 +28088,44 @@ result_t test_vrsqrte_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = impl.test_cases_float_pointer1;
   float _c[2];
-  _c[0] = 1 / sqrtf(_a[0]);
-  _c[1] = 1 / sqrtf(_a[1]);
+  _c[0] = rsqrt_estimate_float(_a[0]);
+  _c[1] = rsqrt_estimate_float(_a[1]);
 
   float32x2_t a = vld1_f32(_a);
   float32x2_t c = vrsqrte_f32(a);
-  return validate_float_error(c, _c[0], _c[1], 0.01f);
+  return validate_float_estimate(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vrsqrte_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vrsqrte_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = rsqrt_estimate_uint32(_a[i]);
+  }
+
+  uint32x2_t a = vld1_u32(_a);
+  uint32x2_t c = vrsqrte_u32(a);
+  return validate_uint32_estimate(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vrsqrteq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = impl.test_cases_float_pointer1;
   float _c[4];
   for (int i = 0; i < 4; i++) {
-    _c[i] = 1 / sqrtf(_a[i]);
+    _c[i] = rsqrt_estimate_float(_a[i]);
   }
 
   float32x4_t a = vld1q_f32(_a);
   float32x4_t c = vrsqrteq_f32(a);
-  return validate_float_error(c, _c[0], _c[1], _c[2], _c[3], 0.01f);
+  return validate_float_estimate(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -27012,11 +28135,11 @@ result_t test_vrsqrte_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const double *_a = (const double *)impl.test_cases_float_pointer1;
   double _c[1];
-  _c[0] = 1 / sqrt(_a[0]);
+  _c[0] = rsqrt_estimate_double(_a[0]);
 
   float64x1_t a = vld1_f64(_a);
   float64x1_t c = vrsqrte_f64(a);
-  return validate_double_error(c, _c[0], 0.01f);
+  return validate_double_estimate(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -27026,12 +28149,12 @@ result_t test_vrsqrteq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const double *_a = (const double *)impl.test_cases_float_pointer1;
   double _c[2];
-  _c[0] = 1 / sqrt(_a[0]);
-  _c[1] = 1 / sqrt(_a[1]);
+  _c[0] = rsqrt_estimate_double(_a[0]);
+  _c[1] = rsqrt_estimate_double(_a[1]);
 
   float64x2_t a = vld1q_f64(_a);
   float64x2_t c = vrsqrteq_f64(a);
-  return validate_double_error(c, _c[0], _c[1], 0.01f);
+  return validate_double_estimate(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -27041,10 +28164,10 @@ result_t test_vrsqrtes_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = impl.test_cases_float_pointer1;
   float _c, c;
-  _c = 1 / sqrtf(_a[0]);
+  _c = rsqrt_estimate_float(_a[0]);
 
   c = vrsqrtes_f32(_a[0]);
-  return validate_float_error(c, _c, 0.01f);
+  return validate_float_estimate(c, _c);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -27054,16 +28177,30 @@ result_t test_vrsqrted_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const double *_a = (const double *)impl.test_cases_float_pointer1;
   double _c, c;
-  _c = 1 / sqrt(_a[0]);
+  _c = rsqrt_estimate_double(_a[0]);
 
   c = vrsqrted_f64(_a[0]);
-  return validate_double_error(c, _c, 0.01f);
+  return validate_double_estimate(c, _c);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vrsqrteq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vrsqrteq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = rsqrt_estimate_uint32(_a[i]);
+  }
+
+  uint32x4_t a = vld1q_u32(_a);
+  uint32x4_t c = vrsqrteq_u32(a);
+  return validate_uint32_estimate(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vget_lane_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -30697,57 +31834,497 @@ result_t test_vcvtq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vcvtn_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtn_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = bankers_rounding(_a[i]);
+    _c[i] = (int32_t)r;
+  }
 
-result_t test_vcvtnq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t a = vld1_f32(_a);
+  int32x2_t c = vcvtn_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtn_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtnq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = bankers_rounding(_a[i]);
+    _c[i] = (int32_t)r;
+  }
 
-result_t test_vcvtnq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t a = vld1q_f32(_a);
+  int32x4_t c = vcvtnq_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtm_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtn_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = bankers_rounding(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
 
-result_t test_vcvtmq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t a = vld1_f32(_a);
+  uint32x2_t c = vcvtn_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvtnq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = bankers_rounding(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
+
+  float32x4_t a = vld1q_f32(_a);
+  uint32x4_t c = vcvtnq_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvtm_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = floor(_a[i]);
+    _c[i] = (int32_t)r;
+  }
+
+  float32x2_t a = vld1_f32(_a);
+  int32x2_t c = vcvtm_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvtmq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = floor(_a[i]);
+    _c[i] = (int32_t)r;
+  }
 
-result_t test_vcvtm_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t a = vld1q_f32(_a);
+  int32x4_t c = vcvtmq_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvtm_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = floor(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
+
+  float32x2_t a = vld1_f32(_a);
+  uint32x2_t c = vcvtm_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtmq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtmq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = floor(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
 
-result_t test_vcvtp_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t a = vld1q_f32(_a);
+  uint32x4_t c = vcvtmq_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtpq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtp_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = ceil(_a[i]);
+    _c[i] = (int32_t)r;
+  }
 
-result_t test_vcvtp_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t a = vld1_f32(_a);
+  int32x2_t c = vcvtp_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtpq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtpq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = ceil(_a[i]);
+    _c[i] = (int32_t)r;
+  }
 
-result_t test_vcvta_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t a = vld1q_f32(_a);
+  int32x4_t c = vcvtpq_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtaq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtp_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = ceil(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
 
-result_t test_vcvta_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t a = vld1_f32(_a);
+  uint32x2_t c = vcvtp_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtaq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtpq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = ceil(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
+
+  float32x4_t a = vld1q_f32(_a);
+  uint32x4_t c = vcvtpq_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvta_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = round(_a[i]);
+    _c[i] = (int32_t)r;
+  }
+
+  float32x2_t a = vld1_f32(_a);
+  int32x2_t c = vcvta_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvtaq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = round(_a[i]);
+    _c[i] = (int32_t)r;
+  }
+
+  float32x4_t a = vld1q_f32(_a);
+  int32x4_t c = vcvtaq_s32_f32(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvta_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    float r = round(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
+
+  float32x2_t a = vld1_f32(_a);
+  uint32x2_t c = vcvta_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vcvtaq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_f = impl.test_cases_float_pointer1;
+  float _a[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (float)(int32_t)_a[0] + 0.5;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    float r = round(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint32_t)r;
+  }
+
+  float32x4_t a = vld1q_f32(_a);
+  uint32x4_t c = vcvtaq_u32_f32(a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vcvts_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
 result_t test_vcvts_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcvtns_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtns_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = bankers_rounding(a);
+  int32_t _c = (int32_t)r;
+  int32_t c = vcvtns_s32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtns_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtns_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = bankers_rounding(a);
+  uint32_t _c = r < 0 ? 0 : (uint32_t)r;
+  uint32_t c = vcvtns_u32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtms_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtms_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = floor(a);
+  int32_t _c = (int32_t)r;
+  int32_t c = vcvtms_s32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtms_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtms_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = floor(a);
+  uint32_t _c = r < 0 ? 0 : (uint32_t)r;
+  uint32_t c = vcvtms_u32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtps_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtps_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = ceil(a);
+  int32_t _c = (int32_t)r;
+  int32_t c = vcvtps_s32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtps_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtps_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = ceil(a);
+  uint32_t _c = r < 0 ? 0 : (uint32_t)r;
+  uint32_t c = vcvtps_u32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtas_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtas_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = round(a);
+  int32_t _c = (int32_t)r;
+  int32_t c = vcvtas_s32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtas_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtas_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  float a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (float)(int32_t)a + 0.5;
+  }
+  float r = round(a);
+  uint32_t _c = r < 0 ? 0 : (uint32_t)r;
+  uint32_t c = vcvtas_u32_f32(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vcvt_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
@@ -30813,3156 +32390,2861 @@ result_t test_vcvtq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vcvtn_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtnq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtn_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtnq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtm_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtmq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtm_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtmq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtp_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtpq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtp_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtpq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvta_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtaq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvta_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtaq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtn_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (const double *)impl.test_cases_float_pointer1;
-  int64_t _c, c;
-  _c = _a[0];
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = bankers_rounding(_a[i]);
+    _c[i] = (int64_t)r;
+  }
 
-  c = vcvtd_s64_f64(_a[0]);
-  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+  float64x1_t a = vld1_f64(_a);
+  int64x1_t c = vcvtn_s64_f64(a);
+  return validate_int64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vcvtd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtnq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (const double *)impl.test_cases_float_pointer1;
-  uint64_t _c, c;
-  _c = _a[0];
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = bankers_rounding(_a[i]);
+    _c[i] = (int64_t)r;
+  }
 
-  c = vcvtd_u64_f64(_a[0]);
-  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+  float64x2_t a = vld1q_f64(_a);
+  int64x2_t c = vcvtnq_s64_f64(a);
+  return validate_int64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vcvtnd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtnd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtmd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtmd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtpd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtpd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtad_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtad_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_n_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtn_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (const float *)impl.test_cases_float_pointer1;
-  int32_t _c[2];
-  float32x2_t a = vld1_f32(_a);
-  int32x2_t c;
-
-#define TEST_IMPL(IDX)                  \
-  for (int i = 0; i < 2; i++) {         \
-    _c[i] = _a[i] * powf(2, (IDX + 1)); \
-  }                                     \
-  c = vcvt_n_s32_f32(a, (IDX + 1));     \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
-
-  IMM_32_ITER
-#undef TEST_IMPL
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
+  }
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = bankers_rounding(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
 
-  return TEST_SUCCESS;
+  float64x1_t a = vld1_f64(_a);
+  uint64x1_t c = vcvtn_u64_f64(a);
+  return validate_uint64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vcvt_n_f32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_n_f32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_n_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_f32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_f32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvts_n_f32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvts_n_f32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_n_f64_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_f64_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_n_f64_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_f64_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtd_n_f64_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtd_n_f64_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_f16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_high_f16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_high_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_f32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_high_f32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_f64_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_high_f64_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtx_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtxd_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtx_high_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvts_n_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvts_n_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_n_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvt_n_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtq_n_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtd_n_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcvtd_n_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vmovn_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtnq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  int8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _a[i] & UINT8_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
   }
-  int16x8_t a = vld1q_s16(_a);
-  int8x8_t c = vmovn_s16(a);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = bankers_rounding(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
+
+  float64x2_t a = vld1q_f64(_a);
+  uint64x2_t c = vcvtnq_u64_f64(a);
+  return validate_uint64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtm_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  int16_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _a[i] & UINT16_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
-  int32x4_t a = vld1q_s32(_a);
-  int16x4_t c = vmovn_s32(a);
-  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = floor(_a[i]);
+    _c[i] = (int64_t)r;
+  }
+
+  float64x1_t a = vld1_f64(_a);
+  int64x1_t c = vcvtm_s64_f64(a);
+  return validate_int64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtmq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  int32_t _c[2];
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
   for (int i = 0; i < 2; i++) {
-    _c[i] = _a[i] & UINT32_MAX;
+    _a[i] = _f[i];
   }
-  int64x2_t a = vld1q_s64(_a);
-  int32x2_t c = vmovn_s64(a);
-  return validate_int32(c, _c[0], _c[1]);
-#else
-  return TEST_UNIMPL;
-#endif  // ENABLE_TEST_ALL
-}
-
-result_t test_vmovn_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  uint8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _a[i] & UINT8_MAX;
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = floor(_a[i]);
+    _c[i] = (int64_t)r;
   }
-  uint16x8_t a = vld1q_u16(_a);
-  uint8x8_t c = vmovn_u16(a);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+
+  float64x2_t a = vld1q_f64(_a);
+  int64x2_t c = vcvtmq_s64_f64(a);
+  return validate_int64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtm_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  uint16_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _a[i] & UINT16_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x4_t c = vmovn_u32(a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = floor(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
+
+  float64x1_t a = vld1_f64(_a);
+  uint64x1_t c = vcvtm_u64_f64(a);
+  return validate_uint64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtmq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  uint32_t _c[2];
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
   for (int i = 0; i < 2; i++) {
-    _c[i] = _a[i] & UINT32_MAX;
+    _a[i] = _f[i];
   }
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x2_t c = vmovn_u64(a);
-  return validate_uint32(c, _c[0], _c[1]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = floor(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
+
+  float64x2_t a = vld1q_f64(_a);
+  uint64x2_t c = vcvtmq_u64_f64(a);
+  return validate_uint64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtp_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_r = (int8_t *)impl.test_cases_int_pointer1;
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  int8_t _c[16];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _r[i];
-    _c[i + 8] = _a[i] & UINT8_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
-  int8x8_t r = vld1_s8(_r);
-  int16x8_t a = vld1q_s16(_a);
-  int8x16_t c = vmovn_high_s16(r, a);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                       _c[13], _c[14], _c[15]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = ceil(_a[i]);
+    _c[i] = (int64_t)r;
+  }
+
+  float64x1_t a = vld1_f64(_a);
+  int64x1_t c = vcvtp_s64_f64(a);
+  return validate_int64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtpq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_r = (int16_t *)impl.test_cases_int_pointer1;
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  int16_t _c[8];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _r[i];
-    _c[i + 4] = _a[i] & UINT16_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
   }
-  int16x4_t r = vld1_s16(_r);
-  int32x4_t a = vld1q_s32(_a);
-  int16x8_t c = vmovn_high_s32(r, a);
-  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = ceil(_a[i]);
+    _c[i] = (int64_t)r;
+  }
+
+  float64x2_t a = vld1q_f64(_a);
+  int64x2_t c = vcvtpq_s64_f64(a);
+  return validate_int64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_high_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtp_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer1;
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  int32_t _c[4];
-  for (int i = 0; i < 2; i++) {
-    _c[i] = _r[i];
-    _c[i + 2] = _a[i] & UINT32_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
-  int32x2_t r = vld1_s32(_r);
-  int64x2_t a = vld1q_s64(_a);
-  int32x4_t c = vmovn_high_s64(r, a);
-  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = ceil(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
+
+  float64x1_t a = vld1_f64(_a);
+  uint64x1_t c = vcvtp_u64_f64(a);
+  return validate_uint64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_high_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtpq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_r = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  uint8_t _c[16];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _r[i];
-    _c[i + 8] = _a[i] & UINT8_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
   }
-  uint8x8_t r = vld1_u8(_r);
-  uint16x8_t a = vld1q_u16(_a);
-  uint8x16_t c = vmovn_high_u16(r, a);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                        _c[13], _c[14], _c[15]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = ceil(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
+
+  float64x2_t a = vld1q_f64(_a);
+  uint64x2_t c = vcvtpq_u64_f64(a);
+  return validate_uint64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_high_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvta_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_r = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  uint16_t _c[8];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _r[i];
-    _c[i + 4] = _a[i] & UINT16_MAX;
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
-  uint16x4_t r = vld1_u16(_r);
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x8_t c = vmovn_high_u32(r, a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = round(_a[i]);
+    _c[i] = (int64_t)r;
+  }
+
+  float64x1_t a = vld1_f64(_a);
+  int64x1_t c = vcvta_s64_f64(a);
+  return validate_int64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovn_high_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtaq_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  uint32_t _c[4];
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
   for (int i = 0; i < 2; i++) {
-    _c[i] = _r[i];
-    _c[i + 2] = _a[i] & UINT32_MAX;
+    _a[i] = _f[i];
   }
-  uint32x2_t r = vld1_u32(_r);
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x4_t c = vmovn_high_u64(r, a);
-  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = round(_a[i]);
+    _c[i] = (int64_t)r;
+  }
+
+  float64x2_t a = vld1q_f64(_a);
+  int64x2_t c = vcvtaq_s64_f64(a);
+  return validate_int64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvta_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  int8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = saturate_int8(_a[i]);
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
-  int16x8_t a = vld1q_s16(_a);
-  int8x8_t c = vqmovn_s16(a);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[1];
+  for (int i = 0; i < 1; i++) {
+    double r = round(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
+
+  float64x1_t a = vld1_f64(_a);
+  uint64x1_t c = vcvta_u64_f64(a);
+  return validate_uint64(c, _c[0]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtaq_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  int16_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = saturate_int16(_a[i]);
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
   }
-  int32x4_t a = vld1q_s32(_a);
-  int16x4_t c = vqmovn_s32(a);
-  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
+  // make sure a tie is rounded
+  _a[0] = (double)(int64_t)_a[0] + 0.5;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    double r = round(_a[i]);
+    _c[i] = r < 0 ? 0 : (uint64_t)r;
+  }
+
+  float64x2_t a = vld1q_f64(_a);
+  uint64x2_t c = vcvtaq_u64_f64(a);
+  return validate_uint64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  int32_t _c[2];
-  for (int i = 0; i < 2; i++) {
-    _c[i] = saturate_int32(_a[i]);
-  }
-  int64x2_t a = vld1q_s64(_a);
-  int32x2_t c = vqmovn_s64(a);
-  return validate_int32(c, _c[0], _c[1]);
+  const double *_a = (const double *)impl.test_cases_float_pointer1;
+  int64_t _c, c;
+  _c = _a[0];
+
+  c = vcvtd_s64_f64(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  uint8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    if (_a[i] > UINT8_MAX) {
-      _c[i] = UINT8_MAX;
-    } else {
-      _c[i] = _a[i];
-    }
-  }
-  uint16x8_t a = vld1q_u16(_a);
-  uint8x8_t c = vqmovn_u16(a);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  const double *_a = (const double *)impl.test_cases_float_pointer1;
+  uint64_t _c, c;
+  _c = _a[0];
+
+  c = vcvtd_u64_f64(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtnd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  uint16_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    if (_a[i] > UINT16_MAX) {
-      _c[i] = UINT16_MAX;
-    } else {
-      _c[i] = _a[i];
-    }
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
   }
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x4_t c = vqmovn_u32(a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
+  double r = bankers_rounding(a);
+  int64_t _c = (int64_t)r;
+  int64_t c = vcvtnd_s64_f64(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtnd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  uint32_t _c[2];
-  for (int i = 0; i < 2; i++) {
-    if (_a[i] > UINT32_MAX) {
-      _c[i] = UINT32_MAX;
-    } else {
-      _c[i] = _a[i];
-    }
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
   }
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x2_t c = vqmovn_u64(a);
-  return validate_uint32(c, _c[0], _c[1]);
+  double r = bankers_rounding(a);
+  uint64_t _c = r < 0 ? 0 : (uint64_t)r;
+  uint64_t c = vcvtnd_u64_f64(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovnh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtmd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  int8_t _c = saturate_int8(_a[0]);
-  int8_t c = vqmovnh_s16(_a[0]);
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
+  }
+  double r = floor(a);
+  int64_t _c = (int64_t)r;
+  int64_t c = vcvtmd_s64_f64(a);
   return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovns_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtmd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  int16_t _c = saturate_int16(_a[0]);
-  int16_t c = vqmovns_s32(_a[0]);
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
+  }
+  double r = floor(a);
+  uint64_t _c = r < 0 ? 0 : (uint64_t)r;
+  uint64_t c = vcvtmd_u64_f64(a);
   return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovnd_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtpd_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  int32_t _c = saturate_int32(_a[0]);
-  int32_t c = vqmovnd_s64(_a[0]);
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
+  }
+  double r = ceil(a);
+  int64_t _c = (int64_t)r;
+  int64_t c = vcvtpd_s64_f64(a);
   return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovnh_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtpd_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  uint8_t _c;
-  for (int i = 0; i < 8; i++) {
-    if (_a[0] > UINT8_MAX) {
-      _c = UINT8_MAX;
-    } else {
-      _c = _a[0];
-    }
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
   }
-  uint8_t c = vqmovnh_u16(_a[0]);
+  double r = ceil(a);
+  uint64_t _c = r < 0 ? 0 : (uint64_t)r;
+  uint64_t c = vcvtpd_u64_f64(a);
   return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovns_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtad_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  uint16_t _c;
-  for (int i = 0; i < 4; i++) {
-    if (_a[0] > UINT16_MAX) {
-      _c = UINT16_MAX;
-    } else {
-      _c = _a[0];
-    }
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
   }
-  uint16_t c = vqmovns_u32(_a[0]);
+  double r = round(a);
+  int64_t _c = (int64_t)r;
+  int64_t c = vcvtad_s64_f64(a);
   return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovnd_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtad_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  uint32_t _c;
-  for (int i = 0; i < 2; i++) {
-    if (_a[0] > UINT32_MAX) {
-      _c = UINT32_MAX;
-    } else {
-      _c = _a[0];
-    }
+  double a = impl.test_cases_float_pointer1[0];
+  if (iter % 2) {
+    a = (double)(int64_t)a + 0.5;
   }
-  uint32_t c = vqmovnd_u64(_a[0]);
+  double r = round(a);
+  uint64_t _c = r < 0 ? 0 : (uint64_t)r;
+  uint64_t c = vcvtad_u64_f64(a);
   return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int8_t *_r = (int8_t *)impl.test_cases_int_pointer1;
-  int8_t _c[16];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _r[i];
-    _c[i + 8] = saturate_int8(_a[i]);
-  }
+  const float *_a = (const float *)impl.test_cases_float_pointer1;
+  int32_t _c[2];
+  float32x2_t a = vld1_f32(_a);
+  int32x2_t c;
 
-  int16x8_t a = vld1q_s16(_a);
-  int8x8_t r = vld1_s8(_r);
-  int8x16_t c = vqmovn_high_s16(r, a);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                       _c[13], _c[14], _c[15]);
+#define TEST_IMPL(IDX)                  \
+  for (int i = 0; i < 2; i++) {         \
+    _c[i] = _a[i] * powf(2, (IDX + 1)); \
+  }                                     \
+  c = vcvt_n_s32_f32(a, (IDX + 1));     \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_f32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_r = (int16_t *)impl.test_cases_int_pointer1;
-  int16_t _c[8];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _r[i];
-    _c[i + 4] = saturate_int16(_a[i]);
-  }
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  float _c[2];
+  int32x2_t a = vld1_s32(_a);
+  float32x2_t c;
 
-  int32x4_t a = vld1q_s32(_a);
-  int16x4_t r = vld1_s16(_r);
-  int16x8_t c = vqmovn_high_s32(r, a);
-  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#define TEST_IMPL(IDX)                      \
+  for (int i = 0; i < 2; i++) {             \
+    _c[i] = (float)_a[i] / pow(2, IDX + 1); \
+  }                                         \
+  c = vcvt_n_f32_s32(a, IDX + 1);           \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_high_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_f32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer1;
-  int32_t _c[4];
-  for (int i = 0; i < 2; i++) {
-    _c[i] = _r[i];
-    _c[i + 2] = saturate_int32(_a[i]);
-  }
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  float _c[2];
+  uint32x2_t a = vld1_u32(_a);
+  float32x2_t c;
 
-  int64x2_t a = vld1q_s64(_a);
-  int32x2_t r = vld1_s32(_r);
-  int32x4_t c = vqmovn_high_s64(r, a);
-  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
-#else
-  return TEST_UNIMPL;
-#endif  // ENABLE_TEST_ALL
-}
+#define TEST_IMPL(IDX)                      \
+  for (int i = 0; i < 2; i++) {             \
+    _c[i] = (float)_a[i] / pow(2, IDX + 1); \
+  }                                         \
+  c = vcvt_n_f32_u32(a, IDX + 1);           \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
-result_t test_vqmovn_high_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_r = (uint8_t *)impl.test_cases_int_pointer1;
-  uint8_t _c[16];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _r[i];
-    if (_a[i] > UINT8_MAX) {
-      _c[i + 8] = UINT8_MAX;
-    } else {
-      _c[i + 8] = _a[i];
-    }
-  }
+  IMM_32_ITER
+#undef TEST_IMPL
 
-  uint16x8_t a = vld1q_u16(_a);
-  uint8x8_t r = vld1_u8(_r);
-  uint8x16_t c = vqmovn_high_u16(r, a);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                        _c[13], _c[14], _c[15]);
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_high_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_r = (uint16_t *)impl.test_cases_int_pointer1;
-  uint16_t _c[8];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _r[i];
-    if (_a[i] > UINT16_MAX) {
-      _c[i + 4] = UINT16_MAX;
-    } else {
-      _c[i + 4] = _a[i];
-    }
-  }
+  const float *_a = impl.test_cases_float_pointer1;
+  uint32_t _c[2];
+  float32x2_t a = vld1_f32(_a);
+  uint32x2_t c;
 
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x4_t r = vld1_u16(_r);
-  uint16x8_t c = vqmovn_high_u32(r, a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#define TEST_IMPL(IDX)                                      \
+  for (int i = 0; i < 2; i++) {                             \
+    _c[i] = convert_to_uint32_sat(_a[i] * pow(2, IDX + 1)); \
+  }                                                         \
+  c = vcvt_n_u32_f32(a, IDX + 1);                           \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1]))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovn_high_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer1;
-  uint32_t _c[4];
-  for (int i = 0; i < 2; i++) {
-    _c[i] = _r[i];
-    if (_a[i] > UINT32_MAX) {
-      _c[i + 2] = UINT32_MAX;
-    } else {
-      _c[i + 2] = _a[i];
-    }
-  }
+  const float *_a = impl.test_cases_float_pointer1;
+  int32_t _c[4];
+  float32x4_t a = vld1q_f32(_a);
+  int32x4_t c;
 
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x2_t r = vld1_u32(_r);
-  uint32x4_t c = vqmovn_high_u64(r, a);
-  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 4; i++) {                            \
+    _c[i] = convert_to_int32_sat(_a[i] * pow(2, IDX + 1)); \
+  }                                                        \
+  c = vcvtq_n_s32_f32(a, IDX + 1);                         \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovun_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_f32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  int8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    if (_a[i] < 0) {
-      _c[i] = 0;
-    } else if (_a[i] > UINT8_MAX) {
-      _c[i] = UINT8_MAX;
-    } else {
-      _c[i] = _a[i];
-    }
-  }
-  int16x8_t a = vld1q_s16(_a);
-  uint8x8_t c = vqmovun_s16(a);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  float _c[4];
+  int32x4_t a = vld1q_s32(_a);
+  float32x4_t c;
+
+#define TEST_IMPL(IDX)                      \
+  for (int i = 0; i < 4; i++) {             \
+    _c[i] = (float)_a[i] / pow(2, IDX + 1); \
+  }                                         \
+  c = vcvtq_n_f32_s32(a, IDX + 1);          \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovun_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_f32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  int16_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    if (_a[i] < 0) {
-      _c[i] = 0;
-    } else if (_a[i] > UINT16_MAX) {
-      _c[i] = UINT16_MAX;
-    } else {
-      _c[i] = _a[i];
-    }
-  }
-  int32x4_t a = vld1q_s32(_a);
-  uint16x4_t c = vqmovun_s32(a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  float _c[4];
+  uint32x4_t a = vld1q_u32(_a);
+  float32x4_t c;
+
+#define TEST_IMPL(IDX)                      \
+  for (int i = 0; i < 4; i++) {             \
+    _c[i] = (float)_a[i] / pow(2, IDX + 1); \
+  }                                         \
+  c = vcvtq_n_f32_u32(a, IDX + 1);          \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovun_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvts_n_f32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  int32_t _c[2];
-  for (int i = 0; i < 2; i++) {
-    if (_a[i] < 0) {
-      _c[i] = 0;
-    } else if (_a[i] > UINT32_MAX) {
-      _c[i] = UINT32_MAX;
-    } else {
-      _c[i] = _a[i];
-    }
-  }
-  int64x2_t a = vld1q_s64(_a);
-  uint32x2_t c = vqmovun_s64(a);
-  return validate_uint32(c, _c[0], _c[1]);
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  float _c, c;
+
+#define TEST_IMPL(IDX)                 \
+  _c = (float)_a[0] / pow(2, IDX + 1); \
+  c = vcvts_n_f32_s32(_a[0], IDX + 1); \
+  CHECK_RESULT(validate_float_pair(c, _c))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovunh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvts_n_f32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  uint8_t _c, c;
-  if (_a[0] < 0) {
-    _c = 0;
-  } else if (_a[0] > UINT8_MAX) {
-    _c = UINT8_MAX;
-  } else {
-    _c = _a[0];
-  }
-  c = vqmovunh_s16(_a[0]);
-  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  float _c, c;
+
+#define TEST_IMPL(IDX)                 \
+  _c = (float)_a[0] / pow(2, IDX + 1); \
+  c = vcvts_n_f32_u32(_a[0], IDX + 1); \
+  CHECK_RESULT(validate_float_pair(c, _c))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovuns_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_f64_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  uint16_t _c, c;
-  if (_a[0] < 0) {
-    _c = 0;
-  } else if (_a[0] > UINT16_MAX) {
-    _c = UINT16_MAX;
-  } else {
-    _c = _a[0];
-  }
-  c = vqmovuns_s32(_a[0]);
-  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  double _c[1];
+  int64x1_t a = vld1_s64(_a);
+  float64x1_t c;
+
+#define TEST_IMPL(IDX)                       \
+  for (int i = 0; i < 1; i++) {              \
+    _c[i] = (double)_a[i] / pow(2, IDX + 1); \
+  }                                          \
+  c = vcvt_n_f64_s64(a, IDX + 1);            \
+  CHECK_RESULT(validate_double(c, _c[0]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovund_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_f64_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  uint32_t _c, c;
-  if (_a[0] < 0) {
-    _c = 0;
-  } else if (_a[0] > UINT32_MAX) {
-    _c = UINT32_MAX;
-  } else {
-    _c = _a[0];
-  }
-  c = vqmovund_s64(_a[0]);
-  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  double _c[2];
+  int64x2_t a = vld1q_s64(_a);
+  float64x2_t c;
+
+#define TEST_IMPL(IDX)                       \
+  for (int i = 0; i < 2; i++) {              \
+    _c[i] = (double)_a[i] / pow(2, IDX + 1); \
+  }                                          \
+  c = vcvtq_n_f64_s64(a, IDX + 1);           \
+  CHECK_RESULT(validate_double(c, _c[0], _c[1]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovun_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_f64_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_r = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _c[16];
-  for (int i = 0; i < 8; i++) {
-    if (_a[i] < 0) {
-      _c[i + 8] = 0;
-    } else if (_a[i] > UINT8_MAX) {
-      _c[i + 8] = UINT8_MAX;
-    } else {
-      _c[i + 8] = _a[i];
-    }
-    _c[i] = _r[i];
-  }
-  int16x8_t a = vld1q_s16(_a);
-  uint8x8_t r = vld1_u8(_r);
-  uint8x16_t c = vqmovun_high_s16(r, a);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                        _c[13], _c[14], _c[15]);
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  double _c[1];
+  uint64x1_t a = vld1_u64(_a);
+  float64x1_t c;
+
+#define TEST_IMPL(IDX)                       \
+  for (int i = 0; i < 1; i++) {              \
+    _c[i] = (double)_a[i] / pow(2, IDX + 1); \
+  }                                          \
+  c = vcvt_n_f64_u64(a, IDX + 1);            \
+  CHECK_RESULT(validate_double(c, _c[0]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovun_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_f64_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_r = (uint16_t *)impl.test_cases_int_pointer2;
-  uint16_t _c[8];
-  for (int i = 0; i < 4; i++) {
-    if (_a[i] < 0) {
-      _c[i + 4] = 0;
-    } else if (_a[i] > UINT16_MAX) {
-      _c[i + 4] = UINT16_MAX;
-    } else {
-      _c[i + 4] = _a[i];
-    }
-    _c[i] = _r[i];
-  }
-  int32x4_t a = vld1q_s32(_a);
-  uint16x4_t r = vld1_u16(_r);
-  uint16x8_t c = vqmovun_high_s32(r, a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  double _c[2];
+  uint64x2_t a = vld1q_u64(_a);
+  float64x2_t c;
+
+#define TEST_IMPL(IDX)                       \
+  for (int i = 0; i < 2; i++) {              \
+    _c[i] = (double)_a[i] / pow(2, IDX + 1); \
+  }                                          \
+  c = vcvtq_n_f64_u64(a, IDX + 1);           \
+  CHECK_RESULT(validate_double(c, _c[0], _c[1]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqmovun_high_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtd_n_f64_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer2;
-  uint32_t _c[4];
-  for (int i = 0; i < 2; i++) {
-    if (_a[i] < 0) {
-      _c[i + 2] = 0;
-    } else if (_a[i] > UINT32_MAX) {
-      _c[i + 2] = UINT32_MAX;
-    } else {
-      _c[i + 2] = _a[i];
-    }
-    _c[i] = _r[i];
-  }
-  int64x2_t a = vld1q_s64(_a);
-  uint32x2_t r = vld1_u32(_r);
-  uint32x4_t c = vqmovun_high_s64(r, a);
-  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  double _c, c;
+
+#define TEST_IMPL(IDX)                  \
+  _c = (double)_a[0] / pow(2, IDX + 1); \
+  c = vcvtd_n_f64_s64(_a[0], IDX + 1);  \
+  CHECK_RESULT(validate_double_pair(c, _c))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtd_n_f64_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  int16_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _a[i];
-  }
-  int8x8_t a = vld1_s8(_a);
-  int16x8_t c = vmovl_s8(a);
-  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  double _c, c;
+
+#define TEST_IMPL(IDX)                  \
+  _c = (double)_a[0] / pow(2, IDX + 1); \
+  c = vcvtd_n_f64_u64(_a[0], IDX + 1);  \
+  CHECK_RESULT(validate_double_pair(c, _c))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_f16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_high_f16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  int32_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _a[i];
+  const float *_f = (float *)impl.test_cases_float_pointer1;
+  double _a[2];
+  float _c[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = (double)_f[i] / 3;
+    _c[i] = (float)_a[i];
   }
-  int16x4_t a = vld1_s16(_a);
-  int32x4_t c = vmovl_s16(a);
-  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+  float64x2_t a = vld1q_f64(_a);
+  float32x2_t c = vcvt_f32_f64(a);
+  return validate_float(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_high_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  int64_t _c[2];
+  const float *_r = (float *)impl.test_cases_float_pointer1;
+  const float *_f = (float *)impl.test_cases_float_pointer2;
+  double _a[2];
+  float _c[4];
   for (int i = 0; i < 2; i++) {
-    _c[i] = _a[i];
+    _a[i] = (double)_f[i] / 3;
+    _c[i] = _r[i];
+    _c[i + 2] = (float)_a[i];
   }
-  int32x2_t a = vld1_s32(_a);
-  int64x2_t c = vmovl_s32(a);
-  return validate_int64(c, _c[0], _c[1]);
+  float32x2_t r = vld1_f32(_r);
+  float64x2_t a = vld1q_f64(_a);
+  float32x4_t c = vcvt_high_f32_f64(r, a);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_f32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_high_f32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_f64_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  uint16_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _a[i];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  double _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = (double)_a[i];
   }
-  uint8x8_t a = vld1_u8(_a);
-  uint16x8_t c = vmovl_u8(a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  float32x2_t a = vld1_f32(_a);
+  float64x2_t c = vcvt_f64_f32(a);
+  return validate_double(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_high_f64_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  uint32_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _a[i];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  double _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = (double)_a[i + 2];
   }
-  uint16x4_t a = vld1_u16(_a);
-  uint32x4_t c = vmovl_u16(a);
-  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+  float32x4_t a = vld1q_f32(_a);
+  float64x2_t c = vcvt_high_f64_f32(a);
+  return validate_double(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtx_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  uint64_t _c[2];
+  const float *_f = (float *)impl.test_cases_float_pointer1;
+  double _a[2];
+  float _c[2];
   for (int i = 0; i < 2; i++) {
-    _c[i] = _a[i];
+    _a[i] = (double)_f[i] / 3;
+    _c[i] = round_to_odd(_a[i]);
   }
-  uint32x2_t a = vld1_u32(_a);
-  uint64x2_t c = vmovl_u32(a);
-  return validate_uint64(c, _c[0], _c[1]);
+  float64x2_t a = vld1q_f64(_a);
+  float32x2_t c = vcvtx_f32_f64(a);
+  return validate_float(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_high_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtxd_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  int16_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _a[i + 8];
-  }
-  int8x16_t a = vld1q_s8(_a);
-  int16x8_t c = vmovl_high_s8(a);
-  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  double a = (double)impl.test_cases_float_pointer1[0] / 3;
+  float _c = round_to_odd(a);
+  float c = vcvtxd_f32_f64(a);
+  return validate_float_pair(c, _c);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtx_high_f32_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  int32_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _a[i + 4];
+  const float *_r = (float *)impl.test_cases_float_pointer1;
+  const float *_f = (float *)impl.test_cases_float_pointer2;
+  double _a[2];
+  float _c[4];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = (double)_f[i] / 3;
+    _c[i] = _r[i];
+    _c[i + 2] = round_to_odd(_a[i]);
   }
-  int16x8_t a = vld1q_s16(_a);
-  int32x4_t c = vmovl_high_s16(a);
-  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
+  float32x2_t r = vld1_f32(_r);
+  float64x2_t a = vld1q_f64(_a);
+  float32x4_t c = vcvtx_high_f32_f64(r, a);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  int64_t _c[2];
-  for (int i = 0; i < 2; i++) {
-    _c[i] = _a[i + 2];
-  }
-  int32x4_t a = vld1q_s32(_a);
-  int64x2_t c = vmovl_high_s32(a);
-  return validate_int64(c, _c[0], _c[1]);
+  const float *_a = impl.test_cases_float_pointer1;
+  uint32_t _c[4];
+  float32x4_t a = vld1q_f32(_a);
+  uint32x4_t c;
+
+#define TEST_IMPL(IDX)                                      \
+  for (int i = 0; i < 4; i++) {                             \
+    _c[i] = convert_to_uint32_sat(_a[i] * pow(2, IDX + 1)); \
+  }                                                         \
+  c = vcvtq_n_u32_f32(a, IDX + 1);                          \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_high_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvts_n_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  uint16_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = _a[i + 8];
-  }
-  uint8x16_t a = vld1q_u8(_a);
-  uint16x8_t c = vmovl_high_u8(a);
-  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  const float _a = impl.test_cases_float_pointer1[0];
+  int32_t _c, c;
+
+#define TEST_IMPL(IDX)                             \
+  _c = convert_to_int32_sat(_a * pow(2, IDX + 1)); \
+  c = vcvts_n_s32_f32(_a, IDX + 1);                \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_high_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvts_n_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  uint32_t _c[4];
-  for (int i = 0; i < 4; i++) {
-    _c[i] = _a[i + 4];
-  }
-  uint16x8_t a = vld1q_u16(_a);
-  uint32x4_t c = vmovl_high_u16(a);
-  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+  const float _a = impl.test_cases_float_pointer1[0];
+  uint32_t _c, c;
+
+#define TEST_IMPL(IDX)                              \
+  _c = convert_to_uint32_sat(_a * pow(2, IDX + 1)); \
+  c = vcvts_n_u32_f32(_a, IDX + 1);                 \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+
+  IMM_32_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmovl_high_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  uint64_t _c[2];
-  for (int i = 0; i < 2; i++) {
-    _c[i] = _a[i + 2];
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
-  uint32x4_t a = vld1q_u32(_a);
-  uint64x2_t c = vmovl_high_u32(a);
-  return validate_uint64(c, _c[0], _c[1]);
+  int64_t _c[1];
+  float64x1_t a = vld1_f64(_a);
+  int64x1_t c;
+
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 1; i++) {                            \
+    _c[i] = convert_to_int64_sat(_a[i] * pow(2, IDX + 1)); \
+  }                                                        \
+  c = vcvt_n_s64_f64(a, IDX + 1);                          \
+  CHECK_RESULT(validate_int64(c, _c[0]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
-  int8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    if (_b[i] > 7 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a[_b[i]];
-    }
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
   }
+  int64_t _c[2];
+  float64x2_t a = vld1q_f64(_a);
+  int64x2_t c;
 
-  int8x8_t a = vld1_s8(_a);
-  int8x8_t b = vld1_s8(_b);
-  int8x8_t c = vtbl1_s8(a, b);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 2; i++) {                            \
+    _c[i] = convert_to_int64_sat(_a[i] * pow(2, IDX + 1)); \
+  }                                                        \
+  c = vcvtq_n_s64_f64(a, IDX + 1);                         \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvt_n_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    if (_b[i] > 7 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a[_b[i]];
-    }
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[1];
+  for (int i = 0; i < 1; i++) {
+    _a[i] = _f[i];
   }
+  uint64_t _c[1];
+  float64x1_t a = vld1_f64(_a);
+  uint64x1_t c;
 
-  uint8x8_t a = vld1_u8(_a);
-  uint8x8_t b = vld1_u8(_b);
-  uint8x8_t c = vtbl1_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#define TEST_IMPL(IDX)                                      \
+  for (int i = 0; i < 1; i++) {                             \
+    _c[i] = convert_to_uint64_sat(_a[i] * pow(2, IDX + 1)); \
+  }                                                         \
+  c = vcvt_n_u64_f64(a, IDX + 1);                           \
+  CHECK_RESULT(validate_uint64(c, _c[0]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vtbl2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtq_n_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
-  int8_t _a2[16];
-  int8_t _c[16];
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _a2[i] = _a[2 * i];
-    _a2[i + 8] = _a[2 * i + 1];
+  const float *_f = impl.test_cases_float_pointer1;
+  double _a[2];
+  for (int i = 0; i < 2; i++) {
+    _a[i] = _f[i];
   }
+  uint64_t _c[2];
+  float64x2_t a = vld1q_f64(_a);
+  uint64x2_t c;
 
-  for (int i = 0; i < 8; i++) {
-    if (_b[i] > 15 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a2[_b[i]];
-    }
-  }
-  int8x8x2_t a = vld2_s8(_a);
-  int8x8_t b = vld1_s8(_b);
-  int8x8_t c = vtbl2_s8(a, b);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+#define TEST_IMPL(IDX)                                      \
+  for (int i = 0; i < 2; i++) {                             \
+    _c[i] = convert_to_uint64_sat(_a[i] * pow(2, IDX + 1)); \
+  }                                                         \
+  c = vcvtq_n_u64_f64(a, IDX + 1);                          \
+  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vcvtd_n_s64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _a2[16];
-  uint8_t _c[8];
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _a2[i] = _a[2 * i];
-    _a2[i + 8] = _a[2 * i + 1];
-  }
+  const double _a = impl.test_cases_float_pointer1[0];
+  int64_t _c, c;
 
-  for (int i = 0; i < 8; i++) {
-    if (_b[i] > 15 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a2[_b[i]];
-    }
-  }
+#define TEST_IMPL(IDX)                             \
+  _c = convert_to_int64_sat(_a * pow(2, IDX + 1)); \
+  c = vcvtd_n_s64_f64(_a, IDX + 1);                \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-  uint8x8x2_t a = vld2_u8(_a);
-  uint8x8_t b = vld1_u8(_b);
-  uint8x8_t c = vtbl2_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtd_n_u64_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const double _a = impl.test_cases_float_pointer1[0];
+  uint64_t _c, c;
 
-result_t test_vtbl3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#define TEST_IMPL(IDX)                              \
+  _c = convert_to_uint64_sat(_a * pow(2, IDX + 1)); \
+  c = vcvtd_n_u64_f64(_a, IDX + 1);                 \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmovn_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer_huge;
-  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer3;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   int8_t _c[8];
   for (int i = 0; i < 8; i++) {
-    if (_b[i] > 23 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a[_b[i]];
-    }
+    _c[i] = _a[i] & UINT8_MAX;
   }
-
-  int8x8x3_t a = vld3_s8(_a);
-  int8x8_t b = vld1_s8(_b);
-  int8x8_t c = vtbl3_s8(a, b);
+  int16x8_t a = vld1q_s16(_a);
+  int8x8_t c = vmovn_s16(a);
   return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer3;
-  const size_t reg_elt_num = 8;
-  uint8_t _in_interleave[32];
-  uint8_t _a[24];
-  uint8_t _c[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _a[i] = _in_interleave[3 * i];
-    _a[i + 8] = _in_interleave[3 * i + 1];
-    _a[i + 16] = _in_interleave[3 * i + 2];
-  }
-  for (int i = 0; i < 8; i++) {
-    if (_b[i] > 23 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a[_b[i]];
-    }
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  int16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _a[i] & UINT16_MAX;
   }
-
-  uint8x8x3_t a = vld3_u8(_in_interleave);
-  uint8x8_t b = vld1_u8(_b);
-  uint8x8_t c = vtbl3_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  int32x4_t a = vld1q_s32(_a);
+  int16x4_t c = vmovn_s32(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vtbl4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer2;
-  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer3;
-  const size_t reg_elt_num = 8;
-  int8_t _in_interleave[32];
-  int8_t _a[32];
-  int8_t _c[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _a[i] = _in_interleave[4 * i];
-    _a[i + 8] = _in_interleave[4 * i + 1];
-    _a[i + 16] = _in_interleave[4 * i + 2];
-    _a[i + 24] = _in_interleave[4 * i + 3];
-  }
-  for (int i = 0; i < 8; i++) {
-    if (_b[i] > 31 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a[_b[i]];
-    }
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i] & UINT32_MAX;
   }
-
-  int8x8x4_t a = vld4_s8(_in_interleave);
-  int8x8_t b = vld1_s8(_b);
-  int8x8_t c = vtbl4_s8(a, b);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+  int64x2_t a = vld1q_s64(_a);
+  int32x2_t c = vmovn_s64(a);
+  return validate_int32(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer3;
-  const size_t reg_elt_num = 8;
-  uint8_t _in_interleave[32];
-  uint8_t _a[32];
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
   uint8_t _c[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _a[i] = _in_interleave[4 * i];
-    _a[i + 8] = _in_interleave[4 * i + 1];
-    _a[i + 16] = _in_interleave[4 * i + 2];
-    _a[i + 24] = _in_interleave[4 * i + 3];
-  }
   for (int i = 0; i < 8; i++) {
-    if (_b[i] > 31 || _b[i] < 0) {
-      _c[i] = 0;
-    } else {
-      _c[i] = _a[_b[i]];
-    }
+    _c[i] = _a[i] & UINT8_MAX;
   }
-
-  uint8x8x4_t a = vld4_u8(_in_interleave);
-  uint8x8_t b = vld1_u8(_b);
-  uint8x8_t c = vtbl4_u8(a, b);
+  uint16x8_t a = vld1q_u16(_a);
+  uint8x8_t c = vmovn_u16(a);
   return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbl4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vtbx1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
-  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer3;
-  int8_t _d[8];
-  for (int i = 0; i < 8; i++) {
-    if (_c[i] > 7 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  uint16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _a[i] & UINT16_MAX;
   }
-
-  int8x8_t a = vld1_s8(_a);
-  int8x8_t b = vld1_s8(_b);
-  int8x8_t c = vld1_s8(_c);
-  int8x8_t d = vtbx1_s8(a, b, c);
-  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x4_t c = vmovn_u32(a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer3;
-  uint8_t _d[8];
-  for (int i = 0; i < 8; i++) {
-    if (_c[i] > 7 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i] & UINT32_MAX;
   }
-
-  uint8x8_t a = vld1_u8(_a);
-  uint8x8_t b = vld1_u8(_b);
-  uint8x8_t c = vld1_u8(_c);
-  uint8x8_t d = vtbx1_u8(a, b, c);
-  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x2_t c = vmovn_u64(a);
+  return validate_uint32(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vtbx2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer2;
-  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer3;
-  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer4;
-  const size_t reg_elt_num = 8;
-  int8_t _in_interleave[32];
-  int8_t _b[16];
-  int8_t _d[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _b[i] = _in_interleave[2 * i];
-    _b[i + 8] = _in_interleave[2 * i + 1];
-  }
+  const int8_t *_r = (int8_t *)impl.test_cases_int_pointer1;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  int8_t _c[16];
   for (int i = 0; i < 8; i++) {
-    if (_c[i] > 15 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
+    _c[i] = _r[i];
+    _c[i + 8] = _a[i] & UINT8_MAX;
   }
-
-  int8x8_t a = vld1_s8(_a);
-  int8x8x2_t b = vld2_s8(_in_interleave);
-  int8x8_t c = vld1_s8(_c);
-  int8x8_t d = vtbx2_s8(a, b, c);
-  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  int8x8_t r = vld1_s8(_r);
+  int16x8_t a = vld1q_s16(_a);
+  int8x16_t c = vmovn_high_s16(r, a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer3;
-  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer4;
-  const size_t reg_elt_num = 8;
-  uint8_t _in_interleave[32];
-  uint8_t _b[16];
-  uint8_t _d[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _b[i] = _in_interleave[2 * i];
-    _b[i + 8] = _in_interleave[2 * i + 1];
-  }
-  for (int i = 0; i < 8; i++) {
-    if (_c[i] > 15 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
+  const int16_t *_r = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  int16_t _c[8];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i];
+    _c[i + 4] = _a[i] & UINT16_MAX;
   }
-
-  uint8x8_t a = vld1_u8(_a);
-  uint8x8x2_t b = vld2_u8(_in_interleave);
-  uint8x8_t c = vld1_u8(_c);
-  uint8x8_t d = vtbx2_u8(a, b, c);
-  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  int16x4_t r = vld1_s16(_r);
+  int32x4_t a = vld1q_s32(_a);
+  int16x8_t c = vmovn_high_s32(r, a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vtbx3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_high_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer2;
-  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer3;
-  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer4;
-  const size_t reg_elt_num = 8;
-  int8_t _in_interleave[32];
-  int8_t _b[24];
-  int8_t _d[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _b[i] = _in_interleave[3 * i];
-    _b[i + 8] = _in_interleave[3 * i + 1];
-    _b[i + 16] = _in_interleave[3 * i + 2];
-  }
-  for (int i = 0; i < 8; i++) {
-    if (_c[i] > 23 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
+  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  int32_t _c[4];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i];
+    _c[i + 2] = _a[i] & UINT32_MAX;
   }
-
-  int8x8_t a = vld1_s8(_a);
-  int8x8x3_t b = vld3_s8(_in_interleave);
-  int8x8_t c = vld1_s8(_c);
-  int8x8_t d = vtbx3_s8(a, b, c);
-  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  int32x2_t r = vld1_s32(_r);
+  int64x2_t a = vld1q_s64(_a);
+  int32x4_t c = vmovn_high_s64(r, a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_high_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer3;
-  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer4;
-  const size_t reg_elt_num = 8;
-  uint8_t _in_interleave[32];
-  uint8_t _b[24];
-  uint8_t _d[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _b[i] = _in_interleave[3 * i];
-    _b[i + 8] = _in_interleave[3 * i + 1];
-    _b[i + 16] = _in_interleave[3 * i + 2];
-  }
+  const uint8_t *_r = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  uint8_t _c[16];
   for (int i = 0; i < 8; i++) {
-    if (_c[i] > 23 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
+    _c[i] = _r[i];
+    _c[i + 8] = _a[i] & UINT8_MAX;
   }
-
-  uint8x8_t a = vld1_u8(_a);
-  uint8x8x3_t b = vld3_u8(_in_interleave);
-  uint8x8_t c = vld1_u8(_c);
-  uint8x8_t d = vtbx3_u8(a, b, c);
-  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  uint8x8_t r = vld1_u8(_r);
+  uint16x8_t a = vld1q_u16(_a);
+  uint8x16_t c = vmovn_high_u16(r, a);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vtbx4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_high_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer2;
-  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer3;
-  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer4;
-  const size_t reg_elt_num = 8;
-  int8_t _in_interleave[32];
-  int8_t _b[32];
-  int8_t _d[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _b[i] = _in_interleave[4 * i];
-    _b[i + 8] = _in_interleave[4 * i + 1];
-    _b[i + 16] = _in_interleave[4 * i + 2];
-    _b[i + 24] = _in_interleave[4 * i + 3];
+  const uint16_t *_r = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  uint16_t _c[8];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i];
+    _c[i + 4] = _a[i] & UINT16_MAX;
   }
-  for (int i = 0; i < 8; i++) {
-    if (_c[i] > 31 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
-  }
-
-  int8x8_t a = vld1_s8(_a);
-  int8x8x4_t b = vld4_s8(_in_interleave);
-  int8x8_t c = vld1_s8(_c);
-  int8x8_t d = vtbx4_s8(a, b, c);
-  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  uint16x4_t r = vld1_u16(_r);
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x8_t c = vmovn_high_u32(r, a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovn_high_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer3;
-  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer4;
-  const size_t reg_elt_num = 8;
-  uint8_t _in_interleave[32];
-  uint8_t _b[32];
-  uint8_t _d[8];
-  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
-  // organize input array
-  for (int i = 0; i < 8; i++) {
-    _b[i] = _in_interleave[4 * i];
-    _b[i + 8] = _in_interleave[4 * i + 1];
-    _b[i + 16] = _in_interleave[4 * i + 2];
-    _b[i + 24] = _in_interleave[4 * i + 3];
+  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[4];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i];
+    _c[i + 2] = _a[i] & UINT32_MAX;
   }
+  uint32x2_t r = vld1_u32(_r);
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x4_t c = vmovn_high_u64(r, a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vqmovn_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  int8_t _c[8];
   for (int i = 0; i < 8; i++) {
-    if (_c[i] > 31 || _c[i] < 0) {
-      _d[i] = _a[i];
-    } else {
-      _d[i] = _b[_c[i]];
-    }
+    _c[i] = saturate_int8(_a[i]);
   }
-
-  uint8x8_t a = vld1_u8(_a);
-  uint8x8x4_t b = vld4_u8(_in_interleave);
-  uint8x8_t c = vld1_u8(_c);
-  uint8x8_t d = vtbx4_u8(a, b, c);
-  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  int16x8_t a = vld1q_s16(_a);
+  int8x8_t c = vqmovn_s16(a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vtbx4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl1q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  int8_t _c[16];
-  for (int i = 0; i < 16; i++) {
-    _c[i] = (_b[i] < 16) ? _a[_b[i]] : 0;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  int16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = saturate_int16(_a[i]);
   }
+  int32x4_t a = vld1q_s32(_a);
+  int16x4_t c = vqmovn_s32(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-  int8x16_t a = vld1q_s8(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  int8x16_t c = vqtbl1q_s8(a, b);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                       _c[13], _c[14], _c[15]);
+result_t test_vqmovn_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = saturate_int32(_a[i]);
+  }
+  int64x2_t a = vld1q_s64(_a);
+  int32x2_t c = vqmovn_s64(a);
+  return validate_int32(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
   uint8_t _c[8];
   for (int i = 0; i < 8; i++) {
-    _c[i] = (_b[i] < 16) ? _a[_b[i]] : 0;
+    if (_a[i] > UINT8_MAX) {
+      _c[i] = UINT8_MAX;
+    } else {
+      _c[i] = _a[i];
+    }
   }
-
-  uint8x16_t a = vld1q_u8(_a);
-  uint8x8_t b = vld1_u8(_b);
-  uint8x8_t c = vqtbl1_u8(a, b);
+  uint16x8_t a = vld1q_u16(_a);
+  uint8x8_t c = vqmovn_u16(a);
   return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl1q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _c[16];
-  for (int i = 0; i < 16; i++) {
-    _c[i] = (_b[i] < 16) ? _a[_b[i]] : 0;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  uint16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    if (_a[i] > UINT16_MAX) {
+      _c[i] = UINT16_MAX;
+    } else {
+      _c[i] = _a[i];
+    }
   }
-
-  uint8x16_t a = vld1q_u8(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  uint8x16_t c = vqtbl1q_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                        _c[13], _c[14], _c[15]);
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x4_t c = vqmovn_u32(a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl1q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx1q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx1q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx1q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl2q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  int8_t _c[16];
-  for (int i = 0; i < 16; i++) {
-    _c[i] = (_b[i] < 32) ? _a[_b[i]] : 0;
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    if (_a[i] > UINT32_MAX) {
+      _c[i] = UINT32_MAX;
+    } else {
+      _c[i] = _a[i];
+    }
   }
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x2_t c = vqmovn_u64(a);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-  int8x16x2_t a = vld1q_s8_x2(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  int8x16_t c = vqtbl2q_s8(a, b);
-  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                       _c[13], _c[14], _c[15]);
+result_t test_vqmovnh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  int8_t _c = saturate_int8(_a[0]);
+  int8_t c = vqmovnh_s16(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovns_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _c[8];
-  for (int i = 0; i < 8; i++) {
-    _c[i] = (_b[i] < 32) ? _a[_b[i]] : 0;
-  }
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  int16_t _c = saturate_int16(_a[0]);
+  int16_t c = vqmovns_s32(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-  uint8x16x2_t a = vld1q_u8_x2(_a);
-  uint8x8_t b = vld1_u8(_b);
-  uint8x8_t c = vqtbl2_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
+result_t test_vqmovnd_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  int32_t _c = saturate_int32(_a[0]);
+  int32_t c = vqmovnd_s64(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl2q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovnh_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _c[16];
-  for (int i = 0; i < 16; i++) {
-    _c[i] = (_b[i] < 32) ? _a[_b[i]] : 0;
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  uint8_t _c;
+  for (int i = 0; i < 8; i++) {
+    if (_a[0] > UINT8_MAX) {
+      _c = UINT8_MAX;
+    } else {
+      _c = _a[0];
+    }
   }
-
-  uint8x16x2_t a = vld1q_u8_x2(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  uint8x16_t c = vqtbl2q_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                        _c[13], _c[14], _c[15]);
+  uint8_t c = vqmovnh_u16(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl2q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl3q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl3q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovns_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _c[16];
-  for (int i = 0; i < 16; i++) {
-    _c[i] = (_b[i] < 48) ? _a[_b[i]] : 0;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  uint16_t _c;
+  for (int i = 0; i < 4; i++) {
+    if (_a[0] > UINT16_MAX) {
+      _c = UINT16_MAX;
+    } else {
+      _c = _a[0];
+    }
   }
-
-  uint8x16x3_t a = vld1q_u8_x3(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  uint8x16_t c = vqtbl3q_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                        _c[13], _c[14], _c[15]);
+  uint16_t c = vqmovns_u32(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl3q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl4q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl4q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovnd_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  uint8_t _c[16];
-  for (int i = 0; i < 16; i++) {
-    _c[i] = (_b[i] < 64) ? _a[_b[i]] : 0;
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  uint32_t _c;
+  for (int i = 0; i < 2; i++) {
+    if (_a[0] > UINT32_MAX) {
+      _c = UINT32_MAX;
+    } else {
+      _c = _a[0];
+    }
   }
-
-  uint8x16x4_t a = vld1q_u8_x4(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  uint8x16_t c = vqtbl4q_u8(a, b);
-  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
-                        _c[13], _c[14], _c[15]);
+  uint32_t c = vqmovnd_u64(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqtbl4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbl4q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx2q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx2q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx2q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx3q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx3q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx3q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx4q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx4q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqtbx4q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vmul_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t _c[4];
-  int16x4_t a = vld1_s16(_a);
-  int16x4_t b = vld1_s16(_b);
-  int16x4_t c;
-
-#define TEST_IMPL(IDX)          \
-  for (int i = 0; i < 4; i++) { \
-    _c[i] = _a[i] * _b[IDX];    \
-  }                             \
-  c = vmul_lane_s16(a, b, IDX); \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int8_t *_r = (int8_t *)impl.test_cases_int_pointer1;
+  int8_t _c[16];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = _r[i];
+    _c[i + 8] = saturate_int8(_a[i]);
+  }
 
+  int16x8_t a = vld1q_s16(_a);
+  int8x8_t r = vld1_s8(_r);
+  int8x16_t c = vqmovn_high_s16(r, a);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t _c[2];
-  int32x2_t a = vld1_s32(_a);
-  int32x2_t b = vld1_s32(_b);
-  int32x2_t c;
-
-#define TEST_IMPL(IDX)          \
-  for (int i = 0; i < 2; i++) { \
-    _c[i] = _a[i] * _b[IDX];    \
-  }                             \
-  c = vmul_lane_s32(a, b, IDX); \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int16_t *_r = (int16_t *)impl.test_cases_int_pointer1;
+  int16_t _c[8];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i];
+    _c[i + 4] = saturate_int16(_a[i]);
+  }
 
+  int32x4_t a = vld1q_s32(_a);
+  int16x4_t r = vld1_s16(_r);
+  int16x8_t c = vqmovn_high_s32(r, a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_high_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  float _c[2];
-  float32x2_t a = vld1_f32(_a);
-  float32x2_t b = vld1_f32(_b);
-  float32x2_t c;
-
-#define TEST_IMPL(IDX)          \
-  for (int i = 0; i < 2; i++) { \
-    _c[i] = _a[i] * _b[IDX];    \
-  }                             \
-  c = vmul_lane_f32(a, b, IDX); \
-  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer1;
+  int32_t _c[4];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i];
+    _c[i + 2] = saturate_int32(_a[i]);
+  }
 
-  return TEST_SUCCESS;
+  int64x2_t a = vld1q_s64(_a);
+  int32x2_t r = vld1_s32(_r);
+  int32x4_t c = vqmovn_high_s64(r, a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_high_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  uint16_t _c[4];
-  uint16x4_t a = vld1_u16(_a);
-  uint16x4_t b = vld1_u16(_b);
-  uint16x4_t c;
-
-#define TEST_IMPL(IDX)          \
-  for (int i = 0; i < 4; i++) { \
-    _c[i] = _a[i] * _b[IDX];    \
-  }                             \
-  c = vmul_lane_u16(a, b, IDX); \
-  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint8_t *_r = (uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _c[16];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = _r[i];
+    if (_a[i] > UINT8_MAX) {
+      _c[i + 8] = UINT8_MAX;
+    } else {
+      _c[i + 8] = _a[i];
+    }
+  }
 
+  uint16x8_t a = vld1q_u16(_a);
+  uint8x8_t r = vld1_u8(_r);
+  uint8x16_t c = vqmovn_high_u16(r, a);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_high_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  uint32_t _c[2];
-  uint32x2_t a = vld1_u32(_a);
-  uint32x2_t b = vld1_u32(_b);
-  uint32x2_t c;
-
-#define TEST_IMPL(IDX)          \
-  for (int i = 0; i < 2; i++) { \
-    _c[i] = _a[i] * _b[IDX];    \
-  }                             \
-  c = vmul_lane_u32(a, b, IDX); \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
+  const uint16_t *_r = (uint16_t *)impl.test_cases_int_pointer1;
+  uint16_t _c[8];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i];
+    if (_a[i] > UINT16_MAX) {
+      _c[i + 4] = UINT16_MAX;
+    } else {
+      _c[i + 4] = _a[i];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x4_t r = vld1_u16(_r);
+  uint16x8_t c = vqmovn_high_u32(r, a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovn_high_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t _c[8];
-  int16x8_t a = vld1q_s16(_a);
-  int16x4_t b = vld1_s16(_b);
-  int16x8_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 8; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmulq_lane_s16(a, b, IDX); \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[4];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i];
+    if (_a[i] > UINT32_MAX) {
+      _c[i + 2] = UINT32_MAX;
+    } else {
+      _c[i + 2] = _a[i];
+    }
+  }
 
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x2_t r = vld1_u32(_r);
+  uint32x4_t c = vqmovn_high_u64(r, a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovun_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t _c[4];
-  int32x4_t a = vld1q_s32(_a);
-  int32x2_t b = vld1_s32(_b);
-  int32x4_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 4; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmulq_lane_s32(a, b, IDX); \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
-
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  int8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    if (_a[i] < 0) {
+      _c[i] = 0;
+    } else if (_a[i] > UINT8_MAX) {
+      _c[i] = UINT8_MAX;
+    } else {
+      _c[i] = _a[i];
+    }
+  }
+  int16x8_t a = vld1q_s16(_a);
+  uint8x8_t c = vqmovun_s16(a);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovun_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  float _c[4];
-  float32x4_t a = vld1q_f32(_a);
-  float32x2_t b = vld1_f32(_b);
-  float32x4_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 4; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmulq_lane_f32(a, b, IDX); \
-  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  int16_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    if (_a[i] < 0) {
+      _c[i] = 0;
+    } else if (_a[i] > UINT16_MAX) {
+      _c[i] = UINT16_MAX;
+    } else {
+      _c[i] = _a[i];
+    }
+  }
+  int32x4_t a = vld1q_s32(_a);
+  uint16x4_t c = vqmovun_s32(a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_lane_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovun_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (double *)impl.test_cases_float_pointer1;
-  const double *_b = (double *)impl.test_cases_float_pointer2;
-  double _c[2];
-  float64x1_t a = vld1_f64(_a);
-  float64x1_t b = vld1_f64(_b);
-  float64x1_t c;
-
-  for (int i = 0; i < 1; i++) {
-    _c[i] = _a[i] * _b[0];
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  int32_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    if (_a[i] < 0) {
+      _c[i] = 0;
+    } else if (_a[i] > UINT32_MAX) {
+      _c[i] = UINT32_MAX;
+    } else {
+      _c[i] = _a[i];
+    }
   }
-  c = vmul_lane_f64(a, b, 0);
-  return validate_double(c, _c[0]);
-
-  return TEST_SUCCESS;
-
+  int64x2_t a = vld1q_s64(_a);
+  uint32x2_t c = vqmovun_s64(a);
+  return validate_uint32(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_lane_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovunh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (double *)impl.test_cases_float_pointer1;
-  const double *_b = (double *)impl.test_cases_float_pointer2;
-  double _c[4];
-  float64x2_t a = vld1q_f64(_a);
-  float64x1_t b = vld1_f64(_b);
-  float64x2_t c;
-
-  for (int i = 0; i < 2; i++) {
-    _c[i] = _a[i] * _b[0];
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  uint8_t _c, c;
+  if (_a[0] < 0) {
+    _c = 0;
+  } else if (_a[0] > UINT8_MAX) {
+    _c = UINT8_MAX;
+  } else {
+    _c = _a[0];
   }
-  c = vmulq_lane_f64(a, b, 0);
-  return validate_double(c, _c[0], _c[1]);
-
+  c = vqmovunh_s16(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmuls_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovuns_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  float _c, c;
-  float32x2_t b = vld1_f32(_b);
-
-#define TEST_IMPL(IDX)               \
-  _c = _a[0] * _b[IDX];              \
-  c = vmuls_lane_f32(_a[0], b, IDX); \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  uint16_t _c, c;
+  if (_a[0] < 0) {
+    _c = 0;
+  } else if (_a[0] > UINT16_MAX) {
+    _c = UINT16_MAX;
+  } else {
+    _c = _a[0];
+  }
+  c = vqmovuns_s32(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmuld_lane_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovund_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (double *)impl.test_cases_float_pointer1;
-  const double *_b = (double *)impl.test_cases_float_pointer2;
-  double _c, c;
-  float64x1_t b = vld1_f64(_b);
-
-  _c = _a[0] * _b[0];
-  c = vmuld_lane_f64(_a[0], b, 0);
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  uint32_t _c, c;
+  if (_a[0] < 0) {
+    _c = 0;
+  } else if (_a[0] > UINT32_MAX) {
+    _c = UINT32_MAX;
+  } else {
+    _c = _a[0];
+  }
+  c = vqmovund_s64(_a[0]);
   return c == _c ? TEST_SUCCESS : TEST_FAIL;
-
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovun_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t _c[4];
-  int16x4_t a = vld1_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x4_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 4; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmul_laneq_s16(a, b, IDX); \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_8_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint8_t *_r = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[16];
+  for (int i = 0; i < 8; i++) {
+    if (_a[i] < 0) {
+      _c[i + 8] = 0;
+    } else if (_a[i] > UINT8_MAX) {
+      _c[i + 8] = UINT8_MAX;
+    } else {
+      _c[i + 8] = _a[i];
+    }
+    _c[i] = _r[i];
+  }
+  int16x8_t a = vld1q_s16(_a);
+  uint8x8_t r = vld1_u8(_r);
+  uint8x16_t c = vqmovun_high_s16(r, a);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovun_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t _c[8];
-  int16x8_t a = vld1q_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x8_t c;
-
-#define TEST_IMPL(IDX)            \
-  for (int i = 0; i < 8; i++) {   \
-    _c[i] = _a[i] * _b[IDX];      \
-  }                               \
-  c = vmulq_laneq_s16(a, b, IDX); \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
-
-  IMM_8_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_r = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16_t _c[8];
+  for (int i = 0; i < 4; i++) {
+    if (_a[i] < 0) {
+      _c[i + 4] = 0;
+    } else if (_a[i] > UINT16_MAX) {
+      _c[i + 4] = UINT16_MAX;
+    } else {
+      _c[i + 4] = _a[i];
+    }
+    _c[i] = _r[i];
+  }
+  int32x4_t a = vld1q_s32(_a);
+  uint16x4_t r = vld1_u16(_r);
+  uint16x8_t c = vqmovun_high_s32(r, a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqmovun_high_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t _c[2];
-  int32x2_t a = vld1_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x2_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 2; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmul_laneq_s32(a, b, IDX); \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c[4];
+  for (int i = 0; i < 2; i++) {
+    if (_a[i] < 0) {
+      _c[i + 2] = 0;
+    } else if (_a[i] > UINT32_MAX) {
+      _c[i + 2] = UINT32_MAX;
+    } else {
+      _c[i + 2] = _a[i];
+    }
+    _c[i] = _r[i];
+  }
+  int64x2_t a = vld1q_s64(_a);
+  uint32x2_t r = vld1_u32(_r);
+  uint32x4_t c = vqmovun_high_s64(r, a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-  return TEST_SUCCESS;
+result_t test_vmovl_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  int16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = _a[i];
+  }
+  int8x8_t a = vld1_s8(_a);
+  int16x8_t c = vmovl_s8(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   int32_t _c[4];
-  int32x4_t a = vld1q_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x4_t c;
-
-#define TEST_IMPL(IDX)            \
-  for (int i = 0; i < 4; i++) {   \
-    _c[i] = _a[i] * _b[IDX];      \
-  }                               \
-  c = vmulq_laneq_s32(a, b, IDX); \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _a[i];
+  }
+  int16x4_t a = vld1_s16(_a);
+  int32x4_t c = vmovl_s16(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  uint16_t _c[4];
-  uint16x4_t a = vld1_u16(_a);
-  uint16x8_t b = vld1q_u16(_b);
-  uint16x4_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 4; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmul_laneq_u16(a, b, IDX); \
-  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_8_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i];
+  }
+  int32x2_t a = vld1_s32(_a);
+  int64x2_t c = vmovl_s32(a);
+  return validate_int64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
   uint16_t _c[8];
-  uint16x8_t a = vld1q_u16(_a);
-  uint16x8_t b = vld1q_u16(_b);
-  uint16x8_t c;
-
-#define TEST_IMPL(IDX)            \
-  for (int i = 0; i < 8; i++) {   \
-    _c[i] = _a[i] * _b[IDX];      \
-  }                               \
-  c = vmulq_laneq_u16(a, b, IDX); \
-  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
-
-  IMM_8_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  for (int i = 0; i < 8; i++) {
+    _c[i] = _a[i];
+  }
+  uint8x8_t a = vld1_u8(_a);
+  uint16x8_t c = vmovl_u8(a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  uint32_t _c[2];
-  uint32x2_t a = vld1_u32(_a);
-  uint32x4_t b = vld1q_u32(_b);
-  uint32x2_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 2; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmul_laneq_u32(a, b, IDX); \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _a[i];
+  }
+  uint16x4_t a = vld1_u16(_a);
+  uint32x4_t c = vmovl_u16(a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  uint32_t _c[4];
-  uint32x4_t a = vld1q_u32(_a);
-  uint32x4_t b = vld1q_u32(_b);
-  uint32x4_t c;
-
-#define TEST_IMPL(IDX)            \
-  for (int i = 0; i < 4; i++) {   \
-    _c[i] = _a[i] * _b[IDX];      \
-  }                               \
-  c = vmulq_laneq_u32(a, b, IDX); \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i];
+  }
+  uint32x2_t a = vld1_u32(_a);
+  uint64x2_t c = vmovl_u32(a);
+  return validate_uint64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_high_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  float _c[2];
-  float32x2_t a = vld1_f32(_a);
-  float32x4_t b = vld1q_f32(_b);
-  float32x2_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 2; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmul_laneq_f32(a, b, IDX); \
-  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  int16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = _a[i + 8];
+  }
+  int8x16_t a = vld1q_s8(_a);
+  int16x8_t c = vmovl_high_s8(a);
+  return validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_high_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  float _c[4];
-  float32x4_t a = vld1q_f32(_a);
-  float32x4_t b = vld1q_f32(_b);
-  float32x4_t c;
-
-#define TEST_IMPL(IDX)            \
-  for (int i = 0; i < 4; i++) {   \
-    _c[i] = _a[i] * _b[IDX];      \
-  }                               \
-  c = vmulq_laneq_f32(a, b, IDX); \
-  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  int32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _a[i + 4];
+  }
+  int16x8_t a = vld1q_s16(_a);
+  int32x4_t c = vmovl_high_s16(a);
+  return validate_int32(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmul_laneq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_high_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (double *)impl.test_cases_float_pointer1;
-  const double *_b = (double *)impl.test_cases_float_pointer2;
-  double _c[1];
-  float64x1_t a = vld1_f64(_a);
-  float64x2_t b = vld1q_f64(_b);
-  float64x1_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 1; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmul_laneq_f64(a, b, IDX); \
-  CHECK_RESULT(validate_double(c, _c[0]))
-
-  IMM_1_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  int64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i + 2];
+  }
+  int32x4_t a = vld1q_s32(_a);
+  int64x2_t c = vmovl_high_s32(a);
+  return validate_int64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_laneq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_high_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (double *)impl.test_cases_float_pointer1;
-  const double *_b = (double *)impl.test_cases_float_pointer2;
-  double _c[2];
-  float64x2_t a = vld1q_f64(_a);
-  float64x2_t b = vld1q_f64(_b);
-  float64x2_t c;
-
-#define TEST_IMPL(IDX)            \
-  for (int i = 0; i < 2; i++) {   \
-    _c[i] = _a[i] * _b[IDX];      \
-  }                               \
-  c = vmulq_laneq_f64(a, b, IDX); \
-  CHECK_RESULT(validate_double(c, _c[0], _c[1]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  uint16_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = _a[i + 8];
+  }
+  uint8x16_t a = vld1q_u8(_a);
+  uint16x8_t c = vmovl_high_u8(a);
+  return validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmuls_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_high_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  float _c, c;
-  float32x4_t b = vld1q_f32(_b);
-
-#define TEST_IMPL(IDX)                \
-  _c = _a[0] * _b[IDX];               \
-  c = vmuls_laneq_f32(_a[0], b, IDX); \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  uint32_t _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _a[i + 4];
+  }
+  uint16x8_t a = vld1q_u16(_a);
+  uint32x4_t c = vmovl_high_u16(a);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmuld_laneq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmovl_high_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const double *_a = (double *)impl.test_cases_float_pointer1;
-  const double *_b = (double *)impl.test_cases_float_pointer2;
-  double _c, c;
-  float64x2_t b = vld1q_f64(_b);
-
-#define TEST_IMPL(IDX)                \
-  _c = _a[0] * _b[IDX];               \
-  c = vmuld_laneq_f64(_a[0], b, IDX); \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i + 2];
+  }
+  uint32x4_t a = vld1q_u32(_a);
+  uint64x2_t c = vmovl_high_u32(a);
+  return validate_uint64(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbl1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  uint16_t _c[8];
-  uint16x8_t a = vld1q_u16(_a);
-  uint16x4_t b = vld1_u16(_b);
-  uint16x8_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 8; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmulq_lane_u16(a, b, IDX); \
-  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
+  int8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 7 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a[_b[i]];
+    }
+  }
 
+  int8x8_t a = vld1_s8(_a);
+  int8x8_t b = vld1_s8(_b);
+  int8x8_t c = vtbl1_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmulq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbl1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  uint32_t _c[4];
-  uint32x4_t a = vld1q_u32(_a);
-  uint32x2_t b = vld1_u32(_b);
-  uint32x4_t c;
-
-#define TEST_IMPL(IDX)           \
-  for (int i = 0; i < 4; i++) {  \
-    _c[i] = _a[i] * _b[IDX];     \
-  }                              \
-  c = vmulq_lane_u32(a, b, IDX); \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 7 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a[_b[i]];
+    }
+  }
 
+  uint8x8_t a = vld1_u8(_a);
+  uint8x8_t b = vld1_u8(_b);
+  uint8x8_t c = vtbl1_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[4];
-  int16x4_t a = vld1_s16(_a);
-  int16x4_t b = vld1_s16(_b);
-  int16x4_t c = vld1_s16(_c);
-  int16x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_lane_s16(a, b, c, IDX);   \
-  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
+result_t test_vtbl1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_4_ITER
-#undef TEST_IMPL
+result_t test_vtbl2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
+  int8_t _a2[16];
+  int8_t _c[16];
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _a2[i] = _a[2 * i];
+    _a2[i + 8] = _a[2 * i + 1];
+  }
 
-  return TEST_SUCCESS;
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 15 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a2[_b[i]];
+    }
+  }
+  int8x8x2_t a = vld2_s8(_a);
+  int8x8_t b = vld1_s8(_b);
+  int8x8_t c = vtbl2_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbl2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  int32x2_t a = vld1_s32(_a);
-  int32x2_t b = vld1_s32(_b);
-  int32x2_t c = vld1_s32(_c);
-  int32x2_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_lane_s32(a, b, c, IDX);   \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _a2[16];
+  uint8_t _c[8];
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _a2[i] = _a[2 * i];
+    _a2[i + 8] = _a[2 * i + 1];
+  }
 
-  IMM_2_ITER
-#undef TEST_IMPL
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 15 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a2[_b[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint8x8x2_t a = vld2_u8(_a);
+  uint8x8_t b = vld1_u8(_b);
+  uint8x8_t c = vtbl2_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const float *_a = (const float *)impl.test_cases_float_pointer1;
-  const float *_b = (const float *)impl.test_cases_float_pointer2;
-  const float *_c = (const float *)impl.test_cases_float_pointer3;
-  float _d[4];
-  float32x2_t a = vld1_f32(_a);
-  float32x2_t b = vld1_f32(_b);
-  float32x2_t c = vld1_f32(_c);
-  float32x2_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_lane_f32(a, b, c, IDX);   \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
+result_t test_vtbl2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_2_ITER
-#undef TEST_IMPL
+result_t test_vtbl3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer_huge;
+  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer3;
+  int8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 23 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a[_b[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  int8x8x3_t a = vld3_s8(_a);
+  int8x8_t b = vld1_s8(_b);
+  int8x8_t c = vtbl3_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbl3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
-  uint16_t _d[4];
-  uint16x4_t a = vld1_u16(_a);
-  uint16x4_t b = vld1_u16(_b);
-  uint16x4_t c = vld1_u16(_c);
-  uint16x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_lane_u16(a, b, c, IDX);   \
-  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
+  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer3;
+  const size_t reg_elt_num = 8;
+  uint8_t _in_interleave[32];
+  uint8_t _a[24];
+  uint8_t _c[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _a[i] = _in_interleave[3 * i];
+    _a[i + 8] = _in_interleave[3 * i + 1];
+    _a[i + 16] = _in_interleave[3 * i + 2];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 23 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a[_b[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint8x8x3_t a = vld3_u8(_in_interleave);
+  uint8x8_t b = vld1_u8(_b);
+  uint8x8_t c = vtbl3_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
-  uint32x2_t a = vld1_u32(_a);
-  uint32x2_t b = vld1_u32(_b);
-  uint32x2_t c = vld1_u32(_c);
-  uint32x2_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_lane_u32(a, b, c, IDX);   \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1]))
+result_t test_vtbl3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_2_ITER
-#undef TEST_IMPL
+result_t test_vtbl4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer2;
+  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer3;
+  const size_t reg_elt_num = 8;
+  int8_t _in_interleave[32];
+  int8_t _a[32];
+  int8_t _c[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _a[i] = _in_interleave[4 * i];
+    _a[i + 8] = _in_interleave[4 * i + 1];
+    _a[i + 16] = _in_interleave[4 * i + 2];
+    _a[i + 24] = _in_interleave[4 * i + 3];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 31 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a[_b[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  int8x8x4_t a = vld4_s8(_in_interleave);
+  int8x8_t b = vld1_s8(_b);
+  int8x8_t c = vtbl4_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbl4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[8];
-  int16x8_t a = vld1q_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x4_t c = vld1_s16(_c);
-  int16x8_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_lane_s16(a, b, c, IDX);  \
-  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
+  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer3;
+  const size_t reg_elt_num = 8;
+  uint8_t _in_interleave[32];
+  uint8_t _a[32];
+  uint8_t _c[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _a[i] = _in_interleave[4 * i];
+    _a[i + 8] = _in_interleave[4 * i + 1];
+    _a[i + 16] = _in_interleave[4 * i + 2];
+    _a[i + 24] = _in_interleave[4 * i + 3];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_b[i] > 31 || _b[i] < 0) {
+      _c[i] = 0;
+    } else {
+      _c[i] = _a[_b[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint8x8x4_t a = vld4_u8(_in_interleave);
+  uint8x8_t b = vld1_u8(_b);
+  uint8x8_t c = vtbl4_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  int32x4_t a = vld1q_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x2_t c = vld1_s32(_c);
-  int32x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_lane_s32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+result_t test_vtbl4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_2_ITER
-#undef TEST_IMPL
+result_t test_vtbx1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
+  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer3;
+  int8_t _d[8];
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 7 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  int8x8_t a = vld1_s8(_a);
+  int8x8_t b = vld1_s8(_b);
+  int8x8_t c = vld1_s8(_c);
+  int8x8_t d = vtbx1_s8(a, b, c);
+  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbx1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  const float *_c = (float *)impl.test_cases_float_pointer3;
-  float _d[4];
-  float32x4_t a = vld1q_f32(_a);
-  float32x4_t b = vld1q_f32(_b);
-  float32x2_t c = vld1_f32(_c);
-  float32x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_lane_f32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.00001f))
-
-  IMM_2_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer3;
+  uint8_t _d[8];
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 7 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint8x8_t a = vld1_u8(_a);
+  uint8x8_t b = vld1_u8(_b);
+  uint8x8_t c = vld1_u8(_c);
+  uint8x8_t d = vtbx1_u8(a, b, c);
+  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbx1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vtbx2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[4];
-  int16x4_t a = vld1_s16(_a);
-  int16x4_t b = vld1_s16(_b);
-  int16x8_t c = vld1q_s16(_c);
-  int16x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_laneq_s16(a, b, c, IDX);  \
-  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
-
-  IMM_8_ITER
-#undef TEST_IMPL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer2;
+  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer3;
+  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer4;
+  const size_t reg_elt_num = 8;
+  int8_t _in_interleave[32];
+  int8_t _b[16];
+  int8_t _d[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _b[i] = _in_interleave[2 * i];
+    _b[i + 8] = _in_interleave[2 * i + 1];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 15 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  int8x8_t a = vld1_s8(_a);
+  int8x8x2_t b = vld2_s8(_in_interleave);
+  int8x8_t c = vld1_s8(_c);
+  int8x8_t d = vtbx2_s8(a, b, c);
+  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbx2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[8];
-  int16x8_t a = vld1q_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x8_t c = vld1q_s16(_c);
-  int16x8_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_laneq_s16(a, b, c, IDX); \
-  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
-
-  IMM_8_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer3;
+  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer4;
+  const size_t reg_elt_num = 8;
+  uint8_t _in_interleave[32];
+  uint8_t _b[16];
+  uint8_t _d[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _b[i] = _in_interleave[2 * i];
+    _b[i + 8] = _in_interleave[2 * i + 1];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 15 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint8x8_t a = vld1_u8(_a);
+  uint8x8x2_t b = vld2_u8(_in_interleave);
+  uint8x8_t c = vld1_u8(_c);
+  uint8x8_t d = vtbx2_u8(a, b, c);
+  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[2];
-  int32x2_t a = vld1_s32(_a);
-  int32x2_t b = vld1_s32(_b);
-  int32x4_t c = vld1q_s32(_c);
-  int32x2_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_laneq_s32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
+result_t test_vtbx2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_4_ITER
-#undef TEST_IMPL
+result_t test_vtbx3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer2;
+  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer3;
+  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer4;
+  const size_t reg_elt_num = 8;
+  int8_t _in_interleave[32];
+  int8_t _b[24];
+  int8_t _d[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _b[i] = _in_interleave[3 * i];
+    _b[i + 8] = _in_interleave[3 * i + 1];
+    _b[i + 16] = _in_interleave[3 * i + 2];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 23 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  int8x8_t a = vld1_s8(_a);
+  int8x8x3_t b = vld3_s8(_in_interleave);
+  int8x8_t c = vld1_s8(_c);
+  int8x8_t d = vtbx3_s8(a, b, c);
+  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbx3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  int32x4_t a = vld1q_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x4_t c = vld1q_s32(_c);
-  int32x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_laneq_s32(a, b, c, IDX); \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer3;
+  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer4;
+  const size_t reg_elt_num = 8;
+  uint8_t _in_interleave[32];
+  uint8_t _b[24];
+  uint8_t _d[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _b[i] = _in_interleave[3 * i];
+    _b[i + 8] = _in_interleave[3 * i + 1];
+    _b[i + 16] = _in_interleave[3 * i + 2];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 23 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint8x8_t a = vld1_u8(_a);
+  uint8x8x3_t b = vld3_u8(_in_interleave);
+  uint8x8_t c = vld1_u8(_c);
+  uint8x8_t d = vtbx3_u8(a, b, c);
+  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
-  uint16_t _d[4];
-  uint16x4_t a = vld1_u16(_a);
-  uint16x4_t b = vld1_u16(_b);
-  uint16x8_t c = vld1q_u16(_c);
-  uint16x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_laneq_u16(a, b, c, IDX);  \
-  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3]))
+result_t test_vtbx3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_8_ITER
-#undef TEST_IMPL
+result_t test_vtbx4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *in1 = (int8_t *)impl.test_cases_int_pointer2;
+  const int8_t *in2 = (int8_t *)impl.test_cases_int_pointer3;
+  const int8_t *_c = (int8_t *)impl.test_cases_int_pointer4;
+  const size_t reg_elt_num = 8;
+  int8_t _in_interleave[32];
+  int8_t _b[32];
+  int8_t _d[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _b[i] = _in_interleave[4 * i];
+    _b[i + 8] = _in_interleave[4 * i + 1];
+    _b[i + 16] = _in_interleave[4 * i + 2];
+    _b[i + 24] = _in_interleave[4 * i + 3];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 31 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  int8x8_t a = vld1_s8(_a);
+  int8x8x4_t b = vld4_s8(_in_interleave);
+  int8x8_t c = vld1_s8(_c);
+  int8x8_t d = vtbx4_s8(a, b, c);
+  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vtbx4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
-  uint16_t _d[8];
-  uint16x8_t a = vld1q_u16(_a);
-  uint16x8_t b = vld1q_u16(_b);
-  uint16x8_t c = vld1q_u16(_c);
-  uint16x8_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_laneq_u16(a, b, c, IDX); \
-  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
-
-  IMM_8_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *in1 = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *in2 = (uint8_t *)impl.test_cases_int_pointer3;
+  const uint8_t *_c = (uint8_t *)impl.test_cases_int_pointer4;
+  const size_t reg_elt_num = 8;
+  uint8_t _in_interleave[32];
+  uint8_t _b[32];
+  uint8_t _d[8];
+  merge_arrays(in1, in2, _in_interleave, reg_elt_num);
+  // organize input array
+  for (int i = 0; i < 8; i++) {
+    _b[i] = _in_interleave[4 * i];
+    _b[i + 8] = _in_interleave[4 * i + 1];
+    _b[i + 16] = _in_interleave[4 * i + 2];
+    _b[i + 24] = _in_interleave[4 * i + 3];
+  }
+  for (int i = 0; i < 8; i++) {
+    if (_c[i] > 31 || _c[i] < 0) {
+      _d[i] = _a[i];
+    } else {
+      _d[i] = _b[_c[i]];
+    }
+  }
 
-  return TEST_SUCCESS;
+  uint8x8_t a = vld1_u8(_a);
+  uint8x8x4_t b = vld4_u8(_in_interleave);
+  uint8x8_t c = vld1_u8(_c);
+  uint8x8_t d = vtbx4_u8(a, b, c);
+  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[2];
-  uint32x2_t a = vld1_u32(_a);
-  uint32x2_t b = vld1_u32(_b);
-  uint32x4_t c = vld1q_u32(_c);
-  uint32x2_t d;
+result_t test_vtbx4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_laneq_u32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1]))
+result_t test_vqtbl1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_4_ITER
-#undef TEST_IMPL
+result_t test_vqtbl1q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  int8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = (_b[i] < 16) ? _a[_b[i]] : 0;
+  }
 
-  return TEST_SUCCESS;
+  int8x16_t a = vld1q_s8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  int8x16_t c = vqtbl1q_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqtbl1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
-  uint32x4_t a = vld1q_u32(_a);
-  uint32x4_t b = vld1q_u32(_b);
-  uint32x4_t c = vld1q_u32(_c);
-  uint32x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_laneq_u32(a, b, c, IDX); \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = (_b[i] < 16) ? _a[_b[i]] : 0;
+  }
 
-  return TEST_SUCCESS;
+  uint8x16_t a = vld1q_u8(_a);
+  uint8x8_t b = vld1_u8(_b);
+  uint8x8_t c = vqtbl1_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmla_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqtbl1q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (const float *)impl.test_cases_float_pointer1;
-  const float *_b = (const float *)impl.test_cases_float_pointer2;
-  const float *_c = (const float *)impl.test_cases_float_pointer3;
-  float _d[4];
-  float32x2_t a = vld1_f32(_a);
-  float32x2_t b = vld1_f32(_b);
-  float32x4_t c = vld1q_f32(_c);
-  float32x2_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmla_laneq_f32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
-
-  IMM_4_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = (_b[i] < 16) ? _a[_b[i]] : 0;
+  }
 
-  return TEST_SUCCESS;
+  uint8x16_t a = vld1q_u8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint8x16_t c = vqtbl1q_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const float *_a = (const float *)impl.test_cases_float_pointer1;
-  const float *_b = (const float *)impl.test_cases_float_pointer2;
-  const float *_c = (const float *)impl.test_cases_float_pointer3;
-  float _d[4];
-  float32x4_t a = vld1q_f32(_a);
-  float32x4_t b = vld1q_f32(_b);
-  float32x4_t c = vld1q_f32(_c);
-  float32x4_t d;
+result_t test_vqtbl1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_laneq_f32(a, b, c, IDX); \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
+result_t test_vqtbl1q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_4_ITER
-#undef TEST_IMPL
+result_t test_vqtbx1_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  return TEST_SUCCESS;
+result_t test_vqtbx1q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx1_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx1q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx1_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx1q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbl2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbl2q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  int8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = (_b[i] < 32) ? _a[_b[i]] : 0;
+  }
+
+  int8x16x2_t a = vld1q_s8_x2(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  int8x16_t c = vqtbl2q_s8(a, b);
+  return validate_int8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                       _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqtbl2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint16_t _d[8];
-  uint16x8_t a = vld1q_u16(_a);
-  uint16x8_t b = vld1q_u16(_b);
-  uint16x4_t c = vld1_u16(_c);
-  uint16x8_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_lane_u16(a, b, c, IDX);  \
-  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
-
-  IMM_4_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[8];
+  for (int i = 0; i < 8; i++) {
+    _c[i] = (_b[i] < 32) ? _a[_b[i]] : 0;
+  }
 
-  return TEST_SUCCESS;
+  uint8x16x2_t a = vld1q_u8_x2(_a);
+  uint8x8_t b = vld1_u8(_b);
+  uint8x8_t c = vqtbl2_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlaq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqtbl2q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
-  uint32x4_t a = vld1q_u32(_a);
-  uint32x4_t b = vld1q_u32(_b);
-  uint32x2_t c = vld1_u32(_c);
-  uint32x4_t d;
-
-#define TEST_IMPL(IDX)               \
-  for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] + _b[i] * _c[IDX]; \
-  }                                  \
-  d = vmlaq_lane_u32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
-
-  IMM_2_ITER
-#undef TEST_IMPL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = (_b[i] < 32) ? _a[_b[i]] : 0;
+  }
 
-  return TEST_SUCCESS;
+  uint8x16x2_t a = vld1q_u8_x2(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint8x16_t c = vqtbl2q_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  int32x4_t a = vld1q_s32(_a);
-  int16x4_t b = vld1_s16(_b);
-  int16x4_t c = vld1_s16(_c);
-  int32x4_t d;
+result_t test_vqtbl2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 4; i++) {                        \
-    _d[i] = _a[i] + (int32_t)_b[i] * (int32_t)_c[IDX]; \
-  }                                                    \
-  d = vmlal_lane_s16(a, b, c, IDX);                    \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+result_t test_vqtbl2q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_4_ITER
-#undef TEST_IMPL
+result_t test_vqtbl3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  return TEST_SUCCESS;
+result_t test_vqtbl3q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbl3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbl3q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = (_b[i] < 48) ? _a[_b[i]] : 0;
+  }
+
+  uint8x16x3_t a = vld1q_u8_x3(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint8x16_t c = vqtbl3q_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d[2];
-  int64x2_t a = vld1q_s64(_a);
-  int32x2_t b = vld1_s32(_b);
-  int32x2_t c = vld1_s32(_c);
-  int64x2_t d;
+result_t test_vqtbl3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 2; i++) {                        \
-    _d[i] = _a[i] + (int64_t)_b[i] * (int64_t)_c[IDX]; \
-  }                                                    \
-  d = vmlal_lane_s32(a, b, c, IDX);                    \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+result_t test_vqtbl3q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_2_ITER
-#undef TEST_IMPL
+result_t test_vqtbl4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  return TEST_SUCCESS;
+result_t test_vqtbl4q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbl4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbl4q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  uint8_t _c[16];
+  for (int i = 0; i < 16; i++) {
+    _c[i] = (_b[i] < 64) ? _a[_b[i]] : 0;
+  }
+
+  uint8x16x4_t a = vld1q_u8_x4(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint8x16_t c = vqtbl4q_u8(a, b);
+  return validate_uint8(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7], _c[8], _c[9], _c[10], _c[11], _c[12],
+                        _c[13], _c[14], _c[15]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x4_t b = vld1_u16(_b);
-  uint16x4_t c = vld1_u16(_c);
-  uint32x4_t d;
+result_t test_vqtbl4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-#define TEST_IMPL(IDX)                                   \
-  for (int i = 0; i < 4; i++) {                          \
-    _d[i] = _a[i] + (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
-  }                                                      \
-  d = vmlal_lane_u16(a, b, c, IDX);                      \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
+result_t test_vqtbl4q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  IMM_4_ITER
-#undef TEST_IMPL
+result_t test_vqtbx2_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-  return TEST_SUCCESS;
-#else
-  return TEST_UNIMPL;
-#endif  // ENABLE_TEST_ALL
-}
+result_t test_vqtbx2q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmlal_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqtbx2_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx2q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx2_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx2q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx3_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx3q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx3_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx3q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx3_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx3q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx4_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx4q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx4_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx4q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx4_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vqtbx4q_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmul_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[2];
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x2_t b = vld1_u32(_b);
-  uint32x2_t c = vld1_u32(_c);
-  uint64x2_t d;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[4];
+  int16x4_t a = vld1_s16(_a);
+  int16x4_t b = vld1_s16(_b);
+  int16x4_t c;
 
-#define TEST_IMPL(IDX)                                   \
-  for (int i = 0; i < 2; i++) {                          \
-    _d[i] = _a[i] + (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
-  }                                                      \
-  d = vmlal_lane_u32(a, b, c, IDX);                      \
-  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)          \
+  for (int i = 0; i < 4; i++) { \
+    _c[i] = _a[i] * _b[IDX];    \
+  }                             \
+  c = vmul_lane_s16(a, b, IDX); \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
 
-  IMM_2_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
+
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d[8];
-  int32x4_t a = vld1q_s32(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x4_t c = vld1_s16(_c);
-  int32x4_t d;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[2];
+  int32x2_t a = vld1_s32(_a);
+  int32x2_t b = vld1_s32(_b);
+  int32x2_t c;
 
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 4; i++) {                            \
-    _d[i] = _a[i] + (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
-  }                                                        \
-  d = vmlal_high_lane_s16(a, b, c, IDX);                   \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+#define TEST_IMPL(IDX)          \
+  for (int i = 0; i < 2; i++) { \
+    _c[i] = _a[i] * _b[IDX];    \
+  }                             \
+  c = vmul_lane_s32(a, b, IDX); \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
+
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d[4];
-  int64x2_t a = vld1q_s64(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x2_t c = vld1_s32(_c);
-  int64x2_t d;
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[2];
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t c;
 
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 2; i++) {                            \
-    _d[i] = _a[i] + (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
-  }                                                        \
-  d = vmlal_high_lane_s32(a, b, c, IDX);                   \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)          \
+  for (int i = 0; i < 2; i++) { \
+    _c[i] = _a[i] * _b[IDX];    \
+  }                             \
+  c = vmul_lane_f32(a, b, IDX); \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -33973,50 +35255,47 @@ result_t test_vmlal_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[8];
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x8_t b = vld1q_u16(_b);
-  uint16x4_t c = vld1_u16(_c);
-  uint32x4_t d;
+  uint16_t _c[4];
+  uint16x4_t a = vld1_u16(_a);
+  uint16x4_t b = vld1_u16(_b);
+  uint16x4_t c;
 
-#define TEST_IMPL(IDX)                                       \
-  for (int i = 0; i < 4; i++) {                              \
-    _d[i] = _a[i] + (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
-  }                                                          \
-  d = vmlal_high_lane_u16(a, b, c, IDX);                     \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
+#define TEST_IMPL(IDX)          \
+  for (int i = 0; i < 4; i++) { \
+    _c[i] = _a[i] * _b[IDX];    \
+  }                             \
+  c = vmul_lane_u16(a, b, IDX); \
+  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
+
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[4];
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x4_t b = vld1q_u32(_b);
-  uint32x2_t c = vld1_u32(_c);
-  uint64x2_t d;
+  uint32_t _c[2];
+  uint32x2_t a = vld1_u32(_a);
+  uint32x2_t b = vld1_u32(_b);
+  uint32x2_t c;
 
-#define TEST_IMPL(IDX)                                       \
-  for (int i = 0; i < 2; i++) {                              \
-    _d[i] = _a[i] + (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
-  }                                                          \
-  d = vmlal_high_lane_u32(a, b, c, IDX);                     \
-  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)          \
+  for (int i = 0; i < 2; i++) { \
+    _c[i] = _a[i] * _b[IDX];    \
+  }                             \
+  c = vmul_lane_u32(a, b, IDX); \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -34027,79 +35306,75 @@ result_t test_vmlal_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d[8];
-  int32x4_t a = vld1q_s32(_a);
+  int16_t _c[8];
+  int16x8_t a = vld1q_s16(_a);
   int16x4_t b = vld1_s16(_b);
-  int16x8_t c = vld1q_s16(_c);
-  int32x4_t d;
+  int16x8_t c;
 
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 4; i++) {                        \
-    _d[i] = _a[i] + (int32_t)_b[i] * (int32_t)_c[IDX]; \
-  }                                                    \
-  d = vmlal_laneq_s16(a, b, c, IDX);                   \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 8; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmulq_lane_s16(a, b, IDX); \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
   IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
+
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d[4];
-  int64x2_t a = vld1q_s64(_a);
+  int32_t _c[4];
+  int32x4_t a = vld1q_s32(_a);
   int32x2_t b = vld1_s32(_b);
-  int32x4_t c = vld1q_s32(_c);
-  int64x2_t d;
+  int32x4_t c;
 
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 2; i++) {                        \
-    _d[i] = _a[i] + (int64_t)_b[i] * (int64_t)_c[IDX]; \
-  }                                                    \
-  d = vmlal_laneq_s32(a, b, c, IDX);                   \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 4; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmulq_lane_s32(a, b, IDX); \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
+
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[8];
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x4_t b = vld1_u16(_b);
-  uint16x8_t c = vld1q_u16(_c);
-  uint32x4_t d;
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[4];
+  float32x4_t a = vld1q_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x4_t c;
 
-#define TEST_IMPL(IDX)                                   \
-  for (int i = 0; i < 4; i++) {                          \
-    _d[i] = _a[i] + (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
-  }                                                      \
-  d = vmlal_laneq_u16(a, b, c, IDX);                     \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 4; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmulq_lane_f32(a, b, IDX); \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34108,77 +35383,59 @@ result_t test_vmlal_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_lane_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[4];
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x2_t b = vld1_u32(_b);
-  uint32x4_t c = vld1q_u32(_c);
-  uint64x2_t d;
-
-#define TEST_IMPL(IDX)                                   \
-  for (int i = 0; i < 2; i++) {                          \
-    _d[i] = _a[i] + (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
-  }                                                      \
-  d = vmlal_laneq_u32(a, b, c, IDX);                     \
-  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c[2];
+  float64x1_t a = vld1_f64(_a);
+  float64x1_t b = vld1_f64(_b);
+  float64x1_t c;
 
-  IMM_2_ITER
-#undef TEST_IMPL
+  for (int i = 0; i < 1; i++) {
+    _c[i] = _a[i] * _b[0];
+  }
+  c = vmul_lane_f64(a, b, 0);
+  return validate_double(c, _c[0]);
 
   return TEST_SUCCESS;
+
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_lane_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d[8];
-  int32x4_t a = vld1q_s32(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x8_t c = vld1q_s16(_c);
-  int32x4_t d;
-
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 4; i++) {                            \
-    _d[i] = _a[i] + (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
-  }                                                        \
-  d = vmlal_high_laneq_s16(a, b, c, IDX);                  \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c[4];
+  float64x2_t a = vld1q_f64(_a);
+  float64x1_t b = vld1_f64(_b);
+  float64x2_t c;
 
-  IMM_4_ITER
-#undef TEST_IMPL
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i] * _b[0];
+  }
+  c = vmulq_lane_f64(a, b, 0);
+  return validate_double(c, _c[0], _c[1]);
 
-  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmuls_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d[4];
-  int64x2_t a = vld1q_s64(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x4_t c = vld1q_s32(_c);
-  int64x2_t d;
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c, c;
+  float32x2_t b = vld1_f32(_b);
 
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 2; i++) {                            \
-    _d[i] = _a[i] + (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
-  }                                                        \
-  d = vmlal_high_laneq_s32(a, b, c, IDX);                  \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)               \
+  _c = _a[0] * _b[IDX];              \
+  c = vmuls_lane_f32(_a[0], b, IDX); \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -34189,25 +35446,39 @@ result_t test_vmlal_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmuld_lane_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[8];
-  uint32x4_t a = vld1q_u32(_a);
-  uint16x8_t b = vld1q_u16(_b);
-  uint16x8_t c = vld1q_u16(_c);
-  uint32x4_t d;
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c, c;
+  float64x1_t b = vld1_f64(_b);
 
-#define TEST_IMPL(IDX)                                       \
-  for (int i = 0; i < 4; i++) {                              \
-    _d[i] = _a[i] + (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
-  }                                                          \
-  d = vmlal_high_laneq_u16(a, b, c, IDX);                    \
-  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
+  _c = _a[0] * _b[0];
+  c = vmuld_lane_f64(_a[0], b, 0);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
 
-  IMM_4_ITER
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmul_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[4];
+  int16x4_t a = vld1_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x4_t c;
+
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 4; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmul_laneq_s16(a, b, IDX); \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34216,25 +35487,23 @@ result_t test_vmlal_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlal_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[4];
-  uint64x2_t a = vld1q_u64(_a);
-  uint32x4_t b = vld1q_u32(_b);
-  uint32x4_t c = vld1q_u32(_c);
-  uint64x2_t d;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[8];
+  int16x8_t a = vld1q_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x8_t c;
 
-#define TEST_IMPL(IDX)                                       \
-  for (int i = 0; i < 2; i++) {                              \
-    _d[i] = _a[i] + (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
-  }                                                          \
-  d = vmlal_high_laneq_u32(a, b, c, IDX);                    \
-  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)            \
+  for (int i = 0; i < 8; i++) {   \
+    _c[i] = _a[i] * _b[IDX];      \
+  }                               \
+  c = vmulq_laneq_s16(a, b, IDX); \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
-  IMM_2_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34243,24 +35512,21 @@ result_t test_vmlal_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32x4_t a, d;
-  int16x4_t b, c;
-  int32_t _d[4];
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 4; i++) {                        \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
-  }                                                    \
-                                                       \
-  a = vld1q_s32(_a);                                   \
-  b = vld1_s16(_b);                                    \
-  c = vld1_s16(_c);                                    \
-  d = vqdmlal_lane_s16(a, b, c, IDX);                  \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[2];
+  int32x2_t a = vld1_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x2_t c;
+
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 2; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmul_laneq_s32(a, b, IDX); \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -34271,27 +35537,23 @@ result_t test_vqdmlal_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64x2_t a, d;
-  int32x2_t b, c;
-  int64_t _d[2];
+  int32_t _c[4];
+  int32x4_t a = vld1q_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x4_t c;
 
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 2; i++) {                        \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
-  }                                                    \
-                                                       \
-  a = vld1q_s64(_a);                                   \
-  b = vld1_s32(_b);                                    \
-  c = vld1_s32(_c);                                    \
-  d = vqdmlal_lane_s32(a, b, c, IDX);                  \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)            \
+  for (int i = 0; i < 4; i++) {   \
+    _c[i] = _a[i] * _b[IDX];      \
+  }                               \
+  c = vmulq_laneq_s32(a, b, IDX); \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-  IMM_2_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34300,20 +35562,23 @@ result_t test_vqdmlal_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlalh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d, d;
-  int16x4_t c = vld1_s16(_c);
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16_t _c[4];
+  uint16x4_t a = vld1_u16(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint16x4_t c;
 
-#define TEST_IMPL(IDX)                            \
-  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlalh_lane_s16(_a[0], _b[0], c, IDX);    \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 4; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmul_laneq_u16(a, b, IDX); \
+  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3]))
 
-  IMM_4_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34322,20 +35587,23 @@ result_t test_vqdmlalh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlals_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d, d;
-  int32x2_t c = vld1_s32(_c);
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16_t _c[8];
+  uint16x8_t a = vld1q_u16(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint16x8_t c;
 
-#define TEST_IMPL(IDX)                            \
-  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlals_lane_s32(_a[0], _b[0], c, IDX);    \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)            \
+  for (int i = 0; i < 8; i++) {   \
+    _c[i] = _a[i] * _b[IDX];      \
+  }                               \
+  c = vmulq_laneq_u16(a, b, IDX); \
+  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
-  IMM_2_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34344,23 +35612,21 @@ result_t test_vqdmlals_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32x4_t a = vld1q_s32(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x4_t c = vld1_s16(_c);
-  ;
-  int32x4_t d;
-  int32_t _d[4];
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 4; i++) {                            \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
-  }                                                        \
-  d = vqdmlal_high_lane_s16(a, b, c, IDX);                 \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c[2];
+  uint32x2_t a = vld1_u32(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint32x2_t c;
+
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 2; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmul_laneq_u32(a, b, IDX); \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -34371,25 +35637,23 @@ result_t test_vqdmlal_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64x2_t a = vld1q_s64(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x2_t c = vld1_s32(_c);
-  int64x2_t d;
-  int64_t _d[2];
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c[4];
+  uint32x4_t a = vld1q_u32(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint32x4_t c;
 
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 2; i++) {                            \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
-  }                                                        \
-  d = vqdmlal_high_lane_s32(a, b, c, IDX);                 \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)            \
+  for (int i = 0; i < 4; i++) {   \
+    _c[i] = _a[i] * _b[IDX];      \
+  }                               \
+  c = vmulq_laneq_u32(a, b, IDX); \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
 
-  IMM_2_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34398,25 +35662,23 @@ result_t test_vqdmlal_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32x4_t d;
-  int32_t _d[4];
-  int32x4_t a = vld1q_s32(_a);
-  int16x4_t b = vld1_s16(_b);
-  int16x8_t c = vld1q_s16(_c);
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[2];
+  float32x2_t a = vld1_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x2_t c;
 
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 4; i++) {                        \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
-  }                                                    \
-  d = vqdmlal_laneq_s16(a, b, c, IDX);                 \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 2; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmul_laneq_f32(a, b, IDX); \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34425,23 +35687,21 @@ result_t test_vqdmlal_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64x2_t d;
-  int64x2_t a = vld1q_s64(_a);
-  int32x2_t b = vld1_s32(_b);
-  int32x4_t c = vld1q_s32(_c);
-  int64_t _d[2];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[4];
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t c;
 
-#define TEST_IMPL(IDX)                                 \
-  for (int i = 0; i < 2; i++) {                        \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
-  }                                                    \
-  d = vqdmlal_laneq_s32(a, b, c, IDX);                 \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)            \
+  for (int i = 0; i < 4; i++) {   \
+    _c[i] = _a[i] * _b[IDX];      \
+  }                               \
+  c = vmulq_laneq_f32(a, b, IDX); \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -34452,20 +35712,23 @@ result_t test_vqdmlal_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlalh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmul_laneq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d, d;
-  int16x8_t c = vld1q_s16(_c);
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c[1];
+  float64x1_t a = vld1_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  float64x1_t c;
 
-#define TEST_IMPL(IDX)                            \
-  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlalh_laneq_s16(_a[0], _b[0], c, IDX);   \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 1; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmul_laneq_f64(a, b, IDX); \
+  CHECK_RESULT(validate_double(c, _c[0]))
 
-  IMM_8_ITER
+  IMM_1_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34474,18 +35737,42 @@ result_t test_vqdmlalh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlals_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_laneq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d, d;
-  int32x4_t c = vld1q_s32(_c);
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c[2];
+  float64x2_t a = vld1q_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  float64x2_t c;
 
-#define TEST_IMPL(IDX)                            \
-  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlals_laneq_s32(_a[0], _b[0], c, IDX);   \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)            \
+  for (int i = 0; i < 2; i++) {   \
+    _c[i] = _a[i] * _b[IDX];      \
+  }                               \
+  c = vmulq_laneq_f64(a, b, IDX); \
+  CHECK_RESULT(validate_double(c, _c[0], _c[1]))
+
+  IMM_2_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmuls_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c, c;
+  float32x4_t b = vld1q_f32(_b);
+
+#define TEST_IMPL(IDX)                \
+  _c = _a[0] * _b[IDX];               \
+  c = vmuls_laneq_f32(_a[0], b, IDX); \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -34496,25 +35783,19 @@ result_t test_vqdmlals_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmuld_laneq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32x4_t d;
-  int32_t _d[4];
-  int32x4_t a = vld1q_s32(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x8_t c = vld1q_s16(_c);
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c, c;
+  float64x2_t b = vld1q_f64(_b);
 
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 4; i++) {                            \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
-  }                                                        \
-  d = vqdmlal_high_laneq_s16(a, b, c, IDX);                \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+#define TEST_IMPL(IDX)                \
+  _c = _a[0] * _b[IDX];               \
+  c = vmuld_laneq_f64(_a[0], b, IDX); \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-  IMM_8_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -34523,38 +35804,63 @@ result_t test_vqdmlal_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t it
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlal_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64x2_t d;
-  int64x2_t a = vld1q_s64(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x4_t c = vld1q_s32(_c);
-  int64_t _d[2];
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16_t _c[8];
+  uint16x8_t a = vld1q_u16(_a);
+  uint16x4_t b = vld1_u16(_b);
+  uint16x8_t c;
 
-#define TEST_IMPL(IDX)                                     \
-  for (int i = 0; i < 2; i++) {                            \
-    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
-  }                                                        \
-  d = vqdmlal_high_laneq_s32(a, b, c, IDX);                \
-  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 8; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmulq_lane_u16(a, b, IDX); \
+  CHECK_RESULT(validate_uint16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
   IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
+
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmulq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c[4];
+  uint32x4_t a = vld1q_u32(_a);
+  uint32x2_t b = vld1_u32(_b);
+  uint32x4_t c;
+
+#define TEST_IMPL(IDX)           \
+  for (int i = 0; i < 4; i++) {  \
+    _c[i] = _a[i] * _b[IDX];     \
+  }                              \
+  c = vmulq_lane_u32(a, b, IDX); \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_2_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmla_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
   int16_t _d[4];
   int16x4_t a = vld1_s16(_a);
   int16x4_t b = vld1_s16(_b);
@@ -34563,9 +35869,9 @@ result_t test_vmls_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_lane_s16(a, b, c, IDX);   \
+  d = vmla_lane_s16(a, b, c, IDX);   \
   CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -34577,12 +35883,12 @@ result_t test_vmls_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[2];
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
   int32x2_t a = vld1_s32(_a);
   int32x2_t b = vld1_s32(_b);
   int32x2_t c = vld1_s32(_c);
@@ -34590,9 +35896,9 @@ result_t test_vmls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_lane_s32(a, b, c, IDX);   \
+  d = vmla_lane_s32(a, b, c, IDX);   \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -34604,12 +35910,12 @@ result_t test_vmls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  const float *_c = (float *)impl.test_cases_float_pointer3;
-  float _d[2];
+  const float *_a = (const float *)impl.test_cases_float_pointer1;
+  const float *_b = (const float *)impl.test_cases_float_pointer2;
+  const float *_c = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
   float32x2_t a = vld1_f32(_a);
   float32x2_t b = vld1_f32(_b);
   float32x2_t c = vld1_f32(_c);
@@ -34617,10 +35923,10 @@ result_t test_vmls_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_lane_f32(a, b, c, IDX);   \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.001f))
+  d = vmla_lane_f32(a, b, c, IDX);   \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -34631,11 +35937,11 @@ result_t test_vmls_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
   uint16_t _d[4];
   uint16x4_t a = vld1_u16(_a);
   uint16x4_t b = vld1_u16(_b);
@@ -34644,9 +35950,9 @@ result_t test_vmls_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_lane_u16(a, b, c, IDX);   \
+  d = vmla_lane_u16(a, b, c, IDX);   \
   CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -34658,12 +35964,12 @@ result_t test_vmls_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[2];
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
   uint32x2_t a = vld1_u32(_a);
   uint32x2_t b = vld1_u32(_b);
   uint32x2_t c = vld1_u32(_c);
@@ -34671,9 +35977,9 @@ result_t test_vmls_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_lane_u32(a, b, c, IDX);   \
+  d = vmla_lane_u32(a, b, c, IDX);   \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -34685,7 +35991,7 @@ result_t test_vmls_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
@@ -34698,9 +36004,9 @@ result_t test_vmlsq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_lane_s16(a, b, c, IDX);  \
+  d = vmlaq_lane_s16(a, b, c, IDX);  \
   CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
   IMM_4_ITER
@@ -34712,7 +36018,7 @@ result_t test_vmlsq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
@@ -34725,9 +36031,9 @@ result_t test_vmlsq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_lane_s32(a, b, c, IDX);  \
+  d = vmlaq_lane_s32(a, b, c, IDX);  \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_2_ITER
@@ -34739,7 +36045,7 @@ result_t test_vmlsq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const float *_a = (float *)impl.test_cases_float_pointer1;
   const float *_b = (float *)impl.test_cases_float_pointer2;
@@ -34752,10 +36058,10 @@ result_t test_vmlsq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_lane_f32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.001f))
+  d = vmlaq_lane_f32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.00001f))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -34766,11 +36072,11 @@ result_t test_vmlsq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
   int16_t _d[4];
   int16x4_t a = vld1_s16(_a);
   int16x4_t b = vld1_s16(_b);
@@ -34779,9 +36085,9 @@ result_t test_vmls_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_laneq_s16(a, b, c, IDX);  \
+  d = vmla_laneq_s16(a, b, c, IDX);  \
   CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_8_ITER
@@ -34793,11 +36099,11 @@ result_t test_vmls_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
   int16_t _d[8];
   int16x8_t a = vld1q_s16(_a);
   int16x8_t b = vld1q_s16(_b);
@@ -34806,9 +36112,9 @@ result_t test_vmlsq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_laneq_s16(a, b, c, IDX); \
+  d = vmlaq_laneq_s16(a, b, c, IDX); \
   CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
   IMM_8_ITER
@@ -34820,11 +36126,11 @@ result_t test_vmlsq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
   int32_t _d[2];
   int32x2_t a = vld1_s32(_a);
   int32x2_t b = vld1_s32(_b);
@@ -34833,9 +36139,9 @@ result_t test_vmls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_laneq_s32(a, b, c, IDX);  \
+  d = vmla_laneq_s32(a, b, c, IDX);  \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
 
   IMM_4_ITER
@@ -34847,11 +36153,11 @@ result_t test_vmls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
   int32_t _d[4];
   int32x4_t a = vld1q_s32(_a);
   int32x4_t b = vld1q_s32(_b);
@@ -34860,9 +36166,9 @@ result_t test_vmlsq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_laneq_s32(a, b, c, IDX); \
+  d = vmlaq_laneq_s32(a, b, c, IDX); \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -34874,22 +36180,22 @@ result_t test_vmlsq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint16_t _d[4];
-  uint16x4_t a = vld1_u16(_a);
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
+  uint16_t _d[4];
+  uint16x4_t a = vld1_u16(_a);
   uint16x4_t b = vld1_u16(_b);
   uint16x8_t c = vld1q_u16(_c);
   uint16x4_t d;
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_laneq_u16(a, b, c, IDX);  \
+  d = vmla_laneq_u16(a, b, c, IDX);  \
   CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_8_ITER
@@ -34901,11 +36207,11 @@ result_t test_vmls_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
   uint16_t _d[8];
   uint16x8_t a = vld1q_u16(_a);
   uint16x8_t b = vld1q_u16(_b);
@@ -34914,9 +36220,9 @@ result_t test_vmlsq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_laneq_u16(a, b, c, IDX); \
+  d = vmlaq_laneq_u16(a, b, c, IDX); \
   CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
   IMM_8_ITER
@@ -34928,11 +36234,11 @@ result_t test_vmlsq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
   uint32_t _d[2];
   uint32x2_t a = vld1_u32(_a);
   uint32x2_t b = vld1_u32(_b);
@@ -34941,9 +36247,9 @@ result_t test_vmls_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_laneq_u32(a, b, c, IDX);  \
+  d = vmla_laneq_u32(a, b, c, IDX);  \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1]))
 
   IMM_4_ITER
@@ -34955,11 +36261,11 @@ result_t test_vmls_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
   uint32_t _d[4];
   uint32x4_t a = vld1q_u32(_a);
   uint32x4_t b = vld1q_u32(_b);
@@ -34968,9 +36274,9 @@ result_t test_vmlsq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_laneq_u32(a, b, c, IDX); \
+  d = vmlaq_laneq_u32(a, b, c, IDX); \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -34982,12 +36288,12 @@ result_t test_vmlsq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmls_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmla_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  const float *_c = (float *)impl.test_cases_float_pointer3;
-  float _d[2];
+  const float *_a = (const float *)impl.test_cases_float_pointer1;
+  const float *_b = (const float *)impl.test_cases_float_pointer2;
+  const float *_c = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
   float32x2_t a = vld1_f32(_a);
   float32x2_t b = vld1_f32(_b);
   float32x4_t c = vld1q_f32(_c);
@@ -34995,10 +36301,10 @@ result_t test_vmls_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 2; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmls_laneq_f32(a, b, c, IDX);  \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.001f))
+  d = vmla_laneq_f32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -35009,11 +36315,11 @@ result_t test_vmls_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const float *_a = (float *)impl.test_cases_float_pointer1;
-  const float *_b = (float *)impl.test_cases_float_pointer2;
-  const float *_c = (float *)impl.test_cases_float_pointer3;
+  const float *_a = (const float *)impl.test_cases_float_pointer1;
+  const float *_b = (const float *)impl.test_cases_float_pointer2;
+  const float *_c = (const float *)impl.test_cases_float_pointer3;
   float _d[4];
   float32x4_t a = vld1q_f32(_a);
   float32x4_t b = vld1q_f32(_b);
@@ -35022,10 +36328,10 @@ result_t test_vmlsq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_laneq_f32(a, b, c, IDX); \
-  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.001f))
+  d = vmlaq_laneq_f32(a, b, c, IDX); \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -35036,7 +36342,7 @@ result_t test_vmlsq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
@@ -35049,9 +36355,9 @@ result_t test_vmlsq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 8; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_lane_u16(a, b, c, IDX);  \
+  d = vmlaq_lane_u16(a, b, c, IDX);  \
   CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
   IMM_4_ITER
@@ -35063,7 +36369,7 @@ result_t test_vmlsq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlaq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
@@ -35076,9 +36382,9 @@ result_t test_vmlsq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)               \
   for (int i = 0; i < 4; i++) {      \
-    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+    _d[i] = _a[i] + _b[i] * _c[IDX]; \
   }                                  \
-  d = vmlsq_lane_u32(a, b, c, IDX);  \
+  d = vmlaq_lane_u32(a, b, c, IDX);  \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_2_ITER
@@ -35090,7 +36396,7 @@ result_t test_vmlsq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
@@ -35103,9 +36409,9 @@ result_t test_vmlsl_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 4; i++) {                        \
-    _d[i] = _a[i] - (int32_t)_b[i] * (int32_t)_c[IDX]; \
+    _d[i] = _a[i] + (int32_t)_b[i] * (int32_t)_c[IDX]; \
   }                                                    \
-  d = vmlsl_lane_s16(a, b, c, IDX);                    \
+  d = vmlal_lane_s16(a, b, c, IDX);                    \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -35117,7 +36423,7 @@ result_t test_vmlsl_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
@@ -35130,9 +36436,9 @@ result_t test_vmlsl_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 2; i++) {                        \
-    _d[i] = _a[i] - (int64_t)_b[i] * (int64_t)_c[IDX]; \
+    _d[i] = _a[i] + (int64_t)_b[i] * (int64_t)_c[IDX]; \
   }                                                    \
-  d = vmlsl_lane_s32(a, b, c, IDX);                    \
+  d = vmlal_lane_s32(a, b, c, IDX);                    \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -35144,7 +36450,7 @@ result_t test_vmlsl_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
@@ -35157,9 +36463,9 @@ result_t test_vmlsl_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                   \
   for (int i = 0; i < 4; i++) {                          \
-    _d[i] = _a[i] - (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
   }                                                      \
-  d = vmlsl_lane_u16(a, b, c, IDX);                      \
+  d = vmlal_lane_u16(a, b, c, IDX);                      \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -35171,7 +36477,7 @@ result_t test_vmlsl_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
@@ -35184,9 +36490,9 @@ result_t test_vmlsl_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                   \
   for (int i = 0; i < 2; i++) {                          \
-    _d[i] = _a[i] - (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
   }                                                      \
-  d = vmlsl_lane_u32(a, b, c, IDX);                      \
+  d = vmlal_lane_u32(a, b, c, IDX);                      \
   CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -35198,12 +36504,12 @@ result_t test_vmlsl_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
+  int32_t _d[8];
   int32x4_t a = vld1q_s32(_a);
   int16x8_t b = vld1q_s16(_b);
   int16x4_t c = vld1_s16(_c);
@@ -35211,9 +36517,9 @@ result_t test_vmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 4; i++) {                            \
-    _d[i] = _a[i] - (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
+    _d[i] = _a[i] + (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
   }                                                        \
-  d = vmlsl_high_lane_s16(a, b, c, IDX);                   \
+  d = vmlal_high_lane_s16(a, b, c, IDX);                   \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -35225,12 +36531,12 @@ result_t test_vmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d[2];
+  int64_t _d[4];
   int64x2_t a = vld1q_s64(_a);
   int32x4_t b = vld1q_s32(_b);
   int32x2_t c = vld1_s32(_c);
@@ -35238,9 +36544,9 @@ result_t test_vmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 2; i++) {                            \
-    _d[i] = _a[i] - (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
+    _d[i] = _a[i] + (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
   }                                                        \
-  d = vmlsl_high_lane_s32(a, b, c, IDX);                   \
+  d = vmlal_high_lane_s32(a, b, c, IDX);                   \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -35252,12 +36558,12 @@ result_t test_vmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
   const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
+  uint32_t _d[8];
   uint32x4_t a = vld1q_u32(_a);
   uint16x8_t b = vld1q_u16(_b);
   uint16x4_t c = vld1_u16(_c);
@@ -35265,9 +36571,9 @@ result_t test_vmlsl_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 
 #define TEST_IMPL(IDX)                                       \
   for (int i = 0; i < 4; i++) {                              \
-    _d[i] = _a[i] - (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
   }                                                          \
-  d = vmlsl_high_lane_u16(a, b, c, IDX);                     \
+  d = vmlal_high_lane_u16(a, b, c, IDX);                     \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -35279,12 +36585,12 @@ result_t test_vmlsl_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
   const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[2];
+  uint64_t _d[4];
   uint64x2_t a = vld1q_u64(_a);
   uint32x4_t b = vld1q_u32(_b);
   uint32x2_t c = vld1_u32(_c);
@@ -35292,9 +36598,9 @@ result_t test_vmlsl_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 
 #define TEST_IMPL(IDX)                                       \
   for (int i = 0; i < 2; i++) {                              \
-    _d[i] = _a[i] - (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
   }                                                          \
-  d = vmlsl_high_lane_u32(a, b, c, IDX);                     \
+  d = vmlal_high_lane_u32(a, b, c, IDX);                     \
   CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -35306,12 +36612,12 @@ result_t test_vmlsl_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
+  int32_t _d[8];
   int32x4_t a = vld1q_s32(_a);
   int16x4_t b = vld1_s16(_b);
   int16x8_t c = vld1q_s16(_c);
@@ -35319,12 +36625,12 @@ result_t test_vmlsl_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 4; i++) {                        \
-    _d[i] = _a[i] - (int32_t)_b[i] * (int32_t)_c[IDX]; \
+    _d[i] = _a[i] + (int32_t)_b[i] * (int32_t)_c[IDX]; \
   }                                                    \
-  d = vmlsl_laneq_s16(a, b, c, IDX);                   \
+  d = vmlal_laneq_s16(a, b, c, IDX);                   \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35333,12 +36639,12 @@ result_t test_vmlsl_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d[2];
+  int64_t _d[4];
   int64x2_t a = vld1q_s64(_a);
   int32x2_t b = vld1_s32(_b);
   int32x4_t c = vld1q_s32(_c);
@@ -35346,12 +36652,12 @@ result_t test_vmlsl_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 2; i++) {                        \
-    _d[i] = _a[i] - (int64_t)_b[i] * (int64_t)_c[IDX]; \
+    _d[i] = _a[i] + (int64_t)_b[i] * (int64_t)_c[IDX]; \
   }                                                    \
-  d = vmlsl_laneq_s32(a, b, c, IDX);                   \
+  d = vmlal_laneq_s32(a, b, c, IDX);                   \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35360,12 +36666,12 @@ result_t test_vmlsl_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
   const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
+  uint32_t _d[8];
   uint32x4_t a = vld1q_u32(_a);
   uint16x4_t b = vld1_u16(_b);
   uint16x8_t c = vld1q_u16(_c);
@@ -35373,12 +36679,12 @@ result_t test_vmlsl_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                   \
   for (int i = 0; i < 4; i++) {                          \
-    _d[i] = _a[i] - (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
   }                                                      \
-  d = vmlsl_laneq_u16(a, b, c, IDX);                     \
+  d = vmlal_laneq_u16(a, b, c, IDX);                     \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35387,12 +36693,12 @@ result_t test_vmlsl_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
   const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[2];
+  uint64_t _d[4];
   uint64x2_t a = vld1q_u64(_a);
   uint32x2_t b = vld1_u32(_b);
   uint32x4_t c = vld1q_u32(_c);
@@ -35400,12 +36706,12 @@ result_t test_vmlsl_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 #define TEST_IMPL(IDX)                                   \
   for (int i = 0; i < 2; i++) {                          \
-    _d[i] = _a[i] - (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
   }                                                      \
-  d = vmlsl_laneq_u32(a, b, c, IDX);                     \
+  d = vmlal_laneq_u32(a, b, c, IDX);                     \
   CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35414,12 +36720,12 @@ result_t test_vmlsl_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
+  int32_t _d[8];
   int32x4_t a = vld1q_s32(_a);
   int16x8_t b = vld1q_s16(_b);
   int16x8_t c = vld1q_s16(_c);
@@ -35427,12 +36733,12 @@ result_t test_vmlsl_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 4; i++) {                            \
-    _d[i] = _a[i] - (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
+    _d[i] = _a[i] + (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
   }                                                        \
-  d = vmlsl_high_laneq_s16(a, b, c, IDX);                  \
+  d = vmlal_high_laneq_s16(a, b, c, IDX);                  \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35441,12 +36747,12 @@ result_t test_vmlsl_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64_t _d[2];
+  int64_t _d[4];
   int64x2_t a = vld1q_s64(_a);
   int32x4_t b = vld1q_s32(_b);
   int32x4_t c = vld1q_s32(_c);
@@ -35454,12 +36760,12 @@ result_t test_vmlsl_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 2; i++) {                            \
-    _d[i] = _a[i] - (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
+    _d[i] = _a[i] + (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
   }                                                        \
-  d = vmlsl_high_laneq_s32(a, b, c, IDX);                  \
+  d = vmlal_high_laneq_s32(a, b, c, IDX);                  \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35468,12 +36774,12 @@ result_t test_vmlsl_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
   const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
+  uint32_t _d[8];
   uint32x4_t a = vld1q_u32(_a);
   uint16x8_t b = vld1q_u16(_b);
   uint16x8_t c = vld1q_u16(_c);
@@ -35481,12 +36787,12 @@ result_t test_vmlsl_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 
 #define TEST_IMPL(IDX)                                       \
   for (int i = 0; i < 4; i++) {                              \
-    _d[i] = _a[i] - (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
   }                                                          \
-  d = vmlsl_high_laneq_u16(a, b, c, IDX);                    \
+  d = vmlal_high_laneq_u16(a, b, c, IDX);                    \
   CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35495,12 +36801,12 @@ result_t test_vmlsl_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmlsl_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlal_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
   const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[2];
+  uint64_t _d[4];
   uint64x2_t a = vld1q_u64(_a);
   uint32x4_t b = vld1q_u32(_b);
   uint32x4_t c = vld1q_u32(_c);
@@ -35508,12 +36814,12 @@ result_t test_vmlsl_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 
 #define TEST_IMPL(IDX)                                       \
   for (int i = 0; i < 2; i++) {                              \
-    _d[i] = _a[i] - (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
+    _d[i] = _a[i] + (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
   }                                                          \
-  d = vmlsl_high_laneq_u32(a, b, c, IDX);                    \
+  d = vmlal_high_laneq_u32(a, b, c, IDX);                    \
   CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35522,22 +36828,23 @@ result_t test_vmlsl_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int32x4_t a = vld1q_s32(_a);
-  int16x4_t b = vld1_s16(_b);
-  int16x4_t c = vld1_s16(_c);
-  int32x4_t d;
+  int32x4_t a, d;
+  int16x4_t b, c;
   int32_t _d[4];
-
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 4; i++) {                        \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
   }                                                    \
-  d = vqdmlsl_lane_s16(a, b, c, IDX);                  \
+                                                       \
+  a = vld1q_s32(_a);                                   \
+  b = vld1_s16(_b);                                    \
+  c = vld1_s16(_c);                                    \
+  d = vqdmlal_lane_s16(a, b, c, IDX);                  \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -35549,22 +36856,24 @@ result_t test_vqdmlsl_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int64x2_t a = vld1q_s64(_a);
-  int32x2_t b = vld1_s32(_b);
-  int32x2_t c = vld1_s32(_c);
-  int64x2_t d;
+  int64x2_t a, d;
+  int32x2_t b, c;
   int64_t _d[2];
 
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 2; i++) {                        \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
   }                                                    \
-  d = vqdmlsl_lane_s32(a, b, c, IDX);                  \
+                                                       \
+  a = vld1q_s64(_a);                                   \
+  b = vld1_s32(_b);                                    \
+  c = vld1_s32(_c);                                    \
+  d = vqdmlal_lane_s32(a, b, c, IDX);                  \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -35576,17 +36885,17 @@ result_t test_vqdmlsl_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlslh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlalh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32_t _d, d;
   int16x4_t c = vld1_s16(_c);
-  int32_t d, _d;
 
 #define TEST_IMPL(IDX)                            \
-  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlslh_lane_s16(_a[0], _b[0], c, IDX);    \
+  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlalh_lane_s16(_a[0], _b[0], c, IDX);    \
   CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
   IMM_4_ITER
@@ -35598,17 +36907,17 @@ result_t test_vqdmlslh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlals_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64_t _d, d;
   int32x2_t c = vld1_s32(_c);
-  int64_t d, _d;
 
 #define TEST_IMPL(IDX)                            \
-  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlsls_lane_s32(_a[0], _b[0], c, IDX);    \
+  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlals_lane_s32(_a[0], _b[0], c, IDX);    \
   CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
   IMM_2_ITER
@@ -35620,7 +36929,7 @@ result_t test_vqdmlsls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
@@ -35628,14 +36937,14 @@ result_t test_vqdmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
   int32x4_t a = vld1q_s32(_a);
   int16x8_t b = vld1q_s16(_b);
   int16x4_t c = vld1_s16(_c);
+  ;
   int32x4_t d;
   int32_t _d[4];
-
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 4; i++) {                            \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
   }                                                        \
-  d = vqdmlsl_high_lane_s16(a, b, c, IDX);                 \
+  d = vqdmlal_high_lane_s16(a, b, c, IDX);                 \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
@@ -35647,7 +36956,7 @@ result_t test_vqdmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
@@ -35660,9 +36969,9 @@ result_t test_vqdmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
 
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 2; i++) {                            \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
   }                                                        \
-  d = vqdmlsl_high_lane_s32(a, b, c, IDX);                 \
+  d = vqdmlal_high_lane_s32(a, b, c, IDX);                 \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
@@ -35674,22 +36983,22 @@ result_t test_vqdmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32x4_t d;
+  int32_t _d[4];
   int32x4_t a = vld1q_s32(_a);
   int16x4_t b = vld1_s16(_b);
   int16x8_t c = vld1q_s16(_c);
-  int32x4_t d;
-  int32_t _d[4];
 
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 4; i++) {                        \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
   }                                                    \
-  d = vqdmlsl_laneq_s16(a, b, c, IDX);                 \
+  d = vqdmlal_laneq_s16(a, b, c, IDX);                 \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_8_ITER
@@ -35701,25 +37010,25 @@ result_t test_vqdmlsl_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64x2_t d;
   int64x2_t a = vld1q_s64(_a);
   int32x2_t b = vld1_s32(_b);
   int32x4_t c = vld1q_s32(_c);
-  int64x2_t d;
   int64_t _d[2];
 
 #define TEST_IMPL(IDX)                                 \
   for (int i = 0; i < 2; i++) {                        \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i], _c[IDX])); \
   }                                                    \
-  d = vqdmlsl_laneq_s32(a, b, c, IDX);                 \
+  d = vqdmlal_laneq_s32(a, b, c, IDX);                 \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
-  IMM_2_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -35728,17 +37037,17 @@ result_t test_vqdmlsl_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlslh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlalh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32_t _d, d;
   int16x8_t c = vld1q_s16(_c);
-  int32_t d, _d;
 
 #define TEST_IMPL(IDX)                            \
-  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlslh_laneq_s16(_a[0], _b[0], c, IDX);   \
+  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlalh_laneq_s16(_a[0], _b[0], c, IDX);   \
   CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
   IMM_8_ITER
@@ -35750,17 +37059,17 @@ result_t test_vqdmlslh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlals_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64_t _d, d;
   int32x4_t c = vld1q_s32(_c);
-  int64_t d, _d;
 
 #define TEST_IMPL(IDX)                            \
-  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
-  d = vqdmlsls_laneq_s32(_a[0], _b[0], c, IDX);   \
+  _d = sat_add(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlals_laneq_s32(_a[0], _b[0], c, IDX);   \
   CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
   IMM_4_ITER
@@ -35772,22 +37081,22 @@ result_t test_vqdmlsls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32x4_t d;
+  int32_t _d[4];
   int32x4_t a = vld1q_s32(_a);
   int16x8_t b = vld1q_s16(_b);
   int16x8_t c = vld1q_s16(_c);
-  int32x4_t d;
-  int32_t _d[4];
 
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 4; i++) {                            \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
   }                                                        \
-  d = vqdmlsl_high_laneq_s16(a, b, c, IDX);                \
+  d = vqdmlal_high_laneq_s16(a, b, c, IDX);                \
   CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_8_ITER
@@ -35799,22 +37108,22 @@ result_t test_vqdmlsl_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t it
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmlsl_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlal_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64x2_t d;
   int64x2_t a = vld1q_s64(_a);
   int32x4_t b = vld1q_s32(_b);
   int32x4_t c = vld1q_s32(_c);
-  int64x2_t d;
   int64_t _d[2];
 
 #define TEST_IMPL(IDX)                                     \
   for (int i = 0; i < 2; i++) {                            \
-    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
+    _d[i] = sat_add(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
   }                                                        \
-  d = vqdmlsl_high_laneq_s32(a, b, c, IDX);                \
+  d = vqdmlal_high_laneq_s32(a, b, c, IDX);                \
   CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_4_ITER
@@ -35826,21 +37135,23 @@ result_t test_vqdmlsl_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t it
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[4];
   int16x4_t a = vld1_s16(_a);
   int16x4_t b = vld1_s16(_b);
-  int32x4_t c;
-  int32_t _c[4];
+  int16x4_t c = vld1_s16(_c);
+  int16x4_t d;
 
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 4; i++) {                \
-    _c[i] = (int32_t)_a[i] * (int32_t)_b[IDX]; \
-  }                                            \
-  c = vmull_lane_s16(a, b, IDX);               \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_lane_s16(a, b, c, IDX);   \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -35851,21 +37162,23 @@ result_t test_vmull_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[2];
   int32x2_t a = vld1_s32(_a);
   int32x2_t b = vld1_s32(_b);
-  int64x2_t c;
-  int64_t _c[2];
+  int32x2_t c = vld1_s32(_c);
+  int32x2_t d;
 
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 2; i++) {                \
-    _c[i] = (int64_t)_a[i] * (int64_t)_b[IDX]; \
-  }                                            \
-  c = vmull_lane_s32(a, b, IDX);               \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 2; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_lane_s32(a, b, c, IDX);   \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -35876,21 +37189,50 @@ result_t test_vmull_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  const float *_c = (float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t c = vld1_f32(_c);
+  float32x2_t d;
+
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 2; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_lane_f32(a, b, c, IDX);   \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.001f))
+
+  IMM_2_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmls_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint16_t _d[4];
   uint16x4_t a = vld1_u16(_a);
   uint16x4_t b = vld1_u16(_b);
-  uint32x4_t c;
-  uint32_t _c[4];
+  uint16x4_t c = vld1_u16(_c);
+  uint16x4_t d;
 
-#define TEST_IMPL(IDX)                           \
-  for (int i = 0; i < 4; i++) {                  \
-    _c[i] = (uint32_t)_a[i] * (uint32_t)_b[IDX]; \
-  }                                              \
-  c = vmull_lane_u16(a, b, IDX);                 \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_lane_u16(a, b, c, IDX);   \
+  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -35901,21 +37243,23 @@ result_t test_vmull_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[2];
   uint32x2_t a = vld1_u32(_a);
   uint32x2_t b = vld1_u32(_b);
-  uint64x2_t c;
-  uint64_t _c[2];
+  uint32x2_t c = vld1_u32(_c);
+  uint32x2_t d;
 
-#define TEST_IMPL(IDX)                           \
-  for (int i = 0; i < 2; i++) {                  \
-    _c[i] = (uint64_t)_a[i] * (uint64_t)_b[IDX]; \
-  }                                              \
-  c = vmull_lane_u32(a, b, IDX);                 \
-  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 2; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_lane_u32(a, b, c, IDX);   \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -35926,21 +37270,23 @@ result_t test_vmull_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
   int16x8_t a = vld1q_s16(_a);
-  int16x4_t b = vld1_s16(_b);
-  int32x4_t c;
-  int32_t _c[4];
+  int16x8_t b = vld1q_s16(_b);
+  int16x4_t c = vld1_s16(_c);
+  int16x8_t d;
 
-#define TEST_IMPL(IDX)                             \
-  for (int i = 0; i < 4; i++) {                    \
-    _c[i] = (int32_t)_a[i + 4] * (int32_t)_b[IDX]; \
-  }                                                \
-  c = vmull_high_lane_s16(a, b, IDX);              \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 8; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_lane_s16(a, b, c, IDX);  \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -35951,21 +37297,23 @@ result_t test_vmull_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
   int32x4_t a = vld1q_s32(_a);
-  int32x2_t b = vld1_s32(_b);
-  int64x2_t c;
-  int64_t _c[2];
+  int32x4_t b = vld1q_s32(_b);
+  int32x2_t c = vld1_s32(_c);
+  int32x4_t d;
 
-#define TEST_IMPL(IDX)                             \
-  for (int i = 0; i < 2; i++) {                    \
-    _c[i] = (int64_t)_a[i + 2] * (int64_t)_b[IDX]; \
-  }                                                \
-  c = vmull_high_lane_s32(a, b, IDX);              \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_lane_s32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -35976,23 +37324,25 @@ result_t test_vmull_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
-  uint16x8_t a = vld1q_u16(_a);
-  uint16x4_t b = vld1_u16(_b);
-  uint32x4_t c;
-  uint32_t _c[4];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  const float *_c = (float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x2_t c = vld1_f32(_c);
+  float32x4_t d;
 
-#define TEST_IMPL(IDX)                               \
-  for (int i = 0; i < 4; i++) {                      \
-    _c[i] = (uint32_t)_a[i + 4] * (uint32_t)_b[IDX]; \
-  }                                                  \
-  c = vmull_high_lane_u16(a, b, IDX);                \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_lane_f32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.001f))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36001,23 +37351,25 @@ result_t test_vmull_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
-  uint32x4_t a = vld1q_u32(_a);
-  uint32x2_t b = vld1_u32(_b);
-  uint64x2_t c;
-  uint64_t _c[2];
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[4];
+  int16x4_t a = vld1_s16(_a);
+  int16x4_t b = vld1_s16(_b);
+  int16x8_t c = vld1q_s16(_c);
+  int16x4_t d;
 
-#define TEST_IMPL(IDX)                               \
-  for (int i = 0; i < 2; i++) {                      \
-    _c[i] = (uint64_t)_a[i + 2] * (uint64_t)_b[IDX]; \
-  }                                                  \
-  c = vmull_high_lane_u32(a, b, IDX);                \
-  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_laneq_s16(a, b, c, IDX);  \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_2_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36026,21 +37378,23 @@ result_t test_vmull_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x4_t a = vld1_s16(_a);
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
+  int16x8_t a = vld1q_s16(_a);
   int16x8_t b = vld1q_s16(_b);
-  int32x4_t c;
-  int32_t _c[4];
+  int16x8_t c = vld1q_s16(_c);
+  int16x8_t d;
 
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 4; i++) {                \
-    _c[i] = (int32_t)_a[i] * (int32_t)_b[IDX]; \
-  }                                            \
-  c = vmull_laneq_s16(a, b, IDX);              \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 8; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_laneq_s16(a, b, c, IDX); \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
   IMM_8_ITER
 #undef TEST_IMPL
@@ -36051,21 +37405,50 @@ result_t test_vmull_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[2];
   int32x2_t a = vld1_s32(_a);
+  int32x2_t b = vld1_s32(_b);
+  int32x4_t c = vld1q_s32(_c);
+  int32x2_t d;
+
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 2; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_laneq_s32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmlsq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a = vld1q_s32(_a);
   int32x4_t b = vld1q_s32(_b);
-  int64x2_t c;
-  int64_t _c[2];
+  int32x4_t c = vld1q_s32(_c);
+  int32x4_t d;
 
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 2; i++) {                \
-    _c[i] = (int64_t)_a[i] * (int64_t)_b[IDX]; \
-  }                                            \
-  c = vmull_laneq_s32(a, b, IDX);              \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_laneq_s32(a, b, c, IDX); \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36076,21 +37459,50 @@ result_t test_vmull_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint16_t _d[4];
   uint16x4_t a = vld1_u16(_a);
+  uint16x4_t b = vld1_u16(_b);
+  uint16x8_t c = vld1q_u16(_c);
+  uint16x4_t d;
+
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_laneq_u16(a, b, c, IDX);  \
+  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3]))
+
+  IMM_8_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmlsq_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint16_t _d[8];
+  uint16x8_t a = vld1q_u16(_a);
   uint16x8_t b = vld1q_u16(_b);
-  uint32x4_t c;
-  uint32_t _c[4];
+  uint16x8_t c = vld1q_u16(_c);
+  uint16x8_t d;
 
-#define TEST_IMPL(IDX)                           \
-  for (int i = 0; i < 4; i++) {                  \
-    _c[i] = (uint32_t)_a[i] * (uint32_t)_b[IDX]; \
-  }                                              \
-  c = vmull_laneq_u16(a, b, IDX);                \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 8; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_laneq_u16(a, b, c, IDX); \
+  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
   IMM_8_ITER
 #undef TEST_IMPL
@@ -36101,21 +37513,50 @@ result_t test_vmull_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[2];
   uint32x2_t a = vld1_u32(_a);
+  uint32x2_t b = vld1_u32(_b);
+  uint32x4_t c = vld1q_u32(_c);
+  uint32x2_t d;
+
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 2; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_laneq_u32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1]))
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vmlsq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
+  uint32x4_t a = vld1q_u32(_a);
   uint32x4_t b = vld1q_u32(_b);
-  uint64x2_t c;
-  uint64_t _c[2];
+  uint32x4_t c = vld1q_u32(_c);
+  uint32x4_t d;
 
-#define TEST_IMPL(IDX)                           \
-  for (int i = 0; i < 2; i++) {                  \
-    _c[i] = (uint64_t)_a[i] * (uint64_t)_b[IDX]; \
-  }                                              \
-  c = vmull_laneq_u32(a, b, IDX);                \
-  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_laneq_u32(a, b, c, IDX); \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36126,23 +37567,25 @@ result_t test_vmull_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmls_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x8_t a = vld1q_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int32x4_t c;
-  int32_t _c[4];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  const float *_c = (float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x4_t c = vld1q_f32(_c);
+  float32x2_t d;
 
-#define TEST_IMPL(IDX)                             \
-  for (int i = 0; i < 4; i++) {                    \
-    _c[i] = (int32_t)_a[i + 4] * (int32_t)_b[IDX]; \
-  }                                                \
-  c = vmull_high_laneq_s16(a, b, IDX);             \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 2; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmls_laneq_f32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.001f))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36151,21 +37594,23 @@ result_t test_vmull_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x4_t a = vld1q_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int64x2_t c;
-  int64_t _c[2];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  const float *_c = (float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t c = vld1q_f32(_c);
+  float32x4_t d;
 
-#define TEST_IMPL(IDX)                             \
-  for (int i = 0; i < 2; i++) {                    \
-    _c[i] = (int64_t)_a[i + 2] * (int64_t)_b[IDX]; \
-  }                                                \
-  c = vmull_high_laneq_s32(a, b, IDX);             \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_laneq_f32(a, b, c, IDX); \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.001f))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36176,23 +37621,25 @@ result_t test_vmull_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsq_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
   const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint16_t _d[8];
   uint16x8_t a = vld1q_u16(_a);
   uint16x8_t b = vld1q_u16(_b);
-  uint32x4_t c;
-  uint32_t _c[4];
+  uint16x4_t c = vld1_u16(_c);
+  uint16x8_t d;
 
-#define TEST_IMPL(IDX)                               \
-  for (int i = 0; i < 4; i++) {                      \
-    _c[i] = (uint32_t)_a[i + 4] * (uint32_t)_b[IDX]; \
-  }                                                  \
-  c = vmull_high_laneq_u16(a, b, IDX);               \
-  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 8; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_lane_u16(a, b, c, IDX);  \
+  CHECK_RESULT(validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36201,23 +37648,25 @@ result_t test_vmull_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vmull_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
   const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
   uint32x4_t a = vld1q_u32(_a);
   uint32x4_t b = vld1q_u32(_b);
-  uint64x2_t c;
-  uint64_t _c[2];
+  uint32x2_t c = vld1_u32(_c);
+  uint32x4_t d;
 
-#define TEST_IMPL(IDX)                               \
-  for (int i = 0; i < 2; i++) {                      \
-    _c[i] = (uint64_t)_a[i + 2] * (uint64_t)_b[IDX]; \
-  }                                                  \
-  c = vmull_high_laneq_u32(a, b, IDX);               \
-  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)               \
+  for (int i = 0; i < 4; i++) {      \
+    _d[i] = _a[i] - _b[i] * _c[IDX]; \
+  }                                  \
+  d = vmlsq_lane_u32(a, b, c, IDX);  \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36226,21 +37675,23 @@ result_t test_vmull_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmull_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int32_t _c[4];
-  int16x4_t a = vld1_s16(_a);
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a = vld1q_s32(_a);
   int16x4_t b = vld1_s16(_b);
-  int32x4_t c;
+  int16x4_t c = vld1_s16(_c);
+  int32x4_t d;
 
-#define TEST_IMPL(IDX)                 \
-  for (int i = 0; i < 4; i++) {        \
-    _c[i] = sat_dmull(_a[i], _b[IDX]); \
-  }                                    \
-  c = vqdmull_lane_s16(a, b, IDX);     \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _d[i] = _a[i] - (int32_t)_b[i] * (int32_t)_c[IDX]; \
+  }                                                    \
+  d = vmlsl_lane_s16(a, b, c, IDX);                    \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36251,21 +37702,23 @@ result_t test_vqdmull_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmull_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int64_t _c[2];
-  int32x2_t a = vld1_s32(_a);
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64_t _d[2];
+  int64x2_t a = vld1q_s64(_a);
   int32x2_t b = vld1_s32(_b);
-  int64x2_t c;
+  int32x2_t c = vld1_s32(_c);
+  int64x2_t d;
 
-#define TEST_IMPL(IDX)                 \
-  for (int i = 0; i < 2; i++) {        \
-    _c[i] = sat_dmull(_a[i], _b[IDX]); \
-  }                                    \
-  c = vqdmull_lane_s32(a, b, IDX);     \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _d[i] = _a[i] - (int64_t)_b[i] * (int64_t)_c[IDX]; \
+  }                                                    \
+  d = vmlsl_lane_s32(a, b, c, IDX);                    \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -36276,17 +37729,23 @@ result_t test_vqdmull_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmullh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x4_t b = vld1_s16(_b);
-  int32_t c, _c;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x4_t b = vld1_u16(_b);
+  uint16x4_t c = vld1_u16(_c);
+  uint32x4_t d;
 
-#define TEST_IMPL(IDX)                  \
-  _c = sat_dmull(_a[0], _b[IDX]);       \
-  c = vqdmullh_lane_s16(_a[0], b, IDX); \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)                                   \
+  for (int i = 0; i < 4; i++) {                          \
+    _d[i] = _a[i] - (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
+  }                                                      \
+  d = vmlsl_lane_u16(a, b, c, IDX);                      \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36297,17 +37756,23 @@ result_t test_vqdmullh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x2_t b = vld1_s32(_b);
-  int64_t c, _c;
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint64_t _d[2];
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x2_t b = vld1_u32(_b);
+  uint32x2_t c = vld1_u32(_c);
+  uint64x2_t d;
 
-#define TEST_IMPL(IDX)                  \
-  _c = sat_dmull(_a[0], _b[IDX]);       \
-  c = vqdmulls_lane_s32(_a[0], b, IDX); \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)                                   \
+  for (int i = 0; i < 2; i++) {                          \
+    _d[i] = _a[i] - (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
+  }                                                      \
+  d = vmlsl_lane_u32(a, b, c, IDX);                      \
+  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -36318,21 +37783,23 @@ result_t test_vqdmulls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmull_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x8_t a = vld1q_s16(_a);
-  int16x4_t b = vld1_s16(_b);
-  int32x4_t c;
-  int32_t _c[4];
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a = vld1q_s32(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x4_t c = vld1_s16(_c);
+  int32x4_t d;
 
-#define TEST_IMPL(IDX)                     \
-  for (int i = 0; i < 4; i++) {            \
-    _c[i] = sat_dmull(_a[i + 4], _b[IDX]); \
-  }                                        \
-  c = vqdmull_high_lane_s16(a, b, IDX);    \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 4; i++) {                            \
+    _d[i] = _a[i] - (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
+  }                                                        \
+  d = vmlsl_high_lane_s16(a, b, c, IDX);                   \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36343,21 +37810,23 @@ result_t test_vqdmull_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmull_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x4_t a = vld1q_s32(_a);
-  int32x2_t b = vld1_s32(_b);
-  int64x2_t c;
-  int64_t _c[2];
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64_t _d[2];
+  int64x2_t a = vld1q_s64(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x2_t c = vld1_s32(_c);
+  int64x2_t d;
 
-#define TEST_IMPL(IDX)                     \
-  for (int i = 0; i < 2; i++) {            \
-    _c[i] = sat_dmull(_a[i + 2], _b[IDX]); \
-  }                                        \
-  c = vqdmull_high_lane_s32(a, b, IDX);    \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 2; i++) {                            \
+    _d[i] = _a[i] - (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
+  }                                                        \
+  d = vmlsl_high_lane_s32(a, b, c, IDX);                   \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -36368,23 +37837,25 @@ result_t test_vqdmull_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t ite
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmull_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int32_t _c[4];
-  int16x4_t a = vld1_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int32x4_t c;
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint16x4_t c = vld1_u16(_c);
+  uint32x4_t d;
 
-#define TEST_IMPL(IDX)                 \
-  for (int i = 0; i < 4; i++) {        \
-    _c[i] = sat_dmull(_a[i], _b[IDX]); \
-  }                                    \
-  c = vqdmull_laneq_s16(a, b, IDX);    \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                       \
+  for (int i = 0; i < 4; i++) {                              \
+    _d[i] = _a[i] - (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
+  }                                                          \
+  d = vmlsl_high_lane_u16(a, b, c, IDX);                     \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36393,23 +37864,25 @@ result_t test_vqdmull_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmull_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int64_t _c[2];
-  int32x2_t a = vld1_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int64x2_t c;
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint64_t _d[2];
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint32x2_t c = vld1_u32(_c);
+  uint64x2_t d;
 
-#define TEST_IMPL(IDX)                 \
-  for (int i = 0; i < 2; i++) {        \
-    _c[i] = sat_dmull(_a[i], _b[IDX]); \
-  }                                    \
-  c = vqdmull_laneq_s32(a, b, IDX);    \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)                                       \
+  for (int i = 0; i < 2; i++) {                              \
+    _d[i] = _a[i] - (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
+  }                                                          \
+  d = vmlsl_high_lane_u32(a, b, c, IDX);                     \
+  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36418,25 +37891,23 @@ result_t test_vqdmull_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmullh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqdmulls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqdmull_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x8_t a = vld1q_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int32x4_t c;
-  int32_t _c[4];
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a = vld1q_s32(_a);
+  int16x4_t b = vld1_s16(_b);
+  int16x8_t c = vld1q_s16(_c);
+  int32x4_t d;
 
-#define TEST_IMPL(IDX)                     \
-  for (int i = 0; i < 4; i++) {            \
-    _c[i] = sat_dmull(_a[i + 4], _b[IDX]); \
-  }                                        \
-  c = vqdmull_high_laneq_s16(a, b, IDX);   \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _d[i] = _a[i] - (int32_t)_b[i] * (int32_t)_c[IDX]; \
+  }                                                    \
+  d = vmlsl_laneq_s16(a, b, c, IDX);                   \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_8_ITER
 #undef TEST_IMPL
@@ -36447,21 +37918,23 @@ result_t test_vqdmull_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t it
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmull_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x4_t a = vld1q_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int64x2_t c;
-  int64_t _c[2];
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64_t _d[2];
+  int64x2_t a = vld1q_s64(_a);
+  int32x2_t b = vld1_s32(_b);
+  int32x4_t c = vld1q_s32(_c);
+  int64x2_t d;
 
-#define TEST_IMPL(IDX)                     \
-  for (int i = 0; i < 2; i++) {            \
-    _c[i] = sat_dmull(_a[i + 2], _b[IDX]); \
-  }                                        \
-  c = vqdmull_high_laneq_s32(a, b, IDX);   \
-  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _d[i] = _a[i] - (int64_t)_b[i] * (int64_t)_c[IDX]; \
+  }                                                    \
+  d = vmlsl_laneq_s32(a, b, c, IDX);                   \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36472,25 +37945,25 @@ result_t test_vqdmull_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t it
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x8_t a, c;
-  int16x4_t b;
-  int16_t _c[8];
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x4_t b = vld1_u16(_b);
+  uint16x8_t c = vld1q_u16(_c);
+  uint32x4_t d;
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 8; i++) {                                               \
-    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
-  }                                                                            \
-                                                                               \
-  a = vld1q_s16(_a);                                                           \
-  b = vld1_s16(_b);                                                            \
-  c = vqdmulhq_lane_s16(a, b, IDX);                                           \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
+#define TEST_IMPL(IDX)                                   \
+  for (int i = 0; i < 4; i++) {                          \
+    _d[i] = _a[i] - (uint32_t)_b[i] * (uint32_t)_c[IDX]; \
+  }                                                      \
+  d = vmlsl_laneq_u16(a, b, c, IDX);                     \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_4_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36499,25 +37972,25 @@ result_t test_vqdmulhq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x4_t a, c;
-  int32x2_t b;
-  int32_t _c[4];
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint64_t _d[2];
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x2_t b = vld1_u32(_b);
+  uint32x4_t c = vld1q_u32(_c);
+  uint64x2_t d;
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 4; i++) {                                               \
-    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
-  }                                                                            \
-                                                                               \
-  a = vld1q_s32(_a);                                                           \
-  b = vld1_s32(_b);                                                            \
-  c = vqdmulhq_lane_s32(a, b, IDX);                                           \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                   \
+  for (int i = 0; i < 2; i++) {                          \
+    _d[i] = _a[i] - (uint64_t)_b[i] * (uint64_t)_c[IDX]; \
+  }                                                      \
+  d = vmlsl_laneq_u32(a, b, c, IDX);                     \
+  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
-  IMM_2_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36526,19 +37999,25 @@ result_t test_vqdmulhq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x4_t v = vld1_s16(_b);
-  int16_t c, _c;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a = vld1q_s32(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x8_t c = vld1q_s16(_c);
+  int32x4_t d;
 
-#define TEST_IMPL(IDX)                                                        \
-  _c = saturate_int16((int32_t)_a[0] * (int32_t)_b[IDX] >> 15);             \
-  c = vqdmulhh_lane_s16(_a[0], v, IDX);                                       \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 4; i++) {                            \
+    _d[i] = _a[i] - (int32_t)_b[i + 4] * (int32_t)_c[IDX]; \
+  }                                                        \
+  d = vmlsl_high_laneq_s16(a, b, c, IDX);                  \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_4_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36547,19 +38026,25 @@ result_t test_vqdmulhh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x2_t v = vld1_s32(_b);
-  int32_t c, _c;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64_t _d[2];
+  int64x2_t a = vld1q_s64(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x4_t c = vld1q_s32(_c);
+  int64x2_t d;
 
-#define TEST_IMPL(IDX)                                                       \
-  _c = saturate_int32((int64_t)_a[0] * (int64_t)_b[IDX] >> 31);            \
-  c = vqdmulhs_lane_s32(_a[0], v, IDX);                                      \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 2; i++) {                            \
+    _d[i] = _a[i] - (int64_t)_b[i + 2] * (int64_t)_c[IDX]; \
+  }                                                        \
+  d = vmlsl_high_laneq_s32(a, b, c, IDX);                  \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
-  IMM_2_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36568,23 +38053,23 @@ result_t test_vqdmulhs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x4_t a;
-  int16x8_t v;
-  int16x4_t c;
-  int16_t _c[4];
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (uint16_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
+  uint32x4_t a = vld1q_u32(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint16x8_t c = vld1q_u16(_c);
+  uint32x4_t d;
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 4; i++) {                                               \
-    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
-  }                                                                            \
-  a = vld1_s16(_a);                                                            \
-  v = vld1q_s16(_b);                                                           \
-  c = vqdmulh_laneq_s16(a, v, IDX);                                           \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                       \
+  for (int i = 0; i < 4; i++) {                              \
+    _d[i] = _a[i] - (uint32_t)_b[i + 4] * (uint32_t)_c[IDX]; \
+  }                                                          \
+  d = vmlsl_high_laneq_u16(a, b, c, IDX);                    \
+  CHECK_RESULT(validate_uint32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_8_ITER
 #undef TEST_IMPL
@@ -36595,23 +38080,25 @@ result_t test_vqdmulh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmlsl_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x8_t a, v, c;
-  int16_t _c[8];
+  const uint64_t *_a = (uint64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (uint32_t *)impl.test_cases_int_pointer3;
+  uint64_t _d[2];
+  uint64x2_t a = vld1q_u64(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint32x4_t c = vld1q_u32(_c);
+  uint64x2_t d;
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 8; i++) {                                               \
-    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
-  }                                                                            \
-  a = vld1q_s16(_a);                                                           \
-  v = vld1q_s16(_b);                                                           \
-  c = vqdmulhq_laneq_s16(a, v, IDX);                                          \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
+#define TEST_IMPL(IDX)                                       \
+  for (int i = 0; i < 2; i++) {                              \
+    _d[i] = _a[i] - (uint64_t)_b[i + 2] * (uint64_t)_c[IDX]; \
+  }                                                          \
+  d = vmlsl_high_laneq_u32(a, b, c, IDX);                    \
+  CHECK_RESULT(validate_uint64(d, _d[0], _d[1]))
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36620,22 +38107,23 @@ result_t test_vqdmulhq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulh_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x2_t a, c;
-  int32x4_t v;
-  int32_t _c[2];
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32x4_t a = vld1q_s32(_a);
+  int16x4_t b = vld1_s16(_b);
+  int16x4_t c = vld1_s16(_c);
+  int32x4_t d;
+  int32_t _d[4];
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 2; i++) {                                               \
-    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
-  }                                                                            \
-  a = vld1_s32(_a);                                                            \
-  v = vld1q_s32(_b);                                                           \
-  c = vqdmulh_laneq_s32(a, v, IDX);                                           \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+  }                                                    \
+  d = vqdmlsl_lane_s16(a, b, c, IDX);                  \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36646,23 +38134,25 @@ result_t test_vqdmulh_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x4_t a, v, c;
-  int32_t _c[4];
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64x2_t a = vld1q_s64(_a);
+  int32x2_t b = vld1_s32(_b);
+  int32x2_t c = vld1_s32(_c);
+  int64x2_t d;
+  int64_t _d[2];
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 4; i++) {                                               \
-    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
-  }                                                                            \
-  a = vld1q_s32(_a);                                                           \
-  v = vld1q_s32(_b);                                                           \
-  c = vqdmulhq_laneq_s32(a, v, IDX);                                          \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+  }                                                    \
+  d = vqdmlsl_lane_s32(a, b, c, IDX);                  \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36671,19 +38161,20 @@ result_t test_vqdmulhq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlslh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x8_t v = vld1q_s16(_b);
-  int16_t c, _c;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16x4_t c = vld1_s16(_c);
+  int32_t d, _d;
 
-#define TEST_IMPL(IDX)                                                        \
-  _c = saturate_int16((int32_t)_a[0] * (int32_t)_b[IDX] >> 15);             \
-  c = vqdmulhh_laneq_s16(_a[0], v, IDX);                                      \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)                            \
+  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlslh_lane_s16(_a[0], _b[0], c, IDX);    \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-  IMM_8_ITER
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36692,19 +38183,20 @@ result_t test_vqdmulhh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulhs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x4_t v = vld1q_s32(_b);
-  int32_t c, _c;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32x2_t c = vld1_s32(_c);
+  int64_t d, _d;
 
-#define TEST_IMPL(IDX)                                                       \
-  _c = saturate_int32((int64_t)_a[0] * (int64_t)_b[IDX] >> 31);            \
-  c = vqdmulhs_laneq_s32(_a[0], v, IDX);                                     \
-  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)                            \
+  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlsls_lane_s32(_a[0], _b[0], c, IDX);    \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-  IMM_4_ITER
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36713,21 +38205,23 @@ result_t test_vqdmulhs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16x4_t a, b, c;
-  int16_t _c[4];
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32x4_t a = vld1q_s32(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x4_t c = vld1_s16(_c);
+  int32x4_t d;
+  int32_t _d[4];
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 4; i++) {                                               \
-    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
-  }                                                                            \
-  a = vld1_s16(_a);                                                            \
-  b = vld1_s16(_b);                                                            \
-  c = vqdmulh_lane_s16(a, b, IDX);                                            \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 4; i++) {                            \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
+  }                                                        \
+  d = vqdmlsl_high_lane_s16(a, b, c, IDX);                 \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36738,21 +38232,23 @@ result_t test_vqdmulh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqdmulh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32x2_t a, b, c;
-  int32_t _c[2];
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64x2_t a = vld1q_s64(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x2_t c = vld1_s32(_c);
+  int64x2_t d;
+  int64_t _d[2];
 
-#define TEST_IMPL(IDX)                                                        \
-  for (int i = 0; i < 2; i++) {                                               \
-    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
-  }                                                                            \
-  a = vld1_s32(_a);                                                            \
-  b = vld1_s32(_b);                                                            \
-  c = vqdmulh_lane_s32(a, b, IDX);                                            \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 2; i++) {                            \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
+  }                                                        \
+  d = vqdmlsl_high_lane_s32(a, b, c, IDX);                 \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -36763,25 +38259,25 @@ result_t test_vqdmulh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmulhq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t _c[8];
-  int16x8_t a, c;
-  int16x4_t b;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32x4_t a = vld1q_s32(_a);
+  int16x4_t b = vld1_s16(_b);
+  int16x8_t c = vld1q_s16(_c);
+  int32x4_t d;
+  int32_t _d[4];
 
-#define TEST_IMPL(IDX)                  \
-  for (int i = 0; i < 8; i++) {         \
-    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
-  }                                     \
-                                        \
-  a = vld1q_s16(_a);                    \
-  b = vld1_s16(_b);                     \
-  c = vqrdmulhq_lane_s16(a, b, IDX);    \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+  }                                                    \
+  d = vqdmlsl_laneq_s16(a, b, c, IDX);                 \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_4_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36790,22 +38286,23 @@ result_t test_vqrdmulhq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmulhq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t _c[4];
-  int32x4_t a, c;
-  int32x2_t b;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int64x2_t a = vld1q_s64(_a);
+  int32x2_t b = vld1_s32(_b);
+  int32x4_t c = vld1q_s32(_c);
+  int64x2_t d;
+  int64_t _d[2];
 
-#define TEST_IMPL(IDX)                  \
-  for (int i = 0; i < 4; i++) {         \
-    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
-  }                                     \
-  a = vld1q_s32(_a);                    \
-  b = vld1_s32(_b);                     \
-  c = vqrdmulhq_lane_s32(a, b, IDX);    \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i], _c[IDX])); \
+  }                                                    \
+  d = vqdmlsl_laneq_s32(a, b, c, IDX);                 \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
@@ -36816,38 +38313,40 @@ result_t test_vqrdmulhq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmulhh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmulhs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmulh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmulhq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmulh_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmlslh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16x8_t c = vld1q_s16(_c);
+  int32_t d, _d;
 
-result_t test_vqrdmulhq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                            \
+  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlslh_laneq_s16(_a[0], _b[0], c, IDX);   \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vqrdmulhh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vqrdmulhs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vqrdmulh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t _c[4];
-  int16x4_t a, b, c;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32x4_t c = vld1q_s32(_c);
+  int64_t d, _d;
 
-#define TEST_IMPL(IDX)                  \
-  for (int i = 0; i < 4; i++) {         \
-    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
-  }                                     \
-                                        \
-  a = vld1_s16(_a);                     \
-  b = vld1_s16(_b);                     \
-  c = vqrdmulh_lane_s16(a, b, IDX);     \
-  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                            \
+  _d = sat_sub(_a[0], sat_dmull(_b[0], _c[IDX])); \
+  d = vqdmlsls_laneq_s32(_a[0], _b[0], c, IDX);   \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -36858,23 +38357,25 @@ result_t test_vqrdmulh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmulh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t _c[2];
-  int32x2_t a, b, c;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int32x4_t a = vld1q_s32(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x8_t c = vld1q_s16(_c);
+  int32x4_t d;
+  int32_t _d[4];
 
-#define TEST_IMPL(IDX)                  \
-  for (int i = 0; i < 2; i++) {         \
-    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
-  }                                     \
-  a = vld1_s32(_a);                     \
-  b = vld1_s32(_b);                     \
-  c = vqrdmulh_lane_s32(a, b, IDX);     \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 4; i++) {                            \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 4], _c[IDX])); \
+  }                                                        \
+  d = vqdmlsl_high_laneq_s16(a, b, c, IDX);                \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
-  IMM_2_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -36883,346 +38384,248 @@ result_t test_vqrdmulh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlahq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vqdmlsl_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[8];
-  int16x8_t a, b, d;
-  int16x4_t c;
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 8; i++) {                \
-    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
-  }                                            \
-  a = vld1q_s16(_a);                           \
-  b = vld1q_s16(_b);                           \
-  c = vld1_s16(_c);                            \
-  d = vqrdmlahq_lane_s16(a, b, c, IDX);
-
-  IMM_4_ITER
-#undef TEST_IMPL
-
-  return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
-#endif
-#else
-  return TEST_UNIMPL;
-#endif  // ENABLE_TEST_ALL
-}
-
-result_t test_vqrdmlah_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmlahq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmlahq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int64_t *_a = (int64_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  int32x4_t a, b, d;
-  int32x2_t c;
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 4; i++) {                \
-    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
-  }                                            \
-  a = vld1q_s32(_a);                           \
-  b = vld1q_s32(_b);                           \
-  c = vld1_s32(_c);                            \
-  d = vqrdmlahq_lane_s32(a, b, c, IDX);
+  int64x2_t a = vld1q_s64(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x4_t c = vld1q_s32(_c);
+  int64x2_t d;
+  int64_t _d[2];
 
-  IMM_2_ITER
+#define TEST_IMPL(IDX)                                     \
+  for (int i = 0; i < 2; i++) {                            \
+    _d[i] = sat_sub(_a[i], sat_dmull(_b[i + 2], _c[IDX])); \
+  }                                                        \
+  d = vqdmlsl_high_laneq_s32(a, b, c, IDX);                \
+  CHECK_RESULT(validate_int64(d, _d[0], _d[1]))
+
+  IMM_4_ITER
 #undef TEST_IMPL
 
-  return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
-}  // namespace NEON2RVV
-
-result_t test_vqrdmlah_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmlahq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+}
 
-result_t test_vqrdmlah_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[4];
-  int16x4_t a, b, c, d;
+  int16x4_t a = vld1_s16(_a);
+  int16x4_t b = vld1_s16(_b);
+  int32x4_t c;
+  int32_t _c[4];
+
 #define TEST_IMPL(IDX)                         \
   for (int i = 0; i < 4; i++) {                \
-    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
+    _c[i] = (int32_t)_a[i] * (int32_t)_b[IDX]; \
   }                                            \
-  a = vld1_s16(_a);                            \
-  b = vld1_s16(_b);                            \
-  c = vld1_s16(_c);                            \
-  d = vqrdmlah_lane_s16(a, b, c, IDX);
+  c = vmull_lane_s16(a, b, IDX);               \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
 
-  return validate_int16(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlah_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[2];
-  int32x2_t a, b, c, d;
+  int32x2_t a = vld1_s32(_a);
+  int32x2_t b = vld1_s32(_b);
+  int64x2_t c;
+  int64_t _c[2];
+
 #define TEST_IMPL(IDX)                         \
   for (int i = 0; i < 2; i++) {                \
-    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
+    _c[i] = (int64_t)_a[i] * (int64_t)_b[IDX]; \
   }                                            \
-  a = vld1_s32(_a);                            \
-  b = vld1_s32(_b);                            \
-  c = vld1_s32(_c);                            \
-  d = vqrdmlah_lane_s32(a, b, c, IDX);
+  c = vmull_lane_s32(a, b, IDX);               \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
 
-  return validate_int32(d, _d[0], _d[1]);
-#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlshq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[8];
-  int16x8_t a, b, d;
-  int16x4_t c;
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 8; i++) {                \
-    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
-  }                                            \
-  a = vld1q_s16(_a);                           \
-  b = vld1q_s16(_b);                           \
-  c = vld1_s16(_c);                            \
-  d = vqrdmlshq_lane_s16(a, b, c, IDX);
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16x4_t a = vld1_u16(_a);
+  uint16x4_t b = vld1_u16(_b);
+  uint32x4_t c;
+  uint32_t _c[4];
+
+#define TEST_IMPL(IDX)                           \
+  for (int i = 0; i < 4; i++) {                  \
+    _c[i] = (uint32_t)_a[i] * (uint32_t)_b[IDX]; \
+  }                                              \
+  c = vmull_lane_u16(a, b, IDX);                 \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
 
-  return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
-#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlsh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmlshq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vqrdmlshq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  const int64_t round_const = (int64_t)1 << 31;
-  int32x4_t a, b, d;
-  int32x2_t c;
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 4; i++) {                \
-    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
-  }                                            \
-  a = vld1q_s32(_a);                           \
-  b = vld1q_s32(_b);                           \
-  c = vld1_s32(_c);                            \
-  d = vqrdmlshq_lane_s32(a, b, c, IDX);
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32x2_t a = vld1_u32(_a);
+  uint32x2_t b = vld1_u32(_b);
+  uint64x2_t c;
+  uint64_t _c[2];
+
+#define TEST_IMPL(IDX)                           \
+  for (int i = 0; i < 2; i++) {                  \
+    _c[i] = (uint64_t)_a[i] * (uint64_t)_b[IDX]; \
+  }                                              \
+  c = vmull_lane_u32(a, b, IDX);                 \
+  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
 
   IMM_2_ITER
 #undef TEST_IMPL
 
-  return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlsh_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[2];
-  int32x2_t a, b, d;
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t a = vld1q_s16(_a);
+  int16x4_t b = vld1_s16(_b);
   int32x4_t c;
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 2; i++) {                \
-    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
-  }                                            \
-  a = vld1_s32(_a);                            \
-  b = vld1_s32(_b);                            \
-  c = vld1q_s32(_c);                           \
-  d = vqrdmlsh_laneq_s32(a, b, c, IDX);        \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
+  int32_t _c[4];
+
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 4; i++) {                    \
+    _c[i] = (int32_t)_a[i + 4] * (int32_t)_b[IDX]; \
+  }                                                \
+  c = vmull_high_lane_s16(a, b, IDX);              \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
-#endif
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlshq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  int32x4_t a, b, c, d;
-#define TEST_IMPL(IDX)                         \
-  for (int i = 0; i < 4; i++) {                \
-    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
-  }                                            \
-  a = vld1q_s32(_a);                           \
-  b = vld1q_s32(_b);                           \
-  c = vld1q_s32(_c);                           \
-  d = vqrdmlshq_laneq_s32(a, b, c, IDX);       \
-  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
+  int32x4_t a = vld1q_s32(_a);
+  int32x2_t b = vld1_s32(_b);
+  int64x2_t c;
+  int64_t _c[2];
 
-  IMM_4_ITER
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 2; i++) {                    \
+    _c[i] = (int64_t)_a[i + 2] * (int64_t)_b[IDX]; \
+  }                                                \
+  c = vmull_high_lane_s32(a, b, IDX);              \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
-#endif
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlahh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_high_lane_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d = sat_rdmlah(_a[0], _b[0], _c[0]);
-  int16_t d = vqrdmlahh_s16(_a[0], _b[0], _c[0]);
-  return d == _d ? TEST_SUCCESS : TEST_FAIL;
-#else
-  return TEST_UNIMPL;
-#endif
-}
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16x8_t a = vld1q_u16(_a);
+  uint16x4_t b = vld1_u16(_b);
+  uint32x4_t c;
+  uint32_t _c[4];
 
-result_t test_vqrdmlahs_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d = sat_add((int32_t)_a[0], vqrdmulhs_s32(_b[0], _c[0]));
-  int32_t d = vqrdmlahs_s32(_a[0], _b[0], _c[0]);
-  return d == _d ? TEST_SUCCESS : TEST_FAIL;
-#else
-  return TEST_UNIMPL;
-#endif
-}
+#define TEST_IMPL(IDX)                               \
+  for (int i = 0; i < 4; i++) {                      \
+    _c[i] = (uint32_t)_a[i + 4] * (uint32_t)_b[IDX]; \
+  }                                                  \
+  c = vmull_high_lane_u16(a, b, IDX);                \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vqrdmlshh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d = sat_sub((int16_t)_a[0], vqrdmulhh_s16(_b[0], _c[0]));
-  int16_t d = vqrdmlshh_s16(_a[0], _b[0], _c[0]);
-  return d == _d ? TEST_SUCCESS : TEST_FAIL;
-#endif
-#else
-  return TEST_UNIMPL;
-#endif
-}
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vqrdmlshs_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d = sat_rdmlsh(_a[0], _b[0], _c[0]);
-  int32_t d = vqrdmlshs_s32(_a[0], _b[0], _c[0]);
-  return d == _d ? TEST_SUCCESS : TEST_FAIL;
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlahh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_high_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16x4_t c = vld1_s16(_c);
-  int16_t _d, d;
-#define TEST_IMPL(IDX)                          \
-  _d = sat_rdmlah(_a[0], _b[0], _c[IDX]);       \
-  d = vqrdmlahh_lane_s16(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32x4_t a = vld1q_u32(_a);
+  uint32x2_t b = vld1_u32(_b);
+  uint64x2_t c;
+  uint64_t _c[2];
 
-  IMM_4_ITER
+#define TEST_IMPL(IDX)                               \
+  for (int i = 0; i < 2; i++) {                      \
+    _c[i] = (uint64_t)_a[i + 2] * (uint64_t)_b[IDX]; \
+  }                                                  \
+  c = vmull_high_lane_u32(a, b, IDX);                \
+  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
+
+  IMM_2_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlahh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16x8_t c = vld1q_s16(_c);
-  int16_t _d, d;
-#define TEST_IMPL(IDX)                           \
-  _d = sat_rdmlah(_a[0], _b[0], _c[IDX]);        \
-  d = vqrdmlahh_laneq_s16(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+  int16x4_t a = vld1_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int32x4_t c;
+  int32_t _c[4];
+
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i++) {                \
+    _c[i] = (int32_t)_a[i] * (int32_t)_b[IDX]; \
+  }                                            \
+  c = vmull_laneq_s16(a, b, IDX);              \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_8_ITER
 #undef TEST_IMPL
@@ -37230,133 +38633,124 @@ result_t test_vqrdmlahh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
   return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlahs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32x2_t c = vld1_s32(_c);
-  int32_t _d, d;
-#define TEST_IMPL(IDX)                          \
-  _d = sat_add((int32_t)_a[0], vqrdmulhs_s32(_b[0], _c[IDX])); \
-  d = vqrdmlahs_lane_s32(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+  int32x2_t a = vld1_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int64x2_t c;
+  int64_t _c[2];
 
-  IMM_2_ITER
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 2; i++) {                \
+    _c[i] = (int64_t)_a[i] * (int64_t)_b[IDX]; \
+  }                                            \
+  c = vmull_laneq_s32(a, b, IDX);              \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
+
+  IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlahs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32x4_t c = vld1q_s32(_c);
-  int32_t _d, d;
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16x4_t a = vld1_u16(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint32x4_t c;
+  uint32_t _c[4];
+
 #define TEST_IMPL(IDX)                           \
-  _d = sat_add((int32_t)_a[0], vqrdmulhs_s32(_b[0], _c[IDX])); \
-  d = vqrdmlahs_laneq_s32(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+  for (int i = 0; i < 4; i++) {                  \
+    _c[i] = (uint32_t)_a[i] * (uint32_t)_b[IDX]; \
+  }                                              \
+  c = vmull_laneq_u16(a, b, IDX);                \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
 
-  IMM_4_ITER
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlshh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
-  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16x4_t c = vld1_s16(_c);
-  int16_t _d, d;
-#define TEST_IMPL(IDX)                          \
-  _d = sat_sub((int16_t)_a[0], vqrdmulhh_s16(_b[0], _c[IDX])); \
-  d = vqrdmlshh_lane_s16(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32x2_t a = vld1_u32(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint64x2_t c;
+  uint64_t _c[2];
+
+#define TEST_IMPL(IDX)                           \
+  for (int i = 0; i < 2; i++) {                  \
+    _c[i] = (uint64_t)_a[i] * (uint64_t)_b[IDX]; \
+  }                                              \
+  c = vmull_laneq_u32(a, b, IDX);                \
+  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
 
   IMM_4_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
-#endif
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlshh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
-  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
-  int16x8_t c = vld1q_s16(_c);
-  int16_t _d, d;
-#define TEST_IMPL(IDX)                           \
-  _d = sat_sub((int16_t)_a[0], vqrdmulhh_s16(_b[0], _c[IDX])); \
-  d = vqrdmlshh_laneq_s16(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+  int16x8_t a = vld1q_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int32x4_t c;
+  int32_t _c[4];
+
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 4; i++) {                    \
+    _c[i] = (int32_t)_a[i + 4] * (int32_t)_b[IDX]; \
+  }                                                \
+  c = vmull_high_laneq_s16(a, b, IDX);             \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
-#endif
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vqrdmlshs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+result_t test_vmull_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32x2_t c = vld1_s32(_c);
-  int32_t _d, d;
-#define TEST_IMPL(IDX)                          \
-  _d = sat_rdmlsh(_a[0], _b[0], _c[IDX]);       \
-  d = vqrdmlshs_lane_s32(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
-
-  IMM_2_ITER
-#undef TEST_IMPL
-
-  return TEST_SUCCESS;
-#else
-  return TEST_UNIMPL;
-#endif
-}
+  int32x4_t a = vld1q_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int64x2_t c;
+  int64_t _c[2];
 
-result_t test_vqrdmlshs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
-  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
-  int32x4_t c = vld1q_s32(_c);
-  int32_t _d, d;
-#define TEST_IMPL(IDX)                           \
-  _d = sat_rdmlsh(_a[0], _b[0], _c[IDX]);        \
-  d = vqrdmlshs_laneq_s32(_a[0], _b[0], c, IDX); \
-  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 2; i++) {                    \
+    _c[i] = (int64_t)_a[i + 2] * (int64_t)_b[IDX]; \
+  }                                                \
+  c = vmull_high_laneq_s32(a, b, IDX);             \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -37364,659 +38758,3210 @@ result_t test_vqrdmlshs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
   return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif
+#endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vabsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vceqzh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcgezh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vcgtzh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vclezh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vmull_high_laneq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (uint16_t *)impl.test_cases_int_pointer2;
+  uint16x8_t a = vld1q_u16(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint32x4_t c;
+  uint32_t _c[4];
 
-result_t test_vcltzh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                               \
+  for (int i = 0; i < 4; i++) {                      \
+    _c[i] = (uint32_t)_a[i + 4] * (uint32_t)_b[IDX]; \
+  }                                                  \
+  c = vmull_high_laneq_u16(a, b, IDX);               \
+  CHECK_RESULT(validate_uint32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcvth_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vcvth_f16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvth_f16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vmull_high_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (uint32_t *)impl.test_cases_int_pointer2;
+  uint32x4_t a = vld1q_u32(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint64x2_t c;
+  uint64_t _c[2];
 
-result_t test_vcvth_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                               \
+  for (int i = 0; i < 2; i++) {                      \
+    _c[i] = (uint64_t)_a[i + 2] * (uint64_t)_b[IDX]; \
+  }                                                  \
+  c = vmull_high_laneq_u32(a, b, IDX);               \
+  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
 
-result_t test_vcvth_f16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvth_f16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvth_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int32_t _c[4];
+  int16x4_t a = vld1_s16(_a);
+  int16x4_t b = vld1_s16(_b);
+  int32x4_t c;
 
-result_t test_vcvth_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                 \
+  for (int i = 0; i < 4; i++) {        \
+    _c[i] = sat_dmull(_a[i], _b[IDX]); \
+  }                                    \
+  c = vqdmull_lane_s16(a, b, IDX);     \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcvth_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvth_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvth_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int64_t _c[2];
+  int32x2_t a = vld1_s32(_a);
+  int32x2_t b = vld1_s32(_b);
+  int64x2_t c;
 
-result_t test_vcvth_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                 \
+  for (int i = 0; i < 2; i++) {        \
+    _c[i] = sat_dmull(_a[i], _b[IDX]); \
+  }                                    \
+  c = vqdmull_lane_s32(a, b, IDX);     \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
 
-result_t test_vcvtah_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtah_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtah_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmullh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x4_t b = vld1_s16(_b);
+  int32_t c, _c;
 
-result_t test_vcvtah_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                  \
+  _c = sat_dmull(_a[0], _b[IDX]);       \
+  c = vqdmullh_lane_s16(_a[0], b, IDX); \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vcvtah_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtah_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtmh_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulls_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x2_t b = vld1_s32(_b);
+  int64_t c, _c;
 
-result_t test_vcvtmh_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                  \
+  _c = sat_dmull(_a[0], _b[IDX]);       \
+  c = vqdmulls_lane_s32(_a[0], b, IDX); \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vcvtmh_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtmh_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtmh_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_high_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t a = vld1q_s16(_a);
+  int16x4_t b = vld1_s16(_b);
+  int32x4_t c;
+  int32_t _c[4];
 
-result_t test_vcvtmh_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 4; i++) {            \
+    _c[i] = sat_dmull(_a[i + 4], _b[IDX]); \
+  }                                        \
+  c = vqdmull_high_lane_s16(a, b, IDX);    \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcvtnh_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtnh_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtnh_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_high_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x4_t a = vld1q_s32(_a);
+  int32x2_t b = vld1_s32(_b);
+  int64x2_t c;
+  int64_t _c[2];
 
-result_t test_vcvtnh_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 2; i++) {            \
+    _c[i] = sat_dmull(_a[i + 2], _b[IDX]); \
+  }                                        \
+  c = vqdmull_high_lane_s32(a, b, IDX);    \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
 
-result_t test_vcvtnh_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtnh_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtph_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int32_t _c[4];
+  int16x4_t a = vld1_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int32x4_t c;
 
-result_t test_vcvtph_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                 \
+  for (int i = 0; i < 4; i++) {        \
+    _c[i] = sat_dmull(_a[i], _b[IDX]); \
+  }                                    \
+  c = vqdmull_laneq_s16(a, b, IDX);    \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcvtph_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtph_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtph_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int64_t _c[2];
+  int32x2_t a = vld1_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int64x2_t c;
 
-result_t test_vcvtph_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                 \
+  for (int i = 0; i < 2; i++) {        \
+    _c[i] = sat_dmull(_a[i], _b[IDX]); \
+  }                                    \
+  c = vqdmull_laneq_s32(a, b, IDX);    \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
 
-result_t test_vnegh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vrecpeh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vrecpxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmullh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vrndh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulls_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vrndah_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_high_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t a = vld1q_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int32x4_t c;
+  int32_t _c[4];
 
-result_t test_vrndih_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 4; i++) {            \
+    _c[i] = sat_dmull(_a[i + 4], _b[IDX]); \
+  }                                        \
+  c = vqdmull_high_laneq_s16(a, b, IDX);   \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vrndmh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vrndnh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vrndph_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmull_high_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x4_t a = vld1q_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int64x2_t c;
+  int64_t _c[2];
 
-result_t test_vrndxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 2; i++) {            \
+    _c[i] = sat_dmull(_a[i + 2], _b[IDX]); \
+  }                                        \
+  c = vqdmull_high_laneq_s32(a, b, IDX);   \
+  CHECK_RESULT(validate_int64(c, _c[0], _c[1]))
 
-result_t test_vrsqrteh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vsqrth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vaddh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t a, c;
+  int16x4_t b;
+  int16_t _c[8];
 
-result_t test_vabdh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 8; i++) {                                               \
+    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
+  }                                                                            \
+                                                                               \
+  a = vld1q_s16(_a);                                                           \
+  b = vld1_s16(_b);                                                            \
+  c = vqdmulhq_lane_s16(a, b, IDX);                                           \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
-result_t test_vcageh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcagth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcaleh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x4_t a, c;
+  int32x2_t b;
+  int32_t _c[4];
 
-result_t test_vcalth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 4; i++) {                                               \
+    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
+  }                                                                            \
+                                                                               \
+  a = vld1q_s32(_a);                                                           \
+  b = vld1_s32(_b);                                                            \
+  c = vqdmulhq_lane_s32(a, b, IDX);                                           \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vceqh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcgeh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcgth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x4_t v = vld1_s16(_b);
+  int16_t c, _c;
 
-result_t test_vcleh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  _c = saturate_int16((int32_t)_a[0] * (int32_t)_b[IDX] >> 15);             \
+  c = vqdmulhh_lane_s16(_a[0], v, IDX);                                       \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vclth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvth_n_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvth_n_f16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x2_t v = vld1_s32(_b);
+  int32_t c, _c;
 
-result_t test_vcvth_n_f16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                       \
+  _c = saturate_int32((int64_t)_a[0] * (int64_t)_b[IDX] >> 31);            \
+  c = vqdmulhs_lane_s32(_a[0], v, IDX);                                      \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vcvth_n_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvth_n_f16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvth_n_f16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x4_t a;
+  int16x8_t v;
+  int16x4_t c;
+  int16_t _c[4];
 
-result_t test_vcvth_n_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 4; i++) {                                               \
+    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
+  }                                                                            \
+  a = vld1_s16(_a);                                                            \
+  v = vld1q_s16(_b);                                                           \
+  c = vqdmulh_laneq_s16(a, v, IDX);                                           \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcvth_n_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vcvth_n_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvth_n_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t a, v, c;
+  int16_t _c[8];
 
-result_t test_vcvth_n_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 8; i++) {                                               \
+    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
+  }                                                                            \
+  a = vld1q_s16(_a);                                                           \
+  v = vld1q_s16(_b);                                                           \
+  c = vqdmulhq_laneq_s16(a, v, IDX);                                          \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
-result_t test_vcvth_n_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vdivh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vmaxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulh_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x2_t a, c;
+  int32x4_t v;
+  int32_t _c[2];
 
-result_t test_vmaxnmh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 2; i++) {                                               \
+    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
+  }                                                                            \
+  a = vld1_s32(_a);                                                            \
+  v = vld1q_s32(_b);                                                           \
+  c = vqdmulh_laneq_s32(a, v, IDX);                                           \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
 
-result_t test_vminh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vminnmh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vmulh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x4_t a, v, c;
+  int32_t _c[4];
 
-result_t test_vmulxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 4; i++) {                                               \
+    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
+  }                                                                            \
+  a = vld1q_s32(_a);                                                           \
+  v = vld1q_s32(_b);                                                           \
+  c = vqdmulhq_laneq_s32(a, v, IDX);                                          \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vrecpsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vrsqrtsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsubh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t v = vld1q_s16(_b);
+  int16_t c, _c;
 
-result_t test_vfmah_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  _c = saturate_int16((int32_t)_a[0] * (int32_t)_b[IDX] >> 15);             \
+  c = vqdmulhh_laneq_s16(_a[0], v, IDX);                                      \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vfmsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vabs_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vabsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulhs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x4_t v = vld1q_s32(_b);
+  int32_t c, _c;
 
-result_t test_vceqz_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                       \
+  _c = saturate_int32((int64_t)_a[0] * (int64_t)_b[IDX] >> 31);            \
+  c = vqdmulhs_laneq_s32(_a[0], v, IDX);                                     \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vceqzq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcgez_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcgezq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x4_t a, b, c;
+  int16_t _c[4];
 
-result_t test_vcgtz_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 4; i++) {                                               \
+    _c[i] = saturate_int16((int32_t)_a[i] * (int32_t)_b[IDX] >> 15);        \
+  }                                                                            \
+  a = vld1_s16(_a);                                                            \
+  b = vld1_s16(_b);                                                            \
+  c = vqdmulh_lane_s16(a, b, IDX);                                            \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcgtzq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vclez_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vclezq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqdmulh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x2_t a, b, c;
+  int32_t _c[2];
 
-result_t test_vcltz_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                        \
+  for (int i = 0; i < 2; i++) {                                               \
+    _c[i] = saturate_int32((int64_t)_a[i] * (int64_t)_b[IDX] >> 31);        \
+  }                                                                            \
+  a = vld1_s32(_a);                                                            \
+  b = vld1_s32(_b);                                                            \
+  c = vqdmulh_lane_s32(a, b, IDX);                                            \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
 
-result_t test_vcltzq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvt_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtq_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[8];
+  int16x8_t a, c;
+  int16x4_t b;
 
-result_t test_vcvt_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                  \
+  for (int i = 0; i < 8; i++) {         \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
+  }                                     \
+                                        \
+  a = vld1q_s16(_a);                    \
+  b = vld1_s16(_b);                     \
+  c = vqrdmulhq_lane_s16(a, b, IDX);    \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
-result_t test_vcvtq_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvt_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[4];
+  int32x4_t a, c;
+  int32x2_t b;
 
-result_t test_vcvt_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                  \
+  for (int i = 0; i < 4; i++) {         \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
+  }                                     \
+  a = vld1q_s32(_a);                    \
+  b = vld1_s32(_b);                     \
+  c = vqrdmulhq_lane_s32(a, b, IDX);    \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcvtq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvta_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtaq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x4_t v = vld1_s16(_b);
+  int16_t c, _c;
 
-result_t test_vcvta_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  _c = sat_rdmulh(_a[0], _b[IDX]);                 \
+  c = vqrdmulhh_lane_s16(_a[0], v, IDX);           \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vcvtaq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtm_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtmq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x2_t v = vld1_s32(_b);
+  int32_t c, _c;
 
-result_t test_vcvtm_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  _c = sat_rdmulh(_a[0], _b[IDX]);                 \
+  c = vqrdmulhs_lane_s32(_a[0], v, IDX);           \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vcvtmq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtn_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtnq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[4];
+  int16x4_t a, c;
+  int16x8_t b;
 
-result_t test_vcvtn_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                        \
+  for (int i = 0; i < 4; i++) {                               \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]);                       \
+  }                                                           \
+  a = vld1_s16(_a);                                           \
+  b = vld1q_s16(_b);                                          \
+  c = vqrdmulh_laneq_s16(a, b, IDX);                          \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vcvtnq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtp_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtpq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[8];
+  int16x8_t a, c;
+  int16x8_t b;
 
-result_t test_vcvtp_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                                    \
+  for (int i = 0; i < 8; i++) {                                                           \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]);                                                   \
+  }                                                                                       \
+  a = vld1q_s16(_a);                                                                      \
+  b = vld1q_s16(_b);                                                                      \
+  c = vqrdmulhq_laneq_s16(a, b, IDX);                                                     \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3], _c[4], _c[5], _c[6], _c[7]))
 
-result_t test_vcvtpq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vneg_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vnegq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulh_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[2];
+  int32x2_t a, c;
+  int32x4_t b;
 
-result_t test_vrecpe_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                          \
+  for (int i = 0; i < 2; i++) {                 \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]);         \
+  }                                             \
+  a = vld1_s32(_a);                             \
+  b = vld1q_s32(_b);                            \
+  c = vqrdmulh_laneq_s32(a, b, IDX);            \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
 
-result_t test_vrecpeq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vrnd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vrndq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[4];
+  int32x4_t a, c;
+  int32x4_t b;
 
-result_t test_vrnda_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                        \
+  for (int i = 0; i < 4; i++) {                               \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]);                       \
+  }                                                           \
+  a = vld1q_s32(_a);                                          \
+  b = vld1q_s32(_b);                                          \
+  c = vqrdmulhq_laneq_s32(a, b, IDX);                         \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vrndaq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vrndi_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vrndiq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t v = vld1q_s16(_b);
+  int16_t c, _c;
 
-result_t test_vrndm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  _c = sat_rdmulh(_a[0], _b[IDX]);                 \
+  c = vqrdmulhh_laneq_s16(_a[0], v, IDX);          \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vrndmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vrndn_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vrndnq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulhs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32x4_t v = vld1q_s32(_b);
+  int32_t c, _c;
 
-result_t test_vrndp_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  _c = sat_rdmulh(_a[0], _b[IDX]);                 \
+  c = vqrdmulhs_laneq_s32(_a[0], v, IDX);          \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vrndpq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vrndx_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vrndxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t _c[4];
+  int16x4_t a, b, c;
 
-result_t test_vrsqrte_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                  \
+  for (int i = 0; i < 4; i++) {         \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
+  }                                     \
+                                        \
+  a = vld1_s16(_a);                     \
+  b = vld1_s16(_b);                     \
+  c = vqrdmulh_lane_s16(a, b, IDX);     \
+  CHECK_RESULT(validate_int16(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vrsqrteq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vsqrt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsqrtq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmulh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c[2];
+  int32x2_t a, b, c;
 
-result_t test_vadd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                  \
+  for (int i = 0; i < 2; i++) {         \
+    _c[i] = sat_rdmulh(_a[i], _b[IDX]); \
+  }                                     \
+  a = vld1_s32(_a);                     \
+  b = vld1_s32(_b);                     \
+  c = vqrdmulh_lane_s32(a, b, IDX);     \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1]))
 
-result_t test_vaddq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vabd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vabdq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
+  int16x8_t a, b, d;
+  int16x4_t c;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 8; i++) {                \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1q_s16(_a);                           \
+  b = vld1q_s16(_b);                           \
+  c = vld1_s16(_c);                            \
+  d = vqrdmlahq_lane_s16(a, b, c, IDX);
 
-result_t test_vcage_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcageq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcagt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlah_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[4];
+  int16x4_t a, b, d;
+  int16x8_t c;
+#define TEST_IMPL(IDX)                                        \
+  for (int i = 0; i < 4; i++) {                               \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]);                \
+  }                                                           \
+  a = vld1_s16(_a);                                           \
+  b = vld1_s16(_b);                                           \
+  c = vld1q_s16(_c);                                          \
+  d = vqrdmlah_laneq_s16(a, b, c, IDX);                       \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
 
-result_t test_vcagtq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vcale_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcaleq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
+  int16x8_t a, b, d;
+  int16x8_t c;
+#define TEST_IMPL(IDX)                                                                    \
+  for (int i = 0; i < 8; i++) {                                                           \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]);                                            \
+  }                                                                                       \
+  a = vld1q_s16(_a);                                                                      \
+  b = vld1q_s16(_b);                                                                      \
+  c = vld1q_s16(_c);                                                                      \
+  d = vqrdmlahq_laneq_s16(a, b, c, IDX);                                                  \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
-result_t test_vcalt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vcaltq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vceq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a, b, d;
+  int32x2_t c;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i++) {                \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1q_s32(_a);                           \
+  b = vld1q_s32(_b);                           \
+  c = vld1_s32(_c);                            \
+  d = vqrdmlahq_lane_s32(a, b, c, IDX);
 
-result_t test_vceqq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcge_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}  // namespace NEON2RVV
 
-result_t test_vcgeq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlah_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[2];
+  int32x2_t a, b, d;
+  int32x4_t c;
+#define TEST_IMPL(IDX)                          \
+  for (int i = 0; i < 2; i++) {                 \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]);  \
+  }                                             \
+  a = vld1_s32(_a);                             \
+  b = vld1_s32(_b);                             \
+  c = vld1q_s32(_c);                            \
+  d = vqrdmlah_laneq_s32(a, b, c, IDX);         \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
 
-result_t test_vcgt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcgtq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcle_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a, b, d;
+  int32x4_t c;
+#define TEST_IMPL(IDX)                                        \
+  for (int i = 0; i < 4; i++) {                               \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]);                \
+  }                                                           \
+  a = vld1q_s32(_a);                                          \
+  b = vld1q_s32(_b);                                          \
+  c = vld1q_s32(_c);                                          \
+  d = vqrdmlahq_laneq_s32(a, b, c, IDX);                      \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
-result_t test_vcleq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vclt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcltq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlah_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[4];
+  int16x4_t a, b, c, d;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i++) {                \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1_s16(_a);                            \
+  b = vld1_s16(_b);                            \
+  c = vld1_s16(_c);                            \
+  d = vqrdmlah_lane_s16(a, b, c, IDX);
 
-result_t test_vcvt_n_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtq_n_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return validate_int16(d, _d[0], _d[1], _d[2], _d[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvt_n_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlah_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[2];
+  int32x2_t a, b, c, d;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 2; i++) {                \
+    _d[i] = sat_rdmlah(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1_s32(_a);                            \
+  b = vld1_s32(_b);                            \
+  c = vld1_s32(_c);                            \
+  d = vqrdmlah_lane_s32(a, b, c, IDX);
 
-result_t test_vcvtq_n_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcvt_n_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return validate_int32(d, _d[0], _d[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcvtq_n_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshq_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
+  int16x8_t a, b, d;
+  int16x4_t c;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 8; i++) {                \
+    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1q_s16(_a);                           \
+  b = vld1q_s16(_b);                           \
+  c = vld1_s16(_c);                            \
+  d = vqrdmlshq_lane_s16(a, b, c, IDX);
 
-result_t test_vcvt_n_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vcvtq_n_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vdiv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlsh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[4];
+  int16x4_t a, b, d;
+  int16x8_t c;
+#define TEST_IMPL(IDX)                                        \
+  for (int i = 0; i < 4; i++) {                               \
+    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]);                \
+  }                                                           \
+  a = vld1_s16(_a);                                           \
+  b = vld1_s16(_b);                                           \
+  c = vld1q_s16(_c);                                          \
+  d = vqrdmlsh_laneq_s16(a, b, c, IDX);                       \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3]))
 
-result_t test_vdivq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vmax_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vmaxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshq_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
+  int16x8_t a, b, d;
+  int16x8_t c;
+#define TEST_IMPL(IDX)                                                                    \
+  for (int i = 0; i < 8; i++) {                                                           \
+    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]);                                            \
+  }                                                                                       \
+  a = vld1q_s16(_a);                                                                      \
+  b = vld1q_s16(_b);                                                                      \
+  c = vld1q_s16(_c);                                                                      \
+  d = vqrdmlshq_laneq_s16(a, b, c, IDX);                                                  \
+  CHECK_RESULT(validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]))
 
-result_t test_vmaxnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vmaxnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vmin_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  const int64_t round_const = (int64_t)1 << 31;
+  int32x4_t a, b, d;
+  int32x2_t c;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i++) {                \
+    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1q_s32(_a);                           \
+  b = vld1q_s32(_b);                           \
+  c = vld1_s32(_c);                            \
+  d = vqrdmlshq_lane_s32(a, b, c, IDX);
 
-result_t test_vminq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vminnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vminnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlsh_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[2];
+  int32x2_t a, b, d;
+  int32x4_t c;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 2; i++) {                \
+    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1_s32(_a);                            \
+  b = vld1_s32(_b);                            \
+  c = vld1q_s32(_c);                           \
+  d = vqrdmlsh_laneq_s32(a, b, c, IDX);        \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1]))
 
-result_t test_vmul_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vmulq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vmulx_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  int32x4_t a, b, c, d;
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i++) {                \
+    _d[i] = sat_rdmlsh(_a[i], _b[i], _c[IDX]); \
+  }                                            \
+  a = vld1q_s32(_a);                           \
+  b = vld1q_s32(_b);                           \
+  c = vld1q_s32(_c);                           \
+  d = vqrdmlshq_laneq_s32(a, b, c, IDX);       \
+  CHECK_RESULT(validate_int32(d, _d[0], _d[1], _d[2], _d[3]))
 
-result_t test_vmulxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vpadd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vpaddq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d = sat_rdmlah(_a[0], _b[0], _c[0]);
+  int16_t d = vqrdmlahh_s16(_a[0], _b[0], _c[0]);
+  return d == _d ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vpmax_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahs_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d = sat_add((int32_t)_a[0], vqrdmulhs_s32(_b[0], _c[0]));
+  int32_t d = vqrdmlahs_s32(_a[0], _b[0], _c[0]);
+  return d == _d ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vpmaxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshh_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d = sat_rdmlsh(_a[0], _b[0], _c[0]);
+  int16_t d = vqrdmlshh_s16(_a[0], _b[0], _c[0]);
+  return d == _d ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vpmaxnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshs_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d = sat_rdmlsh(_a[0], _b[0], _c[0]);
+  int32_t d = vqrdmlshs_s32(_a[0], _b[0], _c[0]);
+  return d == _d ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vpmaxnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16x4_t c = vld1_s16(_c);
+  int16_t _d, d;
+#define TEST_IMPL(IDX)                          \
+  _d = sat_rdmlah(_a[0], _b[0], _c[IDX]);       \
+  d = vqrdmlahh_lane_s16(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vpmin_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vpminq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vpminnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16x8_t c = vld1q_s16(_c);
+  int16_t _d, d;
+#define TEST_IMPL(IDX)                           \
+  _d = sat_rdmlah(_a[0], _b[0], _c[IDX]);        \
+  d = vqrdmlahh_laneq_s16(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vpminnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vrecps_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vrecpsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32x2_t c = vld1_s32(_c);
+  int32_t _d, d;
+#define TEST_IMPL(IDX)                          \
+  _d = sat_add((int32_t)_a[0], vqrdmulhs_s32(_b[0], _c[IDX])); \
+  d = vqrdmlahs_lane_s32(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vrsqrts_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vrsqrtsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vsub_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlahs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32x4_t c = vld1q_s32(_c);
+  int32_t _d, d;
+#define TEST_IMPL(IDX)                           \
+  _d = sat_add((int32_t)_a[0], vqrdmulhs_s32(_b[0], _c[IDX])); \
+  d = vqrdmlahs_laneq_s32(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vsubq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vfma_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vfmaq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16x4_t c = vld1_s16(_c);
+  int16_t _d, d;
+#define TEST_IMPL(IDX)                          \
+  _d = sat_sub((int16_t)_a[0], vqrdmulhh_s16(_b[0], _c[IDX])); \
+  d = vqrdmlshh_lane_s16(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vfms_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vfmsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vfma_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshh_laneq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
+  int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
+  int16x8_t c = vld1q_s16(_c);
+  int16_t _d, d;
+#define TEST_IMPL(IDX)                           \
+  _d = sat_sub((int16_t)_a[0], vqrdmulhh_s16(_b[0], _c[IDX])); \
+  d = vqrdmlshh_laneq_s16(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vfmaq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vfma_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vfmaq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshs_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32x2_t c = vld1_s32(_c);
+  int32_t _d, d;
+#define TEST_IMPL(IDX)                          \
+  _d = sat_rdmlsh(_a[0], _b[0], _c[IDX]);       \
+  d = vqrdmlshs_lane_s32(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vfma_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vfmaq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vfmah_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vqrdmlshs_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
+  int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
+  int32x4_t c = vld1q_s32(_c);
+  int32_t _d, d;
+#define TEST_IMPL(IDX)                           \
+  _d = sat_rdmlsh(_a[0], _b[0], _c[IDX]);        \
+  d = vqrdmlshs_laneq_s32(_a[0], _b[0], c, IDX); \
+  CHECK_RESULT(d == _d ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vfmah_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vfms_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif
+}
 
-result_t test_vfmsq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vabsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfms_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vceqzh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmsq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcgezh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfms_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcgtzh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmsq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vclezh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmsh_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcltzh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmsh_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmul_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_f16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_f16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmul_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_f16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmul_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_f16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulh_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulh_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulx_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulxq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulx_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvth_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulxq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtah_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulx_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtah_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulxq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtah_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vmulxh_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcvtah_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtah_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtah_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmh_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmh_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmh_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmh_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmh_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmh_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnh_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnh_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnh_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnh_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnh_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnh_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtph_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtph_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtph_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtph_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtph_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtph_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vnegh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrecpeh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrecpxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndah_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndih_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndmh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndnh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndph_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrsqrteh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsqrth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaddh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vabdh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcageh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcagth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcaleh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcalth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vceqh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgeh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcleh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vclth_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_f16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_f16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_f16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_f16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_s32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_s64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_u32_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvth_n_u64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdivh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxnmh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminnmh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulxh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrecpsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrsqrtsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsubh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmah_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmsh_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vabs_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vabsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vceqz_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vceqzq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgez_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgezq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgtz_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgtzq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vclez_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vclezq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcltz_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcltzq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvta_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtaq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvta_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtaq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtm_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtm_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtmq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtn_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtn_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtnq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtp_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtpq_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtp_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtpq_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vneg_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vnegq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrecpe_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrecpeq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrnd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrnda_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndaq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndi_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndiq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndn_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndnq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndp_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndpq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndx_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrndxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrsqrte_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrsqrteq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsqrt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsqrtq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vadd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaddq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vabd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vabdq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcage_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcageq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcagt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcagtq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcale_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcaleq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcalt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcaltq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vceq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vceqq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcge_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgeq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcgtq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcle_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcleq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vclt_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcltq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_n_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_n_f16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_n_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_n_f16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_n_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_n_s16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvt_n_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcvtq_n_u16_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdiv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdivq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmax_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmin_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmul_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulx_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpadd_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpaddq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpmax_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpmaxq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpmaxnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpmaxnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpmin_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpminq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpminnm_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vpminnmq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrecps_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrecpsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrsqrts_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrsqrtsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsub_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsubq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfma_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmaq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfms_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmsq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfma_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmaq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfma_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmaq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfma_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmaq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmah_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmah_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfms_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmsq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfms_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmsq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfms_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmsq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmsh_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vfmsh_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmul_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmul_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmul_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulh_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulh_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulx_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulxq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulx_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulxq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulx_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulxq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulxh_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmulxh_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxnmv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmaxnmvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminnmv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vminnmvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vbsl_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vbslq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vzip_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vzipq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vuzp_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vuzpq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vtrn_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vtrnq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmov_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmovq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdup_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdupq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdup_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdupq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vext_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vextq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrev64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vrev64q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vzip1_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vzip1q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vzip2_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vzip2q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vuzp1_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vuzp1q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vuzp2_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vuzp2q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vtrn1_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vtrn1q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vtrn2_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vtrn2q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdup_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdupq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vduph_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vduph_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdot_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer3;
+  const int lane_num = 2;
+  uint32_t _c[lane_num];
+  for (int i = 0; i < lane_num; i++) {
+    _c[i] = _r[i];
+    for (int j = 0; j < 4; j++) {
+      _c[i] += (uint32_t)_a[(i << 2) + j] * _b[(i << 2) + j];
+    }
+  }
+
+  uint8x8_t a = vld1_u8(_a);
+  uint8x8_t b = vld1_u8(_b);
+  uint32x2_t r = vld1_u32(_r);
+  uint32x2_t c = vdot_u32(r, a, b);
+  return validate_uint32(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vdot_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdotq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer3;
+  const int lane_num = 4;
+  uint32_t _c[lane_num];
+  for (int i = 0; i < lane_num; i++) {
+    _c[i] = _r[i];
+    for (int j = 0; j < 4; j++) {
+      _c[i] += (uint32_t)_a[(i << 2) + j] * _b[(i << 2) + j];
+    }
+  }
+
+  uint8x16_t a = vld1q_u8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint32x4_t r = vld1q_u32(_r);
+  uint32x4_t c = vdotq_u32(r, a, b);
+  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vdotq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdot_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdot_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdotq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdotq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
+  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer3;
+  const int lane_num = 4;
+  int32_t _c[lane_num];
+  int8x16_t a, b;
+  int32x4_t r, c;
+
+#define TEST_IMPL(IDX)                                         \
+  for (int i = 0; i < lane_num; i++) {                         \
+    _c[i] = _r[i];                                             \
+    for (int j = 0; j < 4; j++) {                              \
+      _c[i] += (int32_t)_a[(i << 2) + j] * _b[(IDX << 2) + j]; \
+    }                                                          \
+  }                                                            \
+  a = vld1q_s8(_a);                                            \
+  b = vld1q_s8(_b);                                            \
+  r = vld1q_s32(_r);                                           \
+  c = vdotq_laneq_s32(r, a, b, IDX);                           \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vdot_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdot_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdotq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vdotq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
+  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer3;
+  const int lane_num = 4;
+  int32_t _c[lane_num];
+  int8x16_t a;
+  int8x8_t b;
+  int32x4_t r, c;
+
+#define TEST_IMPL(IDX)                                         \
+  for (int i = 0; i < lane_num; i++) {                         \
+    _c[i] = _r[i];                                             \
+    for (int j = 0; j < 4; j++) {                              \
+      _c[i] += (int32_t)_a[(i << 2) + j] * _b[(IDX << 2) + j]; \
+    }                                                          \
+  }                                                            \
+  a = vld1q_s8(_a);                                            \
+  b = vld1_s8(_b);                                             \
+  r = vld1q_s32(_r);                                           \
+  c = vdotq_lane_s32(r, a, b, IDX);                            \
+  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_2_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vsha512hq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha512h2q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha512su0q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha512su1q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_veor3q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *_c = (const uint8_t *)impl.test_cases_int_pointer3;
+  uint8_t _d[16];
+  for (int i = 0; i < 16; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  uint8x16_t a = vld1q_u8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint8x16_t c = vld1q_u8(_c);
+  uint8x16_t d = veor3q_u8(a, b, c);
+  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7], _d[8], _d[9], _d[10], _d[11], _d[12],
+                        _d[13], _d[14], _d[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // defined(__clang__)
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_veor3q_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
+  uint16_t _d[8];
+  for (int i = 0; i < 8; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  uint16x8_t a = vld1q_u16(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint16x8_t c = vld1q_u16(_c);
+  uint16x8_t d = veor3q_u16(a, b, c);
+  return validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_veor3q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
+  for (int i = 0; i < 4; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  uint32x4_t a = vld1q_u32(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint32x4_t c = vld1q_u32(_c);
+  uint32x4_t d = veor3q_u32(a, b, c);
+  return validate_uint32(d, _d[0], _d[1], _d[2], _d[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_veor3q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  const uint64_t *_c = (const uint64_t *)impl.test_cases_int_pointer3;
+  uint64_t _d[2];
+  for (int i = 0; i < 2; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  uint64x2_t a = vld1q_u64(_a);
+  uint64x2_t b = vld1q_u64(_b);
+  uint64x2_t c = vld1q_u64(_c);
+  uint64x2_t d = veor3q_u64(a, b, c);
+  return validate_uint64(d, _d[0], _d[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_veor3q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (const int8_t *)impl.test_cases_int_pointer2;
+  const int8_t *_c = (const int8_t *)impl.test_cases_int_pointer3;
+  int8_t _d[16];
+  for (int i = 0; i < 16; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  int8x16_t a = vld1q_s8(_a);
+  int8x16_t b = vld1q_s8(_b);
+  int8x16_t c = vld1q_s8(_c);
+  int8x16_t d = veor3q_s8(a, b, c);
+  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7], _d[8], _d[9], _d[10], _d[11], _d[12],
+                       _d[13], _d[14], _d[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // defined(__clang__)
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_veor3q_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
+  for (int i = 0; i < 8; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  int16x8_t a = vld1q_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x8_t c = vld1q_s16(_c);
+  int16x8_t d = veor3q_s16(a, b, c);
+  return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_veor3q_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  for (int i = 0; i < 4; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  int32x4_t a = vld1q_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x4_t c = vld1q_s32(_c);
+  int32x4_t d = veor3q_s32(a, b, c);
+  return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_veor3q_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  const int64_t *_b = (const int64_t *)impl.test_cases_int_pointer2;
+  const int64_t *_c = (const int64_t *)impl.test_cases_int_pointer3;
+  int64_t _d[2];
+  for (int i = 0; i < 2; i++) {
+    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  }
+
+  int64x2_t a = vld1q_s64(_a);
+  int64x2_t b = vld1q_s64(_b);
+  int64x2_t c = vld1q_s64(_c);
+  int64x2_t d = veor3q_s64(a, b, c);
+  return validate_int64(d, _d[0], _d[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vrax1q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  uint64_t _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _a[i] ^ ((_b[i] << 1) | (_b[i] >> 63));
+  }
+
+  uint64x2_t a = vld1q_u64(_a);
+  uint64x2_t b = vld1q_u64(_b);
+  uint64x2_t c = vrax1q_u64(a, b);
+  return validate_uint64(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vxarq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  uint64_t _c[2];
+  uint64x2_t a = vld1q_u64(_a);
+  uint64x2_t b = vld1q_u64(_b);
+  uint64x2_t c;
+
+#define TEST_IMPL(IDX)                               \
+  for (int i = 0; i < 2; i++) {                      \
+    uint64_t ab = _a[i] ^ _b[i];                     \
+    _c[i] = (ab >> IDX) | (ab << ((64 - IDX) & 63)); \
+  }                                                  \
+  c = vxarq_u64(a, b, IDX);                          \
+  CHECK_RESULT(validate_uint64(c, _c[0], _c[1]))
+
+  IMM_64_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  const uint8_t *_c = (const uint8_t *)impl.test_cases_int_pointer3;
+  uint8_t _d[16];
+  for (int i = 0; i < 16; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  uint8x16_t a = vld1q_u8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint8x16_t c = vld1q_u8(_c);
+  uint8x16_t d = vbcaxq_u8(a, b, c);
+  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7], _d[8], _d[9], _d[10], _d[11], _d[12],
+                        _d[13], _d[14], _d[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
+  uint16_t _d[8];
+  for (int i = 0; i < 8; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  uint16x8_t a = vld1q_u16(_a);
+  uint16x8_t b = vld1q_u16(_b);
+  uint16x8_t c = vld1q_u16(_c);
+  uint16x8_t d = vbcaxq_u16(a, b, c);
+  return validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
+  uint32_t _d[4];
+  for (int i = 0; i < 4; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  uint32x4_t a = vld1q_u32(_a);
+  uint32x4_t b = vld1q_u32(_b);
+  uint32x4_t c = vld1q_u32(_c);
+  uint32x4_t d = vbcaxq_u32(a, b, c);
+  return validate_uint32(d, _d[0], _d[1], _d[2], _d[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  const uint64_t *_c = (const uint64_t *)impl.test_cases_int_pointer3;
+  uint64_t _d[2];
+  for (int i = 0; i < 2; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  uint64x2_t a = vld1q_u64(_a);
+  uint64x2_t b = vld1q_u64(_b);
+  uint64x2_t c = vld1q_u64(_c);
+  uint64x2_t d = vbcaxq_u64(a, b, c);
+  return validate_uint64(d, _d[0], _d[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  const int8_t *_b = (const int8_t *)impl.test_cases_int_pointer2;
+  const int8_t *_c = (const int8_t *)impl.test_cases_int_pointer3;
+  int8_t _d[16];
+  for (int i = 0; i < 16; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  int8x16_t a = vld1q_s8(_a);
+  int8x16_t b = vld1q_s8(_b);
+  int8x16_t c = vld1q_s8(_c);
+  int8x16_t d = vbcaxq_s8(a, b, c);
+  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7], _d[8], _d[9], _d[10], _d[11], _d[12],
+                       _d[13], _d[14], _d[15]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
+  int16_t _d[8];
+  for (int i = 0; i < 8; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  int16x8_t a = vld1q_s16(_a);
+  int16x8_t b = vld1q_s16(_b);
+  int16x8_t c = vld1q_s16(_c);
+  int16x8_t d = vbcaxq_s16(a, b, c);
+  return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
+  int32_t _d[4];
+  for (int i = 0; i < 4; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  int32x4_t a = vld1q_s32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  int32x4_t c = vld1q_s32(_c);
+  int32x4_t d = vbcaxq_s32(a, b, c);
+  return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vbcaxq_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(__clang__)
+  return TEST_UNIMPL;
+#else
+#ifdef ENABLE_TEST_ALL
+  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
+  const int64_t *_b = (const int64_t *)impl.test_cases_int_pointer2;
+  const int64_t *_c = (const int64_t *)impl.test_cases_int_pointer3;
+  int64_t _d[2];
+  for (int i = 0; i < 2; i++) {
+    _d[i] = _a[i] ^ (_b[i] & ~_c[i]);
+  }
+
+  int64x2_t a = vld1q_s64(_a);
+  int64x2_t b = vld1q_s64(_b);
+  int64x2_t c = vld1q_s64(_c);
+  int64x2_t d = vbcaxq_s64(a, b, c);
+  return validate_int64(d, _d[0], _d[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+#endif  // defined(__clang__)
+}
+
+result_t test_vsm3ss1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm3tt1aq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm3tt1bq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm3tt2aq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm3tt2bq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm3partw1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm3partw2q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm4eq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsm4ekeyq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+// The f16 operands are the float inputs halved, which keeps them inside the f16 range. The float pointers hold only 4
+// values, so 8-lane operands are read from test_cases_floats instead. neon2rvv has no vld1_f16 yet, so they are loaded
+// natively.
+static float16x4_t load_f16x4(const float16_t *p) {
+#if defined(__riscv) || defined(__riscv__)
+  return __riscv_vle16_v_f16m1(p, 4);
+#else
+  return vld1_f16(p);
+#endif
+}
+
+static float16x8_t load_f16x8(const float16_t *p) {
+#if defined(__riscv) || defined(__riscv__)
+  return __riscv_vle16_v_f16m1(p, 8);
+#else
+  return vld1q_f16(p);
+#endif
+}
+#endif
+
+result_t test_vfmlal_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i] + (float)_a[i] * (float)_b[i];
+  }
+
+  float32x2_t c = vfmlal_low_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vfmlsl_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i] - (float)_a[i] * (float)_b[i];
+  }
+
+  float32x2_t c = vfmlsl_low_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vfmlalq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i] + (float)_a[i] * (float)_b[i];
+  }
 
-result_t test_vmulxh_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t c = vfmlalq_low_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vmaxv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlslq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i] - (float)_a[i] * (float)_b[i];
+  }
 
-result_t test_vmaxvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t c = vfmlslq_low_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vminv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlal_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i] + (float)_a[i + 2] * (float)_b[i + 2];
+  }
 
-result_t test_vminvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t c = vfmlal_high_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vmaxnmv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlsl_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  for (int i = 0; i < 2; i++) {
+    _c[i] = _r[i] - (float)_a[i + 2] * (float)_b[i + 2];
+  }
 
-result_t test_vmaxnmvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t c = vfmlsl_high_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vminnmv_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlalq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i] + (float)_a[i + 4] * (float)_b[i + 4];
+  }
 
-result_t test_vminnmvq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t c = vfmlalq_high_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vbsl_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlslq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  for (int i = 0; i < 4; i++) {
+    _c[i] = _r[i] - (float)_a[i + 4] * (float)_b[i + 4];
+  }
 
-result_t test_vbslq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t c = vfmlslq_high_f16(r, a, b);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vzip_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlal_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  float32x2_t c;
 
-result_t test_vzipq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 2; i++) {                    \
+    _c[i] = _r[i] + (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlal_lane_low_f16(r, a, b, IDX);           \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
-result_t test_vuzp_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vuzpq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vtrn_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlal_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[8];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+  }
+  for (int i = 0; i < 8; i++) {
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[2];
+  float32x2_t c;
 
-result_t test_vtrnq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 2; i++) {                    \
+    _c[i] = _r[i] + (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlal_laneq_low_f16(r, a, b, IDX);          \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
-result_t test_vmov_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vmovq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vdup_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlalq_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[4];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+  }
+  for (int i = 0; i < 4; i++) {
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[4];
+  float32x4_t c;
 
-result_t test_vdupq_n_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 4; i++) {                    \
+    _c[i] = _r[i] + (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlalq_lane_low_f16(r, a, b, IDX);          \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vdup_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vdupq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vext_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlalq_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  float32x4_t c;
 
-result_t test_vextq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 4; i++) {                    \
+    _c[i] = _r[i] + (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlalq_laneq_low_f16(r, a, b, IDX);         \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vrev64_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vrev64q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vzip1_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlsl_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  float32x2_t c;
 
-result_t test_vzip1q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 2; i++) {                    \
+    _c[i] = _r[i] - (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlsl_lane_low_f16(r, a, b, IDX);           \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
-result_t test_vzip2_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vzip2q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vuzp1_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlsl_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[8];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+  }
+  for (int i = 0; i < 8; i++) {
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[2];
+  float32x2_t c;
 
-result_t test_vuzp1q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 2; i++) {                    \
+    _c[i] = _r[i] - (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlsl_laneq_low_f16(r, a, b, IDX);          \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
-result_t test_vuzp2_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vuzp2q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vtrn1_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlslq_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[4];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+  }
+  for (int i = 0; i < 4; i++) {
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[4];
+  float32x4_t c;
 
-result_t test_vtrn1q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 4; i++) {                    \
+    _c[i] = _r[i] - (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlslq_lane_low_f16(r, a, b, IDX);          \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vtrn2_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vtrn2q_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vdup_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlslq_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  float32x4_t c;
 
-result_t test_vdupq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  for (int i = 0; i < 4; i++) {                    \
+    _c[i] = _r[i] - (float)_a[i] * (float)_b[IDX]; \
+  }                                                \
+  c = vfmlslq_laneq_low_f16(r, a, b, IDX);         \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vduph_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vduph_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vdot_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer3;
-  const int lane_num = 2;
-  uint32_t _c[lane_num];
-  for (int i = 0; i < lane_num; i++) {
-    _c[i] = _r[i];
-    for (int j = 0; j < 4; j++) {
-      _c[i] += (uint32_t)_a[(i << 2) + j] * _b[(i << 2) + j];
-    }
+result_t test_vfmlal_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
   }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  float32x2_t c;
 
-  uint8x8_t a = vld1_u8(_a);
-  uint8x8_t b = vld1_u8(_b);
-  uint32x2_t r = vld1_u32(_r);
-  uint32x2_t c = vdot_u32(r, a, b);
-  return validate_uint32(c, _c[0], _c[1]);
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _c[i] = _r[i] + (float)_a[i + 2] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlal_lane_high_f16(r, a, b, IDX);              \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vdot_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vdotq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (uint8_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_r = (uint32_t *)impl.test_cases_int_pointer3;
-  const int lane_num = 4;
-  uint32_t _c[lane_num];
-  for (int i = 0; i < lane_num; i++) {
-    _c[i] = _r[i];
-    for (int j = 0; j < 4; j++) {
-      _c[i] += (uint32_t)_a[(i << 2) + j] * _b[(i << 2) + j];
-    }
+result_t test_vfmlsl_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[4];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
   }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[2];
+  float32x2_t c;
 
-  uint8x16_t a = vld1q_u8(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  uint32x4_t r = vld1q_u32(_r);
-  uint32x4_t c = vdotq_u32(r, a, b);
-  return validate_uint32(c, _c[0], _c[1], _c[2], _c[3]);
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _c[i] = _r[i] - (float)_a[i + 2] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlsl_lane_high_f16(r, a, b, IDX);              \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vdotq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlalq_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[4];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+  }
+  for (int i = 0; i < 4; i++) {
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[4];
+  float32x4_t c;
 
-result_t test_vdot_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _c[i] = _r[i] + (float)_a[i + 4] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlalq_lane_high_f16(r, a, b, IDX);             \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vdot_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vdotq_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vdotq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
-  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer3;
-  const int lane_num = 4;
-  int32_t _c[lane_num];
-  int8x16_t a, b;
-  int32x4_t r, c;
+result_t test_vfmlslq_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[4];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+  }
+  for (int i = 0; i < 4; i++) {
+    _b[i] = (float16_t)(impl.test_cases_float_pointer3[i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x4_t b = load_f16x4(_b);
+  float _c[4];
+  float32x4_t c;
 
-#define TEST_IMPL(IDX)                                         \
-  for (int i = 0; i < lane_num; i++) {                         \
-    _c[i] = _r[i];                                             \
-    for (int j = 0; j < 4; j++) {                              \
-      _c[i] += (int32_t)_a[(i << 2) + j] * _b[(IDX << 2) + j]; \
-    }                                                          \
-  }                                                            \
-  a = vld1q_s8(_a);                                            \
-  b = vld1q_s8(_b);                                            \
-  r = vld1q_s32(_r);                                           \
-  c = vdotq_laneq_s32(r, a, b, IDX);                           \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _c[i] = _r[i] - (float)_a[i + 4] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlslq_lane_high_f16(r, a, b, IDX);             \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
   IMM_4_ITER
 #undef TEST_IMPL
@@ -38027,37 +41972,62 @@ result_t test_vdotq_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vdot_laneq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlal_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[8];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+  }
+  for (int i = 0; i < 8; i++) {
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[2];
+  float32x2_t c;
 
-result_t test_vdot_laneq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _c[i] = _r[i] + (float)_a[i + 2] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlal_laneq_high_f16(r, a, b, IDX);             \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
 
-result_t test_vdotq_lane_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vdotq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *_b = (int8_t *)impl.test_cases_int_pointer2;
-  const int32_t *_r = (int32_t *)impl.test_cases_int_pointer3;
-  const int lane_num = 4;
-  int32_t _c[lane_num];
-  int8x16_t a;
-  int8x8_t b;
-  int32x4_t r, c;
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-#define TEST_IMPL(IDX)                                         \
-  for (int i = 0; i < lane_num; i++) {                         \
-    _c[i] = _r[i];                                             \
-    for (int j = 0; j < 4; j++) {                              \
-      _c[i] += (int32_t)_a[(i << 2) + j] * _b[(IDX << 2) + j]; \
-    }                                                          \
-  }                                                            \
-  a = vld1q_s8(_a);                                            \
-  b = vld1_s8(_b);                                             \
-  r = vld1q_s32(_r);                                           \
-  c = vdotq_lane_s32(r, a, b, IDX);                            \
-  CHECK_RESULT(validate_int32(c, _c[0], _c[1], _c[2], _c[3]))
+result_t test_vfmlsl_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[4], _b[8];
+  for (int i = 0; i < 4; i++) {
+    _a[i] = (float16_t)(impl.test_cases_float_pointer2[i] / 2);
+  }
+  for (int i = 0; i < 8; i++) {
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x2_t r = vld1_f32(_r);
+  float16x4_t a = load_f16x4(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[2];
+  float32x2_t c;
 
-  IMM_2_ITER
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 2; i++) {                        \
+    _c[i] = _r[i] - (float)_a[i + 2] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlsl_laneq_high_f16(r, a, b, IDX);             \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1]))
+
+  IMM_8_ITER
 #undef TEST_IMPL
 
   return TEST_SUCCESS;
@@ -38066,417 +42036,991 @@ result_t test_vdotq_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_vsha512hq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
-
-result_t test_vsha512h2q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vfmlalq_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
+  }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  float32x4_t c;
 
-result_t test_vsha512su0q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _c[i] = _r[i] + (float)_a[i + 4] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlalq_laneq_high_f16(r, a, b, IDX);            \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
 
-result_t test_vsha512su1q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_veor3q_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
+  return TEST_SUCCESS;
 #else
-#ifdef ENABLE_TEST_ALL
-  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
-  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
-  const uint8_t *_c = (const uint8_t *)impl.test_cases_int_pointer3;
-  uint8_t _d[16];
-  for (int i = 0; i < 16; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_vfmlslq_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && NEON2RVV_TEST_F16
+  const float *_r = impl.test_cases_float_pointer1;
+  float16_t _a[8], _b[8];
+  for (int i = 0; i < 8; i++) {
+    _a[i] = (float16_t)(impl.test_cases_floats[iter + 4 + i] / 2);
+    _b[i] = (float16_t)(impl.test_cases_floats[iter + 12 + i] / 2);
   }
+  float32x4_t r = vld1q_f32(_r);
+  float16x8_t a = load_f16x8(_a);
+  float16x8_t b = load_f16x8(_b);
+  float _c[4];
+  float32x4_t c;
 
-  uint8x16_t a = vld1q_u8(_a);
-  uint8x16_t b = vld1q_u8(_b);
-  uint8x16_t c = vld1q_u8(_c);
-  uint8x16_t d = veor3q_u8(a, b, c);
-  return validate_uint8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7], _d[8], _d[9], _d[10], _d[11], _d[12],
-                        _d[13], _d[14], _d[15]);
+#define TEST_IMPL(IDX)                                 \
+  for (int i = 0; i < 4; i++) {                        \
+    _c[i] = _r[i] - (float)_a[i + 4] * (float)_b[IDX]; \
+  }                                                    \
+  c = vfmlslq_laneq_high_f16(r, a, b, IDX);            \
+  CHECK_RESULT(validate_float(c, _c[0], _c[1], _c[2], _c[3]))
+
+  IMM_8_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
 #else
   return TEST_UNIMPL;
-#endif  // defined(__clang__)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_veor3q_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
-#else
+result_t test_vcadd_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcadd_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
-  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
-  const uint16_t *_c = (const uint16_t *)impl.test_cases_int_pointer3;
-  uint16_t _d[8];
-  for (int i = 0; i < 8; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[2];
+  for (int i = 0; i < 2; i += 2) {
+    _c[i] = _a[i] - _b[i + 1];
+    _c[i + 1] = _a[i + 1] + _b[i];
   }
 
-  uint16x8_t a = vld1q_u16(_a);
-  uint16x8_t b = vld1q_u16(_b);
-  uint16x8_t c = vld1q_u16(_c);
-  uint16x8_t d = veor3q_u16(a, b, c);
-  return validate_uint16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t c = vcadd_rot90_f32(a, b);
+  return validate_float(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
-#endif  // defined(__clang__)
 }
 
-result_t test_veor3q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
-#else
+result_t test_vcaddq_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcaddq_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
-  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
-  const uint32_t *_c = (const uint32_t *)impl.test_cases_int_pointer3;
-  uint32_t _d[4];
-  for (int i = 0; i < 4; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[4];
+  for (int i = 0; i < 4; i += 2) {
+    _c[i] = _a[i] - _b[i + 1];
+    _c[i + 1] = _a[i + 1] + _b[i];
   }
 
-  uint32x4_t a = vld1q_u32(_a);
-  uint32x4_t b = vld1q_u32(_b);
-  uint32x4_t c = vld1q_u32(_c);
-  uint32x4_t d = veor3q_u32(a, b, c);
-  return validate_uint32(d, _d[0], _d[1], _d[2], _d[3]);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t c = vcaddq_rot90_f32(a, b);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
-#endif  // defined(__clang__)
 }
 
-result_t test_veor3q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
-#else
+result_t test_vcaddq_rot90_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
-  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
-  const uint64_t *_c = (const uint64_t *)impl.test_cases_int_pointer3;
-  uint64_t _d[2];
-  for (int i = 0; i < 2; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c[2];
+  for (int i = 0; i < 2; i += 2) {
+    _c[i] = _a[i] - _b[i + 1];
+    _c[i + 1] = _a[i + 1] + _b[i];
   }
 
-  uint64x2_t a = vld1q_u64(_a);
-  uint64x2_t b = vld1q_u64(_b);
-  uint64x2_t c = vld1q_u64(_c);
-  uint64x2_t d = veor3q_u64(a, b, c);
-  return validate_uint64(d, _d[0], _d[1]);
+  float64x2_t a = vld1q_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  float64x2_t c = vcaddq_rot90_f64(a, b);
+  return validate_double(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
-#endif  // defined(__clang__)
 }
 
-result_t test_veor3q_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
-#else
+result_t test_vcadd_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcadd_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
-  const int8_t *_b = (const int8_t *)impl.test_cases_int_pointer2;
-  const int8_t *_c = (const int8_t *)impl.test_cases_int_pointer3;
-  int8_t _d[16];
-  for (int i = 0; i < 16; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[2];
+  for (int i = 0; i < 2; i += 2) {
+    _c[i] = _a[i] + _b[i + 1];
+    _c[i + 1] = _a[i + 1] - _b[i];
   }
 
-  int8x16_t a = vld1q_s8(_a);
-  int8x16_t b = vld1q_s8(_b);
-  int8x16_t c = vld1q_s8(_c);
-  int8x16_t d = veor3q_s8(a, b, c);
-  return validate_int8(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7], _d[8], _d[9], _d[10], _d[11], _d[12],
-                       _d[13], _d[14], _d[15]);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t c = vcadd_rot270_f32(a, b);
+  return validate_float(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
-#endif  // defined(__clang__)
 #endif  // ENABLE_TEST_ALL
 }
 
-result_t test_veor3q_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
-#else
+result_t test_vcaddq_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcaddq_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
-  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
-  const int16_t *_c = (const int16_t *)impl.test_cases_int_pointer3;
-  int16_t _d[8];
-  for (int i = 0; i < 8; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  const float *_a = (float *)impl.test_cases_float_pointer1;
+  const float *_b = (float *)impl.test_cases_float_pointer2;
+  float _c[4];
+  for (int i = 0; i < 4; i += 2) {
+    _c[i] = _a[i] + _b[i + 1];
+    _c[i + 1] = _a[i + 1] - _b[i];
   }
 
-  int16x8_t a = vld1q_s16(_a);
-  int16x8_t b = vld1q_s16(_b);
-  int16x8_t c = vld1q_s16(_c);
-  int16x8_t d = veor3q_s16(a, b, c);
-  return validate_int16(d, _d[0], _d[1], _d[2], _d[3], _d[4], _d[5], _d[6], _d[7]);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t c = vcaddq_rot270_f32(a, b);
+  return validate_float(c, _c[0], _c[1], _c[2], _c[3]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
-#endif  // defined(__clang__)
 }
 
-result_t test_veor3q_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
-#else
+result_t test_vcaddq_rot270_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
-  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
-  const int32_t *_c = (const int32_t *)impl.test_cases_int_pointer3;
-  int32_t _d[4];
-  for (int i = 0; i < 4; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  const double *_a = (double *)impl.test_cases_float_pointer1;
+  const double *_b = (double *)impl.test_cases_float_pointer2;
+  double _c[2];
+  for (int i = 0; i < 2; i += 2) {
+    _c[i] = _a[i] + _b[i + 1];
+    _c[i + 1] = _a[i + 1] - _b[i];
   }
 
-  int32x4_t a = vld1q_s32(_a);
-  int32x4_t b = vld1q_s32(_b);
-  int32x4_t c = vld1q_s32(_c);
-  int32x4_t d = veor3q_s32(a, b, c);
-  return validate_int32(d, _d[0], _d[1], _d[2], _d[3]);
+  float64x2_t a = vld1q_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  float64x2_t c = vcaddq_rot270_f64(a, b);
+  return validate_double(c, _c[0], _c[1]);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
-#endif  // defined(__clang__)
 }
 
-result_t test_veor3q_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
-#if defined(__clang__)
-  return TEST_UNIMPL;
-#else
+result_t test_vcmla_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vcmla_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-  const int64_t *_a = (const int64_t *)impl.test_cases_int_pointer1;
-  const int64_t *_b = (const int64_t *)impl.test_cases_int_pointer2;
-  const int64_t *_c = (const int64_t *)impl.test_cases_int_pointer3;
-  int64_t _d[2];
-  for (int i = 0; i < 2; i++) {
-    _d[i] = _a[i] ^ _b[i] ^ _c[i];
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  for (int i = 0; i < 2; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] + _a[i] * _b_re;
+    _d[i + 1] = _r[i + 1] + _a[i] * _b_im;
   }
 
-  int64x2_t a = vld1q_s64(_a);
-  int64x2_t b = vld1q_s64(_b);
-  int64x2_t c = vld1q_s64(_c);
-  int64x2_t d = veor3q_s64(a, b, c);
-  return validate_int64(d, _d[0], _d[1]);
+  float32x2_t d = vcmla_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], 0.0001f);
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
-#endif  // defined(__clang__)
 }
 
-result_t test_vrax1q_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vxarq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t d;
 
-result_t test_vbcaxq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 2; i += 2) {         \
+    float _b_re = _b[IDX * 2];             \
+    float _b_im = _b[IDX * 2 + 1];         \
+    _d[i] = _r[i] + _a[i] * _b_re;         \
+    _d[i + 1] = _r[i + 1] + _a[i] * _b_im; \
+  }                                        \
+  d = vcmla_lane_f32(r, a, b, IDX);        \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vbcaxq_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
 
-result_t test_vbcaxq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vbcaxq_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vbcaxq_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x2_t d;
 
-result_t test_vbcaxq_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 2; i += 2) {         \
+    float _b_re = _b[IDX * 2];             \
+    float _b_im = _b[IDX * 2 + 1];         \
+    _d[i] = _r[i] + _a[i] * _b_re;         \
+    _d[i + 1] = _r[i + 1] + _a[i] * _b_im; \
+  }                                        \
+  d = vcmla_laneq_f32(r, a, b, IDX);       \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vbcaxq_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vbcaxq_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsm3ss1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vsm3tt1aq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  for (int i = 0; i < 4; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] + _a[i] * _b_re;
+    _d[i + 1] = _r[i + 1] + _a[i] * _b_im;
+  }
 
-result_t test_vsm3tt1bq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t d = vcmlaq_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsm3tt2aq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const double *_r = (const double *)impl.test_cases_float_pointer1;
+  const double *_a = (const double *)impl.test_cases_float_pointer2;
+  const double *_b = (const double *)impl.test_cases_float_pointer3;
+  double _d[2];
+  float64x2_t r = vld1q_f64(_r);
+  float64x2_t a = vld1q_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  for (int i = 0; i < 2; i += 2) {
+    double _b_re = _b[i];
+    double _b_im = _b[i + 1];
+    _d[i] = _r[i] + _a[i] * _b_re;
+    _d[i + 1] = _r[i + 1] + _a[i] * _b_im;
+  }
 
-result_t test_vsm3tt2bq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float64x2_t d = vcmlaq_f64(r, a, b);
+  return validate_double_error(d, _d[0], _d[1], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsm3partw1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vsm3partw2q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x4_t d;
 
-result_t test_vsm4eq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 4; i += 2) {         \
+    float _b_re = _b[IDX * 2];             \
+    float _b_im = _b[IDX * 2 + 1];         \
+    _d[i] = _r[i] + _a[i] * _b_re;         \
+    _d[i + 1] = _r[i + 1] + _a[i] * _b_im; \
+  }                                        \
+  d = vcmlaq_lane_f32(r, a, b, IDX);       \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
-result_t test_vsm4ekeyq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vfmlal_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmlsl_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t d;
 
-result_t test_vfmlalq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 4; i += 2) {         \
+    float _b_re = _b[IDX * 2];             \
+    float _b_im = _b[IDX * 2 + 1];         \
+    _d[i] = _r[i] + _a[i] * _b_re;         \
+    _d[i + 1] = _r[i + 1] + _a[i] * _b_im; \
+  }                                        \
+  d = vcmlaq_laneq_f32(r, a, b, IDX);      \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
-result_t test_vfmlslq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vfmlal_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vfmlsl_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmlalq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  for (int i = 0; i < 2; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] - _a[i + 1] * _b_im;
+    _d[i + 1] = _r[i + 1] + _a[i + 1] * _b_re;
+  }
 
-result_t test_vfmlslq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t d = vcmla_rot90_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vfmlal_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot90_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmlal_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot90_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t d;
 
-result_t test_vfmlalq_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 2; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] - _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] + _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmla_rot90_lane_f32(r, a, b, IDX);      \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vfmlalq_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
 
-result_t test_vfmlsl_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vfmlsl_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot90_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmlslq_lane_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot90_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x2_t d;
 
-result_t test_vfmlslq_laneq_low_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 2; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] - _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] + _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmla_rot90_laneq_f32(r, a, b, IDX);     \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vfmlal_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vfmlsl_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vfmlalq_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vfmlslq_lane_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  for (int i = 0; i < 4; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] - _a[i + 1] * _b_im;
+    _d[i + 1] = _r[i + 1] + _a[i + 1] * _b_re;
+  }
 
-result_t test_vfmlal_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t d = vcmlaq_rot90_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vfmlsl_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot90_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const double *_r = (const double *)impl.test_cases_float_pointer1;
+  const double *_a = (const double *)impl.test_cases_float_pointer2;
+  const double *_b = (const double *)impl.test_cases_float_pointer3;
+  double _d[2];
+  float64x2_t r = vld1q_f64(_r);
+  float64x2_t a = vld1q_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  for (int i = 0; i < 2; i += 2) {
+    double _b_re = _b[i];
+    double _b_im = _b[i + 1];
+    _d[i] = _r[i] - _a[i + 1] * _b_im;
+    _d[i + 1] = _r[i + 1] + _a[i + 1] * _b_re;
+  }
 
-result_t test_vfmlalq_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float64x2_t d = vcmlaq_rot90_f64(r, a, b);
+  return validate_double_error(d, _d[0], _d[1], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vfmlslq_laneq_high_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot90_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcadd_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot90_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x4_t d;
 
-result_t test_vcadd_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] - _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] + _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmlaq_rot90_lane_f32(r, a, b, IDX);     \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
-result_t test_vcaddq_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
 
-result_t test_vcaddq_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcaddq_rot90_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot90_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcadd_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot90_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t d;
 
-result_t test_vcadd_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] - _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] + _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmlaq_rot90_laneq_f32(r, a, b, IDX);    \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
-result_t test_vcaddq_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcaddq_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcaddq_rot270_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot180_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmla_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot180_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  for (int i = 0; i < 2; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] - _a[i] * _b_re;
+    _d[i + 1] = _r[i + 1] - _a[i] * _b_im;
+  }
 
-result_t test_vcmla_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t d = vcmla_rot180_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmla_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot180_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmla_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot180_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t d;
 
-result_t test_vcmla_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                     \
+  for (int i = 0; i < 2; i += 2) {         \
+    float _b_re = _b[IDX * 2];             \
+    float _b_im = _b[IDX * 2 + 1];         \
+    _d[i] = _r[i] - _a[i] * _b_re;         \
+    _d[i + 1] = _r[i + 1] - _a[i] * _b_im; \
+  }                                        \
+  d = vcmla_rot180_lane_f32(r, a, b, IDX); \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vcmla_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
 
-result_t test_vcmlaq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmlaq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot180_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmlaq_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot180_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x2_t d;
 
-result_t test_vcmlaq_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                      \
+  for (int i = 0; i < 2; i += 2) {          \
+    float _b_re = _b[IDX * 2];              \
+    float _b_im = _b[IDX * 2 + 1];          \
+    _d[i] = _r[i] - _a[i] * _b_re;          \
+    _d[i + 1] = _r[i + 1] - _a[i] * _b_im;  \
+  }                                         \
+  d = vcmla_rot180_laneq_f32(r, a, b, IDX); \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vcmlaq_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcmlaq_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmlaq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot180_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmla_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot180_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  for (int i = 0; i < 4; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] - _a[i] * _b_re;
+    _d[i + 1] = _r[i + 1] - _a[i] * _b_im;
+  }
 
-result_t test_vcmla_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t d = vcmlaq_rot180_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmla_rot90_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot180_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const double *_r = (const double *)impl.test_cases_float_pointer1;
+  const double *_a = (const double *)impl.test_cases_float_pointer2;
+  const double *_b = (const double *)impl.test_cases_float_pointer3;
+  double _d[2];
+  float64x2_t r = vld1q_f64(_r);
+  float64x2_t a = vld1q_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  for (int i = 0; i < 2; i += 2) {
+    double _b_re = _b[i];
+    double _b_im = _b[i + 1];
+    _d[i] = _r[i] - _a[i] * _b_re;
+    _d[i + 1] = _r[i + 1] - _a[i] * _b_im;
+  }
 
-result_t test_vcmla_rot90_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float64x2_t d = vcmlaq_rot180_f64(r, a, b);
+  return validate_double_error(d, _d[0], _d[1], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmla_rot90_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot180_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmla_rot90_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot180_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x4_t d;
 
-result_t test_vcmlaq_rot90_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                      \
+  for (int i = 0; i < 4; i += 2) {          \
+    float _b_re = _b[IDX * 2];              \
+    float _b_im = _b[IDX * 2 + 1];          \
+    _d[i] = _r[i] - _a[i] * _b_re;          \
+    _d[i + 1] = _r[i + 1] - _a[i] * _b_im;  \
+  }                                         \
+  d = vcmlaq_rot180_lane_f32(r, a, b, IDX); \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
-result_t test_vcmlaq_rot90_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
 
-result_t test_vcmlaq_rot90_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmlaq_rot90_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot180_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmlaq_rot90_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot180_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t d;
 
-result_t test_vcmlaq_rot90_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                       \
+  for (int i = 0; i < 4; i += 2) {           \
+    float _b_re = _b[IDX * 2];               \
+    float _b_im = _b[IDX * 2 + 1];           \
+    _d[i] = _r[i] - _a[i] * _b_re;           \
+    _d[i + 1] = _r[i + 1] - _a[i] * _b_im;   \
+  }                                          \
+  d = vcmlaq_rot180_laneq_f32(r, a, b, IDX); \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
-result_t test_vcmlaq_rot90_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcmla_rot180_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmla_rot180_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmla_rot180_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  for (int i = 0; i < 2; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] + _a[i + 1] * _b_im;
+    _d[i + 1] = _r[i + 1] - _a[i + 1] * _b_re;
+  }
 
-result_t test_vcmla_rot180_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x2_t d = vcmla_rot270_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmla_rot180_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot270_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmla_rot180_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot270_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t d;
 
-result_t test_vcmlaq_rot180_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 2; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] + _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] - _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmla_rot270_lane_f32(r, a, b, IDX);     \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vcmlaq_rot180_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
 
-result_t test_vcmlaq_rot180_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmlaq_rot180_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot270_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmlaq_rot180_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmla_rot270_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[2];
+  float32x2_t r = vld1_f32(_r);
+  float32x2_t a = vld1_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x2_t d;
 
-result_t test_vcmlaq_rot180_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 2; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] + _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] - _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmla_rot270_laneq_f32(r, a, b, IDX);    \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], 0.0001f))
 
-result_t test_vcmlaq_rot180_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_2_ITER
+#undef TEST_IMPL
 
-result_t test_vcmla_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmla_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmla_rot270_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  for (int i = 0; i < 4; i += 2) {
+    float _b_re = _b[i];
+    float _b_im = _b[i + 1];
+    _d[i] = _r[i] + _a[i + 1] * _b_im;
+    _d[i + 1] = _r[i + 1] - _a[i + 1] * _b_re;
+  }
 
-result_t test_vcmla_rot270_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float32x4_t d = vcmlaq_rot270_f32(r, a, b);
+  return validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmla_rot270_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot270_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const double *_r = (const double *)impl.test_cases_float_pointer1;
+  const double *_a = (const double *)impl.test_cases_float_pointer2;
+  const double *_b = (const double *)impl.test_cases_float_pointer3;
+  double _d[2];
+  float64x2_t r = vld1q_f64(_r);
+  float64x2_t a = vld1q_f64(_a);
+  float64x2_t b = vld1q_f64(_b);
+  for (int i = 0; i < 2; i += 2) {
+    double _b_re = _b[i];
+    double _b_im = _b[i + 1];
+    _d[i] = _r[i] + _a[i + 1] * _b_im;
+    _d[i + 1] = _r[i + 1] - _a[i + 1] * _b_re;
+  }
 
-result_t test_vcmla_rot270_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  float64x2_t d = vcmlaq_rot270_f64(r, a, b);
+  return validate_double_error(d, _d[0], _d[1], 0.0001f);
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vcmlaq_rot270_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot270_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmlaq_rot270_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot270_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x4_t d;
 
-result_t test_vcmlaq_rot270_f64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] + _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] - _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmlaq_rot270_lane_f32(r, a, b, IDX);    \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
 
-result_t test_vcmlaq_rot270_lane_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_1_ITER
+#undef TEST_IMPL
 
-result_t test_vcmlaq_rot270_lane_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vcmlaq_rot270_laneq_f16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vcmlaq_rot270_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vcmlaq_rot270_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const float *_r = (const float *)impl.test_cases_float_pointer1;
+  const float *_a = (const float *)impl.test_cases_float_pointer2;
+  const float *_b = (const float *)impl.test_cases_float_pointer3;
+  float _d[4];
+  float32x4_t r = vld1q_f32(_r);
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t d;
+
+#define TEST_IMPL(IDX)                         \
+  for (int i = 0; i < 4; i += 2) {             \
+    float _b_re = _b[IDX * 2];                 \
+    float _b_im = _b[IDX * 2 + 1];             \
+    _d[i] = _r[i] + _a[i + 1] * _b_im;         \
+    _d[i + 1] = _r[i + 1] - _a[i + 1] * _b_re; \
+  }                                            \
+  d = vcmlaq_rot270_laneq_f32(r, a, b, IDX);   \
+  CHECK_RESULT(validate_float_error(d, _d[0], _d[1], _d[2], _d[3], 0.0001f))
+
+  IMM_2_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
 result_t test_vrnd32z_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
@@ -38916,9 +43460,6 @@ result_t test_vbfmlaltq_laneq_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter)
 
 result_t test_vqrdmlsh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int16_t *_a = (int16_t *)impl.test_cases_int_pointer1;
   const int16_t *_b = (int16_t *)impl.test_cases_int_pointer2;
   const int16_t *_c = (int16_t *)impl.test_cases_int_pointer3;
@@ -38937,7 +43478,6 @@ result_t test_vqrdmlsh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #undef TEST_IMPL
 
   return validate_int16(d, _d[0], _d[1], _d[2], _d[3]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -38945,9 +43485,6 @@ result_t test_vqrdmlsh_lane_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 
 result_t test_vqrdmlsh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #ifdef ENABLE_TEST_ALL
-#if defined(__GNUC__)
-  return TEST_UNIMPL;
-#else
   const int32_t *_a = (int32_t *)impl.test_cases_int_pointer1;
   const int32_t *_b = (int32_t *)impl.test_cases_int_pointer2;
   const int32_t *_c = (int32_t *)impl.test_cases_int_pointer3;
@@ -38966,7 +43503,6 @@ result_t test_vqrdmlsh_lane_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
 #undef TEST_IMPL
 
   return validate_int32(d, _d[0], _d[1]);
-#endif
 #else
   return TEST_UNIMPL;
 #endif  // ENABLE_TEST_ALL
@@ -59216,226 +63752,1524 @@ result_t test_vreinterpretq_u32_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t it
 
 result_t test_vreinterpretq_p8_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
 
-result_t test_vreinterpretq_p16_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_vreinterpretq_p16_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u64_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s64_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_f64_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_f16_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vldrq_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vstrq_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u64_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u64_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u64_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u64_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u64_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u64_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s8_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_s32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u8_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_u32_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p8_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vreinterpretq_p16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaeseq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaesdq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaesmcq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaesimcq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha1h_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha1cq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha1pq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha1mq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha1su0q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha1su1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha256hq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha256h2q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha256su0q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vsha256su1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+// Dummy function to match the case label in run_single_test.
+result_t test_vmull_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vmull_high_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vadd_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vadd_p16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vadd_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaddq_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaddq_p16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaddq_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test_vaddq_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+
+result_t test___crc32b(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 8, 0xedb88320);
+
+  uint32_t c = __crc32b(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test___crc32h(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 16, 0xedb88320);
+
+  uint32_t c = __crc32h(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test___crc32w(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 32, 0xedb88320);
+
+  uint32_t c = __crc32w(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test___crc32d(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 64, 0xedb88320);
+
+  uint32_t c = __crc32d(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test___crc32cb(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 8, 0x82f63b78);
+
+  uint32_t c = __crc32cb(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test___crc32ch(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 16, 0x82f63b78);
+
+  uint32_t c = __crc32ch(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test___crc32cw(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 32, 0x82f63b78);
+
+  uint32_t c = __crc32cw(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test___crc32cd(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint64_t *_b = (const uint64_t *)impl.test_cases_int_pointer2;
+  uint32_t _c = crc32_reflected(_a[0], _b[0], 64, 0x82f63b78);
+
+  uint32_t c = __crc32cd(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_movemask_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint16_t _c = 0;
+  for (int i = 0; i < 16; i++) {
+    _c |= (uint16_t)(_a[i] >> 7) << i;
+  }
+
+  uint8x16_t a = vld1q_u8(_a);
+  uint16_t c = neon2rvv_movemask_u8(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_nibblemask_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  uint64_t _c = 0;
+  for (int i = 0; i < 8; i++) {
+    _c |= (uint64_t)((_a[i] >> 4) & UINT8_MAX) << (i * 8);
+  }
+
+  uint8x16_t a = vreinterpretq_u8_u16(vld1q_u16(_a));
+  uint64_t c = neon2rvv_nibblemask_u8(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_any_nonzero(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _b[16];
+  int _c = 0;
+  for (int i = 0; i < 16; i++) {
+    _b[i] = (_a[i] & 0x7) == 0 ? UINT8_MAX : 0;
+    _c |= _b[i] != 0;
+  }
+
+  uint8x16_t b = vld1q_u8(_b);
+  int c = neon2rvv_any_nonzero(b);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_all_ones(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _b[16];
+  int _c = 1;
+  for (int i = 0; i < 16; i++) {
+    _b[i] = (_a[i] & 0x7) == 0 ? 0 : UINT8_MAX;
+    _c &= _b[i] == UINT8_MAX;
+  }
+
+  uint8x16_t b = vld1q_u8(_b);
+  int c = neon2rvv_all_ones(b);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_first_set_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8_t _b[16];
+  int _c = -1;
+  for (int i = 15; i >= 0; i--) {
+    _b[i] = (_a[i] & 0x7) == 0 ? UINT8_MAX : 0;
+    if (_b[i]) {
+      _c = i;
+    }
+  }
+
+  uint8x16_t b = vld1q_u8(_b);
+  int c = neon2rvv_first_set_lane(b);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vgetq_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8x16_t a = vld1q_u8(_a);
+
+#define TEST_IMPL(IDX)                           \
+  if (neon2rvv::vgetq_lane<IDX>(a) != _a[IDX]) { \
+    return TEST_FAIL;                            \
+  }
+
+  IMM_16_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vsetq_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  int16x8_t b = vld1q_s16(_b);
+  int16_t _c[8], _d[8];
+
+#define TEST_IMPL(IDX)                                  \
+  vst1q_s16(_c, neon2rvv::vsetq_lane<IDX>(_a[IDX], b)); \
+  vst1q_s16(_d, vsetq_lane_s16(_a[IDX], b, IDX));       \
+  for (int i = 0; i < 8; i++) {                         \
+    if (_c[i] != _d[i]) {                               \
+      return TEST_FAIL;                                 \
+    }                                                   \
+  }
+
+  IMM_8_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vdupq_laneq(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32x4_t a = vld1q_u32(_a);
+  uint32_t _c[4];
+
+#define TEST_IMPL(IDX)                           \
+  vst1q_u32(_c, neon2rvv::vdupq_laneq<IDX>(a));  \
+  for (int i = 0; i < 4; i++) {                  \
+    if (_c[i] != _a[IDX]) {                      \
+      return TEST_FAIL;                          \
+    }                                            \
+  }                                              \
+  vst1_u32(_c, neon2rvv::vdup_lane<IDX / 2>(a)); \
+  for (int i = 0; i < 2; i++) {                  \
+    if (_c[i] != _a[IDX / 2]) {                  \
+      return TEST_FAIL;                          \
+    }                                            \
+  }
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vextq(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  uint8x16_t a = vld1q_u8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  uint8_t _c[16], _d[16];
+
+#define TEST_IMPL(IDX)                      \
+  vst1q_u8(_c, neon2rvv::vextq<IDX>(a, b)); \
+  vst1q_u8(_d, vextq_u8(a, b, IDX));        \
+  for (int i = 0; i < 16; i++) {            \
+    if (_c[i] != _d[i]) {                   \
+      return TEST_FAIL;                     \
+    }                                       \
+  }
+
+  IMM_16_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vshrq_n(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int8_t *_a = (const int8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  int8x16_t a = vld1q_s8(_a);
+  uint8x16_t b = vld1q_u8(_b);
+  int8_t _c[16];
+  uint8_t _d[16];
+
+#define TEST_IMPL(IDX)                                                                     \
+  vst1q_s8(_c, neon2rvv::vshrq_n<IDX + 1>(a));                                             \
+  vst1q_u8(_d, neon2rvv::vshrq_n<IDX + 1>(b));                                             \
+  for (int i = 0; i < 16; i++) {                                                           \
+    if (_c[i] != (int8_t)(_a[i] >> (IDX + 1)) || _d[i] != (uint8_t)(_b[i] >> (IDX + 1))) { \
+      return TEST_FAIL;                                                                    \
+    }                                                                                      \
+  }
+
+  IMM_8_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vshrn_n(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  uint32x4_t a = vld1q_u32(_a);
+  int32x4_t b = vld1q_s32(_b);
+  uint16_t _c[4];
+  int16_t _d[4];
+
+#define TEST_IMPL(IDX)                                                                       \
+  vst1_u16(_c, neon2rvv::vshrn_n<IDX + 1>(a));                                               \
+  vst1_s16(_d, neon2rvv::vshrn_n<IDX + 1>(b));                                               \
+  for (int i = 0; i < 4; i++) {                                                              \
+    if (_c[i] != (uint16_t)(_a[i] >> (IDX + 1)) || _d[i] != (int16_t)(_b[i] >> (IDX + 1))) { \
+      return TEST_FAIL;                                                                      \
+    }                                                                                        \
+  }
+
+  IMM_16_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vfmaq_laneq(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const float *_a = impl.test_cases_float_pointer1;
+  const float *_b = impl.test_cases_float_pointer2;
+  const float *_c = impl.test_cases_float_pointer3;
+  float32x4_t a = vld1q_f32(_a);
+  float32x4_t b = vld1q_f32(_b);
+  float32x4_t c = vld1q_f32(_c);
+  float _d[4], _e[4];
+
+#define TEST_IMPL(IDX)                                \
+  vst1q_f32(_d, neon2rvv::vfmaq_laneq<IDX>(a, b, c)); \
+  vst1q_f32(_e, vfmaq_laneq_f32(a, b, c, IDX));       \
+  if (memcmp(_d, _e, sizeof(_d)) != 0) {              \
+    return TEST_FAIL;                                 \
+  }                                                   \
+  vst1q_f32(_d, neon2rvv::vmulq_laneq<IDX>(a, c));    \
+  vst1q_f32(_e, vmulq_laneq_f32(a, c, IDX));          \
+  if (memcmp(_d, _e, sizeof(_d)) != 0) {              \
+    return TEST_FAIL;                                 \
+  }
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vget_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  uint8x8_t a = vld1_u8(_a);
+
+#define TEST_IMPL(IDX)                                       \
+  if (neon2rvv::vget_lane<IDX>(a) != vget_lane_u8(a, IDX)) { \
+    return TEST_FAIL;                                        \
+  }
+
+  IMM_8_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vset_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  int16x4_t b = vld1_s16(_b);
+  int16_t _c[4], _d[4];
+
+#define TEST_IMPL(IDX)                                \
+  vst1_s16(_c, neon2rvv::vset_lane<IDX>(_a[IDX], b)); \
+  vst1_s16(_d, vset_lane_s16(_a[IDX], b, IDX));       \
+  if (memcmp(_c, _d, sizeof(_c)) != 0) {              \
+    return TEST_FAIL;                                 \
+  }
+
+  IMM_4_ITER
+#undef TEST_IMPL
+
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
+
+result_t test_neon2rvv_vdupq_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint16_t *_a = (const uint16_t *)impl.test_cases_int_pointer1;
+  uint16x4_t a = vld1_u16(_a);
+  uint16x8_t b = vld1q_u16(_a);
+  uint16_t _c[8], _d[8];
 
-result_t test_vreinterpretq_u64_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                             \
+  vst1q_u16(_c, neon2rvv::vdupq_lane<IDX / 2>(a)); \
+  vst1q_u16(_d, vdupq_lane_u16(a, IDX / 2));       \
+  if (memcmp(_c, _d, sizeof(_c)) != 0) {           \
+    return TEST_FAIL;                              \
+  }                                                \
+  vst1_u16(_c, neon2rvv::vdup_laneq<IDX>(b));      \
+  vst1_u16(_d, vdup_laneq_u16(b, IDX));            \
+  if (memcmp(_c, _d, sizeof(uint16_t) * 4) != 0) { \
+    return TEST_FAIL;                              \
+  }
 
-result_t test_vreinterpretq_s64_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vreinterpretq_f64_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_f16_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_vext(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_int_pointer1;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_int_pointer2;
+  uint8x8_t a = vld1_u8(_a);
+  uint8x8_t b = vld1_u8(_b);
+  uint8_t _c[8], _d[8];
 
-result_t test_vldrq_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                    \
+  vst1_u8(_c, neon2rvv::vext<IDX>(a, b)); \
+  vst1_u8(_d, vext_u8(a, b, IDX));        \
+  if (memcmp(_c, _d, sizeof(_c)) != 0) {  \
+    return TEST_FAIL;                     \
+  }
 
-result_t test_vstrq_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vreinterpretq_u64_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u64_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_vshl_n(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  int16x4_t a = vld1_s16(_a);
+  int16x8_t b = vld1q_s16(_a);
+  int16_t _c[8], _d[8];
 
-result_t test_vreinterpretq_u64_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                            \
+  vst1_s16(_c, neon2rvv::vshl_n<IDX>(a));         \
+  vst1_s16(_d, vshl_n_s16(a, IDX));               \
+  if (memcmp(_c, _d, sizeof(int16_t) * 4) != 0) { \
+    return TEST_FAIL;                             \
+  }                                               \
+  vst1q_s16(_c, neon2rvv::vshlq_n<IDX>(b));       \
+  vst1q_s16(_d, vshlq_n_s16(b, IDX));             \
+  if (memcmp(_c, _d, sizeof(_c)) != 0) {          \
+    return TEST_FAIL;                             \
+  }
 
-result_t test_vreinterpretq_u64_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_16_ITER
+#undef TEST_IMPL
 
-result_t test_vreinterpretq_u64_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u64_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_vshr_n(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const uint16_t *_b = (const uint16_t *)impl.test_cases_int_pointer2;
+  int16x4_t a = vld1_s16(_a);
+  uint16x4_t b = vld1_u16(_b);
+  int16_t _c[4], _d[4];
+  uint16_t _e[4], _f[4];
 
-result_t test_vreinterpretq_s8_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                                      \
+  vst1_s16(_c, neon2rvv::vshr_n<IDX + 1>(a));                               \
+  vst1_s16(_d, vshr_n_s16(a, IDX + 1));                                     \
+  vst1_u16(_e, neon2rvv::vshr_n<IDX + 1>(b));                               \
+  vst1_u16(_f, vshr_n_u16(b, IDX + 1));                                     \
+  if (memcmp(_c, _d, sizeof(_c)) != 0 || memcmp(_e, _f, sizeof(_e)) != 0) { \
+    return TEST_FAIL;                                                       \
+  }
 
-result_t test_vreinterpretq_s8_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_16_ITER
+#undef TEST_IMPL
 
-result_t test_vreinterpretq_s8_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s8_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_vmulq_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  const int16_t *_b = (const int16_t *)impl.test_cases_int_pointer2;
+  int16x4_t a = vld1_s16(_a);
+  int16x8_t aq = vld1q_s16(_a);
+  int16x4_t b = vld1_s16(_b);
+  int16x8_t bq = vld1q_s16(_b);
+  int16_t _c[8], _d[8];
 
-result_t test_vreinterpretq_s8_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                 \
+  vst1_s16(_c, neon2rvv::vmul_lane<IDX / 2>(a, b));    \
+  vst1_s16(_d, vmul_lane_s16(a, b, IDX / 2));          \
+  if (memcmp(_c, _d, sizeof(int16_t) * 4) != 0) {      \
+    return TEST_FAIL;                                  \
+  }                                                    \
+  vst1q_s16(_c, neon2rvv::vmulq_lane<IDX / 2>(aq, b)); \
+  vst1q_s16(_d, vmulq_lane_s16(aq, b, IDX / 2));       \
+  if (memcmp(_c, _d, sizeof(_c)) != 0) {               \
+    return TEST_FAIL;                                  \
+  }                                                    \
+  vst1_s16(_c, neon2rvv::vmul_laneq<IDX>(a, bq));      \
+  vst1_s16(_d, vmul_laneq_s16(a, bq, IDX));            \
+  if (memcmp(_c, _d, sizeof(int16_t) * 4) != 0) {      \
+    return TEST_FAIL;                                  \
+  }                                                    \
+  vst1q_s16(_c, neon2rvv::vmulq_laneq<IDX>(aq, bq));   \
+  vst1q_s16(_d, vmulq_laneq_s16(aq, bq, IDX));         \
+  if (memcmp(_c, _d, sizeof(_c)) != 0) {               \
+    return TEST_FAIL;                                  \
+  }
 
-result_t test_vreinterpretq_s8_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_8_ITER
+#undef TEST_IMPL
 
-result_t test_vreinterpretq_s8_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s8_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_vfma_lane(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const float *_a = impl.test_cases_float_pointer1;
+  const float *_b = impl.test_cases_float_pointer2;
+  const float *_c = impl.test_cases_float_pointer3;
+  float32x2_t a = vld1_f32(_a);
+  float32x2_t b = vld1_f32(_b);
+  float32x2_t c = vld1_f32(_c);
+  float32x4_t aq = vld1q_f32(_a);
+  float32x4_t bq = vld1q_f32(_b);
+  float32x4_t cq = vld1q_f32(_c);
+  float _d[4], _e[4];
 
-result_t test_vreinterpretq_s16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                     \
+  vst1_f32(_d, neon2rvv::vfma_lane<IDX / 2>(a, b, c));     \
+  vst1_f32(_e, vfma_lane_f32(a, b, c, IDX / 2));           \
+  if (memcmp(_d, _e, sizeof(float) * 2) != 0) {            \
+    return TEST_FAIL;                                      \
+  }                                                        \
+  vst1q_f32(_d, neon2rvv::vfmaq_lane<IDX / 2>(aq, bq, c)); \
+  vst1q_f32(_e, vfmaq_lane_f32(aq, bq, c, IDX / 2));       \
+  if (memcmp(_d, _e, sizeof(_d)) != 0) {                   \
+    return TEST_FAIL;                                      \
+  }                                                        \
+  vst1_f32(_d, neon2rvv::vfma_laneq<IDX>(a, b, cq));       \
+  vst1_f32(_e, vfma_laneq_f32(a, b, cq, IDX));             \
+  if (memcmp(_d, _e, sizeof(float) * 2) != 0) {            \
+    return TEST_FAIL;                                      \
+  }
 
-result_t test_vreinterpretq_s16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_4_ITER
+#undef TEST_IMPL
 
-result_t test_vreinterpretq_s16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s16_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_add_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  uint8_t _c[67];
 
-result_t test_vreinterpretq_s16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_add_u8(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint8_t)(_a[i] + _b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s16_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_add_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const float *_a = (const float *)impl.test_cases_floats + iter % 4096;
+  const float *_b = (const float *)impl.test_cases_floats + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  float _c[67];
 
-result_t test_vreinterpretq_s16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_add_f32(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (float)(_a[i] + _b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_qadd_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  uint8_t _c[67];
 
-result_t test_vreinterpretq_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_qadd_u8(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint8_t)(_a[i] + _b[i] > UINT8_MAX ? UINT8_MAX : _a[i] + _b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s32_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_qadd_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int16_t *_a = (const int16_t *)impl.test_cases_ints + iter % 4096;
+  const int16_t *_b = (const int16_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  int16_t _c[67];
 
-result_t test_vreinterpretq_s32_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_qadd_s16(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    int32_t sum = (int32_t)_a[i] + _b[i];
+    sum = sum > INT16_MAX ? INT16_MAX : sum < INT16_MIN ? INT16_MIN : sum;
+    if (_c[i] != sum) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s32_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_min_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  uint8_t _c[67];
 
-result_t test_vreinterpretq_s32_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_min_u8(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint8_t)(_a[i] < _b[i] ? _a[i] : _b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s32_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_max_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  uint8_t _c[67];
 
-result_t test_vreinterpretq_s32_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_max_u8(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint8_t)(_a[i] > _b[i] ? _a[i] : _b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_s32_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_abd_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  uint8_t _c[67];
 
-result_t test_vreinterpretq_u8_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_abd_u8(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint8_t)(_a[i] > _b[i] ? _a[i] - _b[i] : _b[i] - _a[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u8_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_mlal_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  const uint16_t *_acc = (const uint16_t *)impl.test_cases_ints + 8192 + iter % 1024;
+  size_t n = 1 + iter % 67;
+  uint16_t _c[67];
+  for (size_t i = 0; i < n; i++) {
+    _c[i] = _acc[i];
+  }
 
-result_t test_vreinterpretq_u8_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_mlal_u8(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint16_t)(_acc[i] + _a[i] * _b[i])) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u8_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_cvt_f32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int32_t *_a = (const int32_t *)impl.test_cases_ints + iter % 4096;
+  size_t n = 1 + iter % 67;
+  float _c[67];
 
-result_t test_vreinterpretq_u8_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_cvt_f32_s32(_c, _a, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (float)_a[i]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u8_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_cvt_s32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const float *_a = (const float *)impl.test_cases_floats + iter % 4096;
+  size_t n = 1 + iter % 67;
+  int32_t _c[67];
 
-result_t test_vreinterpretq_u8_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_cvt_s32_f32(_c, _a, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (int32_t)_a[i]) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u8_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_cgt_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  uint8_t _c[67];
 
-result_t test_vreinterpretq_u16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_cgt_u8(_c, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint8_t)(_a[i] > _b[i] ? UINT8_MAX : 0)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_bsl_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_mask = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + 4096 + iter % 4096;
+  const uint8_t *_b = (const uint8_t *)impl.test_cases_ints + 8192 + iter % 4096;
+  size_t n = 1 + iter % 67;
+  uint8_t _c[67];
 
-result_t test_vreinterpretq_u16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  neon2rvv_bulk_bsl_u8(_c, _mask, _a, _b, n);
+  for (size_t i = 0; i < n; i++) {
+    if (_c[i] != (uint8_t)((_mask[i] & _a[i]) | (~_mask[i] & _b[i]))) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u16_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_addlv_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const uint8_t *_a = (const uint8_t *)impl.test_cases_ints + iter % 4096;
+  size_t n = 1 + iter % 4096;
+  uint64_t _c = 0;
+  for (size_t i = 0; i < n; i++) {
+    _c += _a[i];
+  }
 
-result_t test_vreinterpretq_u16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return neon2rvv_bulk_addlv_u8(_a, n) == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_bulk_addlv_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const int16_t *_a = (const int16_t *)impl.test_cases_ints + iter % 4096;
+  size_t n = 1 + iter % 4096;
+  int64_t _c = 0;
+  for (size_t i = 0; i < n; i++) {
+    _c += _a[i];
+  }
 
-result_t test_vreinterpretq_u16_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return neon2rvv_bulk_addlv_s16(_a, n) == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_expr_vst1q(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const float *_a = impl.test_cases_floats + iter % 4096;
+  const float *_b = impl.test_cases_floats + 2048 + iter % 4096;
+  const float *_c = impl.test_cases_floats + 4096 + iter % 4096;
+  const float k = impl.test_cases_floats[iter];
+  size_t n = 4 * (1 + iter % 31);
+  float _d[124], _e[124];
 
-result_t test_vreinterpretq_p8_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  for (size_t i = 0; i < n; i += 4) {
+    float32x4_t ab_mul = vmulq_f32(vld1q_f32(_a + i), vld1q_f32(_b + i));
+    vst1q_f32(_d + i, vfmaq_f32(ab_mul, vld1q_f32(_c + i), vdupq_n_f32(k)));
+  }
+  neon2rvv::vst1q(_e, neon2rvv::vfmaq(neon2rvv::vmulq(neon2rvv::vld1q(_a), neon2rvv::vld1q(_b)), neon2rvv::vld1q(_c),
+                                      neon2rvv::vdupq_n(k)),
+                  n);
+  if (memcmp(_d, _e, n * sizeof(float)) != 0) {
+    return TEST_FAIL;
+  }
 
-result_t test_vreinterpretq_p16_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  for (size_t i = 0; i < n; i += 4) {
+    float32x4_t ab_div = vdivq_f32(vld1q_f32(_a + i), vld1q_f32(_b + i));
+    vst1q_f32(_d + i, vabsq_f32(vsubq_f32(ab_div, vnegq_f32(vld1q_f32(_c + i)))));
+  }
+  neon2rvv::vst1q(
+      _e, neon2rvv::vabsq(neon2rvv::vsubq(neon2rvv::vdivq(neon2rvv::vld1q(_a), neon2rvv::vld1q(_b)),
+                                          neon2rvv::vnegq(neon2rvv::vld1q(_c)))),
+      n);
+  return memcmp(_d, _e, n * sizeof(float)) == 0 ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u32_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+// -0 and +0 may come out of a max/min in either order
+static bool same_reduction(float a, float b) { return a == b || (isnan(a) && isnan(b)); }
+#endif
 
-result_t test_vreinterpretq_p8_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test_neon2rvv_expr_reduce(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && (defined(__riscv) || defined(__riscv__))
+  const float *_b = impl.test_cases_floats + 4096 + iter % 4096;
+  size_t n = 4 * (1 + iter % 31);
+  float _a[124], _c[124];
+  memcpy(_a, impl.test_cases_floats + iter % 4096, n * sizeof(float));
+
+  // the second pass puts a NaN in one lane
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass) {
+      _a[iter % n] = NAN;
+    }
+    for (size_t i = 0; i < n; i += 4) {
+      vst1q_f32(_c + i, vmulq_f32(vld1q_f32(_a + i), vld1q_f32(_b + i)));
+    }
+    float sum = 0, max = -INFINITY, min = INFINITY;
+    bool nan = false;
+    for (size_t i = 0; i < n; i++) {
+      sum += _c[i];
+      max = _c[i] > max ? _c[i] : max;
+      min = _c[i] < min ? _c[i] : min;
+      nan = nan || isnan(_c[i]);
+    }
+#if NEON2RVV_STRICT_NAN
+    if (nan) {
+      max = NAN;
+      min = NAN;
+    }
+#endif
 
-result_t test_vreinterpretq_p16_f32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+    if (!same_reduction(neon2rvv::vaddvq(neon2rvv::vmulq(neon2rvv::vld1q(_a), neon2rvv::vld1q(_b)), n), sum) ||
+        !same_reduction(neon2rvv::vmaxvq(neon2rvv::vmulq(neon2rvv::vld1q(_a), neon2rvv::vld1q(_b)), n), max) ||
+        !same_reduction(neon2rvv::vminvq(neon2rvv::vmulq(neon2rvv::vld1q(_a), neon2rvv::vld1q(_b)), n), min)) {
+      return TEST_FAIL;
+    }
+  }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u32_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___clz(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t a = _a[0] >> (iter % 32);
+  unsigned int _c = 0;
+  for (int i = 32 - 1; i >= 0 && !((a >> i) & 1); i--) {
+    _c++;
+  }
 
-result_t test_vreinterpretq_p8_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned int c = __clz(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_p16_s64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___clzl(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const unsigned long *_a = (const unsigned long *)impl.test_cases_int_pointer1;
+  unsigned long a = _a[0] >> (iter % (sizeof(long) * 8));
+  unsigned int _c = 0;
+  for (int i = sizeof(long) * 8 - 1; i >= 0 && !((a >> i) & 1); i--) {
+    _c++;
+  }
 
-result_t test_vreinterpretq_u32_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned int c = __clzl(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_p8_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___clzll(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  uint64_t a = _a[0] >> (iter % 64);
+  unsigned int _c = 0;
+  for (int i = 64 - 1; i >= 0 && !((a >> i) & 1); i--) {
+    _c++;
+  }
 
-result_t test_vreinterpretq_p16_u64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned int c = __clzll(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u32_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___cls(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t a = _a[0] >> (iter % 32);
+  if (iter & 1) {
+    a = ~a;
+  }
+  unsigned int _c = 0;
+  for (int i = 32 - 2; i >= 0 && ((a >> i) & 1) == (a >> (32 - 1)); i--) {
+    _c++;
+  }
 
-result_t test_vreinterpretq_p8_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned int c = __cls(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_p16_s8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___clsl(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const unsigned long *_a = (const unsigned long *)impl.test_cases_int_pointer1;
+  unsigned long a = _a[0] >> (iter % (sizeof(long) * 8));
+  if (iter & 1) {
+    a = ~a;
+  }
+  unsigned int _c = 0;
+  for (int i = sizeof(long) * 8 - 2; i >= 0 && ((a >> i) & 1) == (a >> (sizeof(long) * 8 - 1)); i--) {
+    _c++;
+  }
 
-result_t test_vreinterpretq_u32_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned int c = __clsl(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_p8_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___clsll(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  uint64_t a = _a[0] >> (iter % 64);
+  if (iter & 1) {
+    a = ~a;
+  }
+  unsigned int _c = 0;
+  for (int i = 64 - 2; i >= 0 && ((a >> i) & 1) == (a >> (64 - 1)); i--) {
+    _c++;
+  }
 
-result_t test_vreinterpretq_p16_s16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned int c = __clsll(a);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u32_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rev(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _c = 0;
+  for (int i = 0; i < 4; i++) {
+    _c |= ((_a[0] >> (i * 8)) & 0xff) << ((32 - 8) - i * 8);
+  }
 
-result_t test_vreinterpretq_p8_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32_t c = __rev(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_p16_s32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___revl(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const unsigned long *_a = (const unsigned long *)impl.test_cases_int_pointer1;
+  unsigned long _c = 0;
+  for (int i = 0; i < (int)sizeof(long); i++) {
+    _c |= ((_a[0] >> (i * 8)) & 0xff) << ((sizeof(long) * 8 - 8) - i * 8);
+  }
 
-result_t test_vreinterpretq_u32_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned long c = __revl(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_p8_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___revll(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  uint64_t _c = 0;
+  for (int i = 0; i < 8; i++) {
+    _c |= ((_a[0] >> (i * 8)) & 0xff) << ((64 - 8) - i * 8);
+  }
 
-result_t test_vreinterpretq_p16_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint64_t c = __revll(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_u32_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rev16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _c = 0;
+  for (int i = 0; i < 4; i++) {
+    _c |= ((_a[0] >> (i * 8)) & 0xff) << ((i ^ 1) * 8);
+  }
 
-result_t test_vreinterpretq_p8_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32_t c = __rev16(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vreinterpretq_p16_u16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rev16l(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const unsigned long *_a = (const unsigned long *)impl.test_cases_int_pointer1;
+  unsigned long _c = 0;
+  for (int i = 0; i < (int)sizeof(long); i++) {
+    _c |= ((_a[0] >> (i * 8)) & 0xff) << ((i ^ 1) * 8);
+  }
 
-result_t test_vaeseq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned long c = __rev16l(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vaesdq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rev16ll(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  uint64_t _c = 0;
+  for (int i = 0; i < 8; i++) {
+    _c |= ((_a[0] >> (i * 8)) & 0xff) << ((i ^ 1) * 8);
+  }
 
-result_t test_vaesmcq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint64_t c = __rev16ll(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vaesimcq_u8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___revsh(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const int16_t *_a = (const int16_t *)impl.test_cases_int_pointer1;
+  int16_t _c = (int16_t)(((uint16_t)_a[0] >> 8) | ((uint16_t)_a[0] << 8));
 
-result_t test_vsha1h_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int16_t c = __revsh(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsha1cq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rbit(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  uint32_t _c = reverse_bits(_a[0], 32);
 
-result_t test_vsha1pq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32_t c = __rbit(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsha1mq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rbitl(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const unsigned long *_a = (const unsigned long *)impl.test_cases_int_pointer1;
+  unsigned long _c = reverse_bits(_a[0], sizeof(long) * 8);
 
-result_t test_vsha1su0q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned long c = __rbitl(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsha1su1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rbitll(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  uint64_t _c = reverse_bits(_a[0], 64);
 
-result_t test_vsha256hq_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint64_t c = __rbitll(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsha256h2q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___ror(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint32_t *_a = (const uint32_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t rot = _b[0] % 32;
+  uint32_t _c = rot == 0 ? _a[0] : (_a[0] >> rot) | (_a[0] << (32 - rot));
 
-result_t test_vsha256su0q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint32_t c = __ror(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vsha256su1q_u32(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rorl(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const unsigned long *_a = (const unsigned long *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t rot = _b[0] % (sizeof(long) * 8);
+  unsigned long _c = rot == 0 ? _a[0] : (_a[0] >> rot) | (_a[0] << (sizeof(long) * 8 - rot));
 
-// Dummy function to match the case label in run_single_test.
-result_t test_vmull_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  unsigned long c = __rorl(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vmull_high_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___rorll(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#ifdef ENABLE_TEST_ALL
+  const uint64_t *_a = (const uint64_t *)impl.test_cases_int_pointer1;
+  const uint32_t *_b = (const uint32_t *)impl.test_cases_int_pointer2;
+  uint32_t rot = _b[0] % 64;
+  uint64_t _c = rot == 0 ? _a[0] : (_a[0] >> rot) | (_a[0] << (64 - rot));
 
-result_t test_vadd_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  uint64_t c = __rorll(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // ENABLE_TEST_ALL
+}
 
-result_t test_vadd_p16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___ssat(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  int64_t max;
+  int32_t _c, c;
 
-result_t test_vadd_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                                          \
+  max = ((int64_t)1 << IDX) - 1;                                \
+  _c = _a[0] > max ? max : _a[0] < -max - 1 ? -max - 1 : _a[0]; \
+  c = __ssat(_a[0], IDX + 1);                                   \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test_vaddq_p8(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_32_ITER
+#undef TEST_IMPL
 
-result_t test_vaddq_p16(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+}
 
-result_t test_vaddq_p64(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___usat(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  int64_t max;
+  uint32_t _c, c;
 
-result_t test_vaddq_p128(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+#define TEST_IMPL(IDX)                            \
+  max = ((int64_t)1 << IDX) - 1;                  \
+  _c = _a[0] > max ? max : _a[0] < 0 ? 0 : _a[0]; \
+  c = __usat(_a[0], IDX);                         \
+  CHECK_RESULT(c == _c ? TEST_SUCCESS : TEST_FAIL)
 
-result_t test___crc32b(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  IMM_32_ITER
+#undef TEST_IMPL
 
-result_t test___crc32h(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  return TEST_SUCCESS;
+#else
+  return TEST_UNIMPL;
+#endif  // defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+}
 
-result_t test___crc32w(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___qadd(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c = sat_add(_a[0], _b[0]);
 
-result_t test___crc32d(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int32_t c = __qadd(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+}
 
-result_t test___crc32cb(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___qsub(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  const int32_t *_b = (const int32_t *)impl.test_cases_int_pointer2;
+  int32_t _c = sat_sub(_a[0], _b[0]);
 
-result_t test___crc32ch(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int32_t c = __qsub(_a[0], _b[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+}
 
-result_t test___crc32cw(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+result_t test___qdbl(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) {
+#if defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+  const int32_t *_a = (const int32_t *)impl.test_cases_int_pointer1;
+  int32_t _c = sat_add(_a[0], _a[0]);
 
-result_t test___crc32cd(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_UNIMPL; }
+  int32_t c = __qdbl(_a[0]);
+  return c == _c ? TEST_SUCCESS : TEST_FAIL;
+#else
+  return TEST_UNIMPL;
+#endif  // defined(ENABLE_TEST_ALL) && !defined(__aarch64__)
+}
 
 result_t test_last(const NEON2RVV_TEST_IMPL &impl, uint32_t iter) { return TEST_SUCCESS; }
 
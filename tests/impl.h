@@ -99,30 +99,30 @@
   _(vqaddh_u16)                                                                  \
   _(vqadds_u32)                                                                  \
   _(vqaddd_u64)                                                                  \
-  /*_(vuqadd_s8)                                                              */ \
-  /*_(vuqaddq_s8)                                                             */ \
-  /*_(vuqadd_s16)                                                             */ \
-  /*_(vuqaddq_s16)                                                            */ \
-  /*_(vuqadd_s32)                                                             */ \
-  /*_(vuqaddq_s32)                                                            */ \
-  /*_(vuqadd_s64)                                                             */ \
-  /*_(vuqaddq_s64)                                                            */ \
-  /*_(vuqaddb_s8)                                                             */ \
-  /*_(vuqaddh_s16)                                                            */ \
-  /*_(vuqadds_s32)                                                            */ \
-  /*_(vuqaddd_s64)                                                            */ \
-  /*_(vsqadd_u8)                                                              */ \
-  /*_(vsqaddq_u8)                                                             */ \
-  /*_(vsqadd_u16)                                                             */ \
-  /*_(vsqaddq_u16)                                                            */ \
-  /*_(vsqadd_u32)                                                             */ \
-  /*_(vsqaddq_u32)                                                            */ \
-  /*_(vsqadd_u64)                                                             */ \
-  /*_(vsqaddq_u64)                                                            */ \
-  /*_(vsqaddb_u8)                                                             */ \
-  /*_(vsqaddh_u16)                                                            */ \
-  /*_(vsqadds_u32)                                                            */ \
-  /*_(vsqaddd_u64)                                                            */ \
+  _(vuqadd_s8)                                                                   \
+  _(vuqaddq_s8)                                                                  \
+  _(vuqadd_s16)                                                                  \
+  _(vuqaddq_s16)                                                                 \
+  _(vuqadd_s32)                                                                  \
+  _(vuqaddq_s32)                                                                 \
+  _(vuqadd_s64)                                                                  \
+  _(vuqaddq_s64)                                                                 \
+  _(vuqaddb_s8)                                                                  \
+  _(vuqaddh_s16)                                                                 \
+  _(vuqadds_s32)                                                                 \
+  _(vuqaddd_s64)                                                                 \
+  _(vsqadd_u8)                                                                   \
+  _(vsqaddq_u8)                                                                  \
+  _(vsqadd_u16)                                                                  \
+  _(vsqaddq_u16)                                                                 \
+  _(vsqadd_u32)                                                                  \
+  _(vsqaddq_u32)                                                                 \
+  _(vsqadd_u64)                                                                  \
+  _(vsqaddq_u64)                                                                 \
+  _(vsqaddb_u8)                                                                  \
+  _(vsqaddh_u16)                                                                 \
+  _(vsqadds_u32)                                                                 \
+  _(vsqaddd_u64)                                                                 \
   _(vaddhn_s16)                                                                  \
   _(vaddhn_s32)                                                                  \
   _(vaddhn_s64)                                                                  \
@@ -1364,12 +1364,12 @@
   _(vclsq_s8)                                                                    \
   _(vclsq_s16)                                                                   \
   _(vclsq_s32)                                                                   \
-  /*_(vcls_u8)                                                                */ \
-  /*_(vclsq_u8)                                                               */ \
-  /*_(vcls_u16)                                                               */ \
-  /*_(vclsq_u16)                                                              */ \
-  /*_(vcls_u32)                                                               */ \
-  /*_(vclsq_u32)                                                              */ \
+  _(vcls_u8)                                                                     \
+  _(vclsq_u8)                                                                    \
+  _(vcls_u16)                                                                    \
+  _(vclsq_u16)                                                                   \
+  _(vcls_u32)                                                                    \
+  _(vclsq_u32)                                                                   \
   _(vclz_s8)                                                                     \
   _(vclz_s16)                                                                    \
   _(vclz_s32)                                                                    \
@@ -1668,73 +1668,73 @@
   _(vcvtd_f64_s64)                                                               \
   _(vcvtd_f64_u64)                                                               \
   _(vcvtq_u32_f32)                                                               \
-  /*_(vcvtn_s32_f32)                                                          */ \
-  /*_(vcvtnq_s32_f32)                                                         */ \
-  /*_(vcvtn_u32_f32)                                                          */ \
-  /*_(vcvtnq_u32_f32)                                                         */ \
-  /*_(vcvtm_s32_f32)                                                          */ \
-  /*_(vcvtmq_s32_f32)                                                         */ \
-  /*_(vcvtm_u32_f32)                                                          */ \
-  /*_(vcvtmq_u32_f32)                                                         */ \
-  /*_(vcvtp_s32_f32)                                                          */ \
-  /*_(vcvtpq_s32_f32)                                                         */ \
-  /*_(vcvtp_u32_f32)                                                          */ \
-  /*_(vcvtpq_u32_f32)                                                         */ \
-  /*_(vcvta_s32_f32)                                                          */ \
-  /*_(vcvtaq_s32_f32)                                                         */ \
-  /*_(vcvta_u32_f32)                                                          */ \
-  /*_(vcvtaq_u32_f32)                                                         */ \
+  _(vcvtn_s32_f32)                                                               \
+  _(vcvtnq_s32_f32)                                                              \
+  _(vcvtn_u32_f32)                                                               \
+  _(vcvtnq_u32_f32)                                                              \
+  _(vcvtm_s32_f32)                                                               \
+  _(vcvtmq_s32_f32)                                                              \
+  _(vcvtm_u32_f32)                                                               \
+  _(vcvtmq_u32_f32)                                                              \
+  _(vcvtp_s32_f32)                                                               \
+  _(vcvtpq_s32_f32)                                                              \
+  _(vcvtp_u32_f32)                                                               \
+  _(vcvtpq_u32_f32)                                                              \
+  _(vcvta_s32_f32)                                                               \
+  _(vcvtaq_s32_f32)                                                              \
+  _(vcvta_u32_f32)                                                               \
+  _(vcvtaq_u32_f32)                                                              \
   /*_(vcvts_s32_f32)                                                          */ \
   /*_(vcvts_u32_f32)                                                          */ \
-  /*_(vcvtns_s32_f32)                                                         */ \
-  /*_(vcvtns_u32_f32)                                                         */ \
-  /*_(vcvtms_s32_f32)                                                         */ \
-  /*_(vcvtms_u32_f32)                                                         */ \
-  /*_(vcvtps_s32_f32)                                                         */ \
-  /*_(vcvtps_u32_f32)                                                         */ \
-  /*_(vcvtas_s32_f32)                                                         */ \
-  /*_(vcvtas_u32_f32)                                                         */ \
+  _(vcvtns_s32_f32)                                                              \
+  _(vcvtns_u32_f32)                                                              \
+  _(vcvtms_s32_f32)                                                              \
+  _(vcvtms_u32_f32)                                                              \
+  _(vcvtps_s32_f32)                                                              \
+  _(vcvtps_u32_f32)                                                              \
+  _(vcvtas_s32_f32)                                                              \
+  _(vcvtas_u32_f32)                                                              \
   _(vcvt_s64_f64)                                                                \
   _(vcvtq_s64_f64)                                                               \
   _(vcvt_u64_f64)                                                                \
   _(vcvtq_u64_f64)                                                               \
-  /*_(vcvtn_s64_f64)                                                          */ \
-  /*_(vcvtnq_s64_f64)                                                         */ \
-  /*_(vcvtn_u64_f64)                                                          */ \
-  /*_(vcvtnq_u64_f64)                                                         */ \
-  /*_(vcvtm_s64_f64)                                                          */ \
-  /*_(vcvtmq_s64_f64)                                                         */ \
-  /*_(vcvtm_u64_f64)                                                          */ \
-  /*_(vcvtmq_u64_f64)                                                         */ \
-  /*_(vcvtp_s64_f64)                                                          */ \
-  /*_(vcvtpq_s64_f64)                                                         */ \
-  /*_(vcvtp_u64_f64)                                                          */ \
-  /*_(vcvtpq_u64_f64)                                                         */ \
-  /*_(vcvta_s64_f64)                                                          */ \
-  /*_(vcvtaq_s64_f64)                                                         */ \
-  /*_(vcvta_u64_f64)                                                          */ \
-  /*_(vcvtaq_u64_f64)                                                         */ \
+  _(vcvtn_s64_f64)                                                               \
+  _(vcvtnq_s64_f64)                                                              \
+  _(vcvtn_u64_f64)                                                               \
+  _(vcvtnq_u64_f64)                                                              \
+  _(vcvtm_s64_f64)                                                               \
+  _(vcvtmq_s64_f64)                                                              \
+  _(vcvtm_u64_f64)                                                               \
+  _(vcvtmq_u64_f64)                                                              \
+  _(vcvtp_s64_f64)                                                               \
+  _(vcvtpq_s64_f64)                                                              \
+  _(vcvtp_u64_f64)                                                               \
+  _(vcvtpq_u64_f64)                                                              \
+  _(vcvta_s64_f64)                                                               \
+  _(vcvtaq_s64_f64)                                                              \
+  _(vcvta_u64_f64)                                                               \
+  _(vcvtaq_u64_f64)                                                              \
   _(vcvtd_s64_f64)                                                               \
   _(vcvtd_u64_f64)                                                               \
-  /*_(vcvtnd_s64_f64)                                                         */ \
-  /*_(vcvtnd_u64_f64)                                                         */ \
-  /*_(vcvtmd_s64_f64)                                                         */ \
-  /*_(vcvtmd_u64_f64)                                                         */ \
-  /*_(vcvtpd_s64_f64)                                                         */ \
-  /*_(vcvtpd_u64_f64)                                                         */ \
-  /*_(vcvtad_s64_f64)                                                         */ \
-  /*_(vcvtad_u64_f64)                                                         */ \
+  _(vcvtnd_s64_f64)                                                              \
+  _(vcvtnd_u64_f64)                                                              \
+  _(vcvtmd_s64_f64)                                                              \
+  _(vcvtmd_u64_f64)                                                              \
+  _(vcvtpd_s64_f64)                                                              \
+  _(vcvtpd_u64_f64)                                                              \
+  _(vcvtad_s64_f64)                                                              \
+  _(vcvtad_u64_f64)                                                              \
   /*_(vcvt_f16_f32)                                                           */ \
   /*_(vcvt_high_f16_f32)                                                      */ \
-  /*_(vcvt_f32_f64)                                                           */ \
-  /*_(vcvt_high_f32_f64)                                                      */ \
+  _(vcvt_f32_f64)                                                                \
+  _(vcvt_high_f32_f64)                                                           \
   /*_(vcvt_f32_f16)                                                           */ \
   /*_(vcvt_high_f32_f16)                                                      */ \
-  /*_(vcvt_f64_f32)                                                           */ \
-  /*_(vcvt_high_f64_f32)                                                      */ \
-  /*_(vcvtx_f32_f64)                                                          */ \
-  /*_(vcvtxd_f32_f64)                                                         */ \
-  /*_(vcvtx_high_f32_f64)                                                     */ \
+  _(vcvt_f64_f32)                                                                \
+  _(vcvt_high_f64_f32)                                                           \
+  _(vcvtx_f32_f64)                                                               \
+  _(vcvtxd_f32_f64)                                                              \
+  _(vcvtx_high_f32_f64)                                                          \
   _(vcvt_n_s32_f32)                                                              \
   _(vcvt_n_f32_s32)                                                              \
   _(vcvt_n_f32_u32)                                                              \
@@ -1742,23 +1742,23 @@
   _(vcvtq_n_s32_f32)                                                             \
   _(vcvtq_n_f32_s32)                                                             \
   _(vcvtq_n_f32_u32)                                                             \
-  /*_(vcvts_n_f32_s32)                                                        */ \
-  /*_(vcvts_n_f32_u32)                                                        */ \
-  /*_(vcvt_n_f64_s64)                                                         */ \
-  /*_(vcvtq_n_f64_s64)                                                        */ \
-  /*_(vcvt_n_f64_u64)                                                         */ \
-  /*_(vcvtq_n_f64_u64)                                                        */ \
-  /*_(vcvtd_n_f64_s64)                                                        */ \
-  /*_(vcvtd_n_f64_u64)                                                        */ \
+  _(vcvts_n_f32_s32)                                                             \
+  _(vcvts_n_f32_u32)                                                             \
+  _(vcvt_n_f64_s64)                                                              \
+  _(vcvtq_n_f64_s64)                                                             \
+  _(vcvt_n_f64_u64)                                                              \
+  _(vcvtq_n_f64_u64)                                                             \
+  _(vcvtd_n_f64_s64)                                                             \
+  _(vcvtd_n_f64_u64)                                                             \
   _(vcvtq_n_u32_f32)                                                             \
-  /*_(vcvts_n_s32_f32)                                                        */ \
-  /*_(vcvts_n_u32_f32)                                                        */ \
-  /*_(vcvt_n_s64_f64)                                                         */ \
-  /*_(vcvtq_n_s64_f64)                                                        */ \
-  /*_(vcvt_n_u64_f64)                                                         */ \
-  /*_(vcvtq_n_u64_f64)                                                        */ \
-  /*_(vcvtd_n_s64_f64)                                                        */ \
-  /*_(vcvtd_n_u64_f64)                                                        */ \
+  _(vcvts_n_s32_f32)                                                             \
+  _(vcvts_n_u32_f32)                                                             \
+  _(vcvt_n_s64_f64)                                                              \
+  _(vcvtq_n_s64_f64)                                                             \
+  _(vcvt_n_u64_f64)                                                              \
+  _(vcvtq_n_u64_f64)                                                             \
+  _(vcvtd_n_s64_f64)                                                             \
+  _(vcvtd_n_u64_f64)                                                             \
   _(vmovn_s16)                                                                   \
   _(vmovn_s32)                                                                   \
   _(vmovn_s64)                                                                   \
@@ -2048,27 +2048,27 @@
   _(vqdmulh_lane_s32)                                                            \
   _(vqrdmulhq_lane_s16)                                                          \
   _(vqrdmulhq_lane_s32)                                                          \
-  /*_(vqrdmulhh_lane_s16)                                                     */ \
-  /*_(vqrdmulhs_lane_s32)                                                     */ \
-  /*_(vqrdmulh_laneq_s16)                                                     */ \
-  /*_(vqrdmulhq_laneq_s16)                                                    */ \
-  /*_(vqrdmulh_laneq_s32)                                                     */ \
-  /*_(vqrdmulhq_laneq_s32)                                                    */ \
-  /*_(vqrdmulhh_laneq_s16)                                                    */ \
-  /*_(vqrdmulhs_laneq_s32)                                                    */ \
+  _(vqrdmulhh_lane_s16)                                                          \
+  _(vqrdmulhs_lane_s32)                                                          \
+  _(vqrdmulh_laneq_s16)                                                          \
+  _(vqrdmulhq_laneq_s16)                                                         \
+  _(vqrdmulh_laneq_s32)                                                          \
+  _(vqrdmulhq_laneq_s32)                                                         \
+  _(vqrdmulhh_laneq_s16)                                                         \
+  _(vqrdmulhs_laneq_s32)                                                         \
   _(vqrdmulh_lane_s16)                                                           \
   _(vqrdmulh_lane_s32)                                                           \
   _(vqrdmlahq_lane_s16)                                                          \
-  /*_(vqrdmlah_laneq_s16)                                                     */ \
-  /*_(vqrdmlahq_laneq_s16)                                                    */ \
+  _(vqrdmlah_laneq_s16)                                                          \
+  _(vqrdmlahq_laneq_s16)                                                         \
   _(vqrdmlahq_lane_s32)                                                          \
-  /*_(vqrdmlah_laneq_s32)                                                     */ \
-  /*_(vqrdmlahq_laneq_s32)                                                    */ \
+  _(vqrdmlah_laneq_s32)                                                          \
+  _(vqrdmlahq_laneq_s32)                                                         \
   _(vqrdmlah_lane_s16)                                                           \
   _(vqrdmlah_lane_s32)                                                           \
   _(vqrdmlshq_lane_s16)                                                          \
-  /*_(vqrdmlsh_laneq_s16)                                                     */ \
-  /*_(vqrdmlshq_laneq_s16)                                                    */ \
+  _(vqrdmlsh_laneq_s16)                                                          \
+  _(vqrdmlshq_laneq_s16)                                                         \
   _(vqrdmlshq_lane_s32)                                                          \
   _(vqrdmlsh_laneq_s32)                                                          \
   _(vqrdmlshq_laneq_s32)                                                         \
@@ -3850,14 +3850,14 @@
   /*_(vaddq_p16)                                                              */ \
   /*_(vaddq_p64)                                                              */ \
   /*_(vaddq_p128)                                                             */ \
-  /*_(__crc32b)                                                               */ \
-  /*_(__crc32h)                                                               */ \
-  /*_(__crc32w)                                                               */ \
-  /*_(__crc32d)                                                               */ \
-  /*_(__crc32cb)                                                              */ \
-  /*_(__crc32ch)                                                              */ \
-  /*_(__crc32cw)                                                              */ \
-  /*_(__crc32cd)                                                              */ \
+  _(__crc32b)                                                                    \
+  _(__crc32h)                                                                    \
+  _(__crc32w)                                                                    \
+  _(__crc32d)                                                                    \
+  _(__crc32cb)                                                                   \
+  _(__crc32ch)                                                                   \
+  _(__crc32cw)                                                                   \
+  _(__crc32cd)                                                                   \
   /* Intrinsics for FP16 instructions. */                                        \
   /*_(vabd_f16)                                                               */ \
   /*_(vabdq_f16)                                                              */ \
@@ -4077,16 +4077,16 @@
   _(veor3q_s16)                                                                  \
   _(veor3q_s32)                                                                  \
   _(veor3q_s64)                                                                  \
-  /*_(vrax1q_u64)                                                             */ \
-  /*_(vxarq_u64)                                                              */ \
-  /*_(vbcaxq_u8)                                                              */ \
-  /*_(vbcaxq_u16)                                                             */ \
-  /*_(vbcaxq_u32)                                                             */ \
-  /*_(vbcaxq_u64)                                                             */ \
-  /*_(vbcaxq_s8)                                                              */ \
-  /*_(vbcaxq_s16)                                                             */ \
-  /*_(vbcaxq_s32)                                                             */ \
-  /*_(vbcaxq_s64)                                                             */ \
+  _(vrax1q_u64)                                                                  \
+  _(vxarq_u64)                                                                   \
+  _(vbcaxq_u8)                                                                   \
+  _(vbcaxq_u16)                                                                  \
+  _(vbcaxq_u32)                                                                  \
+  _(vbcaxq_u64)                                                                  \
+  _(vbcaxq_s8)                                                                   \
+  _(vbcaxq_s16)                                                                  \
+  _(vbcaxq_s32)                                                                  \
+  _(vbcaxq_s64)                                                                  \
   /*_(vsm3ss1q_u32)                                                           */ \
   /*_(vsm3tt1aq_u32)                                                          */ \
   /*_(vsm3tt1bq_u32)                                                          */ \
@@ -4100,30 +4100,30 @@
   /*_(vdotq_laneq_u32)                                                        */ \
   /*_(vdot_laneq_s32)                                                         */ \
   _(vdotq_laneq_s32)                                                             \
-  /*_(vfmlal_low_f16)                                                         */ \
-  /*_(vfmlsl_low_f16)                                                         */ \
-  /*_(vfmlal_high_f16)                                                        */ \
-  /*_(vfmlsl_high_f16)                                                        */ \
-  /*_(vfmlalq_low_f16)                                                        */ \
-  /*_(vfmlslq_low_f16)                                                        */ \
-  /*_(vfmlalq_high_f16)                                                       */ \
-  /*_(vfmlslq_high_f16)                                                       */ \
-  /*_(vfmlal_lane_low_f16)                                                    */ \
-  /*_(vfmlal_lane_high_f16)                                                   */ \
-  /*_(vfmlalq_laneq_low_f16)                                                  */ \
-  /*_(vfmlalq_lane_low_f16)                                                   */ \
-  /*_(vfmlal_laneq_low_f16)                                                   */ \
-  /*_(vfmlalq_laneq_high_f16)                                                 */ \
-  /*_(vfmlalq_lane_high_f16)                                                  */ \
-  /*_(vfmlal_laneq_high_f16)                                                  */ \
-  /*_(vfmlsl_lane_low_f16)                                                    */ \
-  /*_(vfmlsl_lane_high_f16)                                                   */ \
-  /*_(vfmlslq_laneq_low_f16)                                                  */ \
-  /*_(vfmlslq_lane_low_f16)                                                   */ \
-  /*_(vfmlsl_laneq_low_f16)                                                   */ \
-  /*_(vfmlslq_laneq_high_f16)                                                 */ \
-  /*_(vfmlslq_lane_high_f16)                                                  */ \
-  /*_(vfmlsl_laneq_high_f16)                                                  */ \
+  _(vfmlal_low_f16)                                                              \
+  _(vfmlsl_low_f16)                                                              \
+  _(vfmlal_high_f16)                                                             \
+  _(vfmlsl_high_f16)                                                             \
+  _(vfmlalq_low_f16)                                                             \
+  _(vfmlslq_low_f16)                                                             \
+  _(vfmlalq_high_f16)                                                            \
+  _(vfmlslq_high_f16)                                                            \
+  _(vfmlal_lane_low_f16)                                                         \
+  _(vfmlal_lane_high_f16)                                                        \
+  _(vfmlalq_laneq_low_f16)                                                       \
+  _(vfmlalq_lane_low_f16)                                                        \
+  _(vfmlal_laneq_low_f16)                                                        \
+  _(vfmlalq_laneq_high_f16)                                                      \
+  _(vfmlalq_lane_high_f16)                                                       \
+  _(vfmlal_laneq_high_f16)                                                       \
+  _(vfmlsl_lane_low_f16)                                                         \
+  _(vfmlsl_lane_high_f16)                                                        \
+  _(vfmlslq_laneq_low_f16)                                                       \
+  _(vfmlslq_lane_low_f16)                                                        \
+  _(vfmlsl_laneq_low_f16)                                                        \
+  _(vfmlslq_laneq_high_f16)                                                      \
+  _(vfmlslq_lane_high_f16)                                                       \
+  _(vfmlsl_laneq_high_f16)                                                       \
   /* AdvSIMD Complex numbers intrinsics. */                                      \
   /*_(vcadd_rot90_f16)                                                        */ \
   /*_(vcaddq_rot90_f16)                                                       */ \
@@ -4153,40 +4153,40 @@
   /*_(vcmla_rot270_laneq_f16)                                                 */ \
   /*_(vcmlaq_rot270_lane_f16)                                                 */ \
   /*_(vcmlaq_rot270_laneq_f16)                                                */ \
-  /*_(vcadd_rot90_f32)                                                        */ \
-  /*_(vcaddq_rot90_f32)                                                       */ \
-  /*_(vcaddq_rot90_f64)                                                       */ \
-  /*_(vcadd_rot270_f32)                                                       */ \
-  /*_(vcaddq_rot270_f32)                                                      */ \
-  /*_(vcaddq_rot270_f64)                                                      */ \
-  /*_(vcmla_f32)                                                              */ \
-  /*_(vcmlaq_f32)                                                             */ \
-  /*_(vcmlaq_f64)                                                             */ \
-  /*_(vcmla_lane_f32)                                                         */ \
-  /*_(vcmla_laneq_f32)                                                        */ \
-  /*_(vcmlaq_lane_f32)                                                        */ \
-  /*_(vcmlaq_laneq_f32)                                                       */ \
-  /*_(vcmla_rot90_f32)                                                        */ \
-  /*_(vcmlaq_rot90_f32)                                                       */ \
-  /*_(vcmlaq_rot90_f64)                                                       */ \
-  /*_(vcmla_rot90_lane_f32)                                                   */ \
-  /*_(vcmla_rot90_laneq_f32)                                                  */ \
-  /*_(vcmlaq_rot90_lane_f32)                                                  */ \
-  /*_(vcmlaq_rot90_laneq_f32)                                                 */ \
-  /*_(vcmla_rot180_f32)                                                       */ \
-  /*_(vcmlaq_rot180_f32)                                                      */ \
-  /*_(vcmlaq_rot180_f64)                                                      */ \
-  /*_(vcmla_rot180_lane_f32)                                                  */ \
-  /*_(vcmla_rot180_laneq_f32)                                                 */ \
-  /*_(vcmlaq_rot180_lane_f32)                                                 */ \
-  /*_(vcmlaq_rot180_laneq_f32)                                                */ \
-  /*_(vcmla_rot270_f32)                                                       */ \
-  /*_(vcmlaq_rot270_f32)                                                      */ \
-  /*_(vcmlaq_rot270_f64)                                                      */ \
-  /*_(vcmla_rot270_lane_f32)                                                  */ \
-  /*_(vcmla_rot270_laneq_f32)                                                 */ \
-  /*_(vcmlaq_rot270_lane_f32)                                                 */ \
-  /*_(vcmlaq_rot270_laneq_f32)                                                */ \
+  _(vcadd_rot90_f32)                                                             \
+  _(vcaddq_rot90_f32)                                                            \
+  _(vcaddq_rot90_f64)                                                            \
+  _(vcadd_rot270_f32)                                                            \
+  _(vcaddq_rot270_f32)                                                           \
+  _(vcaddq_rot270_f64)                                                           \
+  _(vcmla_f32)                                                                   \
+  _(vcmlaq_f32)                                                                  \
+  _(vcmlaq_f64)                                                                  \
+  _(vcmla_lane_f32)                                                              \
+  _(vcmla_laneq_f32)                                                             \
+  _(vcmlaq_lane_f32)                                                             \
+  _(vcmlaq_laneq_f32)                                                            \
+  _(vcmla_rot90_f32)                                                             \
+  _(vcmlaq_rot90_f32)                                                            \
+  _(vcmlaq_rot90_f64)                                                            \
+  _(vcmla_rot90_lane_f32)                                                        \
+  _(vcmla_rot90_laneq_f32)                                                       \
+  _(vcmlaq_rot90_lane_f32)                                                       \
+  _(vcmlaq_rot90_laneq_f32)                                                      \
+  _(vcmla_rot180_f32)                                                            \
+  _(vcmlaq_rot180_f32)                                                           \
+  _(vcmlaq_rot180_f64)                                                           \
+  _(vcmla_rot180_lane_f32)                                                       \
+  _(vcmla_rot180_laneq_f32)                                                      \
+  _(vcmlaq_rot180_lane_f32)                                                      \
+  _(vcmlaq_rot180_laneq_f32)                                                     \
+  _(vcmla_rot270_f32)                                                            \
+  _(vcmlaq_rot270_f32)                                                           \
+  _(vcmlaq_rot270_f64)                                                           \
+  _(vcmla_rot270_lane_f32)                                                       \
+  _(vcmla_rot270_laneq_f32)                                                      \
+  _(vcmlaq_rot270_lane_f32)                                                      \
+  _(vcmlaq_rot270_laneq_f32)                                                     \
   /*_(vrnd32z_f32)                                                            */ \
   /*_(vrnd32zq_f32)                                                           */ \
   /*_(vrnd32z_f64)                                                            */ \
@@ -4364,8 +4364,237 @@
   /*_(vbfmlalbq_laneq_f32)                                                    */ \
   /*_(vbfmlaltq_lane_f32)                                                     */ \
   /*_(vbfmlaltq_laneq_f32)                                                    */ \
+  /* neon2rvv helpers */                                                         \
+  _(neon2rvv_movemask_u8)                                                        \
+  _(neon2rvv_nibblemask_u8)                                                      \
+  _(neon2rvv_any_nonzero)                                                        \
+  _(neon2rvv_all_ones)                                                           \
+  _(neon2rvv_first_set_lane)                                                     \
+  _(neon2rvv_vgetq_lane)                                                         \
+  _(neon2rvv_vsetq_lane)                                                         \
+  _(neon2rvv_vdupq_laneq)                                                        \
+  _(neon2rvv_vextq)                                                              \
+  _(neon2rvv_vshrq_n)                                                            \
+  _(neon2rvv_vshrn_n)                                                            \
+  _(neon2rvv_vfmaq_laneq)                                                        \
+  _(neon2rvv_vget_lane)                                                          \
+  _(neon2rvv_vset_lane)                                                          \
+  _(neon2rvv_vdupq_lane)                                                         \
+  _(neon2rvv_vext)                                                               \
+  _(neon2rvv_vshl_n)                                                             \
+  _(neon2rvv_vshr_n)                                                             \
+  _(neon2rvv_vmulq_lane)                                                         \
+  _(neon2rvv_vfma_lane)                                                          \
+  _(neon2rvv_bulk_add_u8)                                                        \
+  _(neon2rvv_bulk_add_f32)                                                       \
+  _(neon2rvv_bulk_qadd_u8)                                                       \
+  _(neon2rvv_bulk_qadd_s16)                                                      \
+  _(neon2rvv_bulk_min_u8)                                                        \
+  _(neon2rvv_bulk_max_u8)                                                        \
+  _(neon2rvv_bulk_abd_u8)                                                        \
+  _(neon2rvv_bulk_mlal_u8)                                                       \
+  _(neon2rvv_bulk_cvt_f32_s32)                                                   \
+  _(neon2rvv_bulk_cvt_s32_f32)                                                   \
+  _(neon2rvv_bulk_cgt_u8)                                                        \
+  _(neon2rvv_bulk_bsl_u8)                                                        \
+  _(neon2rvv_bulk_addlv_u8)                                                      \
+  _(neon2rvv_bulk_addlv_s16)                                                     \
+  _(neon2rvv_expr_vst1q)                                                         \
+  _(neon2rvv_expr_reduce)                                                        \
+  _(__clz)                                                                       \
+  _(__clzl)                                                                      \
+  _(__clzll)                                                                     \
+  _(__cls)                                                                       \
+  _(__clsl)                                                                      \
+  _(__clsll)                                                                     \
+  _(__rev)                                                                       \
+  _(__revl)                                                                      \
+  _(__revll)                                                                     \
+  _(__rev16)                                                                     \
+  _(__rev16l)                                                                    \
+  _(__rev16ll)                                                                   \
+  _(__revsh)                                                                     \
+  _(__rbit)                                                                      \
+  _(__rbitl)                                                                     \
+  _(__rbitll)                                                                    \
+  _(__ror)                                                                       \
+  _(__rorl)                                                                      \
+  _(__rorll)                                                                     \
+  _(__ssat)                                                                      \
+  _(__usat)                                                                      \
+  _(__qadd)                                                                      \
+  _(__qsub)                                                                      \
+  _(__qdbl)                                                                      \
   _(last) /* This indicates the end of macros */
 
+// Intrinsics whose whole input space --exhaustive enumerates, as
+// _(name, lane bits, vector inputs, bytes per input vector). Case p of a sweep
+// puts p in lane (p % lanes) of test_cases_int_pointer1 and, for two inputs,
+// p >> (lane bits) in the same lane of test_cases_int_pointer2, so only tests
+// that read those pointers unmodified belong here. Sweeps of 16-bit pairs
+// cover 2^32 cases and only run with --exhaustive-wide.
+#define EXHAUSTIVE_LIST       \
+  _(vadd_s8, 8, 2, 8)         \
+  _(vaddq_s8, 8, 2, 16)       \
+  _(vadd_u8, 8, 2, 8)         \
+  _(vaddq_u8, 8, 2, 16)       \
+  _(vsub_s8, 8, 2, 8)         \
+  _(vsubq_s8, 8, 2, 16)       \
+  _(vsub_u8, 8, 2, 8)         \
+  _(vsubq_u8, 8, 2, 16)       \
+  _(vqadd_s8, 8, 2, 8)        \
+  _(vqaddq_s8, 8, 2, 16)      \
+  _(vqadd_u8, 8, 2, 8)        \
+  _(vqaddq_u8, 8, 2, 16)      \
+  _(vqsub_s8, 8, 2, 8)        \
+  _(vqsubq_s8, 8, 2, 16)      \
+  _(vqsub_u8, 8, 2, 8)        \
+  _(vqsubq_u8, 8, 2, 16)      \
+  _(vhadd_s8, 8, 2, 8)        \
+  _(vhaddq_s8, 8, 2, 16)      \
+  _(vhadd_u8, 8, 2, 8)        \
+  _(vhaddq_u8, 8, 2, 16)      \
+  _(vhsub_s8, 8, 2, 8)        \
+  _(vhsubq_s8, 8, 2, 16)      \
+  _(vhsub_u8, 8, 2, 8)        \
+  _(vhsubq_u8, 8, 2, 16)      \
+  _(vrhadd_s8, 8, 2, 8)       \
+  _(vrhaddq_s8, 8, 2, 16)     \
+  _(vrhadd_u8, 8, 2, 8)       \
+  _(vrhaddq_u8, 8, 2, 16)     \
+  _(vabd_s8, 8, 2, 8)         \
+  _(vabdq_s8, 8, 2, 16)       \
+  _(vabd_u8, 8, 2, 8)         \
+  _(vabdq_u8, 8, 2, 16)       \
+  _(vmax_s8, 8, 2, 8)         \
+  _(vmaxq_s8, 8, 2, 16)       \
+  _(vmax_u8, 8, 2, 8)         \
+  _(vmaxq_u8, 8, 2, 16)       \
+  _(vmin_s8, 8, 2, 8)         \
+  _(vminq_s8, 8, 2, 16)       \
+  _(vmin_u8, 8, 2, 8)         \
+  _(vminq_u8, 8, 2, 16)       \
+  _(vmul_s8, 8, 2, 8)         \
+  _(vmulq_s8, 8, 2, 16)       \
+  _(vmul_u8, 8, 2, 8)         \
+  _(vmulq_u8, 8, 2, 16)       \
+  _(vceq_s8, 8, 2, 8)         \
+  _(vceqq_s8, 8, 2, 16)       \
+  _(vceq_u8, 8, 2, 8)         \
+  _(vceqq_u8, 8, 2, 16)       \
+  _(vcge_s8, 8, 2, 8)         \
+  _(vcgeq_s8, 8, 2, 16)       \
+  _(vcge_u8, 8, 2, 8)         \
+  _(vcgeq_u8, 8, 2, 16)       \
+  _(vcgt_s8, 8, 2, 8)         \
+  _(vcgtq_s8, 8, 2, 16)       \
+  _(vcgt_u8, 8, 2, 8)         \
+  _(vcgtq_u8, 8, 2, 16)       \
+  _(vcle_s8, 8, 2, 8)         \
+  _(vcleq_s8, 8, 2, 16)       \
+  _(vcle_u8, 8, 2, 8)         \
+  _(vcleq_u8, 8, 2, 16)       \
+  _(vclt_s8, 8, 2, 8)         \
+  _(vcltq_s8, 8, 2, 16)       \
+  _(vclt_u8, 8, 2, 8)         \
+  _(vcltq_u8, 8, 2, 16)       \
+  _(vmull_s8, 8, 2, 8)        \
+  _(vmull_u8, 8, 2, 8)        \
+  _(vaddl_s8, 8, 2, 8)        \
+  _(vaddl_u8, 8, 2, 8)        \
+  _(vsubl_s8, 8, 2, 8)        \
+  _(vsubl_u8, 8, 2, 8)        \
+  _(vabdl_s8, 8, 2, 8)        \
+  _(vabdl_u8, 8, 2, 8)        \
+  _(vtbl1_s8, 8, 2, 8)        \
+  _(vtbl1_u8, 8, 2, 8)        \
+  _(vcnt_s8, 8, 1, 8)         \
+  _(vcntq_s8, 8, 1, 16)       \
+  _(vcnt_u8, 8, 1, 8)         \
+  _(vcntq_u8, 8, 1, 16)       \
+  _(vclz_s8, 8, 1, 8)         \
+  _(vclzq_s8, 8, 1, 16)       \
+  _(vclz_u8, 8, 1, 8)         \
+  _(vclzq_u8, 8, 1, 16)       \
+  _(vcls_s8, 8, 1, 8)         \
+  _(vclsq_s8, 8, 1, 16)       \
+  _(vcls_u8, 8, 1, 8)         \
+  _(vclsq_u8, 8, 1, 16)       \
+  _(vabs_s8, 8, 1, 8)         \
+  _(vabsq_s8, 8, 1, 16)       \
+  _(vneg_s8, 8, 1, 8)         \
+  _(vnegq_s8, 8, 1, 16)       \
+  _(vqneg_s8, 8, 1, 8)        \
+  _(vqnegq_s8, 8, 1, 16)      \
+  _(vmvn_s8, 8, 1, 8)         \
+  _(vmvnq_s8, 8, 1, 16)       \
+  _(vmvn_u8, 8, 1, 8)         \
+  _(vmvnq_u8, 8, 1, 16)       \
+  _(vmovl_s8, 8, 1, 8)        \
+  _(vmovl_u8, 8, 1, 8)        \
+  _(vclz_s16, 16, 1, 8)       \
+  _(vclzq_s16, 16, 1, 16)     \
+  _(vclz_u16, 16, 1, 8)       \
+  _(vclzq_u16, 16, 1, 16)     \
+  _(vcls_s16, 16, 1, 8)       \
+  _(vclsq_s16, 16, 1, 16)     \
+  _(vcls_u16, 16, 1, 8)       \
+  _(vclsq_u16, 16, 1, 16)     \
+  _(vabs_s16, 16, 1, 8)       \
+  _(vabsq_s16, 16, 1, 16)     \
+  _(vneg_s16, 16, 1, 8)       \
+  _(vnegq_s16, 16, 1, 16)     \
+  _(vqneg_s16, 16, 1, 8)      \
+  _(vqnegq_s16, 16, 1, 16)    \
+  _(vmvn_s16, 16, 1, 8)       \
+  _(vmvnq_s16, 16, 1, 16)     \
+  _(vmvn_u16, 16, 1, 8)       \
+  _(vmvnq_u16, 16, 1, 16)     \
+  _(vmovn_s16, 16, 1, 16)     \
+  _(vmovn_u16, 16, 1, 16)     \
+  _(vqmovn_s16, 16, 1, 16)    \
+  _(vqmovn_u16, 16, 1, 16)    \
+  _(vqmovun_s16, 16, 1, 16)   \
+  _(vmovl_s16, 16, 1, 8)      \
+  _(vmovl_u16, 16, 1, 8)      \
+  _(vrev32_s16, 16, 1, 8)     \
+  _(vrev32q_s16, 16, 1, 16)   \
+  _(vrev32_u16, 16, 1, 8)     \
+  _(vrev32q_u16, 16, 1, 16)   \
+  _(vrev64_s16, 16, 1, 8)     \
+  _(vrev64q_s16, 16, 1, 16)   \
+  _(vrev64_u16, 16, 1, 8)     \
+  _(vrev64q_u16, 16, 1, 16)   \
+  _(vqrdmulh_s16, 16, 2, 8)   \
+  _(vqrdmulhq_s16, 16, 2, 16) \
+  _(vqdmulh_s16, 16, 2, 8)    \
+  _(vqdmulhq_s16, 16, 2, 16)
+
+// Pairwise intrinsics, which combine lanes 2i and 2i + 1 of each input, in
+// the same format. Case p puts p in lane 2i and p >> (lane bits) in lane
+// 2i + 1 of a pair slot, and every input vector holds lanes / 2 such slots.
+#define EXHAUSTIVE_PAIRWISE_LIST \
+  _(vpadd_s8, 8, 2, 8)           \
+  _(vpaddq_s8, 8, 2, 16)         \
+  _(vpadd_u8, 8, 2, 8)           \
+  _(vpaddq_u8, 8, 2, 16)         \
+  _(vpmax_s8, 8, 2, 8)           \
+  _(vpmaxq_s8, 8, 2, 16)         \
+  _(vpmax_u8, 8, 2, 8)           \
+  _(vpmaxq_u8, 8, 2, 16)         \
+  _(vpmin_s8, 8, 2, 8)           \
+  _(vpminq_s8, 8, 2, 16)         \
+  _(vpmin_u8, 8, 2, 8)           \
+  _(vpminq_u8, 8, 2, 16)         \
+  _(vpaddl_s8, 8, 1, 8)          \
+  _(vpaddlq_s8, 8, 1, 16)        \
+  _(vpaddl_u8, 8, 1, 8)          \
+  _(vpaddlq_u8, 8, 1, 16)        \
+  _(vpaddl_s16, 16, 1, 8)        \
+  _(vpaddlq_s16, 16, 1, 16)      \
+  _(vpaddl_u16, 16, 1, 8)        \
+  _(vpaddlq_u16, 16, 1, 16)
+
 namespace NEON2RVV {
 // The way unit tests are implemented is that 10,000 random floating point and
 // integer vec4 numbers are generated as sample data.
@@ -4395,6 +4624,17 @@ class NEON2RVV_TEST {
   // Failed: TEST_FAIL (0)
   // Unimplemented: TEST_UNIMPL (-1)
   virtual result_t run_test(INSTRUCTION_TEST test) = 0;
+
+  // Run one iteration of this instruction with its inputs taken from data
+  // instead of the random tables. Used by the fuzzing harness.
+  virtual result_t run_fuzz(INSTRUCTION_TEST test, uint32_t iter, const uint8_t* data, size_t size) = 0;
+
+  // Number of vectors an exhaustive sweep of this instruction needs, or 0 when
+  // it is in neither EXHAUSTIVE_LIST nor EXHAUSTIVE_PAIRWISE_LIST, or when
+  // the sweep covers 2^32 cases and `wide` is not set. run_exhaustive() runs
+  // vectors [first, last) so one sweep can be split across threads.
+  virtual uint64_t exhaustive_batches(INSTRUCTION_TEST test, bool wide) = 0;
+  virtual result_t run_exhaustive(INSTRUCTION_TEST test, uint64_t first, uint64_t last) = 0;
   virtual void release(void) = 0;
 };
 
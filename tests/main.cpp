@@ -1,36 +1,232 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <regex>
+#include <thread>
+#include <vector>
+#include "corpus.h"
 #include "impl.h"
 
-int main(int /*argc*/, const char ** /*argv*/) {
+// One unit of work: a whole run_test(), or with --exhaustive a slice of
+// batches so a long sweep is spread over every worker.
+struct test_item {
+  size_t test;        // index into test_queue::tests
+  size_t first_item;  // first item of the same test
+  uint64_t first;
+  uint64_t last;  // 0 for run_test()
+};
+
+struct test_queue {
+  std::vector<NEON2RVV::INSTRUCTION_TEST> tests;
+  std::vector<NEON2RVV::result_t> results;
+  std::vector<test_item> items;
+  std::vector<NEON2RVV::result_t> item_results;
+  std::atomic<size_t> next;
+};
+
+// Sweeps are cut into at most this many items of at least 1024 batches.
+static const uint64_t exhaustive_items = 4096;
+static const uint64_t exhaustive_min_chunk = 1024;
+
+static void print_result(NEON2RVV::INSTRUCTION_TEST test, NEON2RVV::result_t ret) {
+  if (ret == NEON2RVV::TEST_FAIL) {
+    printf("Test %-30s failed\n", NEON2RVV::instruction_string[test]);
+  } else if (ret == NEON2RVV::TEST_UNIMPL) {
+    printf("Test %-30s skipped\n", NEON2RVV::instruction_string[test]);
+  } else {
+    printf("Test %-30s passed\n", NEON2RVV::instruction_string[test]);
+  }
+}
+
+static bool is_final_item(const test_queue *queue, size_t i) {
+  return i + 1 == queue->items.size() || queue->items[i + 1].test != queue->items[i].test;
+}
+
+// Folds the items of the test ending at item i into its result.
+static void finish_test(test_queue *queue, size_t i) {
+  NEON2RVV::result_t ret = NEON2RVV::TEST_SUCCESS;
+  for (size_t j = queue->items[i].first_item; j <= i; j++) {
+    if (queue->item_results[j] == NEON2RVV::TEST_FAIL) {
+      ret = NEON2RVV::TEST_FAIL;
+    } else if (queue->item_results[j] == NEON2RVV::TEST_UNIMPL && ret != NEON2RVV::TEST_FAIL) {
+      ret = NEON2RVV::TEST_UNIMPL;
+    }
+  }
+  queue->results[queue->items[i].test] = ret;
+}
+
+// Every worker owns its test instance and keeps pulling the next unclaimed
+// item, so a thread stuck on a slow test does not hold up the rest.
+static void run_worker(test_queue *queue, bool print_now) {
   NEON2RVV::NEON2RVV_TEST *test = NEON2RVV::NEON2RVV_TEST::create();
+  for (size_t i = queue->next++; i < queue->items.size(); i = queue->next++) {
+    const test_item &item = queue->items[i];
+    NEON2RVV::INSTRUCTION_TEST it = queue->tests[item.test];
+    queue->item_results[i] = item.last ? test->run_exhaustive(it, item.first, item.last) : test->run_test(it);
+    if (print_now && is_final_item(queue, i)) {
+      finish_test(queue, i);
+      print_result(it, queue->results[item.test]);
+    }
+  }
+  test->release();
+}
+
+static void usage(const char *prog) {
+  printf(
+      "Usage: %s [--jobs N] [--shard I/N] [--filter REGEX]\n"
+      "          [--exhaustive | --exhaustive-wide] [--corpus-record FILE | --corpus FILE]\n"
+      "  --jobs N        run tests on N threads, 0 uses every core (default 1)\n"
+      "  --shard I/N     only run intrinsics whose index modulo N equals I\n"
+      "  --filter REGEX  only run intrinsics whose name matches REGEX\n"
+      "  --exhaustive    sweep every input of the intrinsics in the EXHAUSTIVE_* lists\n"
+      "  --exhaustive-wide  also run the sweeps of 2^32 cases, which take hours under QEMU\n"
+      "  --corpus-record FILE  write the native results to a golden corpus\n"
+      "  --corpus FILE         check results against a golden corpus\n",
+      prog);
+}
+
+int main(int argc, const char **argv) {
+  unsigned jobs = 1;
+  unsigned shard_index = 0;
+  unsigned shard_count = 1;
+  const char *filter = NULL;
+  bool exhaustive = false;
+  bool exhaustive_wide = false;
+  const char *corpus_path = NULL;
+  NEON2RVV::corpus_mode_t corpus_mode = NEON2RVV::CORPUS_OFF;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--jobs") && i + 1 < argc) {
+      char *end;
+      unsigned long n = strtoul(argv[++i], &end, 10);
+      if (argv[i][0] < '0' || argv[i][0] > '9' || *end || n > UINT32_MAX) {
+        usage(argv[0]);
+        return -1;
+      }
+      jobs = (unsigned)n;
+    } else if (!strcmp(argv[i], "--shard") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%u/%u", &shard_index, &shard_count) != 2 || shard_index >= shard_count) {
+        usage(argv[0]);
+        return -1;
+      }
+    } else if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (!strcmp(argv[i], "--exhaustive")) {
+      exhaustive = true;
+    } else if (!strcmp(argv[i], "--exhaustive-wide")) {
+      exhaustive = true;
+      exhaustive_wide = true;
+    } else if (!strcmp(argv[i], "--corpus-record") && i + 1 < argc) {
+      corpus_path = argv[++i];
+      corpus_mode = NEON2RVV::CORPUS_RECORD;
+    } else if (!strcmp(argv[i], "--corpus") && i + 1 < argc) {
+      corpus_path = argv[++i];
+      corpus_mode = NEON2RVV::CORPUS_COMPARE;
+    } else {
+      usage(argv[0]);
+      return -1;
+    }
+  }
+#if NEON2RVV_TEST_THREADS
+  if (jobs == 0) {
+    jobs = std::thread::hardware_concurrency();
+  }
+#endif
+  jobs = jobs ? jobs : 1;
+
+  std::regex pattern;
+  if (filter) {
+    try {
+      pattern = std::regex(filter);
+    } catch (const std::regex_error &e) {
+      printf("--filter: %s\n", e.what());
+      usage(argv[0]);
+      return -1;
+    }
+  }
+
+  test_queue queue;
+  NEON2RVV::NEON2RVV_TEST *planner = exhaustive ? NEON2RVV::NEON2RVV_TEST::create() : NULL;
+  for (uint32_t i = 0; i < NEON2RVV::it_last; i++) {
+    if (i % shard_count != shard_index) {
+      continue;
+    }
+    if (filter && !std::regex_search(NEON2RVV::instruction_string[i], pattern)) {
+      continue;
+    }
+    NEON2RVV::INSTRUCTION_TEST test = NEON2RVV::INSTRUCTION_TEST(i);
+    test_item item = {queue.tests.size(), queue.items.size(), 0, 0};
+    if (exhaustive) {
+      uint64_t batches = planner->exhaustive_batches(test, exhaustive_wide);
+      if (!batches) {
+        continue;
+      }
+      uint64_t chunk = batches / exhaustive_items;
+      chunk = chunk > exhaustive_min_chunk ? chunk : exhaustive_min_chunk;
+      for (item.first = 0; item.first < batches; item.first += chunk) {
+        item.last = item.first + chunk < batches ? item.first + chunk : batches;
+        queue.items.push_back(item);
+      }
+    } else {
+      queue.items.push_back(item);
+    }
+    queue.tests.push_back(test);
+  }
+  if (planner) {
+    planner->release();
+  }
+  queue.results.resize(queue.tests.size());
+  queue.item_results.resize(queue.items.size());
+  queue.next = 0;
+
+  if (corpus_path && !NEON2RVV::corpus_open(corpus_path, corpus_mode)) {
+    return -1;
+  }
+
+  // A single job stays on the main thread, which keeps the runner usable on
+  // targets without thread support such as spike + pk.
+  if (jobs == 1 || !NEON2RVV_TEST_THREADS) {
+    run_worker(&queue, true);
+  } else {
+#if NEON2RVV_TEST_THREADS
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < jobs; i++) {
+      workers.push_back(std::thread(run_worker, &queue, false));
+    }
+    for (size_t i = 0; i < workers.size(); i++) {
+      workers[i].join();
+    }
+    for (size_t i = 0; i < queue.items.size(); i++) {
+      if (is_final_item(&queue, i)) {
+        finish_test(&queue, i);
+        print_result(queue.tests[queue.items[i].test], queue.results[queue.items[i].test]);
+      }
+    }
+#endif
+  }
+  NEON2RVV::corpus_close();
+
   uint32_t pass_count = 0;
   uint32_t failed_count = 0;
   uint32_t ignore_count = 0;
-  for (uint32_t i = 0; i < NEON2RVV::it_last; i++) {
-    NEON2RVV::INSTRUCTION_TEST test_iter = NEON2RVV::INSTRUCTION_TEST(i);
-    NEON2RVV::result_t ret = test->run_test(test_iter);
-    // If the test fails, we will run it again so we can step into the
-    // debugger and figure out why!
-    if (ret == NEON2RVV::TEST_FAIL) {
-      printf("Test %-30s failed\n", NEON2RVV::instruction_string[test_iter]);
+  for (size_t i = 0; i < queue.results.size(); i++) {
+    if (queue.results[i] == NEON2RVV::TEST_FAIL) {
       failed_count++;
-    } else if (ret == NEON2RVV::TEST_UNIMPL) {
-      printf("Test %-30s skipped\n", NEON2RVV::instruction_string[test_iter]);
+    } else if (queue.results[i] == NEON2RVV::TEST_UNIMPL) {
       ignore_count++;
     } else {
-      printf("Test %-30s passed\n", NEON2RVV::instruction_string[test_iter]);
       pass_count++;
     }
   }
-  test->release();
+  uint32_t total_count = pass_count + failed_count + ignore_count;
   printf(
       "NEON2RVV_TEST Complete!\n"
       "Passed:  %d\n"
       "Failed:  %d\n"
       "Ignored: %d\n"
       "Coverage rate: %.2f%%\n",
-      pass_count, failed_count, ignore_count, (float)pass_count / (pass_count + failed_count + ignore_count) * 100);
+      pass_count, failed_count, ignore_count, total_count ? (float)pass_count / total_count * 100 : 0.0f);
 
   return failed_count ? -1 : 0;
 }